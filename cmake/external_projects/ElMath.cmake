@@ -561,5 +561,9 @@ else()
   include(external_projects/ElMath/ParMETIS)
 endif()
 if(NOT EL_HAVE_METIS)
-  message(FATAL_ERROR "METIS support is required for Elemental but existing support was not detected and downloading was prevented")
+  if(EL_NATIVE_PARTITIONER)
+    message(STATUS "METIS support was not detected and downloading was prevented, so graph partitioning will use the native multilevel partitioner")
+  else()
+    message(FATAL_ERROR "METIS support is required for Elemental but existing support was not detected and downloading was prevented (configure with EL_NATIVE_PARTITIONER=ON to use the native multilevel partitioner instead)")
+  endif()
 endif()
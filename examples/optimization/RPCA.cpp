@@ -68,6 +68,10 @@ main( int argc, char* argv[] )
           El::Input("--usePivQR","use pivoted QR approx?",false);
         const El::Int numPivSteps =
           El::Input("--numPivSteps","number of steps of QR",75);
+        const bool useSubspace =
+          El::Input("--useSubspace","use warm-started subspace SVT?",false);
+        const El::Int numSubspaceIts =
+          El::Input("--numSubspaceIts","number of subspace iterations",2);
         const bool useALM = El::Input("--useALM","use ALM algorithm?",true);
         const bool display = El::Input("--display","display matrices",false);
         const bool print = El::Input("--print","print matrices",true);
@@ -138,6 +142,8 @@ main( int argc, char* argv[] )
         ctrl.usePivQR = usePivQR;
         ctrl.progress = print;
         ctrl.numPivSteps = numPivSteps;
+        ctrl.useSubspace = useSubspace;
+        ctrl.numSubspaceIts = numSubspaceIts;
         ctrl.maxIts = maxIts;
         ctrl.tau = tau;
         ctrl.beta = beta;
@@ -282,11 +282,10 @@ void Copy( const SparseMatrix<S>& A, Matrix<T>& B )
     const Int* ARowBuf = A.LockedSourceBuffer();
     const Int* AColBuf = A.LockedTargetBuffer();
 
-    T* BBuf = B.Buffer();
-    const Int BLDim = B.LDim();
-
     B.Resize( m, n );
     Zero( B );
+    T* BBuf = B.Buffer();
+    const Int BLDim = B.LDim();
     for( Int e=0; e<numEntries; ++e )
         BBuf[ARowBuf[e]+AColBuf[e]*BLDim] = Caster<S,T>::Cast(AValBuf[e]);
 }
@@ -0,0 +1,350 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_BLAS_ENTRYWISE_HPP
+#define EL_BLAS_ENTRYWISE_HPP
+
+// Fused entrywise expressions, e.g.,
+//
+//   Entrywise(Y) = alpha*Entrywise(X) + Hadamard(Entrywise(Z),Entrywise(W));
+//
+// is evaluated in a single threaded (and vectorizable) pass over the local
+// entries of Y rather than with one pass (and one temporary) per operation.
+// All of the operands must have the same dimensions and, in the distributed
+// case, the same distribution and alignments. Since entry (i,j) of the result
+// only depends upon entry (i,j) of each operand, the target may alias any of
+// the operands.
+
+namespace El {
+namespace entrywise {
+
+// The local portion of an operand, as well as where it lives in the global
+// matrix
+struct Layout
+{
+    Int height=0, width=0;
+    Int localHeight=0, localWidth=0;
+    Int colShift=0, rowShift=0;
+    Int colStride=1, rowStride=1;
+
+    bool operator==( const Layout& other ) const
+    {
+        return height == other.height && width == other.width &&
+               localHeight == other.localHeight &&
+               localWidth == other.localWidth &&
+               colShift == other.colShift && rowShift == other.rowShift &&
+               colStride == other.colStride && rowStride == other.rowStride;
+    }
+};
+
+inline void AssertConformal( const Layout& A, const Layout& B )
+{
+    if( !(A == B) )
+        LogicError
+        ("Nonconformal entrywise expression: ",A.height," x ",A.width,
+         " with local size ",A.localHeight," x ",A.localWidth," and shifts (",
+         A.colShift,",",A.rowShift,") vs. ",B.height," x ",B.width,
+         " with local size ",B.localHeight," x ",B.localWidth," and shifts (",
+         B.colShift,",",B.rowShift,")");
+}
+
+template<typename T>
+Layout MakeLayout( const Matrix<T>& A )
+{
+    Layout layout;
+    layout.height = layout.localHeight = A.Height();
+    layout.width = layout.localWidth = A.Width();
+    return layout;
+}
+
+template<typename T>
+Layout MakeLayout( const AbstractDistMatrix<T>& A )
+{
+    Layout layout;
+    layout.height = A.Height();
+    layout.width = A.Width();
+    layout.localHeight = A.LocalHeight();
+    layout.localWidth = A.LocalWidth();
+    layout.colShift = A.ColShift();
+    layout.rowShift = A.RowShift();
+    layout.colStride = A.ColStride();
+    layout.rowStride = A.RowStride();
+    return layout;
+}
+
+template<typename T>
+Layout MakeLayout( const DistMultiVec<T>& A )
+{
+    Layout layout;
+    layout.height = A.Height();
+    layout.width = layout.localWidth = A.Width();
+    layout.localHeight = A.LocalHeight();
+    layout.colShift = A.FirstLocalRow();
+    return layout;
+}
+
+// Every expression provides its value_type, its Shape(), and the value of
+// local entry (i,j) through operator()
+template<class Derived>
+struct Expression
+{
+    const Derived& Get() const { return static_cast<const Derived&>(*this); }
+};
+
+template<typename T>
+class Operand : public Expression<Operand<T>>
+{
+public:
+    typedef T value_type;
+
+    Operand( const T* buffer, Int ldim, const Layout& layout )
+    : buffer_(buffer), ldim_(ldim), layout_(layout) { }
+
+    const Layout& Shape() const { return layout_; }
+    T operator()( Int i, Int j ) const { return buffer_[i+j*ldim_]; }
+
+private:
+    const T* buffer_;
+    Int ldim_;
+    Layout layout_;
+};
+
+struct Plus
+{
+    template<typename S,typename T>
+    auto operator()( const S& alpha, const T& beta ) const
+    -> decltype(alpha+beta)
+    { return alpha + beta; }
+};
+
+struct Minus
+{
+    template<typename S,typename T>
+    auto operator()( const S& alpha, const T& beta ) const
+    -> decltype(alpha-beta)
+    { return alpha - beta; }
+};
+
+struct Times
+{
+    template<typename S,typename T>
+    auto operator()( const S& alpha, const T& beta ) const
+    -> decltype(alpha*beta)
+    { return alpha * beta; }
+};
+
+template<class L,class R,class Op>
+class Binary : public Expression<Binary<L,R,Op>>
+{
+public:
+    typedef typename L::value_type value_type;
+
+    Binary( const L& A, const R& B ) : A_(A), B_(B)
+    { AssertConformal( A.Shape(), B.Shape() ); }
+
+    const Layout& Shape() const { return A_.Shape(); }
+    value_type operator()( Int i, Int j ) const
+    { return Op()( A_(i,j), B_(i,j) ); }
+
+private:
+    L A_;
+    R B_;
+};
+
+template<class E>
+class Scaled : public Expression<Scaled<E>>
+{
+public:
+    typedef typename E::value_type value_type;
+
+    Scaled( value_type alpha, const E& A ) : alpha_(alpha), A_(A) { }
+
+    const Layout& Shape() const { return A_.Shape(); }
+    value_type operator()( Int i, Int j ) const { return alpha_*A_(i,j); }
+
+private:
+    value_type alpha_;
+    E A_;
+};
+
+template<class E,class Function>
+class Mapped : public Expression<Mapped<E,Function>>
+{
+public:
+    typedef typename std::decay<
+      typename std::result_of<Function(typename E::value_type)>::type>::type
+      value_type;
+
+    Mapped( const E& A, Function func ) : A_(A), func_(func) { }
+
+    const Layout& Shape() const { return A_.Shape(); }
+    value_type operator()( Int i, Int j ) const { return func_(A_(i,j)); }
+
+private:
+    E A_;
+    Function func_;
+};
+
+template<typename T,class E,class Update>
+void Evaluate
+( T* buffer, Int ldim, const Layout& layout, const E& expr, Update update )
+{
+    EL_DEBUG_CSE
+    AssertConformal( layout, expr.Shape() );
+    const Int localHeight = layout.localHeight;
+    const Int localWidth = layout.localWidth;
+    EL_PARALLEL_FOR
+    for( Int j=0; j<localWidth; ++j )
+    {
+        EL_SIMD
+        for( Int i=0; i<localHeight; ++i )
+        {
+            update( buffer[i+j*ldim], expr(i,j) );
+        }
+    }
+}
+
+// A writeable operand
+template<typename T>
+class Target : public Expression<Target<T>>
+{
+public:
+    typedef T value_type;
+
+    Target( T* buffer, Int ldim, const Layout& layout )
+    : buffer_(buffer), ldim_(ldim), layout_(layout) { }
+    // Copies refer to the same entries, while assignment evaluates
+    Target( const Target& ) = default;
+
+    const Layout& Shape() const { return layout_; }
+    T operator()( Int i, Int j ) const { return buffer_[i+j*ldim_]; }
+
+    template<class E>
+    Target& operator=( const Expression<E>& expr )
+    {
+        Evaluate
+        ( buffer_, ldim_, layout_, expr.Get(),
+          []( T& alpha, const T& beta ) { alpha = beta; } );
+        return *this;
+    }
+    Target& operator=( const Target& other )
+    { return operator=( static_cast<const Expression<Target>&>(other) ); }
+
+    template<class E>
+    Target& operator+=( const Expression<E>& expr )
+    {
+        Evaluate
+        ( buffer_, ldim_, layout_, expr.Get(),
+          []( T& alpha, const T& beta ) { alpha += beta; } );
+        return *this;
+    }
+
+    template<class E>
+    Target& operator-=( const Expression<E>& expr )
+    {
+        Evaluate
+        ( buffer_, ldim_, layout_, expr.Get(),
+          []( T& alpha, const T& beta ) { alpha -= beta; } );
+        return *this;
+    }
+
+    template<class E>
+    Target& operator*=( const Expression<E>& expr )
+    {
+        Evaluate
+        ( buffer_, ldim_, layout_, expr.Get(),
+          []( T& alpha, const T& beta ) { alpha *= beta; } );
+        return *this;
+    }
+
+private:
+    T* buffer_;
+    Int ldim_;
+    Layout layout_;
+};
+
+template<class L,class R>
+Binary<L,R,Plus>
+operator+( const Expression<L>& A, const Expression<R>& B )
+{ return Binary<L,R,Plus>( A.Get(), B.Get() ); }
+
+template<class L,class R>
+Binary<L,R,Minus>
+operator-( const Expression<L>& A, const Expression<R>& B )
+{ return Binary<L,R,Minus>( A.Get(), B.Get() ); }
+
+template<class E>
+Scaled<E> operator-( const Expression<E>& A )
+{ return Scaled<E>( typename E::value_type(-1), A.Get() ); }
+
+template<class E>
+Scaled<E> operator*( typename E::value_type alpha, const Expression<E>& A )
+{ return Scaled<E>( alpha, A.Get() ); }
+
+template<class E>
+Scaled<E> operator*( const Expression<E>& A, typename E::value_type alpha )
+{ return Scaled<E>( alpha, A.Get() ); }
+
+// The entrywise product, (A o B)(i,j) = A(i,j) B(i,j)
+template<class L,class R>
+Binary<L,R,Times> Hadamard( const Expression<L>& A, const Expression<R>& B )
+{ return Binary<L,R,Times>( A.Get(), B.Get() ); }
+
+// Applies func to each entry of the expression
+template<class E,class Function>
+Mapped<E,Function> Map( const Expression<E>& A, Function func )
+{ return Mapped<E,Function>( A.Get(), func ); }
+
+} // namespace entrywise
+
+template<typename T>
+entrywise::Operand<T> Entrywise( const Matrix<T>& A )
+{
+    return entrywise::Operand<T>
+    ( A.LockedBuffer(), A.LDim(), entrywise::MakeLayout(A) );
+}
+
+template<typename T>
+entrywise::Target<T> Entrywise( Matrix<T>& A )
+{
+    return entrywise::Target<T>
+    ( A.Buffer(), A.LDim(), entrywise::MakeLayout(A) );
+}
+
+template<typename T>
+entrywise::Operand<T> Entrywise( const AbstractDistMatrix<T>& A )
+{
+    return entrywise::Operand<T>
+    ( A.LockedBuffer(), A.LDim(), entrywise::MakeLayout(A) );
+}
+
+template<typename T>
+entrywise::Target<T> Entrywise( AbstractDistMatrix<T>& A )
+{
+    return entrywise::Target<T>
+    ( A.Buffer(), A.LDim(), entrywise::MakeLayout(A) );
+}
+
+template<typename T>
+entrywise::Operand<T> Entrywise( const DistMultiVec<T>& A )
+{
+    return entrywise::Operand<T>
+    ( A.LockedMatrix().LockedBuffer(), A.LockedMatrix().LDim(),
+      entrywise::MakeLayout(A) );
+}
+
+template<typename T>
+entrywise::Target<T> Entrywise( DistMultiVec<T>& A )
+{
+    return entrywise::Target<T>
+    ( A.Matrix().Buffer(), A.Matrix().LDim(), entrywise::MakeLayout(A) );
+}
+
+} // namespace El
+
+#endif // ifndef EL_BLAS_ENTRYWISE_HPP
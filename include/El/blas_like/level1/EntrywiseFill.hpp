@@ -11,8 +11,8 @@
 
 namespace El {
 
-template<typename T>
-void EntrywiseFill( Matrix<T>& A, function<T(void)> func )
+template<typename T,class Function>
+void EntrywiseFill( Matrix<T>& A, Function func )
 {
     EL_DEBUG_CSE
     const Int m = A.Height();
@@ -22,12 +22,12 @@ void EntrywiseFill( Matrix<T>& A, function<T(void)> func )
             A(i,j) = func();
 }
 
-template<typename T>
-void EntrywiseFill( AbstractDistMatrix<T>& A, function<T(void)> func )
+template<typename T,class Function>
+void EntrywiseFill( AbstractDistMatrix<T>& A, Function func )
 { EntrywiseFill( A.Matrix(), func ); }
 
-template<typename T>
-void EntrywiseFill( DistMultiVec<T>& A, function<T(void)> func )
+template<typename T,class Function>
+void EntrywiseFill( DistMultiVec<T>& A, Function func )
 { EntrywiseFill( A.Matrix(), func ); }
 
 #ifdef EL_INSTANTIATE_BLAS_LEVEL1
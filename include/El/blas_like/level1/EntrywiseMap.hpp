@@ -11,8 +11,8 @@
 
 namespace El {
 
-template<typename T>
-void EntrywiseMap( Matrix<T>& A, function<T(const T&)> func )
+template<typename T,class Function>
+void EntrywiseMap( Matrix<T>& A, Function func )
 {
     EL_DEBUG_CSE
     const Int m = A.Height();
@@ -44,8 +44,8 @@ void EntrywiseMap( Matrix<T>& A, function<T(const T&)> func )
     }
 }
 
-template<typename T>
-void EntrywiseMap( SparseMatrix<T>& A, function<T(const T&)> func )
+template<typename T,class Function>
+void EntrywiseMap( SparseMatrix<T>& A, Function func )
 {
     EL_DEBUG_CSE
     T* vBuf = A.ValueBuffer();
@@ -55,12 +55,12 @@ void EntrywiseMap( SparseMatrix<T>& A, function<T(const T&)> func )
         vBuf[k] = func(vBuf[k]);
 }
 
-template<typename T>
-void EntrywiseMap( AbstractDistMatrix<T>& A, function<T(const T&)> func )
+template<typename T,class Function>
+void EntrywiseMap( AbstractDistMatrix<T>& A, Function func )
 { EntrywiseMap( A.Matrix(), func ); }
 
-template<typename T>
-void EntrywiseMap( DistSparseMatrix<T>& A, function<T(const T&)> func )
+template<typename T,class Function>
+void EntrywiseMap( DistSparseMatrix<T>& A, Function func )
 {
     EL_DEBUG_CSE
     T* vBuf = A.ValueBuffer();
@@ -70,13 +70,13 @@ void EntrywiseMap( DistSparseMatrix<T>& A, function<T(const T&)> func )
         vBuf[k] = func(vBuf[k]);
 }
 
-template<typename T>
-void EntrywiseMap( DistMultiVec<T>& A, function<T(const T&)> func )
+template<typename T,class Function>
+void EntrywiseMap( DistMultiVec<T>& A, Function func )
 { EntrywiseMap( A.Matrix(), func ); }
 
-template<typename S,typename T>
+template<typename S,typename T,class Function>
 void EntrywiseMap
-( const Matrix<S>& A, Matrix<T>& B, function<T(const S&)> func )
+( const Matrix<S>& A, Matrix<T>& B, Function func )
 {
     EL_DEBUG_CSE
     const Int m = A.Height();
@@ -97,11 +97,11 @@ void EntrywiseMap
     }
 }
 
-template<typename S,typename T>
+template<typename S,typename T,class Function>
 void EntrywiseMap
 ( const SparseMatrix<S>& A,
         SparseMatrix<T>& B,
-        function<T(const S&)> func )
+        Function func )
 {
     EL_DEBUG_CSE
     const Int numEntries = A.NumEntries();
@@ -114,11 +114,11 @@ void EntrywiseMap
         BValBuf[k] = func(AValBuf[k]);
 }
 
-template<typename S,typename T>
+template<typename S,typename T,class Function>
 void EntrywiseMap
 ( const AbstractDistMatrix<S>& A,
         AbstractDistMatrix<T>& B,
-        function<T(const S&)> func )
+        Function func )
 {
     if( A.DistData().colDist == B.DistData().colDist &&
         A.DistData().rowDist == B.DistData().rowDist &&
@@ -145,11 +145,11 @@ void EntrywiseMap
     }
 }
 
-template<typename S,typename T>
+template<typename S,typename T,class Function>
 void EntrywiseMap
 ( const DistSparseMatrix<S>& A,
         DistSparseMatrix<T>& B,
-        function<T(const S&)> func )
+        Function func )
 {
     EL_DEBUG_CSE
     const Int numLocalEntries = A.NumLocalEntries();
@@ -163,11 +163,11 @@ void EntrywiseMap
         BValBuf[k] = func(AValBuf[k]);
 }
 
-template<typename S,typename T>
+template<typename S,typename T,class Function>
 void EntrywiseMap
 ( const DistMultiVec<S>& A,
         DistMultiVec<T>& B,
-        function<T(const S&)> func )
+        Function func )
 {
     EL_DEBUG_CSE
     B.SetGrid( A.Grid() );
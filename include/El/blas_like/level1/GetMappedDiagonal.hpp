@@ -11,11 +11,11 @@
 
 namespace El {
 
-template<typename T,typename S>
+template<typename T,typename S,class Function>
 void GetMappedDiagonal
 ( const Matrix<T>& A,
         Matrix<S>& d,
-        function<S(const T&)> func,
+        Function func,
         Int offset )
 {
     EL_DEBUG_CSE
@@ -36,11 +36,11 @@ void GetMappedDiagonal
     }
 }
 
-template<typename T,typename S,Dist U,Dist V>
+template<typename T,typename S,Dist U,Dist V,class Function>
 void GetMappedDiagonal
 ( const DistMatrix<T,U,V>& A,
         AbstractDistMatrix<S>& dPre,
-        function<S(const T&)> func,
+        Function func,
         Int offset )
 {
     EL_DEBUG_CSE
@@ -82,11 +82,11 @@ void GetMappedDiagonal
     }
 }
 
-template<typename T,typename S,Dist U,Dist V>
+template<typename T,typename S,Dist U,Dist V,class Function>
 void GetMappedDiagonal
 ( const DistMatrix<T,U,V,BLOCK>& A,
         AbstractDistMatrix<S>& d,
-        function<S(const T&)> func,
+        Function func,
         Int offset )
 {
     EL_DEBUG_CSE
@@ -113,11 +113,11 @@ void GetMappedDiagonal
     d.ProcessQueues();
 }
 
-template<typename T,typename S>
+template<typename T,typename S,class Function>
 void GetMappedDiagonal
 ( const SparseMatrix<T>& A,
         Matrix<S>& d,
-        function<S(const T&)> func,
+        Function func,
         Int offset )
 {
     EL_DEBUG_CSE
@@ -147,15 +147,15 @@ void GetMappedDiagonal
             dBuf[Min(i,j)] = func(valBuf[e]);
         }
         else
-            dBuf[Min(i,j)] = func(0);
+            dBuf[Min(i,j)] = func(T(0));
     }
 }
 
-template<typename T,typename S>
+template<typename T,typename S,class Function>
 void GetMappedDiagonal
 ( const DistSparseMatrix<T>& A,
         DistMultiVec<S>& d,
-        function<S(const T&)> func,
+        Function func,
         Int offset )
 {
     EL_DEBUG_CSE
@@ -187,7 +187,7 @@ void GetMappedDiagonal
             dBuf[iLoc] = func(valBuf[e]);
         }
         else
-            dBuf[iLoc] = func(0);
+            dBuf[iLoc] = func(T(0));
     }
 }
 
@@ -11,8 +11,8 @@
 
 namespace El {
 
-template<typename T>
-void IndexDependentFill( Matrix<T>& A, function<T(Int,Int)> func )
+template<typename T,class Function>
+void IndexDependentFill( Matrix<T>& A, Function func )
 {
     EL_DEBUG_CSE
     const Int m = A.Height();
@@ -45,9 +45,9 @@ void IndexDependentFill( Matrix<T>& A, function<T(Int,Int)> func )
 
 }
 
-template<typename T>
+template<typename T,class Function>
 void IndexDependentFill
-( AbstractDistMatrix<T>& A, function<T(Int,Int)> func )
+( AbstractDistMatrix<T>& A, Function func )
 {
     EL_DEBUG_CSE
     const Int mLoc = A.LocalHeight();
@@ -11,8 +11,8 @@
 
 namespace El {
 
-template<typename T>
-void IndexDependentMap( Matrix<T>& A, function<T(Int,Int,const T&)> func )
+template<typename T,class Function>
+void IndexDependentMap( Matrix<T>& A, Function func )
 {
     EL_DEBUG_CSE
     const Int m = A.Height();
@@ -45,9 +45,9 @@ void IndexDependentMap( Matrix<T>& A, function<T(Int,Int,const T&)> func )
 
 }
 
-template<typename T>
+template<typename T,class Function>
 void IndexDependentMap
-( AbstractDistMatrix<T>& A, function<T(Int,Int,const T&)> func )
+( AbstractDistMatrix<T>& A, Function func )
 {
     EL_DEBUG_CSE
     const Int mLoc = A.LocalHeight();
@@ -84,15 +84,15 @@ void IndexDependentMap
 
 }
 
-template<typename S,typename T>
+template<typename S,typename T,class Function>
 void IndexDependentMap
-( const Matrix<S>& A, Matrix<T>& B, function<T(Int,Int,const S&)> func )
+( const Matrix<S>& A, Matrix<T>& B, Function func )
 {
     EL_DEBUG_CSE
     const Int m = A.Height();
     const Int n = A.Width();
     B.Resize( m, n );
-    const T* ABuf = A.LockedBuffer();
+    const S* ABuf = A.LockedBuffer();
     T* BBuf = B.Buffer();
     const Int ALDim = A.LDim();
     const Int BLDim = B.LDim();
@@ -122,18 +122,18 @@ void IndexDependentMap
 
 }
 
-template<typename S,typename T,Dist U,Dist V,DistWrap wrap>
+template<typename S,typename T,Dist U,Dist V,DistWrap wrap,class Function>
 void IndexDependentMap
 ( const DistMatrix<S,U,V,wrap>& A,
         DistMatrix<T,U,V,wrap>& B,
-  function<T(Int,Int,const S&)> func )
+  Function func )
 {
     EL_DEBUG_CSE
     const Int mLoc = A.LocalHeight();
     const Int nLoc = A.LocalWidth();
     B.AlignWith( A.DistData() );
     B.Resize( A.Height(), A.Width() );
-    const T* ALocBuf = A.LockedBuffer();
+    const S* ALocBuf = A.LockedBuffer();
     T* BLocBuf = B.Buffer();
     const Int ALocLDim = A.LDim();
     const Int BLocLDim = B.LDim();
@@ -167,16 +167,16 @@ void IndexDependentMap
 
 }
 
-template<typename S,typename T,Dist U,Dist V>
+template<typename S,typename T,Dist U,Dist V,class Function>
 void IndexDependentMap
 ( const AbstractDistMatrix<S>& A,
         DistMatrix<T,U,V>& B,
-  function<T(Int,Int,const S&)> func )
+  Function func )
 {
     EL_DEBUG_CSE
     if( A.Wrap() == ELEMENT && A.DistData() == B.DistData() )
     {
-        auto& ACast = static_cast<const DistMatrix<T,U,V>&>(A);
+        auto& ACast = static_cast<const DistMatrix<S,U,V>&>(A);
         IndexDependentMap( ACast, B, func );
     }
     else
@@ -195,16 +195,16 @@ void IndexDependentMap
     }
 }
 
-template<typename S,typename T,Dist U,Dist V>
+template<typename S,typename T,Dist U,Dist V,class Function>
 void IndexDependentMap
 ( const AbstractDistMatrix<S>& A,
         DistMatrix<T,U,V,BLOCK>& B,
-  function<T(Int,Int,const S&)> func )
+  Function func )
 {
     EL_DEBUG_CSE
     if( A.Wrap() == BLOCK && A.DistData() == B.DistData() )
     {
-        auto& ACast = static_cast<const DistMatrix<T,U,V,BLOCK>&>(A);
+        auto& ACast = static_cast<const DistMatrix<S,U,V,BLOCK>&>(A);
         IndexDependentMap( ACast, B, func );
     }
     else
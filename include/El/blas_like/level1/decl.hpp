@@ -817,44 +817,47 @@ T Dotu( const DistMultiVec<T>& A, const DistMultiVec<T>& B );
 
 // EntrywiseFill
 // =============
-template<typename T>
-void EntrywiseFill( Matrix<T>& A, function<T(void)> func );
-template<typename T>
-void EntrywiseFill( AbstractDistMatrix<T>& A, function<T(void)> func );
-template<typename T>
-void EntrywiseFill( DistMultiVec<T>& A, function<T(void)> func );
+// NOTE: Here and in EntrywiseMap, GetMappedDiagonal, IndexDependentFill, and
+// IndexDependentMap, 'func' may be any callable (e.g., a lambda), which can
+// then be inlined into the loop over the entries.
+template<typename T,class Function>
+void EntrywiseFill( Matrix<T>& A, Function func );
+template<typename T,class Function>
+void EntrywiseFill( AbstractDistMatrix<T>& A, Function func );
+template<typename T,class Function>
+void EntrywiseFill( DistMultiVec<T>& A, Function func );
 
 // EntrywiseMap
 // ============
-template<typename T>
-void EntrywiseMap( Matrix<T>& A, function<T(const T&)> func );
-template<typename T>
-void EntrywiseMap( SparseMatrix<T>& A, function<T(const T&)> func );
-template<typename T>
-void EntrywiseMap( AbstractDistMatrix<T>& A, function<T(const T&)> func );
-template<typename T>
-void EntrywiseMap( DistSparseMatrix<T>& A, function<T(const T&)> func );
-template<typename T>
-void EntrywiseMap( DistMultiVec<T>& A, function<T(const T&)> func );
-
-template<typename S,typename T>
+template<typename T,class Function>
+void EntrywiseMap( Matrix<T>& A, Function func );
+template<typename T,class Function>
+void EntrywiseMap( SparseMatrix<T>& A, Function func );
+template<typename T,class Function>
+void EntrywiseMap( AbstractDistMatrix<T>& A, Function func );
+template<typename T,class Function>
+void EntrywiseMap( DistSparseMatrix<T>& A, Function func );
+template<typename T,class Function>
+void EntrywiseMap( DistMultiVec<T>& A, Function func );
+
+template<typename S,typename T,class Function>
 void EntrywiseMap
-( const Matrix<S>& A, Matrix<T>& B, function<T(const S&)> func );
-template<typename S,typename T>
+( const Matrix<S>& A, Matrix<T>& B, Function func );
+template<typename S,typename T,class Function>
 void EntrywiseMap
-( const SparseMatrix<S>& A, SparseMatrix<T>& B, function<T(const S&)> func );
-template<typename S,typename T>
+( const SparseMatrix<S>& A, SparseMatrix<T>& B, Function func );
+template<typename S,typename T,class Function>
 void EntrywiseMap
 ( const AbstractDistMatrix<S>& A, AbstractDistMatrix<T>& B,
-  function<T(const S&)> func );
-template<typename S,typename T>
+  Function func );
+template<typename S,typename T,class Function>
 void EntrywiseMap
 ( const DistSparseMatrix<S>& A, DistSparseMatrix<T>& B,
-  function<T(const S&)> func );
-template<typename S,typename T>
+  Function func );
+template<typename S,typename T,class Function>
 void EntrywiseMap
 ( const DistMultiVec<S>& A, DistMultiVec<T>& B,
-  function<T(const S&)> func );
+  Function func );
 
 // Fill
 // ====
@@ -952,25 +955,25 @@ GetImagPartOfDiagonal( const DistMatrix<T,U,V,BLOCK>& A, Int offset=0 );
 
 // GetMappedDiagonal
 // =================
-template<typename T,typename S>
+template<typename T,typename S,class Function>
 void GetMappedDiagonal
-( const Matrix<T>& A, Matrix<S>& d, function<S(const T&)> func, Int offset=0 );
-template<typename T,typename S,Dist U,Dist V>
+( const Matrix<T>& A, Matrix<S>& d, Function func, Int offset=0 );
+template<typename T,typename S,Dist U,Dist V,class Function>
 void GetMappedDiagonal
 ( const DistMatrix<T,U,V>& A, AbstractDistMatrix<S>& d,
-  function<S(const T&)> func, Int offset=0 );
-template<typename T,typename S,Dist U,Dist V>
+  Function func, Int offset=0 );
+template<typename T,typename S,Dist U,Dist V,class Function>
 void GetMappedDiagonal
 ( const DistMatrix<T,U,V,BLOCK>& A, AbstractDistMatrix<S>& d,
-  function<S(const T&)> func, Int offset=0 );
-template<typename T,typename S>
+  Function func, Int offset=0 );
+template<typename T,typename S,class Function>
 void GetMappedDiagonal
 ( const SparseMatrix<T>& A, Matrix<S>& d,
-  function<S(const T&)> func, Int offset=0 );
-template<typename T,typename S>
+  Function func, Int offset=0 );
+template<typename T,typename S,class Function>
 void GetMappedDiagonal
 ( const DistSparseMatrix<T>& A, DistMultiVec<S>& d,
-  function<S(const T&)> func, Int offset=0 );
+  Function func, Int offset=0 );
 
 // GetSubgraph
 // ===========
@@ -1186,40 +1189,40 @@ void ImagPart
 
 // IndexDependentFill
 // ==================
-template<typename T>
-void IndexDependentFill( Matrix<T>& A, function<T(Int,Int)> func );
-template<typename T>
+template<typename T,class Function>
+void IndexDependentFill( Matrix<T>& A, Function func );
+template<typename T,class Function>
 void IndexDependentFill
-( AbstractDistMatrix<T>& A, function<T(Int,Int)> func );
+( AbstractDistMatrix<T>& A, Function func );
 
 // IndexDependentMap
 // =================
-template<typename T>
-void IndexDependentMap( Matrix<T>& A, function<T(Int,Int,const T&)> func );
-template<typename T>
+template<typename T,class Function>
+void IndexDependentMap( Matrix<T>& A, Function func );
+template<typename T,class Function>
 void IndexDependentMap
-( AbstractDistMatrix<T>& A, function<T(Int,Int,const T&)> func );
+( AbstractDistMatrix<T>& A, Function func );
 
-template<typename S,typename T>
+template<typename S,typename T,class Function>
 void IndexDependentMap
 ( const Matrix<S>& A,
         Matrix<T>& B,
-        function<T(Int,Int,const S&)> func );
-template<typename S,typename T,Dist U,Dist V,DistWrap wrap>
+        Function func );
+template<typename S,typename T,Dist U,Dist V,DistWrap wrap,class Function>
 void IndexDependentMap
 ( const DistMatrix<S,U,V,wrap>& A,
         DistMatrix<T,U,V,wrap>& B,
-        function<T(Int,Int,const S&)> func );
-template<typename S,typename T,Dist U,Dist V>
+        Function func );
+template<typename S,typename T,Dist U,Dist V,class Function>
 void IndexDependentMap
 ( const AbstractDistMatrix<S>& A,
         DistMatrix<T,U,V>& B,
-        function<T(Int,Int,const S&)> func );
-template<typename S,typename T,Dist U,Dist V>
+        Function func );
+template<typename S,typename T,Dist U,Dist V,class Function>
 void IndexDependentMap
 ( const AbstractDistMatrix<S>& A,
         DistMatrix<T,U,V,BLOCK>& B,
-        function<T(Int,Int,const S&)> func );
+        Function func );
 
 // Kronecker product
 // =================
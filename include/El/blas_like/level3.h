@@ -23,7 +23,9 @@ typedef enum {
   EL_GEMM_SUMMA_B,
   EL_GEMM_SUMMA_C,
   EL_GEMM_SUMMA_DOT,
-  EL_GEMM_CANNON
+  EL_GEMM_CANNON,
+  EL_GEMM_SKINNY_INNER,
+  EL_GEMM_SKINNY_OUTER
 } ElGemmAlgorithm;
 
 EL_EXPORT ElError ElGemm_i
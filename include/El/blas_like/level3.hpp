@@ -26,7 +26,12 @@ enum GemmAlgorithm {
   GEMM_SUMMA_B,
   GEMM_SUMMA_C,
   GEMM_SUMMA_DOT,
-  GEMM_CANNON
+  GEMM_CANNON,
+  // 1D algorithms for when only one of m, n, and the summation dimension is
+  // large, e.g., A^H B for tall-skinny A and B (inner) or A B for tall-skinny
+  // A and a small B (outer)
+  GEMM_SKINNY_INNER,
+  GEMM_SKINNY_OUTER
 };
 }
 using namespace GemmAlgorithmNS;
@@ -53,6 +58,19 @@ void Gemm
   T alpha, const AbstractDistMatrix<T>& A, const AbstractDistMatrix<T>& B,
                  AbstractDistMatrix<T>& C, GemmAlgorithm alg=GEMM_DEFAULT );
 
+// Mixed-precision variants: the entries of A and B are stored (and
+// communicated) in their own datatypes but are accumulated in that of C
+template<typename TA,typename TB,typename TC>
+void Gemm
+( Orientation orientA, Orientation orientB,
+  TC alpha, const Matrix<TA>& A, const Matrix<TB>& B,
+  TC beta,        Matrix<TC>& C );
+template<typename TA,typename TB,typename TC>
+void Gemm
+( Orientation orientA, Orientation orientB,
+  TC alpha, const AbstractDistMatrix<TA>& A, const AbstractDistMatrix<TB>& B,
+  TC beta,        AbstractDistMatrix<TC>& C );
+
 template<typename T>
 void LocalGemm
 ( Orientation orientA, Orientation orientB,
@@ -182,6 +200,67 @@ void Multiply
   T beta,
         AbstractDistMatrix<T>& Y );
 
+// Sparse-times-sparse products
+// ----------------------------
+// C := alpha A B, where the product is formed row-by-row with a threaded,
+// hash-based accumulator. MultiplySymbolic overwrites C with the sparsity
+// pattern of A B (with explicitly zero values) and MultiplyNumeric then
+// overwrites the values of C -- whose pattern must contain that of A B --
+// with those of alpha A B, so that repeated products of matrices with fixed
+// sparsity patterns (e.g., Galerkin products) only pay for the latter.
+//
+// In the distributed case, the product has the same row distribution as A and
+// is either formed by fetching the rows of B referenced by the local rows of
+// A (SPARSE_MULTIPLY_ROW_WISE) or with a 2D sparse SUMMA over the process grid
+// (SPARSE_MULTIPLY_SUMMA), which communicates asymptotically less data when
+// the local rows of A reference a large fraction of the rows of B.
+namespace SparseMultiplyAlgorithmNS {
+enum SparseMultiplyAlgorithm {
+  SPARSE_MULTIPLY_DEFAULT,
+  SPARSE_MULTIPLY_ROW_WISE,
+  SPARSE_MULTIPLY_SUMMA
+};
+}
+using namespace SparseMultiplyAlgorithmNS;
+
+template<typename T>
+void Multiply
+( T alpha,
+  const SparseMatrix<T>& A,
+  const SparseMatrix<T>& B,
+        SparseMatrix<T>& C );
+template<typename T>
+void Multiply
+( T alpha,
+  const DistSparseMatrix<T>& A,
+  const DistSparseMatrix<T>& B,
+        DistSparseMatrix<T>& C,
+  SparseMultiplyAlgorithm alg=SPARSE_MULTIPLY_DEFAULT );
+
+template<typename T>
+void MultiplySymbolic
+( const SparseMatrix<T>& A,
+  const SparseMatrix<T>& B,
+        SparseMatrix<T>& C );
+template<typename T>
+void MultiplySymbolic
+( const DistSparseMatrix<T>& A,
+  const DistSparseMatrix<T>& B,
+        DistSparseMatrix<T>& C );
+
+template<typename T>
+void MultiplyNumeric
+( T alpha,
+  const SparseMatrix<T>& A,
+  const SparseMatrix<T>& B,
+        SparseMatrix<T>& C );
+template<typename T>
+void MultiplyNumeric
+( T alpha,
+  const DistSparseMatrix<T>& A,
+  const DistSparseMatrix<T>& B,
+        DistSparseMatrix<T>& C );
+
 // MultiShiftQuasiTrsm
 // ===================
 template<typename F>
@@ -467,6 +546,23 @@ void Trsm
         AbstractDistMatrix<F>& B,
   bool checkIfSingular=false, TrsmAlgorithm alg=TRSM_DEFAULT );
 
+// Mixed-precision variants: A is stored (and communicated) in the datatype
+// FA while B is solved for in the datatype FB
+template<typename FA,typename FB>
+void Trsm
+( LeftOrRight side, UpperOrLower uplo,
+  Orientation orientation, UnitOrNonUnit diag,
+  FB alpha, const Matrix<FA>& A, Matrix<FB>& B,
+  bool checkIfSingular=false );
+template<typename FA,typename FB>
+void Trsm
+( LeftOrRight side, UpperOrLower uplo,
+  Orientation orientation, UnitOrNonUnit diag,
+  FB alpha,
+  const AbstractDistMatrix<FA>& A,
+        AbstractDistMatrix<FB>& B,
+  bool checkIfSingular=false );
+
 template<typename F>
 void LocalTrsm
 ( LeftOrRight side, UpperOrLower uplo,
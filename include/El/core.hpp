@@ -33,11 +33,19 @@
 
 #define EL_UNUSED(expr) (void)(expr)
 
+// Argument checks within hot paths (e.g., single-entry access) may be wrapped
+// in EL_DEBUG_SAMPLED so that, when a debug check period has been set via
+// SetDebugCheckPeriod, only one in every 'period' of them is executed. The
+// check is a complete statement (with an empty 'then' branch) so that it
+// cannot capture a trailing 'else' of the caller.
 #ifdef EL_RELEASE
 # define EL_DEBUG_ONLY(cmd)
+# define EL_DEBUG_SAMPLED(cmd)
 # define EL_RELEASE_ONLY(cmd) cmd;
 #else
 # define EL_DEBUG_ONLY(cmd) cmd;
+# define EL_DEBUG_SAMPLED(cmd) \
+  if( !El::SampleDebugCheck() ) { } else { cmd; }
 # define EL_RELEASE_ONLY(cmd)
 #endif
 
@@ -284,6 +292,7 @@ class DistMatrix;
 
 #include <El/core/Matrix/decl.hpp>
 #include <El/core/Graph/decl.hpp>
+#include <El/core/Graph/assembly.hpp>
 #include <El/core/DistMap/decl.hpp>
 #include <El/core/DistGraph/decl.hpp>
 #include <El/core/SparseMatrix/decl.hpp>
@@ -136,7 +136,9 @@ public:
     void QueueLocalDisconnection( Int localSource, Int target )
     EL_NO_RELEASE_EXCEPT;
     void ProcessQueues();
-    void ProcessLocalQueues();
+    // If 'sorted' is true, the local edges are assumed to already be sorted
+    // by source and then target
+    void ProcessLocalQueues( bool sorted=false );
 
     // For manually modifying/accessing buffers
     void ForceNumLocalEdges( Int numLocalEdges );
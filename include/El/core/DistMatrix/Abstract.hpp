@@ -225,9 +225,18 @@ public:
 
     // Batch updating of remote entries
     // ---------------------------------
+    // NOTE: QueueUpdate may be called concurrently from within an OpenMP
+    //       parallel region, in which case each thread appends to its own
+    //       queue if Reserve was called beforehand (outside of the region).
+    //       Duplicate updates of the same entry are summed before they are
+    //       sent, and the updates are exchanged only between the pairs of
+    //       processes which have updates for one another.
     void Reserve( Int numRemoteEntries );
     void QueueUpdate( const Entry<Ring>& entry ) EL_NO_RELEASE_EXCEPT;
     void QueueUpdate( Int i, Int j, Ring value ) EL_NO_RELEASE_EXCEPT;
+    // Queue A(i:i+height-1,j:j+width-1) += block, whose entries are sent to
+    // their owners without any accompanying indices
+    void QueueUpdate( Int i, Int j, const El::Matrix<Ring>& block );
     void ProcessQueues( bool includeViewers=true );
 
     // Batch extraction of remote entries
@@ -333,6 +342,17 @@ protected:
     //       require separate MPI wrappers from ValueInt<Int>
     mutable vector<ValueInt<Int>> remotePulls_;
 
+    // Per-thread queues of remote updates (see Reserve)
+    vector<vector<Entry<Ring>>> threadUpdates_;
+
+    // Queued dense block updates
+    struct BlockUpdate
+    {
+        Int i, j;
+        El::Matrix<Ring> block;
+    };
+    vector<BlockUpdate> blockUpdates_;
+
     // Protected constructors
     // ======================
     // Create a 0 x 0 distributed matrix
@@ -70,6 +70,28 @@ struct PermutationMeta
             mpi::Comm permComm );
 };
 
+// The state of a permutation application which has been started (e.g., via
+// DistPermutation::StartPermuteRows) but not yet finished. Between the two
+// calls, the rows (or columns) of the matrix which are being permuted should
+// be neither read nor modified.
+template<typename T>
+struct PermutationExchange
+{
+    // The matrix being permuted (possibly a view owned by 'view')
+    AbstractDistMatrix<T>* A=nullptr;
+    unique_ptr<AbstractDistMatrix<T>> view;
+
+    bool rows=true;
+    bool inverse=false;
+    // The metadata, scaled by the local length of each row (or column)
+    PermutationMeta meta;
+
+    vector<T> sendBuf, recvBuf;
+    vector<mpi::Request<T>> requests;
+
+    bool Active() const { return A != nullptr; }
+};
+
 // TODO(poulson): Convert to accepting Grid rather than mpi::Comm
 class DistPermutation
 {
@@ -155,6 +177,33 @@ public:
       bool conjugate=false,
       Int offset=0 ) const;
 
+    // Split-phase (nonblocking) variants of the above. The exchange begun by
+    // each Start routine is completed by FinishPermutation, and unrelated work
+    // can be overlapped in between. Permutations which cannot be expressed as
+    // a single exchange are applied immediately by the Start routine.
+    template<typename T>
+    void StartPermuteCols
+    ( AbstractDistMatrix<T>& A,
+      PermutationExchange<T>& exchange,
+      Int offset=0 ) const;
+    template<typename T>
+    void StartInversePermuteCols
+    ( AbstractDistMatrix<T>& A,
+      PermutationExchange<T>& exchange,
+      Int offset=0 ) const;
+    template<typename T>
+    void StartPermuteRows
+    ( AbstractDistMatrix<T>& A,
+      PermutationExchange<T>& exchange,
+      Int offset=0 ) const;
+    template<typename T>
+    void StartInversePermuteRows
+    ( AbstractDistMatrix<T>& A,
+      PermutationExchange<T>& exchange,
+      Int offset=0 ) const;
+    template<typename T>
+    void FinishPermutation( PermutationExchange<T>& exchange ) const;
+
     // Form the permutation vector p so that P A = A(p,:)
     void ExplicitVector( AbstractDistMatrix<Int>& p ) const;
 
@@ -185,10 +234,38 @@ private:
     mutable DistMatrix<Int,VC,STAR> invPerm_;
     mutable bool staleInverse_=true;
 
+    // If the swap sequence has implicit origins and each swap destination is
+    // at least as large as its origin (as is the case for partial pivoting),
+    // then the swaps are composed into a partial permutation of [0,numSwaps_)
+    // so that they may be applied with a single exchange
+    mutable bool staleSwapPerm_=true;
+    mutable bool monotoneSwaps_=false;
+    mutable DistMatrix<Int,STAR,STAR> swapPerm_, swapInvPerm_;
+
     // Use the alignment and communicator as a key
     typedef std::pair<Int,mpi::Comm> keyType_;
     mutable std::map<keyType_,PermutationMeta> rowMeta_, colMeta_;
     mutable bool staleMeta_=false;
+
+    void FormSwapPermutation() const;
+    // Returns the (cached) metadata for permuting the rows (or columns) of a
+    // matrix with the given alignment and communicator, or nullptr if the
+    // permutation is a swap sequence which cannot be applied in one exchange
+    const PermutationMeta* Meta( bool rows, Int align, mpi::Comm comm ) const;
+
+    template<typename T>
+    void ApplySwaps
+    ( AbstractDistMatrix<T>& A, bool rows, bool inverse, Int offset ) const;
+    template<typename T>
+    void ApplyPermutation
+    ( AbstractDistMatrix<T>& A, bool rows, bool inverse, Int offset ) const;
+    template<typename T>
+    void StartPermutation
+    ( AbstractDistMatrix<T>& A,
+      PermutationExchange<T>& exchange,
+      bool rows,
+      bool inverse,
+      Int offset ) const;
 };
 
 } // namespace El
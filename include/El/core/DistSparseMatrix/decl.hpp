@@ -86,7 +86,28 @@ public:
     EL_NO_RELEASE_EXCEPT;
 
     void ProcessQueues();
-    void ProcessLocalQueues();
+    // If 'sorted' is true, the local entries are assumed to already be sorted
+    // by row and then column
+    void ProcessLocalQueues( bool sorted=false );
+
+    // Bulk ingestion
+    // ^^^^^^^^^^^^^^
+    // Queue a batch of updates stored in coordinate (COO) format, where END
+    // may be used to refer to the last row or column
+    void QueueUpdates
+    ( Int numEntries, const Int* rows, const Int* cols, const Ring* values,
+      bool passive=false );
+    void QueueLocalUpdates
+    ( Int numEntries,
+      const Int* localRows, const Int* cols, const Ring* values );
+    // Overwrite the matrix with one of the given size whose locally-owned rows
+    // are given by the compressed sparse row (CSR) arrays
+    // (localRowOffsets, cols, values), where 'localRowOffsets' is of length
+    // LocalHeight()+1 (after resizing). If the column indices of each row are
+    // strictly increasing, the arrays are copied directly into place.
+    void ImportLocalCSR
+    ( Int height, Int width,
+      const Int* localRowOffsets, const Int* cols, const Ring* values );
 
     // Operator overloading
     // ====================
@@ -327,70 +327,170 @@ void DistSparseMatrix<Ring>::ProcessQueues()
 }
 
 template<typename Ring>
-void DistSparseMatrix<Ring>::ProcessLocalQueues()
+void DistSparseMatrix<Ring>::ProcessLocalQueues( bool sorted )
 {
     EL_DEBUG_CSE
     if( distGraph_.locallyConsistent_ )
         return;
 
-    Int numRemoved = 0;
-    const Int numLocalEntries = vals_.size();
-    vector<Entry<Ring>> entries( numLocalEntries );
-    if( distGraph_.markedForRemoval_.size() != 0 )
+    assembly::RemoveMarked
+    ( distGraph_.sources_, distGraph_.targets_, &vals_,
+      distGraph_.markedForRemoval_ );
+    assembly::Consolidate
+    ( distGraph_.numLocalSources_, distGraph_.FirstLocalSource(),
+      distGraph_.sources_, distGraph_.targets_, &vals_,
+      distGraph_.localSourceOffsets_, sorted );
+    distGraph_.locallyConsistent_ = true;
+}
+
+template<typename Ring>
+void DistSparseMatrix<Ring>::QueueUpdates
+( Int numEntries, const Int* rows, const Int* cols, const Ring* values,
+  bool passive )
+{
+    EL_DEBUG_CSE
+    if( FrozenSparsity() )
+    {
+        for( Int e=0; e<numEntries; ++e )
+            QueueUpdate( rows[e], cols[e], values[e], passive );
+        return;
+    }
+    const Int height = Height();
+    const Int width = Width();
+    const Int firstLocalRow = FirstLocalRow();
+    const Int localHeight = LocalHeight();
+    Int numLocalEntries = 0;
+    for( Int e=0; e<numEntries; ++e )
+    {
+        const Int row = ( rows[e] == END ? height-1 : rows[e] );
+        if( row >= firstLocalRow && row < firstLocalRow+localHeight )
+            ++numLocalEntries;
+    }
+    Reserve
+    ( numLocalEntries, ( passive ? 0 : numEntries-numLocalEntries ) );
+
+    for( Int e=0; e<numEntries; ++e )
     {
-        for( Int s=0; s<numLocalEntries; ++s )
+        const Int row = ( rows[e] == END ? height-1 : rows[e] );
+        const Int col = ( cols[e] == END ? width-1 : cols[e] );
+        EL_DEBUG_ONLY(
+          if( row < 0 || row >= height || col < 0 || col >= width )
+              LogicError
+              ("Entry (",row,",",col,") is out of bounds of ",
+               height," x ",width," matrix");
+        )
+        if( row >= firstLocalRow && row < firstLocalRow+localHeight )
         {
-            pair<Int,Int> candidate(distGraph_.sources_[s],
-                                    distGraph_.targets_[s]);
-            if( distGraph_.markedForRemoval_.find(candidate) ==
-                distGraph_.markedForRemoval_.end() )
-            {
-                entries[s-numRemoved].i = distGraph_.sources_[s];
-                entries[s-numRemoved].j = distGraph_.targets_[s];
-                entries[s-numRemoved].value = vals_[s];
-            }
-            else
-            {
-                ++numRemoved;
-            }
+            distGraph_.sources_.push_back( row );
+            distGraph_.targets_.push_back( col );
+            vals_.push_back( values[e] );
+        }
+        else if( !passive )
+        {
+            distGraph_.remoteSources_.push_back( row );
+            distGraph_.remoteTargets_.push_back( col );
+            remoteVals_.push_back( values[e] );
         }
-        SwapClear( distGraph_.markedForRemoval_ );
-        entries.resize( numLocalEntries-numRemoved );
     }
-    else
+    if( numLocalEntries > 0 )
+    {
+        distGraph_.locallyConsistent_ = false;
+        distGraph_.multMeta.ready = false;
+    }
+}
+
+template<typename Ring>
+void DistSparseMatrix<Ring>::QueueLocalUpdates
+( Int numEntries, const Int* localRows, const Int* cols, const Ring* values )
+{
+    EL_DEBUG_CSE
+    if( FrozenSparsity() )
     {
-        for( Int s=0; s<numLocalEntries; ++s )
-            entries[s] = Entry<Ring>{distGraph_.sources_[s],
-                                  distGraph_.targets_[s],vals_[s]};
+        for( Int e=0; e<numEntries; ++e )
+            QueueLocalUpdate( localRows[e], cols[e], values[e] );
+        return;
     }
-    std::sort( entries.begin(), entries.end(), CompareEntries );
-    const Int numSorted = entries.size();
+    if( numEntries == 0 )
+        return;
+    const Int width = Width();
+    const Int firstLocalRow = FirstLocalRow();
+    const Int localHeight = LocalHeight();
+    const Int oldSize = distGraph_.sources_.size();
+    distGraph_.sources_.resize( oldSize+numEntries );
+    distGraph_.targets_.resize( oldSize+numEntries );
+    Int* sourceBuf = &distGraph_.sources_[oldSize];
+    Int* targetBuf = &distGraph_.targets_[oldSize];
+    for( Int e=0; e<numEntries; ++e )
+    {
+        const Int localRow =
+          ( localRows[e] == END ? localHeight-1 : localRows[e] );
+        const Int col = ( cols[e] == END ? width-1 : cols[e] );
+        EL_DEBUG_ONLY(
+          if( localRow < 0 || localRow >= localHeight ||
+              col < 0 || col >= width )
+              LogicError
+              ("Local entry (",localRow,",",col,") is out of bounds");
+        )
+        sourceBuf[e] = firstLocalRow + localRow;
+        targetBuf[e] = col;
+    }
+    vals_.insert( vals_.end(), values, values+numEntries );
+    distGraph_.locallyConsistent_ = false;
+    distGraph_.multMeta.ready = false;
+}
+
+template<typename Ring>
+void DistSparseMatrix<Ring>::ImportLocalCSR
+( Int height, Int width,
+  const Int* localRowOffsets, const Int* cols, const Ring* values )
+{
+    EL_DEBUG_CSE
+    Empty( false );
+    Resize( height, width );
 
-    // Combine duplicates
-    // ------------------
-    Int lastUnique=0;
-    for( Int s=1; s<numSorted; ++s )
+    const Int localHeight = LocalHeight();
+    const Int firstLocalRow = FirstLocalRow();
+    const Int firstOffset = localRowOffsets[0];
+    const Int numLocalEntries = localRowOffsets[localHeight] - firstOffset;
+    distGraph_.targets_.assign
+    ( cols+firstOffset, cols+firstOffset+numLocalEntries );
+    vals_.assign( values+firstOffset, values+firstOffset+numLocalEntries );
+    distGraph_.sources_.resize( numLocalEntries );
+    distGraph_.localSourceOffsets_.resize( localHeight+1 );
+
+    const Int* targetBuf = distGraph_.targets_.data();
+    bool sorted = true;
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
     {
-        if( entries[s].i != entries[lastUnique].i ||
-            entries[s].j != entries[lastUnique].j )
-            entries[++lastUnique] = entries[s];
-        else
-            entries[lastUnique].value += entries[s].value;
+        const Int rowBeg = localRowOffsets[iLoc] - firstOffset;
+        const Int rowEnd = localRowOffsets[iLoc+1] - firstOffset;
+        EL_DEBUG_ONLY(
+          if( rowEnd < rowBeg )
+              LogicError("Row offsets were not non-decreasing");
+          for( Int e=rowBeg; e<rowEnd; ++e )
+              if( targetBuf[e] < 0 || targetBuf[e] >= width )
+                  LogicError("Column index ",targetBuf[e]," out of bounds");
+        )
+        distGraph_.localSourceOffsets_[iLoc] = rowBeg;
+        for( Int e=rowBeg; e<rowEnd; ++e )
+        {
+            distGraph_.sources_[e] = firstLocalRow + iLoc;
+            if( e > rowBeg && targetBuf[e] <= targetBuf[e-1] )
+                sorted = false;
+        }
     }
-    const Int numUnique = lastUnique+1;
+    distGraph_.localSourceOffsets_[localHeight] = numLocalEntries;
+    distGraph_.multMeta.ready = false;
 
-    entries.resize( numUnique );
-    distGraph_.sources_.resize( numUnique );
-    distGraph_.targets_.resize( numUnique );
-    vals_.resize( numUnique );
-    for( Int s=0; s<numUnique; ++s )
+    if( sorted )
     {
-        distGraph_.sources_[s] = entries[s].i;
-        distGraph_.targets_[s] = entries[s].j;
-        vals_[s] = entries[s].value;
+        distGraph_.locallyConsistent_ = true;
+    }
+    else
+    {
+        distGraph_.locallyConsistent_ = false;
+        ProcessLocalQueues();
     }
-    distGraph_.ComputeSourceOffsets();
-    distGraph_.locallyConsistent_ = true;
 }
 
 // Operator overloading
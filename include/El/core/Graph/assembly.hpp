@@ -0,0 +1,316 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_CORE_GRAPH_ASSEMBLY_HPP
+#define EL_CORE_GRAPH_ASSEMBLY_HPP
+
+namespace El {
+namespace assembly {
+
+// Consolidate a list of (source,target) edges, with optional accompanying
+// values, into the sorted, duplicate-free format used by Graph, DistGraph,
+// SparseMatrix, and DistSparseMatrix:
+//
+//  1) The edges are bucketed by their source using a stable, threaded
+//     counting sort (each thread histograms and then scatters a contiguous
+//     chunk of the edges),
+//  2) the targets within each source are sorted (in parallel over the
+//     sources) and the values of duplicate edges are summed in the same pass,
+//  3) the source offsets are formed from the number of unique edges in each
+//     source and the result is compacted in parallel.
+//
+// The sources are assumed to lie in [firstSource,firstSource+numSources).
+// If 'sorted' is true, the edges are assumed to already be sorted by source
+// and then target, and only the duplicates are combined.
+
+const Int insertionSortCutoff = 32;
+
+// Remove the edges (and values) marked for removal while preserving the order
+// of the remaining edges
+template<typename T>
+void RemoveMarked
+( vector<Int>& sources,
+  vector<Int>& targets,
+  vector<T>* values,
+  set<pair<Int,Int>>& markedForRemoval )
+{
+    EL_DEBUG_CSE
+    if( markedForRemoval.size() == 0 )
+        return;
+    const Int numEdges = sources.size();
+    Int numKept = 0;
+    for( Int e=0; e<numEdges; ++e )
+    {
+        pair<Int,Int> candidate(sources[e],targets[e]);
+        if( markedForRemoval.find(candidate) == markedForRemoval.end() )
+        {
+            sources[numKept] = sources[e];
+            targets[numKept] = targets[e];
+            if( values )
+                (*values)[numKept] = (*values)[e];
+            ++numKept;
+        }
+    }
+    sources.resize( numKept );
+    targets.resize( numKept );
+    if( values )
+        values->resize( numKept );
+    SwapClear( markedForRemoval );
+}
+
+template<typename T>
+void SortTargets( Int* targets, T* values, Int num )
+{
+    if( num <= insertionSortCutoff )
+    {
+        for( Int k=1; k<num; ++k )
+        {
+            const Int target = targets[k];
+            Int l = k;
+            if( values )
+            {
+                const T value = values[k];
+                for( ; l>0 && targets[l-1]>target; --l )
+                {
+                    targets[l] = targets[l-1];
+                    values[l] = values[l-1];
+                }
+                values[l] = value;
+            }
+            else
+            {
+                for( ; l>0 && targets[l-1]>target; --l )
+                    targets[l] = targets[l-1];
+            }
+            targets[l] = target;
+        }
+    }
+    else if( values )
+    {
+        vector<pair<Int,T>> pairs( num );
+        for( Int k=0; k<num; ++k )
+            pairs[k] = pair<Int,T>(targets[k],values[k]);
+        std::stable_sort
+        ( pairs.begin(), pairs.end(),
+          []( const pair<Int,T>& a, const pair<Int,T>& b )
+          { return a.first < b.first; } );
+        for( Int k=0; k<num; ++k )
+        {
+            targets[k] = pairs[k].first;
+            values[k] = pairs[k].second;
+        }
+    }
+    else
+        std::sort( targets, targets+num );
+}
+
+template<typename T>
+void Consolidate
+( Int numSources,
+  Int firstSource,
+  vector<Int>& sources,
+  vector<Int>& targets,
+  vector<T>* values,
+  vector<Int>& offsets,
+  bool sorted=false )
+{
+    EL_DEBUG_CSE
+    const Int numEdges = sources.size();
+    EL_DEBUG_ONLY(
+      if( Int(targets.size()) != numEdges ||
+          (values && Int(values->size()) != numEdges) )
+          LogicError("Inconsistent edge buffer sizes");
+      for( Int e=0; e<numEdges; ++e )
+          if( sources[e] < firstSource ||
+              sources[e] >= firstSource+numSources )
+              LogicError("Source ",sources[e]," was out of bounds");
+      if( sorted )
+          for( Int e=1; e<numEdges; ++e )
+              if( sources[e] < sources[e-1] ||
+                  (sources[e] == sources[e-1] && targets[e] < targets[e-1]) )
+                  LogicError("Edges were not sorted");
+    )
+
+    // Bucket the edges by their source
+    // ================================
+    vector<Int> bucketOffsets( numSources+1, 0 );
+    vector<Int> bucketTargets;
+    vector<T> bucketValues;
+    if( sorted )
+    {
+        for( Int e=0; e<numEdges; ++e )
+            ++bucketOffsets[sources[e]-firstSource+1];
+        for( Int s=0; s<numSources; ++s )
+            bucketOffsets[s+1] += bucketOffsets[s];
+        bucketTargets.swap( targets );
+        if( values )
+            bucketValues.swap( *values );
+    }
+    else
+    {
+        bucketTargets.resize( numEdges );
+        if( values )
+            bucketValues.resize( numEdges );
+        const T* valueBuf = ( values ? values->data() : nullptr );
+
+#ifdef EL_HYBRID
+        const Int maxThreads =
+          ( numEdges >= 4*insertionSortCutoff ? omp_get_max_threads() : 1 );
+#else
+        const Int maxThreads = 1;
+#endif
+        // Each thread counts the sources within its chunk of edges
+        vector<Int> threadCounts( maxThreads*numSources, 0 );
+        auto histogram = [&]( Int thread, Int numThreads )
+          {
+            const Int chunk = (numEdges+numThreads-1) / numThreads;
+            const Int eBeg = Min(thread*chunk,numEdges);
+            const Int eEnd = Min((thread+1)*chunk,numEdges);
+            Int* counts = &threadCounts[thread*numSources];
+            for( Int e=eBeg; e<eEnd; ++e )
+                ++counts[sources[e]-firstSource];
+          };
+        // ...and then scatters them to (stable) positions within each bucket
+        auto scatter = [&]( Int thread, Int numThreads )
+          {
+            const Int chunk = (numEdges+numThreads-1) / numThreads;
+            const Int eBeg = Min(thread*chunk,numEdges);
+            const Int eEnd = Min((thread+1)*chunk,numEdges);
+            Int* positions = &threadCounts[thread*numSources];
+            for( Int e=eBeg; e<eEnd; ++e )
+            {
+                const Int pos = positions[sources[e]-firstSource]++;
+                bucketTargets[pos] = targets[e];
+                if( valueBuf )
+                    bucketValues[pos] = valueBuf[e];
+            }
+          };
+        // Convert the per-thread counts into per-thread starting positions
+        auto prefix = [&]( Int numThreads )
+          {
+            Int offset = 0;
+            for( Int s=0; s<numSources; ++s )
+            {
+                bucketOffsets[s] = offset;
+                for( Int t=0; t<numThreads; ++t )
+                {
+                    const Int count = threadCounts[t*numSources+s];
+                    threadCounts[t*numSources+s] = offset;
+                    offset += count;
+                }
+            }
+            bucketOffsets[numSources] = offset;
+          };
+
+#ifdef EL_HYBRID
+        if( maxThreads > 1 )
+        {
+            Int numThreads = 1;
+            #pragma omp parallel
+            {
+                const Int thread = omp_get_thread_num();
+                #pragma omp single
+                numThreads = omp_get_num_threads();
+                histogram( thread, numThreads );
+                #pragma omp barrier
+                #pragma omp single
+                prefix( numThreads );
+                scatter( thread, numThreads );
+            }
+        }
+        else
+#endif
+        {
+            histogram( 0, 1 );
+            prefix( 1 );
+            scatter( 0, 1 );
+        }
+        SwapClear( targets );
+        if( values )
+            SwapClear( *values );
+    }
+    SwapClear( sources );
+
+    // Sort the targets within each source and sum the duplicates
+    // ==========================================================
+    vector<Int> numUnique( numSources );
+    Int* targetBuf = bucketTargets.data();
+    T* valueBuf = ( values ? bucketValues.data() : nullptr );
+    EL_PARALLEL_FOR
+    for( Int s=0; s<numSources; ++s )
+    {
+        const Int offset = bucketOffsets[s];
+        const Int num = bucketOffsets[s+1] - offset;
+        Int* sourceTargets = &targetBuf[offset];
+        T* sourceValues = ( valueBuf ? &valueBuf[offset] : nullptr );
+        if( !sorted )
+            SortTargets( sourceTargets, sourceValues, num );
+        Int last = -1;
+        for( Int k=0; k<num; ++k )
+        {
+            if( last >= 0 && sourceTargets[k] == sourceTargets[last] )
+            {
+                if( sourceValues )
+                    sourceValues[last] += sourceValues[k];
+            }
+            else
+            {
+                ++last;
+                sourceTargets[last] = sourceTargets[k];
+                if( sourceValues )
+                    sourceValues[last] = sourceValues[k];
+            }
+        }
+        numUnique[s] = last+1;
+    }
+
+    // Form the offsets and compact the result
+    // =======================================
+    offsets.resize( numSources+1 );
+    Int numKept = 0;
+    for( Int s=0; s<numSources; ++s )
+    {
+        offsets[s] = numKept;
+        numKept += numUnique[s];
+    }
+    offsets[numSources] = numKept;
+    if( numKept == numEdges )
+    {
+        targets.swap( bucketTargets );
+        if( values )
+            values->swap( bucketValues );
+    }
+    else
+    {
+        targets.resize( numKept );
+        if( values )
+            values->resize( numKept );
+        EL_PARALLEL_FOR
+        for( Int s=0; s<numSources; ++s )
+        {
+            const Int bucketOffset = bucketOffsets[s];
+            const Int offset = offsets[s];
+            for( Int k=0; k<numUnique[s]; ++k )
+            {
+                targets[offset+k] = bucketTargets[bucketOffset+k];
+                if( values )
+                    (*values)[offset+k] = bucketValues[bucketOffset+k];
+            }
+        }
+    }
+    sources.resize( numKept );
+    EL_PARALLEL_FOR
+    for( Int s=0; s<numSources; ++s )
+        for( Int e=offsets[s]; e<offsets[s+1]; ++e )
+            sources[e] = firstSource + s;
+}
+
+} // namespace assembly
+} // namespace El
+
+#endif // ifndef EL_CORE_GRAPH_ASSEMBLY_HPP
@@ -83,9 +83,11 @@ public:
     bool FrozenSparsity() const EL_NO_EXCEPT;
 
     // For appending/removing many edges and then forcing consistency at the end
+    // (if 'sorted' is true, the queued edges are assumed to already be sorted
+    // by source and then target, and only duplicates are removed)
     void QueueConnection( Int source, Int target ) EL_NO_RELEASE_EXCEPT;
     void QueueDisconnection( Int source, Int target );
-    void ProcessQueues();
+    void ProcessQueues( bool sorted=false );
 
     // For manually modifying/accessing the buffers
     void ForceNumEdges( Int numEdges );
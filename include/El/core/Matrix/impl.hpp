@@ -382,7 +382,7 @@ Ring Matrix<Ring>::Get( Int i, Int j ) const
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
-    EL_DEBUG_ONLY(AssertValidEntry( i, j ))
+    EL_DEBUG_SAMPLED(AssertValidEntry( i, j ))
     if( i == END ) i = height_ - 1;
     if( j == END ) j = width_ - 1;
     return CRef( i, j );
@@ -393,7 +393,7 @@ Base<Ring> Matrix<Ring>::GetRealPart( Int i, Int j ) const
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
-    EL_DEBUG_ONLY(AssertValidEntry( i, j ))
+    EL_DEBUG_SAMPLED(AssertValidEntry( i, j ))
     if( i == END ) i = height_ - 1;
     if( j == END ) j = width_ - 1;
     return El::RealPart( CRef( i, j ) );
@@ -404,7 +404,7 @@ Base<Ring> Matrix<Ring>::GetImagPart( Int i, Int j ) const
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
-    EL_DEBUG_ONLY(AssertValidEntry( i, j ))
+    EL_DEBUG_SAMPLED(AssertValidEntry( i, j ))
     if( i == END ) i = height_ - 1;
     if( j == END ) j = width_ - 1;
     return El::ImagPart( CRef( i, j ) );
@@ -415,7 +415,7 @@ void Matrix<Ring>::Set( Int i, Int j, const Ring& alpha )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
-    EL_DEBUG_ONLY(
+    EL_DEBUG_SAMPLED(
       AssertValidEntry( i, j );
       if( Locked() )
           LogicError("Cannot modify data of locked matrices");
@@ -435,7 +435,7 @@ void Matrix<Ring>::SetRealPart( Int i, Int j, const Base<Ring>& alpha )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
-    EL_DEBUG_ONLY(
+    EL_DEBUG_SAMPLED(
       AssertValidEntry( i, j );
       if( Locked() )
           LogicError("Cannot modify data of locked matrices");
@@ -455,7 +455,7 @@ void Matrix<Ring>::SetImagPart( Int i, Int j, const Base<Ring>& alpha )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
-    EL_DEBUG_ONLY(
+    EL_DEBUG_SAMPLED(
       AssertValidEntry( i, j );
       if( Locked() )
           LogicError("Cannot modify data of locked matrices");
@@ -475,7 +475,7 @@ void Matrix<Ring>::Update( Int i, Int j, const Ring& alpha )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
-    EL_DEBUG_ONLY(
+    EL_DEBUG_SAMPLED(
       AssertValidEntry( i, j );
       if( Locked() )
           LogicError("Cannot modify data of locked matrices");
@@ -495,7 +495,7 @@ void Matrix<Ring>::UpdateRealPart( Int i, Int j, const Base<Ring>& alpha )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
-    EL_DEBUG_ONLY(
+    EL_DEBUG_SAMPLED(
       AssertValidEntry( i, j );
       if( Locked() )
           LogicError("Cannot modify data of locked matrices");
@@ -515,7 +515,7 @@ void Matrix<Ring>::UpdateImagPart( Int i, Int j, const Base<Ring>& alpha )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
-    EL_DEBUG_ONLY(
+    EL_DEBUG_SAMPLED(
       AssertValidEntry( i, j );
       if( Locked() )
           LogicError("Cannot modify data of locked matrices");
@@ -535,7 +535,7 @@ void Matrix<Ring>::MakeReal( Int i, Int j )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
-    EL_DEBUG_ONLY(
+    EL_DEBUG_SAMPLED(
       AssertValidEntry( i, j );
       if( Locked() )
           LogicError("Cannot modify data of locked matrices");
@@ -548,7 +548,7 @@ void Matrix<Ring>::Conjugate( Int i, Int j )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
-    EL_DEBUG_ONLY(
+    EL_DEBUG_SAMPLED(
       AssertValidEntry( i, j );
       if( Locked() )
           LogicError("Cannot modify data of locked matrices");
@@ -143,6 +143,45 @@ EL_EXPORT ElError ElSparseMatrixProcessQueues_d( ElSparseMatrix_d A );
 EL_EXPORT ElError ElSparseMatrixProcessQueues_c( ElSparseMatrix_c A );
 EL_EXPORT ElError ElSparseMatrixProcessQueues_z( ElSparseMatrix_z A );
 
+/* void SparseMatrix<T>::QueueUpdates
+   ( Int numEntries, const Int* rows, const Int* cols, const T* values )
+   --------------------------------------------------------------------- */
+EL_EXPORT ElError ElSparseMatrixQueueUpdates_i
+( ElSparseMatrix_i A, ElInt numEntries,
+  const ElInt* rows, const ElInt* cols, const ElInt* values );
+EL_EXPORT ElError ElSparseMatrixQueueUpdates_s
+( ElSparseMatrix_s A, ElInt numEntries,
+  const ElInt* rows, const ElInt* cols, const float* values );
+EL_EXPORT ElError ElSparseMatrixQueueUpdates_d
+( ElSparseMatrix_d A, ElInt numEntries,
+  const ElInt* rows, const ElInt* cols, const double* values );
+EL_EXPORT ElError ElSparseMatrixQueueUpdates_c
+( ElSparseMatrix_c A, ElInt numEntries,
+  const ElInt* rows, const ElInt* cols, const complex_float* values );
+EL_EXPORT ElError ElSparseMatrixQueueUpdates_z
+( ElSparseMatrix_z A, ElInt numEntries,
+  const ElInt* rows, const ElInt* cols, const complex_double* values );
+
+/* void SparseMatrix<T>::ImportCSR
+   ( Int height, Int width,
+     const Int* rowOffsets, const Int* cols, const T* values )
+   --------------------------------------------------------- */
+EL_EXPORT ElError ElSparseMatrixImportCSR_i
+( ElSparseMatrix_i A, ElInt height, ElInt width,
+  const ElInt* rowOffsets, const ElInt* cols, const ElInt* values );
+EL_EXPORT ElError ElSparseMatrixImportCSR_s
+( ElSparseMatrix_s A, ElInt height, ElInt width,
+  const ElInt* rowOffsets, const ElInt* cols, const float* values );
+EL_EXPORT ElError ElSparseMatrixImportCSR_d
+( ElSparseMatrix_d A, ElInt height, ElInt width,
+  const ElInt* rowOffsets, const ElInt* cols, const double* values );
+EL_EXPORT ElError ElSparseMatrixImportCSR_c
+( ElSparseMatrix_c A, ElInt height, ElInt width,
+  const ElInt* rowOffsets, const ElInt* cols, const complex_float* values );
+EL_EXPORT ElError ElSparseMatrixImportCSR_z
+( ElSparseMatrix_z A, ElInt height, ElInt width,
+  const ElInt* rowOffsets, const ElInt* cols, const complex_double* values );
+
 /* Queries
    ======= */
 
@@ -66,7 +66,24 @@ public:
     void QueueUpdate
     ( Int row, Int col, const Ring& value ) EL_NO_RELEASE_EXCEPT;
     void QueueZero( Int row, Int col ) EL_NO_RELEASE_EXCEPT;
-    void ProcessQueues();
+    // If 'sorted' is true, the queued entries are assumed to already be sorted
+    // by row and then column, so that only duplicates need to be combined
+    void ProcessQueues( bool sorted=false );
+
+    // Bulk ingestion
+    // ^^^^^^^^^^^^^^
+    // Queue a batch of updates stored in coordinate (COO) format, where END
+    // may be used to refer to the last row or column
+    void QueueUpdates
+    ( Int numEntries, const Int* rows, const Int* cols, const Ring* values );
+    // Overwrite the matrix with the compressed sparse row (CSR) arrays
+    // (rowOffsets, cols, values), where 'rowOffsets' is of length height+1 and
+    // the entries of row i lie in [rowOffsets[i],rowOffsets[i+1]). If the
+    // column indices of each row are strictly increasing, the arrays are
+    // copied directly into place and no sorting is performed.
+    void ImportCSR
+    ( Int height, Int width,
+      const Int* rowOffsets, const Int* cols, const Ring* values );
 
     // Operator overloading
     // ====================
@@ -414,7 +414,7 @@ void SparseMatrix<Ring>::ForceConsistency( bool consistent ) EL_NO_EXCEPT
 // ==================
 
 template<typename Ring>
-void SparseMatrix<Ring>::ProcessQueues()
+void SparseMatrix<Ring>::ProcessQueues( bool sorted )
 {
     EL_DEBUG_CSE
     EL_DEBUG_ONLY(
@@ -425,64 +425,100 @@ void SparseMatrix<Ring>::ProcessQueues()
     if( graph_.consistent_ )
         return;
 
-    Int numRemoved = 0;
-    const Int numEntries = vals_.size();
-    vector<Entry<Ring>> entries( numEntries );
-    if( graph_.markedForRemoval_.size() != 0 )
+    assembly::RemoveMarked
+    ( graph_.sources_, graph_.targets_, &vals_, graph_.markedForRemoval_ );
+    assembly::Consolidate
+    ( graph_.numSources_, Int(0), graph_.sources_, graph_.targets_, &vals_,
+      graph_.sourceOffsets_, sorted );
+    graph_.consistent_ = true;
+}
+
+template<typename Ring>
+void SparseMatrix<Ring>::QueueUpdates
+( Int numEntries, const Int* rows, const Int* cols, const Ring* values )
+{
+    EL_DEBUG_CSE
+    if( FrozenSparsity() )
     {
-        for( Int s=0; s<numEntries; ++s )
-        {
-            pair<Int,Int> candidate(graph_.sources_[s],graph_.targets_[s]);
-            if( graph_.markedForRemoval_.find(candidate) ==
-                graph_.markedForRemoval_.end() )
-            {
-                entries[s-numRemoved].i = graph_.sources_[s];
-                entries[s-numRemoved].j = graph_.targets_[s];
-                entries[s-numRemoved].value = vals_[s];
-            }
-            else
-            {
-                ++numRemoved;
-            }
-        }
-        graph_.markedForRemoval_.clear();
-        entries.resize( numEntries-numRemoved );
+        for( Int e=0; e<numEntries; ++e )
+            QueueUpdate( rows[e], cols[e], values[e] );
+        return;
     }
-    else
+    if( numEntries == 0 )
+        return;
+    const Int height = Height();
+    const Int width = Width();
+    const Int oldSize = graph_.sources_.size();
+    graph_.sources_.resize( oldSize+numEntries );
+    graph_.targets_.resize( oldSize+numEntries );
+    Int* sourceBuf = &graph_.sources_[oldSize];
+    Int* targetBuf = &graph_.targets_[oldSize];
+    for( Int e=0; e<numEntries; ++e )
     {
-        for( Int s=0; s<numEntries; ++s )
-            entries[s] =
-              Entry<Ring>{graph_.sources_[s],graph_.targets_[s],vals_[s]};
+        const Int row = ( rows[e] == END ? height-1 : rows[e] );
+        const Int col = ( cols[e] == END ? width-1 : cols[e] );
+        EL_DEBUG_ONLY(
+          if( row < 0 || row >= height || col < 0 || col >= width )
+              LogicError
+              ("Entry (",row,",",col,") is out of bounds of ",
+               height," x ",width," matrix");
+        )
+        sourceBuf[e] = row;
+        targetBuf[e] = col;
     }
-    CompareEntriesFunctor comparer;
-    std::sort( entries.begin(), entries.end(), comparer );
-    const Int numSorted = entries.size();
+    vals_.insert( vals_.end(), values, values+numEntries );
+    graph_.consistent_ = false;
+}
 
-    // Compress out duplicates
-    Int lastUnique=0;
-    for( Int s=1; s<numSorted; ++s )
+template<typename Ring>
+void SparseMatrix<Ring>::ImportCSR
+( Int height, Int width,
+  const Int* rowOffsets, const Int* cols, const Ring* values )
+{
+    EL_DEBUG_CSE
+    Empty( false );
+    Resize( height, width );
+
+    const Int firstOffset = rowOffsets[0];
+    const Int numEntries = rowOffsets[height] - firstOffset;
+    graph_.targets_.assign
+    ( cols+firstOffset, cols+firstOffset+numEntries );
+    vals_.assign( values+firstOffset, values+firstOffset+numEntries );
+    graph_.sources_.resize( numEntries );
+    graph_.sourceOffsets_.resize( height+1 );
+
+    const Int* targetBuf = graph_.targets_.data();
+    bool sorted = true;
+    for( Int i=0; i<height; ++i )
     {
-        if( entries[s].i != entries[lastUnique].i ||
-            entries[s].j != entries[lastUnique].j )
-            entries[++lastUnique] = entries[s];
-        else
-            entries[lastUnique].value += entries[s].value;
+        const Int rowBeg = rowOffsets[i] - firstOffset;
+        const Int rowEnd = rowOffsets[i+1] - firstOffset;
+        EL_DEBUG_ONLY(
+          if( rowEnd < rowBeg )
+              LogicError("Row offsets were not non-decreasing");
+          for( Int e=rowBeg; e<rowEnd; ++e )
+              if( targetBuf[e] < 0 || targetBuf[e] >= width )
+                  LogicError("Column index ",targetBuf[e]," out of bounds");
+        )
+        graph_.sourceOffsets_[i] = rowBeg;
+        for( Int e=rowBeg; e<rowEnd; ++e )
+        {
+            graph_.sources_[e] = i;
+            if( e > rowBeg && targetBuf[e] <= targetBuf[e-1] )
+                sorted = false;
+        }
     }
-    const Int numUnique = lastUnique+1;
-    entries.resize( numUnique );
+    graph_.sourceOffsets_[height] = numEntries;
 
-    graph_.sources_.resize( numUnique );
-    graph_.targets_.resize( numUnique );
-    vals_.resize( numUnique );
-    for( Int s=0; s<numUnique; ++s )
+    if( sorted )
     {
-        graph_.sources_[s] = entries[s].i;
-        graph_.targets_[s] = entries[s].j;
-        vals_[s] = entries[s].value;
+        graph_.consistent_ = true;
+    }
+    else
+    {
+        graph_.consistent_ = false;
+        ProcessQueues();
     }
-
-    graph_.ComputeSourceOffsets();
-    graph_.consistent_ = true;
 }
 
 template<typename Ring>
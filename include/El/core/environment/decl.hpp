@@ -242,14 +242,31 @@ EL_DEBUG_ONLY(
     void EnableTracing();
     void DisableTracing();
 
-    void PushCallStack( string s );
+    // Each thread maintains its own call stack of (compile-time) function
+    // names within a fixed-size ring buffer, so that pushing or popping a
+    // frame is only a pointer store and a counter update. If the recursion
+    // depth exceeds the capacity of the buffer, the oldest frames are
+    // overwritten and omitted from the dump.
+    void PushCallStack( const char* s );
+    void PushCallStack( const string& s );
     void PopCallStack();
     void DumpCallStack( ostream& os=cerr );
 
+    // Only execute one in every 'period' of the (per-thread) argument checks
+    // wrapped in EL_DEBUG_SAMPLED; the default period of one executes them all
+    void SetDebugCheckPeriod( Int period );
+    Int DebugCheckPeriod();
+    bool SampleDebugCheck();
+
     class CallStackEntry
     {
     public:
-        CallStackEntry( string s )
+        CallStackEntry( const char* s )
+        {
+            if( !uncaught_exception() )
+                PushCallStack(s);
+        }
+        CallStackEntry( const string& s )
         {
             if( !uncaught_exception() )
                 PushCallStack(s);
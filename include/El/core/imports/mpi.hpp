@@ -1022,6 +1022,34 @@ EL_NO_RELEASE_EXCEPT
 template<typename T>
 void AllReduce( T* buf, int count, Comm comm ) EL_NO_RELEASE_EXCEPT;
 
+// Non-blocking single-buffer AllReduce
+// ------------------------------------
+// The result is only available after the request has been waited upon. If
+// MPI-3 non-blocking collectives are not available, a blocking AllReduce is
+// performed and the request is immediately complete.
+template<typename Real,
+         typename=EnableIf<IsPacked<Real>>>
+void IAllReduce
+( Real* buf, int count, Op op, Comm comm, Request<Real>& request )
+EL_NO_RELEASE_EXCEPT;
+template<typename Real,
+         typename=EnableIf<IsPacked<Real>>>
+void IAllReduce
+( Complex<Real>* buf, int count, Op op, Comm comm,
+  Request<Complex<Real>>& request )
+EL_NO_RELEASE_EXCEPT;
+template<typename T,
+         typename=DisableIf<IsPacked<T>>,
+         typename=void>
+void IAllReduce
+( T* buf, int count, Op op, Comm comm, Request<T>& request )
+EL_NO_RELEASE_EXCEPT;
+
+// Default to SUM
+template<typename T>
+void IAllReduce( T* buf, int count, Comm comm, Request<T>& request )
+EL_NO_RELEASE_EXCEPT;
+
 // ReduceScatter
 // -------------
 template<typename Real,
@@ -10,6 +10,7 @@
 #define EL_LAPACK_EUCLIDEANMIN_C_H
 
 #include <El/core/DistMatrix.h>
+#include <El/lapack_like/util.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -109,7 +110,17 @@ typedef struct {
 } ElSQSDCtrl_d;
 EL_EXPORT ElError ElSQSDCtrlDefault_d( ElSQSDCtrl_d* ctrl );
 
+/* The sparse least squares problems can either be solved through a
+   (regularized) augmented system or a multifrontal QR factorization, which
+   uses 'qrCtrl' to reorder the columns */
+typedef enum {
+  EL_LS_AUGMENTED,
+  EL_LS_SPARSE_QR
+} ElLeastSquaresAlg;
+
 typedef struct {
+  ElLeastSquaresAlg alg;
+  ElBisectCtrl qrCtrl;
   bool scaleTwoNorm;
   ElInt basisSize;
   float alpha;
@@ -121,6 +132,8 @@ typedef struct {
 EL_EXPORT ElError ElLeastSquaresCtrlDefault_s( ElLeastSquaresCtrl_s* ctrl );
 
 typedef struct {
+  ElLeastSquaresAlg alg;
+  ElBisectCtrl qrCtrl;
   bool scaleTwoNorm;
   ElInt basisSize;
   double alpha;
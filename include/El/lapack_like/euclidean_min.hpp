@@ -62,9 +62,26 @@ struct SQSDCtrl
     bool time=false;
 };
 
+// The sparse least squares problems can either be solved through a
+// (regularized) augmented system or a multifrontal QR factorization. The latter
+// avoids the regularization and directly handles rank deficiency, but its
+// distributed implementation assumes that R fits on a single process.
+namespace LeastSquaresAlgNS {
+enum LeastSquaresAlg {
+    LS_AUGMENTED,
+    LS_SPARSE_QR
+};
+}
+using namespace LeastSquaresAlgNS;
+
 template<typename Real>
 struct LeastSquaresCtrl
 {
+    LeastSquaresAlg alg=LS_AUGMENTED;
+
+    // Only used if 'alg' is LS_SPARSE_QR
+    BisectCtrl qrCtrl;
+
     bool scaleTwoNorm=true;
     Int basisSize=15; // only used if 'scaleTwoNorm' is true
 
@@ -79,9 +79,16 @@ inline SQSDCtrl<double> CReflect( const ElSQSDCtrl_d& ctrlC )
     return ctrl;
 }
 
+inline ElLeastSquaresAlg CReflect( LeastSquaresAlg alg )
+{ return static_cast<ElLeastSquaresAlg>(alg); }
+inline LeastSquaresAlg CReflect( ElLeastSquaresAlg alg )
+{ return static_cast<LeastSquaresAlg>(alg); }
+
 inline ElLeastSquaresCtrl_s CReflect( const LeastSquaresCtrl<float>& ctrl )
 {
     ElLeastSquaresCtrl_s ctrlC;
+    ctrlC.alg          = CReflect(ctrl.alg);
+    ctrlC.qrCtrl       = CReflect(ctrl.qrCtrl);
     ctrlC.scaleTwoNorm = ctrl.scaleTwoNorm;
     ctrlC.basisSize    = ctrl.basisSize;
     ctrlC.alpha        = ctrl.alpha; 
@@ -95,6 +102,8 @@ inline ElLeastSquaresCtrl_s CReflect( const LeastSquaresCtrl<float>& ctrl )
 inline ElLeastSquaresCtrl_d CReflect( const LeastSquaresCtrl<double>& ctrl )
 {
     ElLeastSquaresCtrl_d ctrlC;
+    ctrlC.alg          = CReflect(ctrl.alg);
+    ctrlC.qrCtrl       = CReflect(ctrl.qrCtrl);
     ctrlC.scaleTwoNorm = ctrl.scaleTwoNorm;
     ctrlC.basisSize    = ctrl.basisSize;
     ctrlC.alpha        = ctrl.alpha; 
@@ -108,6 +117,8 @@ inline ElLeastSquaresCtrl_d CReflect( const LeastSquaresCtrl<double>& ctrl )
 inline LeastSquaresCtrl<float> CReflect( const ElLeastSquaresCtrl_s& ctrlC )
 {
     LeastSquaresCtrl<float> ctrl;
+    ctrl.alg          = CReflect(ctrlC.alg);
+    ctrl.qrCtrl       = CReflect(ctrlC.qrCtrl);
     ctrl.scaleTwoNorm = ctrlC.scaleTwoNorm;
     ctrl.basisSize    = ctrlC.basisSize;
     ctrl.alpha        = ctrlC.alpha; 
@@ -121,6 +132,8 @@ inline LeastSquaresCtrl<float> CReflect( const ElLeastSquaresCtrl_s& ctrlC )
 inline LeastSquaresCtrl<double> CReflect( const ElLeastSquaresCtrl_d& ctrlC )
 {
     LeastSquaresCtrl<double> ctrl;
+    ctrl.alg          = CReflect(ctrlC.alg);
+    ctrl.qrCtrl       = CReflect(ctrlC.qrCtrl);
     ctrl.scaleTwoNorm = ctrlC.scaleTwoNorm;
     ctrl.basisSize    = ctrlC.basisSize;
     ctrl.alpha        = ctrlC.alpha; 
@@ -13,6 +13,8 @@
 #include <El/lapack_like/util.hpp>
 #include <El/lapack_like/factor/ldl/sparse/symbolic.hpp>
 #include <El/lapack_like/factor/ldl/sparse/numeric.hpp>
+#include <El/lapack_like/factor/qr/sparse.hpp>
+#include <El/lapack_like/factor/HODLR.hpp>
 
 namespace El {
 
@@ -0,0 +1,216 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_FACTOR_HODLR_HPP
+#define EL_FACTOR_HODLR_HPP
+
+// A Hierarchically Off-Diagonal Low-Rank (HODLR) representation of a dense
+// n x n matrix which is only accessed through a function returning its
+// entries, such as the discretization of a kernel or Green's function, e.g.,
+// the Cauchy matrix with
+//
+//   auto entry = [&]( Int i, Int j ) { return Field(1)/(x[i]-y[j]); };
+//
+// The index set is recursively bisected until the diagonal blocks have at most
+// 'maxLeafSize' rows, which are stored densely, while each pair of
+// off-diagonal blocks of a bisection is compressed, A(I1,I2) ~= U12 V12^H and
+// A(I2,I1) ~= U21 V21^H, with the partially-pivoted adaptive cross
+// approximation of
+//
+//   Mario Bebendorf,
+//   "Approximation of boundary element matrices",
+//   Numer. Math., Vol. 86, No. 4, pp. 565--589, 2000,
+//
+// which only evaluates O(r) rows and columns of a block of rank r. A matrix-
+// vector product therefore requires O(r n log n) work and storage.
+//
+// The factorization follows
+//
+//   Sivaram Ambikasaran and Eric Darve,
+//   "An O(N log N) fast direct solver for partial hierarchically semi-separable
+//   matrices", J. Sci. Comput., Vol. 57, No. 3, pp. 477--501, 2013,
+//
+// in that each node applies the Sherman-Morrison-Woodbury formula to the
+// block-diagonal matrix of its children (whose factorizations are applied to
+// U12 and U21) plus the low-rank update formed by its off-diagonal blocks,
+// which requires O(r^2 n log^2 n) work and allows for O(r n log n) solves.
+
+namespace El {
+
+template<typename Real>
+struct HODLRCtrl
+{
+    // Diagonal blocks of at most 'maxLeafSize' rows are stored densely
+    Int maxLeafSize=64;
+
+    // The cross approximation of an off-diagonal block stops once the norm of
+    // the latest rank-one term is at most 'relTol' times that of the
+    // approximation or its rank reaches 'maxRank' (if 'maxRank' >= 0)
+    Real relTol=Sqrt(limits::Epsilon<Real>());
+    Int maxRank=-1;
+
+    bool progress=false;
+};
+
+namespace hodlr {
+
+template<typename Field>
+struct Node
+{
+    // The rows (and columns) [beg,end) of the matrix
+    Int beg=0, end=0;
+
+    // A leaf stores its diagonal block and the block's partially-pivoted LU
+    // factorization
+    Matrix<Field> D, DFact;
+    Permutation P;
+
+    // Otherwise, with I1 and I2 the indices of the two children,
+    // A(I1,I2) ~= U12 V12^H and A(I2,I1) ~= U21 V21^H
+    unique_ptr<Node<Field>> left, right;
+    Matrix<Field> U12, V12, U21, V21;
+
+    // The factorization, Y12 = inv(A(I1,I1)) U12, Y21 = inv(A(I2,I2)) U21,
+    // and the LU factorization of the capacitance matrix
+    //
+    //   K = | I,           V12^H Y21 |
+    //       | V21^H Y12,   I         |
+    Matrix<Field> Y12, Y21, K;
+    Permutation PK;
+
+    bool Leaf() const { return !left; }
+};
+
+// A bisection of the index set between two teams of processes, where each
+// process only stores the rows it owns of the factors of that bisection
+template<typename Field>
+struct DistNode
+{
+    // The processes owning the indices of both children
+    mpi::Comm comm;
+
+    // Whether this process belongs to the first child
+    bool first=true;
+
+    // The ranks of A(I1,I2) ~= U12 V12^H and A(I2,I1) ~= U21 V21^H
+    Int rank12=0, rank21=0;
+
+    // The local rows of U12 and V21 (in the first child) or of U21 and V12
+    // (in the second child)
+    Matrix<Field> U, V;
+
+    // The local rows of inv(A(I1,I1)) U12 (or inv(A(I2,I2)) U21) and the
+    // (redundantly computed) LU factorization of the capacitance matrix
+    Matrix<Field> Y, K;
+    Permutation PK;
+};
+
+} // namespace hodlr
+
+template<typename Field>
+class HODLR
+{
+public:
+    HODLR();
+
+    // Form the compressed representation of the n x n matrix whose (i,j)
+    // entry is 'entry(i,j)'
+    HODLR
+    ( Int n,
+      const function<Field(Int,Int)>& entry,
+      const HODLRCtrl<Base<Field>>& ctrl=HODLRCtrl<Base<Field>>() );
+    void Compress
+    ( Int n,
+      const function<Field(Int,Int)>& entry,
+      const HODLRCtrl<Base<Field>>& ctrl=HODLRCtrl<Base<Field>>() );
+
+    // Y := alpha A X + beta Y
+    void Multiply
+    ( Field alpha, const Matrix<Field>& X, Field beta, Matrix<Field>& Y ) const;
+
+    void Factor();
+
+    // Overwrite B with inv(A) B
+    void Solve( Matrix<Field>& B ) const;
+
+    Int Height() const;
+    bool Factored() const;
+
+    // The largest rank of the off-diagonal blocks
+    Int MaxRank() const;
+
+    // The number of entries stored for the (unfactored) representation
+    Int NumEntries() const;
+
+    const hodlr::Node<Field>& Root() const;
+
+private:
+    Int height_=0;
+    bool factored_=false;
+    unique_ptr<hodlr::Node<Field>> root_;
+};
+
+// A HODLR matrix whose rows are distributed as those of a DistMultiVec over
+// the given grid. The leading bisections split the processes into two teams
+// (of nearly equal size) until each team is a single process, which then
+// stores its diagonal block as a sequential HODLR matrix. The off-diagonal
+// blocks shared between two teams are compressed with a distributed cross
+// approximation, where each process only evaluates the rows or columns it
+// owns, and each such bisection requires one reduction (over the union of
+// the two teams) of r vectors for a matrix-vector product or a solve.
+
+template<typename Field>
+class DistHODLR
+{
+public:
+    DistHODLR( const El::Grid& grid=El::Grid::Default() );
+    ~DistHODLR();
+
+    void Compress
+    ( Int n,
+      const function<Field(Int,Int)>& entry,
+      const HODLRCtrl<Base<Field>>& ctrl=HODLRCtrl<Base<Field>>() );
+
+    // Y := alpha A X + beta Y
+    void Multiply
+    ( Field alpha, const DistMultiVec<Field>& X,
+      Field beta,        DistMultiVec<Field>& Y ) const;
+
+    void Factor();
+
+    // Overwrite B with inv(A) B
+    void Solve( DistMultiVec<Field>& B ) const;
+
+    Int Height() const;
+    bool Factored() const;
+    Int MaxRank() const;
+    const El::Grid& Grid() const;
+
+    // The diagonal block of the rows owned by this process
+    const HODLR<Field>& LocalMatrix() const;
+
+private:
+    const El::Grid* grid_;
+    Int height_=0, maxRank_=0;
+    bool factored_=false;
+
+    HODLR<Field> local_;
+
+    // The bisections from the root down to that of this process's team
+    vector<unique_ptr<hodlr::DistNode<Field>>> nodes_;
+
+    // Overwrite the local rows B with those of inv(A_d) B, where A_d is the
+    // diagonal block owned by the team of this process at depth 'depth'
+    void SolveBelow( Int depth, Matrix<Field>& B ) const;
+
+    void FreeNodes();
+};
+
+} // namespace El
+
+#endif // ifndef EL_FACTOR_HODLR_HPP
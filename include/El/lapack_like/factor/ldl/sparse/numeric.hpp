@@ -439,7 +439,8 @@ class SparseLDLFactorization
 public:
     SparseLDLFactorization();
 
-    // Find a reordering and initialize the frontal tree.
+    // Find a reordering (nested dissection or minimum degree, as chosen by
+    // the ordering member of BisectCtrl) and initialize the frontal tree.
     void Initialize
     ( const SparseMatrix<Field>& A,
             bool hermitian=true,
@@ -552,7 +553,8 @@ class DistSparseLDLFactorization
 public:
     DistSparseLDLFactorization();
 
-    // Find a reordering and initialize the frontal tree.
+    // Find a reordering (nested dissection or minimum degree, as chosen by
+    // the ordering member of BisectCtrl) and initialize the frontal tree.
     void Initialize
     ( const DistSparseMatrix<Field>& A,
             bool hermitian=true,
@@ -50,6 +50,35 @@ void NestedDissection
         DistNodeInfo& rootInfo,
   const BisectCtrl& ctrl=BisectCtrl() );
 
+// Whether the sequential portion of a reordering should use approximate
+// minimum degree rather than nested dissection, where 'numSources' is the
+// number of vertices ordered by each of the 'numProcesses' processes
+bool UseMinimumDegree
+( Int numSources, const BisectCtrl& ctrl=BisectCtrl(), int numProcesses=1 );
+
+// Reorder with approximate minimum degree and form the tree of (relaxed)
+// fundamental supernodes of the postordered elimination tree. Subtrees with at
+// most 'ctrl.cutoff' vertices are amalgamated into sparse leaves, as are all of
+// the subtrees beneath a bounded number of nested supernodes.
+void MinimumDegree
+( const Graph& graph,
+        vector<Int>& map,
+        Separator& rootSep,
+        NodeInfo& rootInfo,
+  const BisectCtrl& ctrl=BisectCtrl() );
+
+// The same, but for a subgraph whose targets beyond its sources refer to the
+// (already reordered) indices 'off+target' of its ancestors and whose vertices
+// are mapped to the original indices by 'perm'; neither the map nor the
+// symbolic analysis is formed.
+void MinimumDegreeSubtree
+( const Graph& graph,
+  const vector<Int>& perm,
+        Separator& sep,
+        NodeInfo& info,
+        Int off,
+  const BisectCtrl& ctrl=BisectCtrl() );
+
 void NaturalNestedDissection
 ( Int nx, Int ny, Int nz,
   const Graph& graph,
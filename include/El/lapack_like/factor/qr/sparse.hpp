@@ -0,0 +1,202 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_FACTOR_QR_SPARSE_HPP
+#define EL_FACTOR_QR_SPARSE_HPP
+
+#include <El/lapack_like/factor/ldl/sparse/symbolic.hpp>
+
+// A multifrontal Householder QR factorization, A P^T = Q R, of a sparse
+// matrix, where the column permutation P is a fill-reducing ordering of the
+// graph of A^H A and R is its (upper-triangular) Cholesky factor.
+//
+// The elimination tree of the symbolic factorization of A^H A (as computed for
+// a sparse LDL^H factorization) determines the fronts: each row of A is
+// assembled into the front containing its first (reordered) column, the
+// trapezoidal update blocks of the children are stacked beneath them, and the
+// front is factored with the dense Householder QR. Q is kept implicitly as the
+// Householder reflectors of the fronts, e.g., see
+//
+//   Timothy A. Davis,
+//   "Algorithm 915, SuiteSparseQR: Multifrontal multithreaded rank-revealing
+//    sparse QR factorization",
+//   ACM Trans. Math. Softw., 38(1), 2011.
+//
+// The vectors of coefficients against R, such as the leading n rows of Q^H B,
+// are indexed by the reordered columns. A column whose remaining norm within
+// its front is negligible (relative to the largest column norm of A, see
+// 'SetRankTolerance') is marked as dependent and does not consume a row of R,
+// as in SuiteSparseQR, and its coefficient is set to zero, which yields a
+// basic solution for rank-deficient problems.
+
+namespace El {
+
+namespace qr {
+
+template<typename Field>
+struct SparseFront
+{
+    // The rows of A whose first reordered column lies within this front
+    vector<Int> rows;
+
+    // The Householder QR of the front, which is stacked as the above rows of A
+    // followed by the update blocks of the children
+    Matrix<Field> F;
+    Matrix<Field> householderScalars;
+    Matrix<Base<Field>> signature;
+
+    // The relative index of the column eliminated by each pivot, with the
+    // dependent columns of the front placed after the independent ones
+    vector<Int> pivotOrder;
+
+    // The number of rows of R produced by this front and the number of rows of
+    // the update block passed to the parent
+    Int numPivots=0;
+    Int numUpdates=0;
+
+    SparseFront<Field>* parent=nullptr;
+    vector<unique_ptr<SparseFront<Field>>> children;
+
+    SparseFront( SparseFront<Field>* parentNode=nullptr );
+};
+
+} // namespace qr
+
+template<typename Field>
+class SparseQRFactorization
+{
+public:
+    SparseQRFactorization();
+
+    // Reorder the columns of A and form its implicit QR factorization
+    void Factor
+    ( const SparseMatrix<Field>& A,
+      const BisectCtrl& bisectCtrl=BisectCtrl() );
+
+    // Return the (height(A) x k) matrix Q [C; 0], where C is width(A) x k
+    void ApplyQ( const Matrix<Field>& C, Matrix<Field>& B ) const;
+
+    // Return the leading width(A) x k block of Q^H B
+    void ApplyAdjointQ( const Matrix<Field>& B, Matrix<Field>& C ) const;
+
+    // Overwrite C with 'inv(R) C' or 'inv(R)^H C'
+    void SolveAgainstR( Orientation orientation, Matrix<Field>& C ) const;
+
+    // Overwrite C with 'P^T C' (from the reordered to the original column
+    // indices) or 'P C'
+    void PermuteToOriginal( Matrix<Field>& C ) const;
+    void PermuteToReordered( Matrix<Field>& C ) const;
+
+    // Solve min_X || A X - B ||_F
+    void LeastSquares( const Matrix<Field>& B, Matrix<Field>& X ) const;
+
+    // Solve min_X || X ||_F subject to A^H X = B
+    void MinimumNorm( const Matrix<Field>& B, Matrix<Field>& X ) const;
+
+    // Return R, with rows indexed by the reordered columns and columns by the
+    // original columns, so that R^H R = A^H A
+    void ExplicitR( SparseMatrix<Field>& R ) const;
+
+    // Columns whose remaining norms have magnitude at most tol times the
+    // largest column norm of A are treated as dependent
+    void SetRankTolerance( Base<Field> tol );
+    Int Rank() const;
+
+    Int Height() const;
+    Int Width() const;
+    bool Factored() const;
+    Int NumEntries() const;
+
+    const ldl::NodeInfo& NodeInfo() const;
+    const qr::SparseFront<Field>& Front() const;
+    const vector<Int>& Map() const;
+    const vector<Int>& InverseMap() const;
+
+private:
+    bool factored_=false;
+    Int height_=0, width_=0;
+    Base<Field> rankTol_=0, maxColNorm_=0;
+
+    unique_ptr<qr::SparseFront<Field>> front_;
+    unique_ptr<ldl::NodeInfo> info_;
+    unique_ptr<ldl::Separator> separator_;
+
+    vector<Int> map_, inverseMap_;
+
+    Base<Field> DependenceTolerance() const;
+    bool Dependent( const Field& diagonal ) const;
+};
+
+// A QR factorization of a tall DistSparseMatrix in the manner of a
+// Tall-Skinny QR: the block of rows owned by each process is factored with
+// the sequential multifrontal QR, and then pairs of the resulting triangular
+// factors are stacked and refactored up a binary tree whose root is the first
+// process. Each process keeps its local factorization and those of the tree
+// nodes it combined, so that Q (and Q^H) can be applied with one message per
+// tree level.
+//
+// This assumes that R (whose pattern is that of the Cholesky factor of A^H A)
+// fits in the memory of a single process, as is the case for the least
+// squares problems of regressions with many more rows than columns.
+
+template<typename Field>
+class DistSparseQRFactorization
+{
+public:
+    DistSparseQRFactorization();
+
+    void Factor
+    ( const DistSparseMatrix<Field>& A,
+      const BisectCtrl& bisectCtrl=BisectCtrl() );
+
+    // Solve min_X || A X - B ||_F, where B is distributed like the rows of A
+    void LeastSquares
+    ( const DistMultiVec<Field>& B, DistMultiVec<Field>& X ) const;
+
+    // Solve min_X || X ||_F subject to A^H X = B, where X is distributed like
+    // the rows of A
+    void MinimumNorm
+    ( const DistMultiVec<Field>& B, DistMultiVec<Field>& X ) const;
+
+    void SetRankTolerance( Base<Field> tol );
+
+    Int Height() const;
+    Int Width() const;
+    bool Factored() const;
+
+    // The factorization of the local rows
+    const SparseQRFactorization<Field>& LocalFactorization() const;
+
+private:
+    bool factored_=false;
+    Int height_=0, width_=0;
+    Base<Field> rankTol_=0;
+    const Grid* grid_=nullptr;
+
+    SparseQRFactorization<Field> localFact_;
+
+    // The combined factorizations (and the partners whose factors were
+    // received) at each level of the tree which this process participated in
+    vector<unique_ptr<SparseQRFactorization<Field>>> combinedFacts_;
+    vector<int> partners_;
+
+    // The process which this process sent its factor to (or -1 for the root)
+    int parent_=-1;
+
+    // Overwrite C with the width(A) x k coefficients of the root, which are
+    // only returned on the root process
+    void ReduceAdjointQ( const Matrix<Field>& BLoc, Matrix<Field>& C ) const;
+    // The reverse, starting from the coefficients C on the root process
+    void ExpandQ( const Matrix<Field>& C, Matrix<Field>& BLoc ) const;
+
+    const SparseQRFactorization<Field>& RootFactorization() const;
+};
+
+} // namespace El
+
+#endif // ifndef EL_FACTOR_QR_SPARSE_HPP
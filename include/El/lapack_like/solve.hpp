@@ -248,8 +248,14 @@ void MultiShiftHessSolve
 
 } // namespace El
 
+#include <El/lapack_like/solve/Krylov.hpp>
+#include <El/lapack_like/solve/AMG.hpp>
+#include <El/lapack_like/solve/BiCGStab.hpp>
 #include <El/lapack_like/solve/FGMRES.hpp>
+#include <El/lapack_like/solve/GMRES.hpp>
 #include <El/lapack_like/solve/LGMRES.hpp>
+#include <El/lapack_like/solve/MINRES.hpp>
+#include <El/lapack_like/solve/PCG.hpp>
 #include <El/lapack_like/solve/Refined.hpp>
 
 #endif // ifndef EL_SOLVE_HPP
@@ -0,0 +1,155 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_SOLVE_AMG_HPP
+#define EL_SOLVE_AMG_HPP
+
+// A smoothed aggregation algebraic multigrid preconditioner for Hermitian
+// positive-definite sparse matrices, e.g., see
+//
+//   Petr Vanek, Jan Mandel, and Marian Brezina,
+//   "Algebraic multigrid by smoothed aggregation for second and fourth order
+//   elliptic problems", Computing, Vol. 56, No. 3, pp. 179--196, 1996.
+//
+// The rows of level l are grouped into aggregates of strongly-connected rows,
+// where a_ij is a strong connection if |a_ij| >= theta_l sqrt(|a_ii a_jj|)
+// with theta_l = theta (1/2)^l, so that the increasingly dense coarse
+// operators continue to coarsen. The aggregation is uncoupled, i.e., each
+// process only aggregates its own rows using the strong connections between
+// them, so that the setup does not require any communication beyond the
+// sparse matrix products. The tentative prolongator injects the (normalized)
+// constant vector into each aggregate and is smoothed with one damped Jacobi
+// step,
+//
+//   P = (I - omega/lambda_max inv(D) A) T,
+//
+// and the coarse operator is the Galerkin product P^H A P. Once the operator
+// is small enough (or coarsening stalls), it is factored with the sparse-direct
+// LDL^H factorization.
+//
+// The preconditioner applies one V-cycle with polynomial (damped Jacobi or
+// Chebyshev) smoothing in inv(D) A, which is symmetric, so it may be used
+// within PCG (or MINRES). Since it has the form of a preconditioner
+// functional, it can be passed directly as the 'precond' argument of the
+// Krylov solvers, e.g.,
+//
+//   DistAMG<Field> amg;
+//   amg.Setup( A );
+//   auto applyA =
+//     [&]( Field alpha, const DistMultiVec<Field>& X,
+//          Field beta,        DistMultiVec<Field>& Y )
+//     { Multiply( NORMAL, alpha, A, X, beta, Y ); };
+//   PCG( applyA, amg, B, relTol, maxIts, progress );
+
+namespace El {
+
+namespace AMGSmootherNS {
+enum AMGSmoother {
+  AMG_JACOBI,
+  AMG_CHEBYSHEV
+};
+}
+using namespace AMGSmootherNS;
+
+template<typename Real>
+struct AMGCtrl
+{
+    // The threshold, theta, for strong connections on the finest level, which
+    // is halved on each coarser level
+    Real strengthTol=Real(0.08);
+
+    // The prolongator is smoothed with the damping omega/lambda_max, where
+    // lambda_max is an estimate of the spectral radius of inv(D) A from
+    // 'numPowerIts' steps of the power method
+    Real prolongatorDamping=Real(4)/Real(3);
+    Int numPowerIts=10;
+
+    // The number of Jacobi sweeps (or the degree of the Chebyshev polynomial)
+    // before and after each coarse-grid correction. Jacobi uses the damping
+    // 'jacobiDamping'/lambda_max, while Chebyshev targets the interval
+    // [lambda_max/chebyshevRatio,lambda_max] (with lambda_max inflated by 10%
+    // since the power method underestimates it).
+    AMGSmoother smoother=AMG_CHEBYSHEV;
+    Int numSmoothingSteps=2;
+    Real jacobiDamping=Real(4)/Real(3);
+    Real chebyshevRatio=Real(30);
+
+    // Coarsening stops once the operator has at most 'maxCoarseSize' rows or
+    // there are 'maxLevels' levels
+    Int maxCoarseSize=1000;
+    Int maxLevels=10;
+
+    bool progress=false;
+};
+
+namespace amg {
+
+template<typename Field>
+struct Level
+{
+    DistSparseMatrix<Field> A;
+
+    // The inverse of the local diagonal of A
+    Matrix<Field> invDiag;
+
+    // An estimate of the spectral radius of inv(D) A
+    Base<Field> lambdaMax=0;
+
+    // The prolongator from the next coarser level and its adjoint
+    DistSparseMatrix<Field> P, R;
+
+    Level( const El::Grid& grid );
+};
+
+} // namespace amg
+
+template<typename Field>
+class DistAMG
+{
+public:
+    DistAMG();
+
+    // Form the hierarchy of coarse operators and factor the coarsest one
+    void Setup
+    ( const DistSparseMatrix<Field>& A,
+      const AMGCtrl<Base<Field>>& ctrl=AMGCtrl<Base<Field>>() );
+
+    // Overwrite B with the result of applying one V-cycle to it (with a zero
+    // initial guess), which approximates inv(A) B
+    void Apply( DistMultiVec<Field>& B ) const;
+    void operator()( DistMultiVec<Field>& B ) const;
+
+    Int NumLevels() const;
+
+    // The total number of nonzeros over all of the levels relative to that of
+    // the original operator
+    double OperatorComplexity() const;
+
+    const DistSparseMatrix<Field>& Operator( Int level ) const;
+    const DistSparseMatrix<Field>& Prolongator( Int level ) const;
+
+private:
+    AMGCtrl<Base<Field>> ctrl_;
+    vector<unique_ptr<amg::Level<Field>>> levels_;
+    unique_ptr<DistSparseLDLFactorization<Field>> coarseFact_;
+    double operatorComplexity_=0;
+
+    void Cycle
+    ( Int level,
+      const DistMultiVec<Field>& B,
+            DistMultiVec<Field>& X ) const;
+    void Smooth
+    ( const amg::Level<Field>& level,
+      const DistMultiVec<Field>& B,
+            DistMultiVec<Field>& X,
+            bool zeroInit ) const;
+};
+
+} // namespace El
+
+#endif // ifndef EL_SOLVE_AMG_HPP
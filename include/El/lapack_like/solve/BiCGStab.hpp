@@ -0,0 +1,178 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_SOLVE_BICGSTAB_HPP
+#define EL_SOLVE_BICGSTAB_HPP
+
+// The right-preconditioned Biconjugate Gradient Stabilized method for general
+// square systems, e.g., see
+//   Henk A. van der Vorst,
+//   "Bi-CGSTAB: A fast and smoothly converging variant of Bi-CG for the
+//   solution of nonsymmetric linear systems",
+//   SIAM J. Sci. Stat. Comput., Vol. 13, No. 2, pp. 631--644, 1992.
+//
+// The textbook formulation requires four blocking reductions per iteration.
+// Here they are fused into two: the inner product of the shadow residual with
+// A inv(M) p is summed along with the norm of the current residual, and the
+// inner products defining the stabilization parameter are summed along with
+// those that (by linearity) define the next Bi-CG coefficient. As a result,
+// convergence of the final iterate is only detected after one more
+// application of the preconditioner and the operator.
+
+namespace El {
+
+namespace bicgstab {
+
+// See Krylov.hpp for the requirements on 'applyA' and 'precond'.
+//
+// If the relative residual norm does not drop below 'relTol' within 'maxIts'
+// iterations, a RuntimeError is thrown and b is left unchanged.
+
+template<typename Field,class VecType,class ApplyAType,class PrecondType>
+Int Single
+( const ApplyAType& applyA,
+  const PrecondType& precond,
+        VecType& b,
+        Base<Field> relTol,
+        Int maxIts,
+        bool progress )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( b.Width() != 1 )
+          LogicError("Expected a single right-hand side");
+    )
+    typedef Base<Field> Real;
+    const Int n = b.Height();
+
+    const Real origResidNorm = FrobeniusNorm( b );
+    if( progress )
+        Output("origResidNorm: ",origResidNorm);
+    if( origResidNorm == Real(0) )
+        return 0;
+
+    // x := 0, r := b, rHat := b, p := 0, v := 0
+    VecType x(b), r(b), rHat(b), p(b), v(b), pHat(b), sHat(b), t(b);
+    Zeros( x, n, 1 );
+    Zeros( p, n, 1 );
+    Zeros( v, n, 1 );
+    krylov::Reduction<Field> reduction( krylov::ReductionComm(b) );
+
+    Field rho = origResidNorm*origResidNorm, rhoOld=1, alpha=1, omega=1;
+    Int iter=0;
+    while( true )
+    {
+        // p := r + (rho/rho_old)(alpha/omega) (p - omega v)
+        const Field beta = (rho/rhoOld)*(alpha/omega);
+        Entrywise(p) =
+          Entrywise(r) + beta*(Entrywise(p) - omega*Entrywise(v));
+
+        // v := A inv(M) p
+        pHat = p;
+        precond( pHat );
+        applyA( Field(1), pHat, Field(0), v );
+
+        // Sum rHat' v and || r ||_2^2
+        reduction.Clear();
+        const Int rHatVIndex = reduction.AddDot( rHat, v );
+        const Int rrIndex = reduction.AddDot( r, r );
+        reduction.Sum();
+        const Real relResidNorm =
+          Sqrt(RealPart(reduction[rrIndex])) / origResidNorm;
+        if( iter > 0 && progress )
+            Output("iter ",iter,": relative residual norm ",relResidNorm);
+        if( relResidNorm <= relTol )
+            break;
+        if( iter >= maxIts )
+            RuntimeError("BiCGStab did not converge");
+        const Field rHatV = reduction[rHatVIndex];
+        if( rHatV == Field(0) )
+            RuntimeError("BiCGStab broke down since rHat' A inv(M) p = 0");
+
+        // s := r - alpha v (overwriting r), t := A inv(M) s
+        alpha = rho / rHatV;
+        Axpy( -alpha, v, r );
+        sHat = r;
+        precond( sHat );
+        applyA( Field(1), sHat, Field(0), t );
+        ++iter;
+
+        // Sum t' s, t' t, s' s, rHat' s, and rHat' t
+        reduction.Clear();
+        const Int tsIndex = reduction.AddDot( t, r );
+        const Int ttIndex = reduction.AddDot( t, t );
+        const Int ssIndex = reduction.AddDot( r, r );
+        const Int rHatSIndex = reduction.AddDot( rHat, r );
+        const Int rHatTIndex = reduction.AddDot( rHat, t );
+        reduction.Sum();
+        const Real sNorm = Sqrt(RealPart(reduction[ssIndex]));
+        if( sNorm / origResidNorm <= relTol )
+        {
+            // x := x + alpha inv(M) p
+            Axpy( alpha, pHat, x );
+            if( progress )
+                Output
+                ("iter ",iter,": relative residual norm ",sNorm/origResidNorm);
+            break;
+        }
+        const Real tt = RealPart(reduction[ttIndex]);
+        if( tt == Real(0) )
+            RuntimeError("BiCGStab broke down since A inv(M) s = 0");
+
+        // x := x + alpha inv(M) p + omega inv(M) s, r := s - omega t
+        omega = reduction[tsIndex] / tt;
+        Entrywise(x) += alpha*Entrywise(pHat) + omega*Entrywise(sHat);
+        Axpy( -omega, t, r );
+
+        // rho := rHat' r = rHat' s - omega rHat' t
+        rhoOld = rho;
+        rho = reduction[rHatSIndex] - omega*reduction[rHatTIndex];
+        if( rho == Field(0) || omega == Field(0) )
+            RuntimeError("BiCGStab broke down");
+    }
+    b = x;
+    return iter;
+}
+
+} // namespace bicgstab
+
+template<typename Field,class ApplyAType,class PrecondType>
+Int BiCGStab
+( const ApplyAType& applyA,
+  const PrecondType& precond,
+        Matrix<Field>& B,
+        Base<Field> relTol,
+        Int maxIts,
+        bool progress )
+{
+    EL_DEBUG_CSE
+    return krylov::ColumnByColumn
+    ( B, [&]( Matrix<Field>& b )
+         { return bicgstab::Single<Field>
+                  ( applyA, precond, b, relTol, maxIts, progress ); } );
+}
+
+template<typename Field,class ApplyAType,class PrecondType>
+Int BiCGStab
+( const ApplyAType& applyA,
+  const PrecondType& precond,
+        DistMultiVec<Field>& B,
+        Base<Field> relTol,
+        Int maxIts,
+        bool progress )
+{
+    EL_DEBUG_CSE
+    return krylov::ColumnByColumn
+    ( B, [&]( DistMultiVec<Field>& b )
+         { return bicgstab::Single<Field>
+                  ( applyA, precond, b, relTol, maxIts, progress ); } );
+}
+
+} // namespace El
+
+#endif // ifndef EL_SOLVE_BICGSTAB_HPP
@@ -0,0 +1,232 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_SOLVE_GMRES_HPP
+#define EL_SOLVE_GMRES_HPP
+
+// Restarted, right-preconditioned GMRES, e.g., see "Algorithm 9.5" of
+//   Yousef Saad
+//   "Iterative Methods for Sparse Linear Systems", 2nd edition, SIAM, 2003.
+//
+// Unlike FGMRES, which orthogonalizes with Modified Gram-Schmidt (and
+// therefore performs one blocking reduction per basis vector), each Arnoldi
+// step orthogonalizes with Classical Gram-Schmidt, where the projections onto
+// the basis and the norm of the new vector are summed in a single reduction
+// and the norm of the projected vector follows from the Pythagorean identity,
+// || w - V h ||_2^2 = || w ||_2^2 - || h ||_2^2. A second pass (and
+// reduction) is only performed when the first removed more than half of the
+// squared norm (the criterion of Daniel, Gragg, Kaufman, and Stewart), so
+// that typically a single reduction is required per iteration.
+
+namespace El {
+
+namespace gmres {
+
+// See Krylov.hpp for the requirements on 'applyA' and 'precond'.
+//
+// If the relative residual norm does not drop below 'relTol' within 'maxIts'
+// iterations, a RuntimeError is thrown and b is left unchanged.
+
+template<typename Field,class VecType,class ApplyAType,class PrecondType>
+Int Single
+( const ApplyAType& applyA,
+  const PrecondType& precond,
+        VecType& b,
+        Base<Field> relTol,
+        Int restart,
+        Int maxIts,
+        bool progress )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( b.Width() != 1 )
+          LogicError("Expected a single right-hand side");
+    )
+    typedef Base<Field> Real;
+    const Int n = b.Height();
+    if( restart < 1 )
+        LogicError("The GMRES restart parameter must be positive");
+
+    const Real origResidNorm = FrobeniusNorm( b );
+    if( progress )
+        Output("origResidNorm: ",origResidNorm);
+    if( origResidNorm == Real(0) )
+        return 0;
+
+    // x := 0, w := b (= b - A x)
+    VecType x(b), w(b), z(b);
+    Zeros( x, n, 1 );
+    vector<VecType> V(restart+1,b);
+    krylov::Reduction<Field> reduction( krylov::ReductionComm(b) );
+
+    Matrix<Real> cs;
+    Matrix<Field> sn, H, t;
+    Real residNorm = origResidNorm;
+    Int iter=0;
+    bool converged = false;
+    while( !converged )
+    {
+        // v_0 := w / || w ||_2, t := || w ||_2 e_0
+        V[0] = w;
+        V[0] *= Field(1/residNorm);
+        Zeros( t, restart+1, 1 );
+        t(0) = residNorm;
+        Zeros( H, restart, restart );
+        Zeros( cs, restart, 1 );
+        Zeros( sn, restart, 1 );
+
+        Int numBasis = 0;
+        for( Int j=0; j<restart; ++j )
+        {
+            // w := A inv(M) v_j
+            z = V[j];
+            precond( z );
+            applyA( Field(1), z, Field(0), w );
+
+            // Orthogonalize w against V_j and compute delta := || w ||_2
+            Real delta;
+            for( Int pass=0; ; ++pass )
+            {
+                reduction.Clear();
+                for( Int i=0; i<=j; ++i )
+                    reduction.AddDot( V[i], w );
+                const Int wwIndex = reduction.AddDot( w, w );
+                reduction.Sum();
+
+                Real hNormSquared = 0;
+                for( Int i=0; i<=j; ++i )
+                {
+                    const Field eta = reduction[i];
+                    H(i,j) += eta;
+                    Axpy( -eta, V[i], w );
+                    hNormSquared += RealPart(Conj(eta)*eta);
+                }
+                const Real wNormSquared = RealPart(reduction[wwIndex]);
+                const Real deltaSquared = wNormSquared - hNormSquared;
+                if( deltaSquared > wNormSquared/2 )
+                {
+                    delta = Sqrt( deltaSquared );
+                    break;
+                }
+                if( pass == 1 )
+                {
+                    // The identity suffered from cancellation
+                    delta = FrobeniusNorm( w );
+                    break;
+                }
+            }
+            if( !limits::IsFinite(delta) )
+                RuntimeError("Arnoldi step produced a non-finite number");
+            if( delta != Real(0) )
+            {
+                V[j+1] = w;
+                V[j+1] *= Field(1/delta);
+            }
+
+            // Apply the existing rotations to the new column of H
+            for( Int i=0; i<j; ++i )
+            {
+                const Real& c = cs(i);
+                const Field& s = sn(i);
+                const Field eta_i_j = H(i,j);
+                const Field eta_ip1_j = H(i+1,j);
+                H(i,  j) =  c      *eta_i_j + s*eta_ip1_j;
+                H(i+1,j) = -Conj(s)*eta_i_j + c*eta_ip1_j;
+            }
+
+            // Generate and apply a new rotation to both H and t
+            Real c;
+            Field s;
+            H(j,j) = Givens( H(j,j), Field(delta), c, s );
+            cs(j) = c;
+            sn(j) = s;
+            const Field tau_j = t(j);
+            const Field tau_jp1 = t(j+1);
+            t(j)   =  c      *tau_j + s*tau_jp1;
+            t(j+1) = -Conj(s)*tau_j + c*tau_jp1;
+            numBasis = j+1;
+            ++iter;
+
+            const Real relResidNorm = Abs(t(j+1)) / origResidNorm;
+            if( progress )
+                Output("iter ",iter,": relative residual norm ",relResidNorm);
+            if( relResidNorm <= relTol || delta == Real(0) )
+            {
+                converged = true;
+                break;
+            }
+            if( iter >= maxIts )
+                RuntimeError("GMRES did not converge");
+        }
+
+        // x := x + inv(M) V_j y, where y minimizes || t - H_j y ||_2
+        auto y = t( IR(0,numBasis), ALL );
+        auto HTL = H( IR(0,numBasis), IR(0,numBasis) );
+        Trsv( UPPER, NORMAL, NON_UNIT, HTL, y );
+        z = V[0];
+        z *= y(0);
+        for( Int i=1; i<numBasis; ++i )
+            Axpy( y(i), V[i], z );
+        precond( z );
+        x += z;
+
+        if( !converged )
+        {
+            // w := b - A x
+            w = b;
+            applyA( Field(-1), x, Field(1), w );
+            residNorm = FrobeniusNorm( w );
+            if( residNorm / origResidNorm <= relTol )
+                converged = true;
+        }
+    }
+    b = x;
+    return iter;
+}
+
+} // namespace gmres
+
+template<typename Field,class ApplyAType,class PrecondType>
+Int GMRES
+( const ApplyAType& applyA,
+  const PrecondType& precond,
+        Matrix<Field>& B,
+        Base<Field> relTol,
+        Int restart,
+        Int maxIts,
+        bool progress )
+{
+    EL_DEBUG_CSE
+    return krylov::ColumnByColumn
+    ( B, [&]( Matrix<Field>& b )
+         { return gmres::Single<Field>
+                  ( applyA, precond, b, relTol, restart, maxIts,
+                    progress ); } );
+}
+
+template<typename Field,class ApplyAType,class PrecondType>
+Int GMRES
+( const ApplyAType& applyA,
+  const PrecondType& precond,
+        DistMultiVec<Field>& B,
+        Base<Field> relTol,
+        Int restart,
+        Int maxIts,
+        bool progress )
+{
+    EL_DEBUG_CSE
+    return krylov::ColumnByColumn
+    ( B, [&]( DistMultiVec<Field>& b )
+         { return gmres::Single<Field>
+                  ( applyA, precond, b, relTol, restart, maxIts,
+                    progress ); } );
+}
+
+} // namespace El
+
+#endif // ifndef EL_SOLVE_GMRES_HPP
@@ -0,0 +1,168 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_SOLVE_KRYLOV_HPP
+#define EL_SOLVE_KRYLOV_HPP
+
+// Utilities shared by the Krylov subspace methods (PCG, MINRES, BiCGStab,
+// and GMRES). Each method is written once in terms of a vector type, VecType,
+// which may be a Matrix, a DistMultiVec, or a non-redundant AbstractDistMatrix
+// (e.g., a [VC,STAR] column vector). Since the latency of the global
+// reductions behind the inner products, rather than the bandwidth of the
+// matrix-vector products, limits the scalability of these methods, every
+// inner product is formed from local contributions which are summed in as few
+// (fused) reductions as possible -- and, for the pipelined methods, without
+// blocking, so that the reduction overlaps the application of the operator
+// and the preconditioner.
+//
+// In what follows, 'applyA' should be a function of the form
+//
+//   void applyA( Field alpha, const VecType& x, Field beta, VecType& y )
+//
+// and overwrite y := alpha A x + beta y, while 'precond' should have the form
+//
+//   void precond( VecType& b )
+//
+// and overwrite b with an approximation of inv(A) b.
+
+namespace El {
+namespace krylov {
+
+template<typename Field>
+const Matrix<Field>& LockedLocal( const Matrix<Field>& x )
+{ return x; }
+
+template<typename Field>
+const Matrix<Field>& LockedLocal( const DistMultiVec<Field>& x )
+{ return x.LockedMatrix(); }
+
+template<typename Field>
+const Matrix<Field>& LockedLocal( const AbstractDistMatrix<Field>& x )
+{ return x.LockedMatrix(); }
+
+// The communicator over which the local contributions to an inner product
+// must be summed
+template<typename Field>
+mpi::Comm ReductionComm( const Matrix<Field>& x )
+{ return mpi::COMM_SELF; }
+
+template<typename Field>
+mpi::Comm ReductionComm( const DistMultiVec<Field>& x )
+{ return x.Grid().Comm(); }
+
+template<typename Field>
+mpi::Comm ReductionComm( const AbstractDistMatrix<Field>& x )
+{
+    if( x.RedundantSize() != 1 || x.CrossSize() != 1 )
+        LogicError("Krylov vectors cannot be redundantly distributed");
+    return x.DistComm();
+}
+
+// A set of inner products whose local contributions are summed with a single
+// reduction, e.g.,
+//
+//   Reduction<Field> reduction( ReductionComm(r) );
+//   const Int rr = reduction.AddDot( r, r );
+//   const Int ru = reduction.AddDot( r, u );
+//   reduction.Start();
+//   ... (work which does not depend upon the inner products)
+//   reduction.Finish();
+//   ... reduction[rr], reduction[ru] ...
+template<typename Field>
+class Reduction
+{
+public:
+    explicit Reduction( mpi::Comm comm ) : comm_(comm) { }
+
+    // Queue the local contribution to x^H y and return its index
+    template<class VecType>
+    Int AddDot( const VecType& x, const VecType& y )
+    {
+        values_.push_back( Dot( LockedLocal(x), LockedLocal(y) ) );
+        return values_.size()-1;
+    }
+
+    // Begin a non-blocking summation of the queued contributions
+    void Start()
+    {
+        mpi::IAllReduce( values_.data(), values_.size(), comm_, request_ );
+        started_ = true;
+    }
+
+    // Complete the summation begun by Start()
+    void Finish()
+    {
+        if( started_ )
+            mpi::Wait( request_ );
+        started_ = false;
+    }
+
+    // Sum the queued contributions in a single blocking reduction
+    void Sum() { mpi::AllReduce( values_.data(), values_.size(), comm_ ); }
+
+    // Forget all of the inner products
+    void Clear() { values_.resize( 0 ); }
+
+    const Field& operator[]( Int i ) const { return values_[i]; }
+
+private:
+    mpi::Comm comm_;
+    vector<Field> values_;
+    mpi::Request<Field> request_;
+    bool started_=false;
+};
+
+// Solve for each column of B independently using 'single', which should
+// overwrite a single right-hand side with its solution and return the number
+// of iterations that were required. The largest number of iterations is
+// returned.
+template<typename Field,class SingleType>
+Int ColumnByColumn( Matrix<Field>& B, const SingleType& single )
+{
+    EL_DEBUG_CSE
+    Int mostIts = 0;
+    const Int width = B.Width();
+    Matrix<Field> b;
+    for( Int j=0; j<width; ++j )
+    {
+        auto bView = B( ALL, IR(j) );
+        b = bView;
+        const Int its = single( b );
+        bView = b;
+        mostIts = Max(mostIts,its);
+    }
+    return mostIts;
+}
+
+template<typename Field,class SingleType>
+Int ColumnByColumn( DistMultiVec<Field>& B, const SingleType& single )
+{
+    EL_DEBUG_CSE
+    const Int height = B.Height();
+    const Int width = B.Width();
+
+    Int mostIts = 0;
+    DistMultiVec<Field> u(B.Grid());
+    Zeros( u, height, 1 );
+    auto& BLoc = B.Matrix();
+    auto& uLoc = u.Matrix();
+    for( Int j=0; j<width; ++j )
+    {
+        auto bLoc = BLoc( ALL, IR(j) );
+        uLoc = bLoc;
+        const Int its = single( u );
+        bLoc = uLoc;
+        mostIts = Max(mostIts,its);
+    }
+    return mostIts;
+}
+
+} // namespace krylov
+} // namespace El
+
+#endif // ifndef EL_SOLVE_KRYLOV_HPP
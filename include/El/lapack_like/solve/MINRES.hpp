@@ -0,0 +1,168 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_SOLVE_MINRES_HPP
+#define EL_SOLVE_MINRES_HPP
+
+// The preconditioned Minimum Residual method for Hermitian (possibly
+// indefinite) systems with a Hermitian positive-definite preconditioner, e.g.,
+// see
+//   Christopher C. Paige and Michael A. Saunders,
+//   "Solution of sparse indefinite systems of linear equations",
+//   SIAM J. Numer. Anal., Vol. 12, No. 4, pp. 617--629, 1975.
+//
+// The Lanczos coefficients are real, and so each iteration only requires the
+// two inner products defining them. Convergence is measured by the recurrence
+// for the residual norm in the norm induced by the preconditioner, which does
+// not require any further reductions.
+
+namespace El {
+
+namespace minres {
+
+// See Krylov.hpp for the requirements on 'applyA' and 'precond'.
+//
+// If the relative (preconditioned) residual norm does not drop below 'relTol'
+// within 'maxIts' iterations, a RuntimeError is thrown and b is left
+// unchanged.
+
+template<typename Field,class VecType,class ApplyAType,class PrecondType>
+Int Single
+( const ApplyAType& applyA,
+  const PrecondType& precond,
+        VecType& b,
+        Base<Field> relTol,
+        Int maxIts,
+        bool progress )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( b.Width() != 1 )
+          LogicError("Expected a single right-hand side");
+    )
+    typedef Base<Field> Real;
+    const Int n = b.Height();
+
+    // y := inv(M) b, beta_1 := sqrt(b' y)
+    VecType x(b), y(b), v(b);
+    precond( y );
+    const Real beta1Squared = RealPart(Dot( b, y ));
+    if( beta1Squared < Real(0) )
+        RuntimeError("MINRES requires a positive-definite preconditioner");
+    const Real beta1 = Sqrt( beta1Squared );
+    if( progress )
+        Output("origResidNorm: ",beta1);
+    if( beta1 == Real(0) )
+        return 0;
+    Zeros( x, n, 1 );
+
+    // The last two (unpreconditioned) Lanczos residuals and the last three
+    // search directions are stored in rotating slots to avoid copies
+    vector<VecType> R(2,b), W(3,x);
+    Int r1=0, r2=1, w=0, w1=1, w2=2;
+
+    Real oldBeta=0, beta=beta1, dBar=0, epsilon=0, phiBar=beta1;
+    Real c=-1, s=0;
+    Int iter=0;
+    while( true )
+    {
+        // v := y / beta, y := A v - (beta/oldBeta) r_1
+        v = y;
+        v *= Field(1/beta);
+        applyA( Field(1), v, Field(0), y );
+        if( iter > 0 )
+            Axpy( Field(-beta/oldBeta), R[r1], y );
+
+        // alpha := v' y, y := y - (alpha/beta) r_2
+        const Real alpha = RealPart(Dot( v, y ));
+        Axpy( Field(-alpha/beta), R[r2], y );
+
+        // r_1 := r_2, r_2 := y, y := inv(M) r_2, beta := sqrt(r_2' y)
+        R[r1] = y;
+        std::swap( r1, r2 );
+        precond( y );
+        oldBeta = beta;
+        const Real betaSquared = RealPart(Dot( R[r2], y ));
+        if( betaSquared < Real(0) )
+            RuntimeError("MINRES requires a positive-definite preconditioner");
+        beta = Sqrt( betaSquared );
+
+        // Apply the previous rotation to the new column of the tridiagonal
+        // matrix and then generate and apply a new one
+        const Real oldEpsilon = epsilon;
+        const Real delta = c*dBar + s*alpha;
+        const Real gammaBar = s*dBar - c*alpha;
+        epsilon = s*beta;
+        dBar = -c*beta;
+        const Real gamma =
+          Max( SafeNorm( gammaBar, beta ), limits::Epsilon<Real>() );
+        c = gammaBar / gamma;
+        s = beta / gamma;
+        const Real phi = c*phiBar;
+        phiBar = s*phiBar;
+
+        // w := (v - epsilon_old w_1 - delta w_2) / gamma, x := x + phi w
+        const Int oldW1 = w1;
+        w1 = w2;
+        w2 = w;
+        w = oldW1;
+        Entrywise(W[w]) =
+          Field(1/gamma)*(Entrywise(v) - Field(oldEpsilon)*Entrywise(W[w1]) -
+                          Field(delta)*Entrywise(W[w2]));
+        Axpy( Field(phi), W[w], x );
+        ++iter;
+
+        const Real relResidNorm = phiBar / beta1;
+        if( progress )
+            Output("iter ",iter,": relative residual norm ",relResidNorm);
+        if( relResidNorm <= relTol || beta == Real(0) )
+            break;
+        if( iter >= maxIts )
+            RuntimeError("MINRES did not converge");
+    }
+    b = x;
+    return iter;
+}
+
+} // namespace minres
+
+template<typename Field,class ApplyAType,class PrecondType>
+Int MINRES
+( const ApplyAType& applyA,
+  const PrecondType& precond,
+        Matrix<Field>& B,
+        Base<Field> relTol,
+        Int maxIts,
+        bool progress )
+{
+    EL_DEBUG_CSE
+    return krylov::ColumnByColumn
+    ( B, [&]( Matrix<Field>& b )
+         { return minres::Single<Field>
+                  ( applyA, precond, b, relTol, maxIts, progress ); } );
+}
+
+template<typename Field,class ApplyAType,class PrecondType>
+Int MINRES
+( const ApplyAType& applyA,
+  const PrecondType& precond,
+        DistMultiVec<Field>& B,
+        Base<Field> relTol,
+        Int maxIts,
+        bool progress )
+{
+    EL_DEBUG_CSE
+    return krylov::ColumnByColumn
+    ( B, [&]( DistMultiVec<Field>& b )
+         { return minres::Single<Field>
+                  ( applyA, precond, b, relTol, maxIts, progress ); } );
+}
+
+} // namespace El
+
+#endif // ifndef EL_SOLVE_MINRES_HPP
@@ -0,0 +1,351 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_SOLVE_PCG_HPP
+#define EL_SOLVE_PCG_HPP
+
+// The Preconditioned Conjugate Gradient method for Hermitian positive-definite
+// systems with a Hermitian positive-definite preconditioner, e.g., see
+// "Algorithm 9.1" of
+//   Yousef Saad
+//   "Iterative Methods for Sparse Linear Systems", 2nd edition, SIAM, 2003.
+//
+// A typical use is to precondition with a (possibly stale) factorization of a
+// nearby matrix, such as that of the normal equations from a previous
+// iteration of an Interior Point Method.
+//
+// The pipelined variant (PipelinedPCG) is the reformulation of
+//   Pieter Ghysels and Wim Vanroose,
+//   "Hiding global synchronization latency in the preconditioned Conjugate
+//   Gradient algorithm", Parallel Computing, Vol. 40, No. 7, pp. 224--238,
+//   2014.
+// which requires a single non-blocking reduction per iteration that is
+// overlapped with the application of the preconditioner and the operator, at
+// the cost of four additional vectors and of recurrences which are somewhat
+// less stable than those of the standard formulation.
+
+namespace El {
+
+namespace pcg {
+
+// In what follows, 'applyA' should be a function of the form
+//
+//   void applyA
+//   ( Field alpha, const VecType& x, Field beta, VecType& y )
+//
+// and overwrite y := alpha A x + beta y, while 'precond' should have the form
+//
+//   void precond( VecType& b )
+//
+// and overwrite b with an approximation of inv(A) b.
+//
+// If the relative residual norm does not drop below 'relTol' within 'maxIts'
+// iterations, or the method breaks down due to a non-positive curvature, then
+// b is left unchanged and, if 'converged' is null, a RuntimeError is thrown.
+// Otherwise, '*converged' is set to whether the method succeeded, which allows
+// callers with a fallback (such as a fresh factorization) to avoid relying
+// upon exceptions.
+
+template<typename Field,class VecType,class ApplyAType,class PrecondType>
+Int Single
+( const ApplyAType& applyA,
+  const PrecondType& precond,
+        VecType& b,
+        Base<Field> relTol,
+        Int maxIts,
+        bool progress,
+        bool* converged=nullptr )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( b.Width() != 1 )
+          LogicError("Expected a single right-hand side");
+    )
+    typedef Base<Field> Real;
+    const Int n = b.Height();
+    if( converged != nullptr )
+        *converged = true;
+
+    const Real origResidNorm = FrobeniusNorm( b );
+    if( progress )
+        Output("origResidNorm: ",origResidNorm);
+    if( origResidNorm == Real(0) )
+        return 0;
+
+    // x := 0, r := b, z := inv(M) r, p := z
+    VecType x(b), r(b), z(b), p(b), q(b);
+    Zeros( x, n, 1 );
+    precond( z );
+    p = z;
+    Field rz = Dot( r, z );
+
+    Int iter=0;
+    while( true )
+    {
+        // q := A p
+        applyA( Field(1), p, Field(0), q );
+        const Field pq = Dot( p, q );
+        if( RealPart(pq) <= Real(0) )
+        {
+            if( converged == nullptr )
+                RuntimeError("PCG encountered a non-positive curvature of ",pq);
+            if( progress )
+                Output("PCG encountered a non-positive curvature of ",pq);
+            *converged = false;
+            return iter;
+        }
+        const Field alpha = rz / pq;
+        Axpy(  alpha, p, x );
+        Axpy( -alpha, q, r );
+        ++iter;
+
+        const Real residNorm = FrobeniusNorm( r );
+        const Real relResidNorm = residNorm / origResidNorm;
+        if( progress )
+            Output("iter ",iter,": relative residual norm ",relResidNorm);
+        if( relResidNorm <= relTol )
+            break;
+        if( iter >= maxIts )
+        {
+            if( converged == nullptr )
+                RuntimeError("PCG did not converge");
+            *converged = false;
+            return iter;
+        }
+
+        // z := inv(M) r, p := z + (r'z / r_old'z_old) p
+        z = r;
+        precond( z );
+        const Field rzNew = Dot( r, z );
+        const Field beta = rzNew / rz;
+        rz = rzNew;
+        p *= beta;
+        p += z;
+    }
+    b = x;
+    return iter;
+}
+
+template<typename Field,class VecType,class ApplyAType,class PrecondType>
+Int Pipelined
+( const ApplyAType& applyA,
+  const PrecondType& precond,
+        VecType& b,
+        Base<Field> relTol,
+        Int maxIts,
+        bool progress,
+        bool* converged=nullptr )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( b.Width() != 1 )
+          LogicError("Expected a single right-hand side");
+    )
+    typedef Base<Field> Real;
+    const Int n = b.Height();
+    if( converged != nullptr )
+        *converged = true;
+
+    const Real origResidNorm = FrobeniusNorm( b );
+    if( progress )
+        Output("origResidNorm: ",origResidNorm);
+    if( origResidNorm == Real(0) )
+        return 0;
+
+    // x := 0, r := b, u := inv(M) r, w := A u
+    VecType x(b), r(b), u(b), w(b), m(b), nVec(b), p(b), q(b), s(b), z(b);
+    precond( u );
+    applyA( Field(1), u, Field(0), w );
+    Zeros( x, n, 1 );
+    Zeros( p, n, 1 );
+    Zeros( q, n, 1 );
+    Zeros( s, n, 1 );
+    Zeros( z, n, 1 );
+    krylov::Reduction<Field> reduction( krylov::ReductionComm(b) );
+
+    Field gammaOld=1, alphaOld=1;
+    Int iter=0;
+    while( true )
+    {
+        // Begin summing r' r, r' u, and u' w...
+        reduction.Clear();
+        const Int rrIndex = reduction.AddDot( r, r );
+        const Int ruIndex = reduction.AddDot( r, u );
+        const Int uwIndex = reduction.AddDot( u, w );
+        reduction.Start();
+
+        // ...while forming m := inv(M) w and n := A m
+        m = w;
+        precond( m );
+        applyA( Field(1), m, Field(0), nVec );
+        reduction.Finish();
+
+        const Real relResidNorm =
+          Sqrt(RealPart(reduction[rrIndex])) / origResidNorm;
+        if( iter > 0 && progress )
+            Output("iter ",iter,": relative residual norm ",relResidNorm);
+        if( relResidNorm <= relTol )
+            break;
+        if( iter >= maxIts )
+        {
+            if( converged == nullptr )
+                RuntimeError("Pipelined PCG did not converge");
+            *converged = false;
+            return iter;
+        }
+
+        const Field gamma = reduction[ruIndex];
+        const Field delta = reduction[uwIndex];
+        const Field beta = ( iter == 0 ? Field(0) : gamma/gammaOld );
+        // This is p' A p in exact arithmetic
+        const Field curvature =
+          ( iter == 0 ? delta : delta - beta*gamma/alphaOld );
+        if( RealPart(curvature) <= Real(0) )
+        {
+            if( converged == nullptr )
+                RuntimeError
+                ("Pipelined PCG encountered a non-positive curvature of ",
+                 curvature);
+            if( progress )
+                Output
+                ("Pipelined PCG encountered a non-positive curvature of ",
+                 curvature);
+            *converged = false;
+            return iter;
+        }
+        const Field alpha = gamma / curvature;
+
+        // z := n + beta z, q := m + beta q, s := w + beta s, p := u + beta p
+        Entrywise(z) = Entrywise(nVec) + beta*Entrywise(z);
+        Entrywise(q) = Entrywise(m) + beta*Entrywise(q);
+        Entrywise(s) = Entrywise(w) + beta*Entrywise(s);
+        Entrywise(p) = Entrywise(u) + beta*Entrywise(p);
+
+        // x := x + alpha p, r := r - alpha s, u := u - alpha q,
+        // w := w - alpha z
+        Axpy(  alpha, p, x );
+        Axpy( -alpha, s, r );
+        Axpy( -alpha, q, u );
+        Axpy( -alpha, z, w );
+        gammaOld = gamma;
+        alphaOld = alpha;
+        ++iter;
+    }
+    b = x;
+    return iter;
+}
+
+} // namespace pcg
+
+template<typename Field,class ApplyAType,class PrecondType>
+Int PCG
+( const ApplyAType& applyA,
+  const PrecondType& precond,
+        Matrix<Field>& B,
+        Base<Field> relTol,
+        Int maxIts,
+        bool progress,
+        bool* converged=nullptr )
+{
+    EL_DEBUG_CSE
+    if( converged != nullptr )
+        *converged = true;
+    bool columnConverged;
+    return krylov::ColumnByColumn
+    ( B, [&]( Matrix<Field>& b )
+         {
+             const Int its = pcg::Single<Field>
+               ( applyA, precond, b, relTol, maxIts, progress,
+                 converged != nullptr ? &columnConverged : nullptr );
+             if( converged != nullptr && !columnConverged )
+                 *converged = false;
+             return its;
+         } );
+}
+
+template<typename Field,class ApplyAType,class PrecondType>
+Int PCG
+( const ApplyAType& applyA,
+  const PrecondType& precond,
+        DistMultiVec<Field>& B,
+        Base<Field> relTol,
+        Int maxIts,
+        bool progress,
+        bool* converged=nullptr )
+{
+    EL_DEBUG_CSE
+    if( converged != nullptr )
+        *converged = true;
+    bool columnConverged;
+    return krylov::ColumnByColumn
+    ( B, [&]( DistMultiVec<Field>& b )
+         {
+             const Int its = pcg::Single<Field>
+               ( applyA, precond, b, relTol, maxIts, progress,
+                 converged != nullptr ? &columnConverged : nullptr );
+             if( converged != nullptr && !columnConverged )
+                 *converged = false;
+             return its;
+         } );
+}
+
+template<typename Field,class ApplyAType,class PrecondType>
+Int PipelinedPCG
+( const ApplyAType& applyA,
+  const PrecondType& precond,
+        Matrix<Field>& B,
+        Base<Field> relTol,
+        Int maxIts,
+        bool progress,
+        bool* converged=nullptr )
+{
+    EL_DEBUG_CSE
+    if( converged != nullptr )
+        *converged = true;
+    bool columnConverged;
+    return krylov::ColumnByColumn
+    ( B, [&]( Matrix<Field>& b )
+         {
+             const Int its = pcg::Pipelined<Field>
+               ( applyA, precond, b, relTol, maxIts, progress,
+                 converged != nullptr ? &columnConverged : nullptr );
+             if( converged != nullptr && !columnConverged )
+                 *converged = false;
+             return its;
+         } );
+}
+
+template<typename Field,class ApplyAType,class PrecondType>
+Int PipelinedPCG
+( const ApplyAType& applyA,
+  const PrecondType& precond,
+        DistMultiVec<Field>& B,
+        Base<Field> relTol,
+        Int maxIts,
+        bool progress,
+        bool* converged=nullptr )
+{
+    EL_DEBUG_CSE
+    if( converged != nullptr )
+        *converged = true;
+    bool columnConverged;
+    return krylov::ColumnByColumn
+    ( B, [&]( DistMultiVec<Field>& b )
+         {
+             const Int its = pcg::Pipelined<Field>
+               ( applyA, precond, b, relTol, maxIts, progress,
+                 converged != nullptr ? &columnConverged : nullptr );
+             if( converged != nullptr && !columnConverged )
+                 *converged = false;
+             return its;
+         } );
+}
+
+} // namespace El
+
+#endif // ifndef EL_SOLVE_PCG_HPP
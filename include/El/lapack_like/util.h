@@ -15,6 +15,26 @@
 extern "C" {
 #endif
 
+/* Graph reordering
+   ================ */
+typedef enum {
+  EL_SPARSE_ORDERING_AUTO,
+  EL_SPARSE_NESTED_DISSECTION,
+  EL_SPARSE_MINIMUM_DEGREE
+} ElSparseOrdering;
+
+typedef struct {
+  bool sequential;
+  ElInt numDistSeps;
+  ElInt numSeqSeps;
+  ElInt cutoff;
+  bool storeFactRecvInds;
+  bool native;
+  ElSparseOrdering ordering;
+  ElInt minDegreeCutoff;
+} ElBisectCtrl;
+EL_EXPORT ElError ElBisectCtrlDefault( ElBisectCtrl* ctrl );
+
 /* Median
    ====== */
 EL_EXPORT ElError ElMedian_i( ElConstMatrix_i x, ElValueInt_i* median );
@@ -53,4 +73,8 @@ EL_EXPORT ElError ElTaggedSortDist_d
 } // extern "C"
 #endif
 
+#ifdef __cplusplus
+#include <El/lapack_like/util/CReflect.hpp>
+#endif
+
 #endif /* ifndef EL_UTIL_C_H */
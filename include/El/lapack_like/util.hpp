@@ -13,6 +13,20 @@ namespace El {
 
 // Graph reordering
 // ================
+namespace SparseOrderingNS {
+enum SparseOrdering
+{
+    // Approximate minimum degree for sequential graphs with at most
+    // 'minDegreeCutoff' vertices, or for the subgraphs owned by each of 'p'
+    // processes when they have at most 'minDegreeCutoff/p' vertices, and
+    // nested dissection otherwise
+    SPARSE_ORDERING_AUTO,
+    SPARSE_NESTED_DISSECTION,
+    SPARSE_MINIMUM_DEGREE
+};
+}
+using namespace SparseOrderingNS;
+
 struct BisectCtrl
 {
     bool sequential;
@@ -21,9 +35,18 @@ struct BisectCtrl
     Int cutoff;
     bool storeFactRecvInds;
 
+    // Use the native multilevel partitioner even if (Par)METIS is available
+    // (it is always used in their absence)
+    bool native;
+
+    // The fill-reducing ordering of the sequential portion of the tree
+    SparseOrdering ordering;
+    Int minDegreeCutoff;
+
     BisectCtrl()
     : sequential(true), numDistSeps(1), numSeqSeps(1), cutoff(1024),
-      storeFactRecvInds(false)
+      storeFactRecvInds(false), native(false),
+      ordering(SPARSE_NESTED_DISSECTION), minDegreeCutoff(200000)
     { }
 };
 
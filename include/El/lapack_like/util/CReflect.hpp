@@ -0,0 +1,49 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_LAPACK_UTIL_CREFLECT_C_HPP
+#define EL_LAPACK_UTIL_CREFLECT_C_HPP
+
+namespace El {
+
+inline ElSparseOrdering CReflect( SparseOrdering ordering )
+{ return static_cast<ElSparseOrdering>(ordering); }
+inline SparseOrdering CReflect( ElSparseOrdering ordering )
+{ return static_cast<SparseOrdering>(ordering); }
+
+inline ElBisectCtrl CReflect( const BisectCtrl& ctrl )
+{
+    ElBisectCtrl ctrlC;
+    ctrlC.sequential        = ctrl.sequential;
+    ctrlC.numDistSeps       = ctrl.numDistSeps;
+    ctrlC.numSeqSeps        = ctrl.numSeqSeps;
+    ctrlC.cutoff            = ctrl.cutoff;
+    ctrlC.storeFactRecvInds = ctrl.storeFactRecvInds;
+    ctrlC.native            = ctrl.native;
+    ctrlC.ordering          = CReflect(ctrl.ordering);
+    ctrlC.minDegreeCutoff   = ctrl.minDegreeCutoff;
+    return ctrlC;
+}
+
+inline BisectCtrl CReflect( const ElBisectCtrl& ctrlC )
+{
+    BisectCtrl ctrl;
+    ctrl.sequential        = ctrlC.sequential;
+    ctrl.numDistSeps       = ctrlC.numDistSeps;
+    ctrl.numSeqSeps        = ctrlC.numSeqSeps;
+    ctrl.cutoff            = ctrlC.cutoff;
+    ctrl.storeFactRecvInds = ctrlC.storeFactRecvInds;
+    ctrl.native            = ctrlC.native;
+    ctrl.ordering          = CReflect(ctrlC.ordering);
+    ctrl.minDegreeCutoff   = ctrlC.minDegreeCutoff;
+    return ctrl;
+}
+
+} // namespace El
+
+#endif // ifndef EL_LAPACK_UTIL_CREFLECT_C_HPP
@@ -30,6 +30,11 @@ inline ElMehrotraCtrl_s CReflect( const MehrotraCtrl<float>& ctrl )
     ctrlC.maxIts        = ctrl.maxIts;
     ctrlC.maxStepRatio  = ctrl.maxStepRatio;
     ctrlC.system        = CReflect(ctrl.system);
+    ctrlC.splitDenseColumns = ctrl.splitDenseColumns;
+    ctrlC.denseColumnRatio  = ctrl.denseColumnRatio;
+    ctrlC.maxDenseColumns   = ctrl.maxDenseColumns;
+    ctrlC.reuseFactorization = ctrl.reuseFactorization;
+    ctrlC.maxReuseIts       = ctrl.maxReuseIts;
     ctrlC.mehrotra      = ctrl.mehrotra;
    
     auto centralityRuleRes =
@@ -74,6 +79,11 @@ inline ElMehrotraCtrl_d CReflect( const MehrotraCtrl<double>& ctrl )
     ctrlC.maxIts        = ctrl.maxIts;
     ctrlC.maxStepRatio  = ctrl.maxStepRatio;
     ctrlC.system        = CReflect(ctrl.system);
+    ctrlC.splitDenseColumns = ctrl.splitDenseColumns;
+    ctrlC.denseColumnRatio  = ctrl.denseColumnRatio;
+    ctrlC.maxDenseColumns   = ctrl.maxDenseColumns;
+    ctrlC.reuseFactorization = ctrl.reuseFactorization;
+    ctrlC.maxReuseIts       = ctrl.maxReuseIts;
     ctrlC.mehrotra      = ctrl.mehrotra;
 
     auto centralityRuleRes =
@@ -118,6 +128,11 @@ inline MehrotraCtrl<float> CReflect( const ElMehrotraCtrl_s& ctrlC )
     ctrl.maxIts            = ctrlC.maxIts;
     ctrl.maxStepRatio      = ctrlC.maxStepRatio;
     ctrl.system            = CReflect(ctrlC.system);
+    ctrl.splitDenseColumns = ctrlC.splitDenseColumns;
+    ctrl.denseColumnRatio  = ctrlC.denseColumnRatio;
+    ctrl.maxDenseColumns   = ctrlC.maxDenseColumns;
+    ctrl.reuseFactorization = ctrlC.reuseFactorization;
+    ctrl.maxReuseIts       = ctrlC.maxReuseIts;
     ctrl.mehrotra          = ctrlC.mehrotra;
     ctrl.centralityRule    = ctrlC.centralityRule;
     ctrl.standardInitShift = ctrlC.standardInitShift;
@@ -155,6 +170,11 @@ inline MehrotraCtrl<double> CReflect( const ElMehrotraCtrl_d& ctrlC )
     ctrl.maxIts            = ctrlC.maxIts;
     ctrl.maxStepRatio      = ctrlC.maxStepRatio;
     ctrl.system            = CReflect(ctrlC.system);
+    ctrl.splitDenseColumns = ctrlC.splitDenseColumns;
+    ctrl.denseColumnRatio  = ctrlC.denseColumnRatio;
+    ctrl.maxDenseColumns   = ctrlC.maxDenseColumns;
+    ctrl.reuseFactorization = ctrlC.reuseFactorization;
+    ctrl.maxReuseIts       = ctrlC.maxReuseIts;
     ctrl.mehrotra          = ctrlC.mehrotra;
     ctrl.centralityRule    = ctrlC.centralityRule;
     ctrl.standardInitShift = ctrlC.standardInitShift;
@@ -234,6 +254,53 @@ inline ADMMCtrl<double> CReflect( const ElADMMCtrl_d& ctrlC )
     return ctrl;
 }
 
+/* Matrix-free first-order methods
+   ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^ */
+inline ElFirstOrderCtrl_s CReflect( const FirstOrderCtrl<float>& ctrl )
+{
+    ElFirstOrderCtrl_s ctrlC;
+    ctrlC.maxIter         = ctrl.maxIter;
+    ctrlC.tol             = ctrl.tol;
+    ctrlC.stepSize        = ctrl.stepSize;
+    ctrlC.numPowerIts     = ctrl.numPowerIts;
+    ctrlC.adaptiveRestart = ctrl.adaptiveRestart;
+    ctrlC.progress        = ctrl.progress;
+    return ctrlC;
+}
+inline ElFirstOrderCtrl_d CReflect( const FirstOrderCtrl<double>& ctrl )
+{
+    ElFirstOrderCtrl_d ctrlC;
+    ctrlC.maxIter         = ctrl.maxIter;
+    ctrlC.tol             = ctrl.tol;
+    ctrlC.stepSize        = ctrl.stepSize;
+    ctrlC.numPowerIts     = ctrl.numPowerIts;
+    ctrlC.adaptiveRestart = ctrl.adaptiveRestart;
+    ctrlC.progress        = ctrl.progress;
+    return ctrlC;
+}
+inline FirstOrderCtrl<float> CReflect( const ElFirstOrderCtrl_s& ctrlC )
+{
+    FirstOrderCtrl<float> ctrl;
+    ctrl.maxIter         = ctrlC.maxIter;
+    ctrl.tol             = ctrlC.tol;
+    ctrl.stepSize        = ctrlC.stepSize;
+    ctrl.numPowerIts     = ctrlC.numPowerIts;
+    ctrl.adaptiveRestart = ctrlC.adaptiveRestart;
+    ctrl.progress        = ctrlC.progress;
+    return ctrl;
+}
+inline FirstOrderCtrl<double> CReflect( const ElFirstOrderCtrl_d& ctrlC )
+{
+    FirstOrderCtrl<double> ctrl;
+    ctrl.maxIter         = ctrlC.maxIter;
+    ctrl.tol             = ctrlC.tol;
+    ctrl.stepSize        = ctrlC.stepSize;
+    ctrl.numPowerIts     = ctrlC.numPowerIts;
+    ctrl.adaptiveRestart = ctrlC.adaptiveRestart;
+    ctrl.progress        = ctrlC.progress;
+    return ctrl;
+}
+
 /* Linear programs
    ^^^^^^^^^^^^^^^ */
 inline ElLPApproach CReflect( LPApproach approach )
@@ -637,36 +704,44 @@ inline bpdn::ADMMCtrl<double> CReflect( const ElBPDNADMMCtrl_d& ctrlC )
 inline ElBPDNCtrl_s CReflect( const BPDNCtrl<float>& ctrl )
 {
     ElBPDNCtrl_s ctrlC;
-    ctrlC.useIPM   = ctrl.useIPM;
-    ctrlC.admmCtrl = CReflect(ctrl.admmCtrl);
-    ctrlC.ipmCtrl  = CReflect(ctrl.ipmCtrl);
+    ctrlC.useIPM    = ctrl.useIPM;
+    ctrlC.useFISTA  = ctrl.useFISTA;
+    ctrlC.admmCtrl  = CReflect(ctrl.admmCtrl);
+    ctrlC.ipmCtrl   = CReflect(ctrl.ipmCtrl);
+    ctrlC.fistaCtrl = CReflect(ctrl.fistaCtrl);
     return ctrlC;
 }
 
 inline ElBPDNCtrl_d CReflect( const BPDNCtrl<double>& ctrl )
 {
     ElBPDNCtrl_d ctrlC;
-    ctrlC.useIPM   = ctrl.useIPM;
-    ctrlC.admmCtrl = CReflect(ctrl.admmCtrl);
-    ctrlC.ipmCtrl  = CReflect(ctrl.ipmCtrl);
+    ctrlC.useIPM    = ctrl.useIPM;
+    ctrlC.useFISTA  = ctrl.useFISTA;
+    ctrlC.admmCtrl  = CReflect(ctrl.admmCtrl);
+    ctrlC.ipmCtrl   = CReflect(ctrl.ipmCtrl);
+    ctrlC.fistaCtrl = CReflect(ctrl.fistaCtrl);
     return ctrlC;
 }
 
 inline BPDNCtrl<float> CReflect( const ElBPDNCtrl_s& ctrlC )
 {
     BPDNCtrl<float> ctrl;
-    ctrl.useIPM   = ctrlC.useIPM;
-    ctrl.admmCtrl = CReflect(ctrlC.admmCtrl);
-    ctrl.ipmCtrl  = CReflect(ctrlC.ipmCtrl);
+    ctrl.useIPM    = ctrlC.useIPM;
+    ctrl.useFISTA  = ctrlC.useFISTA;
+    ctrl.admmCtrl  = CReflect(ctrlC.admmCtrl);
+    ctrl.ipmCtrl   = CReflect(ctrlC.ipmCtrl);
+    ctrl.fistaCtrl = CReflect(ctrlC.fistaCtrl);
     return ctrl;
 }
 
 inline BPDNCtrl<double> CReflect( const ElBPDNCtrl_d& ctrlC )
 {
     BPDNCtrl<double> ctrl;
-    ctrl.useIPM   = ctrlC.useIPM;
-    ctrl.admmCtrl = CReflect(ctrlC.admmCtrl);
-    ctrl.ipmCtrl  = CReflect(ctrlC.ipmCtrl);
+    ctrl.useIPM    = ctrlC.useIPM;
+    ctrl.useFISTA  = ctrlC.useFISTA;
+    ctrl.admmCtrl  = CReflect(ctrlC.admmCtrl);
+    ctrl.ipmCtrl   = CReflect(ctrlC.ipmCtrl);
+    ctrl.fistaCtrl = CReflect(ctrlC.fistaCtrl);
     return ctrl;
 }
 
@@ -685,6 +760,7 @@ inline ElNNLSCtrl_s CReflect( const NNLSCtrl<float>& ctrl )
     ctrlC.admmCtrl = CReflect(ctrl.admmCtrl);
     ctrlC.qpCtrl   = CReflect(ctrl.qpCtrl);
     ctrlC.socpCtrl = CReflect(ctrl.socpCtrl);
+    ctrlC.fistaCtrl = CReflect(ctrl.fistaCtrl);
     return ctrlC;
 }
 
@@ -695,6 +771,7 @@ inline ElNNLSCtrl_d CReflect( const NNLSCtrl<double>& ctrl )
     ctrlC.admmCtrl = CReflect(ctrl.admmCtrl);
     ctrlC.qpCtrl   = CReflect(ctrl.qpCtrl);
     ctrlC.socpCtrl = CReflect(ctrl.socpCtrl);
+    ctrlC.fistaCtrl = CReflect(ctrl.fistaCtrl);
     return ctrlC;
 }
 
@@ -705,6 +782,7 @@ inline NNLSCtrl<float> CReflect( const ElNNLSCtrl_s& ctrlC )
     ctrl.admmCtrl = CReflect(ctrlC.admmCtrl);
     ctrl.qpCtrl   = CReflect(ctrlC.qpCtrl);
     ctrl.socpCtrl = CReflect(ctrlC.socpCtrl);
+    ctrl.fistaCtrl = CReflect(ctrlC.fistaCtrl);
     return ctrl;
 }
 
@@ -715,16 +793,25 @@ inline NNLSCtrl<double> CReflect( const ElNNLSCtrl_d& ctrlC )
     ctrl.admmCtrl = CReflect(ctrlC.admmCtrl);
     ctrl.qpCtrl   = CReflect(ctrlC.qpCtrl);
     ctrl.socpCtrl = CReflect(ctrlC.socpCtrl);
+    ctrl.fistaCtrl = CReflect(ctrlC.fistaCtrl);
     return ctrl;
 }
 
 // Non-negative Matrix Factorization
 // ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^
+inline NMFApproach CReflect( ElNMFApproach approach )
+{ return static_cast<NMFApproach>(approach); }
+inline ElNMFApproach CReflect( NMFApproach approach )
+{ return static_cast<ElNMFApproach>(approach); }
+
 inline ElNMFCtrl_s CReflect( const NMFCtrl<float>& ctrl )
 {
     ElNMFCtrl_s ctrlC;
     ctrlC.nnlsCtrl = CReflect(ctrl.nnlsCtrl);
     ctrlC.maxIter = ctrl.maxIter;
+    ctrlC.approach = CReflect(ctrl.approach);
+    ctrlC.tol = ctrl.tol;
+    ctrlC.progress = ctrl.progress;
     return ctrlC;
 }
 
@@ -733,6 +820,9 @@ inline ElNMFCtrl_d CReflect( const NMFCtrl<double>& ctrl )
     ElNMFCtrl_d ctrlC;
     ctrlC.nnlsCtrl = CReflect(ctrl.nnlsCtrl);
     ctrlC.maxIter = ctrl.maxIter;
+    ctrlC.approach = CReflect(ctrl.approach);
+    ctrlC.tol = ctrl.tol;
+    ctrlC.progress = ctrl.progress;
     return ctrlC;
 }
 
@@ -741,6 +831,9 @@ inline NMFCtrl<float> CReflect( const ElNMFCtrl_s& ctrlC )
     NMFCtrl<float> ctrl;
     ctrl.nnlsCtrl = CReflect(ctrlC.nnlsCtrl);
     ctrl.maxIter = ctrlC.maxIter;
+    ctrl.approach = CReflect(ctrlC.approach);
+    ctrl.tol = ctrlC.tol;
+    ctrl.progress = ctrlC.progress;
     return ctrl;
 }
 
@@ -749,6 +842,9 @@ inline NMFCtrl<double> CReflect( const ElNMFCtrl_d& ctrlC )
     NMFCtrl<double> ctrl;
     ctrl.nnlsCtrl = CReflect(ctrlC.nnlsCtrl);
     ctrl.maxIter = ctrlC.maxIter;
+    ctrl.approach = CReflect(ctrlC.approach);
+    ctrl.tol = ctrlC.tol;
+    ctrl.progress = ctrlC.progress;
     return ctrl;
 }
 
@@ -760,8 +856,10 @@ inline ElRPCACtrl_s CReflect( const RPCACtrl<float>& ctrl )
     ElRPCACtrl_s ctrlC;
     ctrlC.useALM      = ctrl.useALM;
     ctrlC.usePivQR    = ctrl.usePivQR;
+    ctrlC.useSubspace = ctrl.useSubspace;
     ctrlC.progress    = ctrl.progress;
     ctrlC.numPivSteps = ctrl.numPivSteps;
+    ctrlC.numSubspaceIts = ctrl.numSubspaceIts;
     ctrlC.maxIts      = ctrl.maxIts;
     ctrlC.tau         = ctrl.tau;
     ctrlC.beta        = ctrl.beta;
@@ -775,8 +873,10 @@ inline ElRPCACtrl_d CReflect( const RPCACtrl<double>& ctrl )
     ElRPCACtrl_d ctrlC;
     ctrlC.useALM      = ctrl.useALM;
     ctrlC.usePivQR    = ctrl.usePivQR;
+    ctrlC.useSubspace = ctrl.useSubspace;
     ctrlC.progress    = ctrl.progress;
     ctrlC.numPivSteps = ctrl.numPivSteps;
+    ctrlC.numSubspaceIts = ctrl.numSubspaceIts;
     ctrlC.maxIts      = ctrl.maxIts;
     ctrlC.tau         = ctrl.tau;
     ctrlC.beta        = ctrl.beta;
@@ -790,8 +890,10 @@ inline RPCACtrl<float> CReflect( const ElRPCACtrl_s& ctrlC )
     RPCACtrl<float> ctrl;
     ctrl.useALM      = ctrlC.useALM;
     ctrl.usePivQR    = ctrlC.usePivQR;
+    ctrl.useSubspace = ctrlC.useSubspace;
     ctrl.progress    = ctrlC.progress;
     ctrl.numPivSteps = ctrlC.numPivSteps;
+    ctrl.numSubspaceIts = ctrlC.numSubspaceIts;
     ctrl.maxIts      = ctrlC.maxIts;
     ctrl.tau         = ctrlC.tau;
     ctrl.beta        = ctrlC.beta;
@@ -805,8 +907,10 @@ inline RPCACtrl<double> CReflect( const ElRPCACtrl_d& ctrlC )
     RPCACtrl<double> ctrl;
     ctrl.useALM      = ctrlC.useALM;
     ctrl.usePivQR    = ctrlC.usePivQR;
+    ctrl.useSubspace = ctrlC.useSubspace;
     ctrl.progress    = ctrlC.progress;
     ctrl.numPivSteps = ctrlC.numPivSteps;
+    ctrl.numSubspaceIts = ctrlC.numSubspaceIts;
     ctrl.maxIts      = ctrlC.maxIts;
     ctrl.tau         = ctrlC.tau;
     ctrl.beta        = ctrlC.beta;
@@ -821,78 +925,147 @@ inline RPCACtrl<double> CReflect( const ElRPCACtrl_d& ctrlC )
 inline ElSparseInvCovCtrl_s CReflect( const SparseInvCovCtrl<float>& ctrl )
 {
     ElSparseInvCovCtrl_s ctrlC;
-    ctrlC.rho      = ctrl.rho;
-    ctrlC.alpha    = ctrl.alpha;
-    ctrlC.maxIter  = ctrl.maxIter;
-    ctrlC.absTol   = ctrl.absTol;
-    ctrlC.relTol   = ctrl.relTol;
-    ctrlC.progress = ctrl.progress;
+    ctrlC.rho               = ctrl.rho;
+    ctrlC.alpha             = ctrl.alpha;
+    ctrlC.maxIter           = ctrl.maxIter;
+    ctrlC.absTol            = ctrl.absTol;
+    ctrlC.relTol            = ctrl.relTol;
+    ctrlC.progress          = ctrl.progress;
+    ctrlC.screen            = ctrl.screen;
+    ctrlC.maxLocalBlockSize = ctrl.maxLocalBlockSize;
     return ctrlC;
 }
 
 inline ElSparseInvCovCtrl_d CReflect( const SparseInvCovCtrl<double>& ctrl )
 {
     ElSparseInvCovCtrl_d ctrlC;
-    ctrlC.rho      = ctrl.rho;
-    ctrlC.alpha    = ctrl.alpha;
-    ctrlC.maxIter  = ctrl.maxIter;
-    ctrlC.absTol   = ctrl.absTol;
-    ctrlC.relTol   = ctrl.relTol;
-    ctrlC.progress = ctrl.progress;
+    ctrlC.rho               = ctrl.rho;
+    ctrlC.alpha             = ctrl.alpha;
+    ctrlC.maxIter           = ctrl.maxIter;
+    ctrlC.absTol            = ctrl.absTol;
+    ctrlC.relTol            = ctrl.relTol;
+    ctrlC.progress          = ctrl.progress;
+    ctrlC.screen            = ctrl.screen;
+    ctrlC.maxLocalBlockSize = ctrl.maxLocalBlockSize;
     return ctrlC;
 }
 
 inline SparseInvCovCtrl<float> CReflect( const ElSparseInvCovCtrl_s& ctrlC )
 {
     SparseInvCovCtrl<float> ctrl;
-    ctrl.rho      = ctrlC.rho;
-    ctrl.alpha    = ctrlC.alpha;
-    ctrl.maxIter  = ctrlC.maxIter;
-    ctrl.absTol   = ctrlC.absTol;
-    ctrl.relTol   = ctrlC.relTol;
-    ctrl.progress = ctrlC.progress;
+    ctrl.rho               = ctrlC.rho;
+    ctrl.alpha             = ctrlC.alpha;
+    ctrl.maxIter           = ctrlC.maxIter;
+    ctrl.absTol            = ctrlC.absTol;
+    ctrl.relTol            = ctrlC.relTol;
+    ctrl.progress          = ctrlC.progress;
+    ctrl.screen            = ctrlC.screen;
+    ctrl.maxLocalBlockSize = ctrlC.maxLocalBlockSize;
     return ctrl;
 }
 
 inline SparseInvCovCtrl<double> CReflect( const ElSparseInvCovCtrl_d& ctrlC )
 {
     SparseInvCovCtrl<double> ctrl;
-    ctrl.rho      = ctrlC.rho;
-    ctrl.alpha    = ctrlC.alpha;
-    ctrl.maxIter  = ctrlC.maxIter;
-    ctrl.absTol   = ctrlC.absTol;
-    ctrl.relTol   = ctrlC.relTol;
-    ctrl.progress = ctrlC.progress;
+    ctrl.rho               = ctrlC.rho;
+    ctrl.alpha             = ctrlC.alpha;
+    ctrl.maxIter           = ctrlC.maxIter;
+    ctrl.absTol            = ctrlC.absTol;
+    ctrl.relTol            = ctrlC.relTol;
+    ctrl.progress          = ctrlC.progress;
+    ctrl.screen            = ctrlC.screen;
+    ctrl.maxLocalBlockSize = ctrlC.maxLocalBlockSize;
     return ctrl;
 }
 
 /* Support Vector Machine
    """""""""""""""""""""" */
+inline ElSVMCoordinateDescentCtrl_s
+CReflect( const svm::CoordinateDescentCtrl<float>& ctrl )
+{
+    ElSVMCoordinateDescentCtrl_s ctrlC;
+    ctrlC.squaredHinge = ctrl.squaredHinge;
+    ctrlC.shrink       = ctrl.shrink;
+    ctrlC.maxIter      = ctrl.maxIter;
+    ctrlC.tol          = ctrl.tol;
+    ctrlC.progress     = ctrl.progress;
+    return ctrlC;
+}
+
+inline ElSVMCoordinateDescentCtrl_d
+CReflect( const svm::CoordinateDescentCtrl<double>& ctrl )
+{
+    ElSVMCoordinateDescentCtrl_d ctrlC;
+    ctrlC.squaredHinge = ctrl.squaredHinge;
+    ctrlC.shrink       = ctrl.shrink;
+    ctrlC.maxIter      = ctrl.maxIter;
+    ctrlC.tol          = ctrl.tol;
+    ctrlC.progress     = ctrl.progress;
+    return ctrlC;
+}
+
+inline svm::CoordinateDescentCtrl<float>
+CReflect( const ElSVMCoordinateDescentCtrl_s& ctrlC )
+{
+    svm::CoordinateDescentCtrl<float> ctrl;
+    ctrl.squaredHinge = ctrlC.squaredHinge;
+    ctrl.shrink       = ctrlC.shrink;
+    ctrl.maxIter      = ctrlC.maxIter;
+    ctrl.tol          = ctrlC.tol;
+    ctrl.progress     = ctrlC.progress;
+    return ctrl;
+}
+
+inline svm::CoordinateDescentCtrl<double>
+CReflect( const ElSVMCoordinateDescentCtrl_d& ctrlC )
+{
+    svm::CoordinateDescentCtrl<double> ctrl;
+    ctrl.squaredHinge = ctrlC.squaredHinge;
+    ctrl.shrink       = ctrlC.shrink;
+    ctrl.maxIter      = ctrlC.maxIter;
+    ctrl.tol          = ctrlC.tol;
+    ctrl.progress     = ctrlC.progress;
+    return ctrl;
+}
+
+inline SVMApproach CReflect( ElSVMApproach approach )
+{ return static_cast<SVMApproach>(approach); }
+inline ElSVMApproach CReflect( SVMApproach approach )
+{ return static_cast<ElSVMApproach>(approach); }
+
 inline ElSVMCtrl_s CReflect( const SVMCtrl<float>& ctrl )
 {
     ElSVMCtrl_s ctrlC;
+    ctrlC.approach = CReflect(ctrl.approach);
     ctrlC.ipmCtrl = CReflect(ctrl.ipmCtrl);
+    ctrlC.cdCtrl = CReflect(ctrl.cdCtrl);
     return ctrlC;
 }
 
 inline ElSVMCtrl_d CReflect( const SVMCtrl<double>& ctrl )
 {
     ElSVMCtrl_d ctrlC;
+    ctrlC.approach = CReflect(ctrl.approach);
     ctrlC.ipmCtrl = CReflect(ctrl.ipmCtrl);
+    ctrlC.cdCtrl = CReflect(ctrl.cdCtrl);
     return ctrlC;
 }
 
 inline SVMCtrl<float> CReflect( const ElSVMCtrl_s& ctrlC )
 {
     SVMCtrl<float> ctrl;
+    ctrl.approach = CReflect(ctrlC.approach);
     ctrl.ipmCtrl = CReflect(ctrlC.ipmCtrl);
+    ctrl.cdCtrl = CReflect(ctrlC.cdCtrl);
     return ctrl;
 }
 
 inline SVMCtrl<double> CReflect( const ElSVMCtrl_d& ctrlC )
 {
     SVMCtrl<double> ctrl;
+    ctrl.approach = CReflect(ctrlC.approach);
     ctrl.ipmCtrl = CReflect(ctrlC.ipmCtrl);
+    ctrl.cdCtrl = CReflect(ctrlC.cdCtrl);
     return ctrl;
 }
 
@@ -566,7 +566,8 @@ EL_EXPORT ElError ElNNLSDistSparse_d
 typedef enum {
   EL_NNLS_ADMM,
   EL_NNLS_QP,
-  EL_NNLS_SOCP
+  EL_NNLS_SOCP,
+  EL_NNLS_FISTA
 } ElNNLSApproach;
 
 typedef struct {
@@ -574,6 +575,7 @@ typedef struct {
   ElADMMCtrl_s admmCtrl;
   ElQPDirectCtrl_s qpCtrl;
   ElSOCPAffineCtrl_s socpCtrl;
+  ElFirstOrderCtrl_s fistaCtrl;
 } ElNNLSCtrl_s;
 
 typedef struct {
@@ -581,6 +583,7 @@ typedef struct {
   ElADMMCtrl_d admmCtrl;
   ElQPDirectCtrl_d qpCtrl;
   ElSOCPAffineCtrl_d socpCtrl;
+  ElFirstOrderCtrl_d fistaCtrl;
 } ElNNLSCtrl_d;
 
 EL_EXPORT ElError ElNNLSCtrlDefault_s( ElNNLSCtrl_s* ctrl );
@@ -645,14 +648,26 @@ EL_EXPORT ElError ElNMFDist_d
   ElDistMatrix_d Y );
 
 /* Expert versions */
+typedef enum {
+  EL_NMF_NNLS,
+  EL_NMF_HALS,
+  EL_NMF_MULTIPLICATIVE
+} ElNMFApproach;
+
 typedef struct {
   ElNNLSCtrl_s nnlsCtrl;
   ElInt maxIter;
+  ElNMFApproach approach;
+  float tol;
+  bool progress;
 } ElNMFCtrl_s;
 
 typedef struct {
   ElNNLSCtrl_d nnlsCtrl;
   ElInt maxIter;
+  ElNMFApproach approach;
+  double tol;
+  bool progress;
 } ElNMFCtrl_d;
 
 EL_EXPORT ElError ElNMFCtrlDefault_s( ElNMFCtrl_s* ctrl );
@@ -680,6 +695,28 @@ EL_EXPORT ElError ElNMFXDist_d
   ElDistMatrix_d Y,
   ElNMFCtrl_d ctrl );
 
+EL_EXPORT ElError ElNMFXSparse_s
+( ElConstSparseMatrix_s A,
+  ElMatrix_s X,
+  ElMatrix_s Y,
+  ElNMFCtrl_s ctrl );
+EL_EXPORT ElError ElNMFXSparse_d
+( ElConstSparseMatrix_d A,
+  ElMatrix_d X,
+  ElMatrix_d Y,
+  ElNMFCtrl_d ctrl );
+
+EL_EXPORT ElError ElNMFXDistSparse_s
+( ElConstDistSparseMatrix_s A,
+  ElDistMultiVec_s X,
+  ElDistMultiVec_s Y,
+  ElNMFCtrl_s ctrl );
+EL_EXPORT ElError ElNMFXDistSparse_d
+( ElConstDistSparseMatrix_d A,
+  ElDistMultiVec_d X,
+  ElDistMultiVec_d Y,
+  ElNMFCtrl_d ctrl );
+
 /* Basis pursuit denoising
    ======================= */
 EL_EXPORT ElError ElBPDN_s
@@ -753,14 +790,18 @@ EL_EXPORT ElError ElBPDNADMMCtrlDefault_d( ElBPDNADMMCtrl_d* ctrl );
 
 typedef struct {
   bool useIPM;
+  bool useFISTA;
   ElBPDNADMMCtrl_s admmCtrl;
   ElQPAffineCtrl_s ipmCtrl;
+  ElFirstOrderCtrl_s fistaCtrl;
 } ElBPDNCtrl_s;
 
 typedef struct {
   bool useIPM;
+  bool useFISTA;
   ElBPDNADMMCtrl_d admmCtrl;
   ElQPAffineCtrl_d ipmCtrl;
+  ElFirstOrderCtrl_d fistaCtrl;
 } ElBPDNCtrl_d;
 
 EL_EXPORT ElError ElBPDNCtrlDefault_s( ElBPDNCtrl_s* ctrl );
@@ -916,8 +957,10 @@ EL_EXPORT ElError ElRPCADist_z
 typedef struct {
   bool useALM;
   bool usePivQR;
+  bool useSubspace;
   bool progress;
   ElInt numPivSteps;
+  ElInt numSubspaceIts;
   ElInt maxIts;
   float tau;
   float beta;
@@ -928,8 +971,10 @@ typedef struct {
 typedef struct {
   bool useALM;
   bool usePivQR;
+  bool useSubspace;
   bool progress;
   ElInt numPivSteps;
+  ElInt numSubspaceIts;
   ElInt maxIts;
   double tau;
   double beta;
@@ -991,6 +1036,8 @@ typedef struct {
   float absTol;
   float relTol;
   bool progress;
+  bool screen;
+  ElInt maxLocalBlockSize;
 } ElSparseInvCovCtrl_s;
 
 typedef struct {
@@ -1000,6 +1047,8 @@ typedef struct {
   double absTol;
   double relTol;
   bool progress;
+  bool screen;
+  ElInt maxLocalBlockSize;
 } ElSparseInvCovCtrl_d;
 
 EL_EXPORT ElError ElSparseInvCovCtrlDefault_s( ElSparseInvCovCtrl_s* ctrl );
@@ -1065,14 +1114,46 @@ EL_EXPORT ElError ElSVMDistSparse_d
    -------------- */
 typedef struct
 {
+  bool squaredHinge;
+  bool shrink;
+  ElInt maxIter;
+  float tol;
+  bool progress;
+} ElSVMCoordinateDescentCtrl_s;
+
+typedef struct
+{
+  bool squaredHinge;
+  bool shrink;
+  ElInt maxIter;
+  double tol;
+  bool progress;
+} ElSVMCoordinateDescentCtrl_d;
+
+typedef enum {
+  EL_SVM_IPM,
+  EL_SVM_COORDINATE_DESCENT
+} ElSVMApproach;
+
+typedef struct
+{
+  ElSVMApproach approach;
   ElQPAffineCtrl_s ipmCtrl;
+  ElSVMCoordinateDescentCtrl_s cdCtrl;
 } ElSVMCtrl_s;
 
 typedef struct
 {
+  ElSVMApproach approach;
   ElQPAffineCtrl_d ipmCtrl;
+  ElSVMCoordinateDescentCtrl_d cdCtrl;
 } ElSVMCtrl_d;
 
+EL_EXPORT ElError ElSVMCoordinateDescentCtrlDefault_s
+( ElSVMCoordinateDescentCtrl_s* ctrl );
+EL_EXPORT ElError ElSVMCoordinateDescentCtrlDefault_d
+( ElSVMCoordinateDescentCtrl_d* ctrl );
+
 EL_EXPORT ElError ElSVMCtrlDefault_s( ElSVMCtrl_s* ctrl );
 EL_EXPORT ElError ElSVMCtrlDefault_d( ElSVMCtrl_d* ctrl );
 
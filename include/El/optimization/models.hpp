@@ -251,7 +251,8 @@ namespace NNLSApproachNS {
 enum NNLSApproach {
     NNLS_ADMM, // The ADMM implementation is still a prototype
     NNLS_QP,
-    NNLS_SOCP
+    NNLS_SOCP,
+    NNLS_FISTA // Matrix-free projected accelerated gradient
 };
 } // namespace NNLSApproachNS
 using namespace NNLSApproachNS;
@@ -262,6 +263,7 @@ struct NNLSCtrl {
   ADMMCtrl<Real> admmCtrl;
   qp::direct::Ctrl<Real> qpCtrl;
   socp::affine::Ctrl<Real> socpCtrl;
+  FirstOrderCtrl<Real> fistaCtrl;
 };
 
 template<typename Real>
@@ -350,10 +352,27 @@ void RNNLS
 
 // Non-negative matrix factorization
 // =================================
+// Approximately factor A ~= X Y^T with X, Y >= 0, where X is an initial guess
+// whose width determines the rank of the factorization.
+
+namespace NMFApproachNS {
+enum NMFApproach {
+    NMF_NNLS, // Alternate between full NNLS solves
+    NMF_HALS, // Hierarchical alternating least squares
+    NMF_MULTIPLICATIVE // Lee-Seung multiplicative updates
+};
+} // namespace NMFApproachNS
+using namespace NMFApproachNS;
+
 template<typename Real>
 struct NMFCtrl {
   NNLSCtrl<Real> nnlsCtrl;
   Int maxIter=20;
+  NMFApproach approach=NMF_NNLS;
+  // The HALS and multiplicative approaches stop once the relative decrease
+  // of || A - X Y^T ||_F falls below 'tol' (if it is positive)
+  Real tol=Real(0);
+  bool progress=false;
 };
 
 template<typename Real>
@@ -368,7 +387,19 @@ void NMF
         AbstractDistMatrix<Real>& X,
         AbstractDistMatrix<Real>& Y,
   const NMFCtrl<Real>& ctrl=NMFCtrl<Real>() );
-// TODO(poulson): Sparse versions
+// NOTE: The sparse versions require the HALS or multiplicative approach
+template<typename Real>
+void NMF
+( const SparseMatrix<Real>& A,
+        Matrix<Real>& X,
+        Matrix<Real>& Y,
+  const NMFCtrl<Real>& ctrl );
+template<typename Real>
+void NMF
+( const DistSparseMatrix<Real>& A,
+        DistMultiVec<Real>& X,
+        DistMultiVec<Real>& Y,
+  const NMFCtrl<Real>& ctrl );
 
 // Basis pursuit denoising (BPDN), a.k.a.,
 // Least absolute selection and shrinkage operator (Lasso):
@@ -394,9 +425,12 @@ struct ADMMCtrl {
 template<typename Real>
 struct BPDNCtrl {
   bool useIPM=true;
+  // If true, the matrix-free FISTA solver overrides the above choice
+  bool useFISTA=false;
   // NOTE: The ADMM implementation is still a prototype
   bpdn::ADMMCtrl<Real> admmCtrl;
   qp::affine::Ctrl<Real> ipmCtrl;
+  FirstOrderCtrl<Real> fistaCtrl;
 };
 
 template<typename Real>
@@ -466,6 +500,40 @@ void EN
         DistMultiVec<Real>& x,
   const qp::affine::Ctrl<Real>& ctrl=qp::affine::Ctrl<Real>() );
 
+// Matrix-free solution via FISTA
+template<typename Real>
+void EN
+( const Matrix<Real>& A,
+  const Matrix<Real>& b,
+        Real lambda1,
+        Real lambda2,
+        Matrix<Real>& x,
+  const FirstOrderCtrl<Real>& ctrl );
+template<typename Real>
+void EN
+( const AbstractDistMatrix<Real>& A,
+  const AbstractDistMatrix<Real>& b,
+        Real lambda1,
+        Real lambda2,
+        AbstractDistMatrix<Real>& x,
+  const FirstOrderCtrl<Real>& ctrl );
+template<typename Real>
+void EN
+( const SparseMatrix<Real>& A,
+  const Matrix<Real>& b,
+        Real lambda1,
+        Real lambda2,
+        Matrix<Real>& x,
+  const FirstOrderCtrl<Real>& ctrl );
+template<typename Real>
+void EN
+( const DistSparseMatrix<Real>& A,
+  const DistMultiVec<Real>& b,
+        Real lambda1,
+        Real lambda2,
+        DistMultiVec<Real>& x,
+  const FirstOrderCtrl<Real>& ctrl );
+
 // Robust Principal Component Analysis (RPCA)
 // ==========================================
 
@@ -474,9 +542,13 @@ struct RPCACtrl
 {
     bool useALM=true;
     bool usePivQR=false;
+    // Use a warm-started subspace iteration for the singular-value
+    // thresholding, predicting the rank from the previous iteration
+    bool useSubspace=false;
     bool progress=true;
 
     Int numPivSteps=75;
+    Int numSubspaceIts=2;
     Int maxIts=1000;
 
     Real tau=Real(0);
@@ -510,6 +582,19 @@ struct SparseInvCovCtrl
     Real absTol=Real(1e-6);
     Real relTol=Real(1e-4);
     bool progress=true;
+
+    // If 'screen' is true, the connected components of the graph of
+    // | S(i,j) | > lambda, i != j, are computed before running ADMM: the
+    // solution is known to be block-diagonal along these components [1], so
+    // each block is solved independently. In the distributed case, blocks of
+    // size at most 'maxLocalBlockSize' are solved sequentially (in parallel
+    // across processes), while larger blocks are solved over the full grid.
+    //
+    // [1] D. Witten, J. Friedman, and N. Simon, "New insights and faster
+    //     computations for the graphical lasso", J. Computational and
+    //     Graphical Statistics, Vol. 20, No. 4, 2011.
+    bool screen=true;
+    Int maxLocalBlockSize=1000;
 };
 
 template<typename Field>
@@ -538,11 +623,43 @@ Int SparseInvCov
 //
 // The output, x, is set to the concatenation of w and beta, x := [w; beta].
 //
+// For sparse matrices, the dual coordinate descent method of Hsieh et al.
+// can instead be used for either the hinge loss or the squared hinge loss,
+// lambda sum_i max(0, 1 - d_i (a_i^T w + beta))^2. In this case, beta is
+// treated as the coefficient of a constant feature and is therefore also
+// regularized.
+//
+
+namespace svm {
+
+template<typename Real>
+struct CoordinateDescentCtrl
+{
+    bool squaredHinge=false;
+    // Temporarily remove dual variables which are likely to stay at a bound
+    bool shrink=true;
+    Int maxIter=1000;
+    // The tolerance on the range of the projected gradient
+    Real tol=Real(0.1);
+    bool progress=false;
+};
+
+} // namespace svm
+
+namespace SVMApproachNS {
+enum SVMApproach {
+    SVM_IPM,
+    SVM_COORDINATE_DESCENT // Only supported for sparse matrices
+};
+} // namespace SVMApproachNS
+using namespace SVMApproachNS;
 
 template<typename Real>
 struct SVMCtrl
 {
+    SVMApproach approach=SVM_IPM;
     qp::affine::Ctrl<Real> ipmCtrl;
+    svm::CoordinateDescentCtrl<Real> cdCtrl;
 };
 
 // TODO(poulson): Switch to explicitly returning w, beta, and z, as it is
@@ -610,6 +727,27 @@ void TV
         DistMultiVec<Real>& x,
   const qp::affine::Ctrl<Real>& ctrl=qp::affine::Ctrl<Real>() );
 
+// Matrix-free solution via the (accelerated) primal-dual hybrid gradient
+// method applied to the dual pair (x, y) with || y ||_oo <= lambda
+template<typename Real>
+void TV
+( const AbstractDistMatrix<Real>& b,
+        Real lambda,
+        AbstractDistMatrix<Real>& x,
+  const FirstOrderCtrl<Real>& ctrl );
+template<typename Real>
+void TV
+( const Matrix<Real>& b,
+        Real lambda,
+        Matrix<Real>& x,
+  const FirstOrderCtrl<Real>& ctrl );
+template<typename Real>
+void TV
+( const DistMultiVec<Real>& b,
+        Real lambda,
+        DistMultiVec<Real>& x,
+  const FirstOrderCtrl<Real>& ctrl );
+
 // Long-only portfolio optimization
 // ================================
 // The long-only version of classical (Markowitz) portfolio optimization
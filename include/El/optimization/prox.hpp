@@ -158,6 +158,24 @@ Int TSQR
   const Base<Field>& rho,
   bool relative=false );
 
+// Warm-started subspace iteration which only computes the (predicted)
+// singular triplets above the threshold; V holds the dominant right singular
+// vectors from the previous call on entry and is updated on exit
+template<typename Field>
+Int Subspace
+( Matrix<Field>& A,
+  const Base<Field>& rho,
+  Matrix<Field>& V,
+  Int numIts=2,
+  bool relative=false );
+template<typename Field>
+Int Subspace
+( AbstractDistMatrix<Field>& A,
+  const Base<Field>& rho,
+  AbstractDistMatrix<Field>& V,
+  Int numIts=2,
+  bool relative=false );
+
 } // namespace svt
 
 // Soft-thresholding
@@ -29,6 +29,11 @@ typedef struct {
   ElInt maxIts;
   float maxStepRatio;
   ElKKTSystem system;
+  bool splitDenseColumns;
+  float denseColumnRatio;
+  ElInt maxDenseColumns;
+  bool reuseFactorization;
+  ElInt maxReuseIts;
   bool mehrotra;
   float (*centralityRule)(float,float,float,float);
   bool standardInitShift;
@@ -62,6 +67,11 @@ typedef struct {
   ElInt maxIts;
   double maxStepRatio;
   ElKKTSystem system;
+  bool splitDenseColumns;
+  double denseColumnRatio;
+  ElInt maxDenseColumns;
+  bool reuseFactorization;
+  ElInt maxReuseIts;
   bool mehrotra;
   double (*centralityRule)(double,double,double,double);
   bool standardInitShift;
@@ -116,6 +126,29 @@ typedef struct {
 EL_EXPORT ElError ElADMMCtrlDefault_s( ElADMMCtrl_s* ctrl );
 EL_EXPORT ElError ElADMMCtrlDefault_d( ElADMMCtrl_d* ctrl );
 
+/* Matrix-free first-order methods
+   =============================== */
+typedef struct {
+  ElInt maxIter;
+  float tol;
+  float stepSize;
+  ElInt numPowerIts;
+  bool adaptiveRestart;
+  bool progress;
+} ElFirstOrderCtrl_s;
+
+typedef struct {
+  ElInt maxIter;
+  double tol;
+  double stepSize;
+  ElInt numPowerIts;
+  bool adaptiveRestart;
+  bool progress;
+} ElFirstOrderCtrl_d;
+
+EL_EXPORT ElError ElFirstOrderCtrlDefault_s( ElFirstOrderCtrl_s* ctrl );
+EL_EXPORT ElError ElFirstOrderCtrlDefault_d( ElFirstOrderCtrl_d* ctrl );
+
 /* Linear programs
    =============== */
 typedef enum {
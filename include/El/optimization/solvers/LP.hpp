@@ -261,6 +261,15 @@ void LP
         DirectLPSolution<DistMultiVec<Real>>& solution,
   const lp::direct::Ctrl<Real>& ctrl=lp::direct::Ctrl<Real>(true) );
 
+// Solve a batch of small, independent, dense LPs via a batched Mehrotra
+// Predictor-Corrector scheme. Returns the number of problems which did not
+// converge to the target tolerance.
+template<typename Real>
+Int LP
+( const vector<DirectLPProblem<Matrix<Real>,Matrix<Real>>>& problems,
+        vector<DirectLPSolution<Matrix<Real>>>& solutions,
+  const BatchMehrotraCtrl<Real>& ctrl=BatchMehrotraCtrl<Real>() );
+
 // These interfaces are now deprecated in favor of the above.
 template<typename Real>
 [[deprecated]]
@@ -143,6 +143,20 @@ void QP
         DistMultiVec<Real>& z,
   const qp::direct::Ctrl<Real>& ctrl=qp::direct::Ctrl<Real>() );
 
+// Solve a batch of small, independent, dense QPs in direct conic form. An
+// empty Q[k] is treated as zero, in which case the problem is an LP. Returns
+// the number of problems which did not converge to the target tolerance.
+template<typename Real>
+Int QP
+( const vector<Matrix<Real>>& Q,
+  const vector<Matrix<Real>>& A,
+  const vector<Matrix<Real>>& b,
+  const vector<Matrix<Real>>& c,
+        vector<Matrix<Real>>& x,
+        vector<Matrix<Real>>& y,
+        vector<Matrix<Real>>& z,
+  const BatchMehrotraCtrl<Real>& ctrl=BatchMehrotraCtrl<Real>() );
+
 // Affine conic form
 // -----------------
 template<typename Real>
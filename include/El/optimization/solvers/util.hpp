@@ -72,6 +72,25 @@ struct MehrotraCtrl
     // (larger) augmented formulation.
     KKTSystem system=FULL_KKT;
 
+    // When NORMAL_KKT is used with sparse matrices, columns of A containing
+    // at least 'denseColumnRatio' times as many nonzeros as A has rows (and
+    // at least ten times the average number per column) are removed from the
+    // sparse normal matrix and handled via a low-rank Schur-complement
+    // (Sherman-Morrison-Woodbury) update of its factorization. At most
+    // 'maxDenseColumns' columns are treated in this manner.
+    bool splitDenseColumns=true;
+    Real denseColumnRatio=Real(0.1);
+    Int maxDenseColumns=100;
+
+    // When NORMAL_KKT is used with sparse matrices (and no dense columns were
+    // split off), the factorization of the normal matrix may be kept from one
+    // iteration to the next and reused as a preconditioner for the Conjugate
+    // Gradient method applied to the current normal equations. A fresh
+    // factorization is only computed once a solve would require more than
+    // 'maxReuseIts' iterations.
+    bool reuseFactorization=false;
+    Int maxReuseIts=20;
+
     // Use Mehrotra's second-order corrector?
     // TODO(poulson): Add support for Gondzio's correctors
     bool mehrotra=true;
@@ -161,6 +180,36 @@ struct MehrotraCtrl
     // replace the default, (muAff/mu)^3
 };
 
+// Batched Mehrotra Predictor-Corrector for many small, dense problems
+// ===================================================================
+// The problems are advanced in lockstep, in groups of at most 'batchSize',
+// with each iteration threaded over the (still active) problems of the group,
+// and converged problems being retired from the active set.
+template<typename Real>
+struct BatchMehrotraCtrl
+{
+    // Retire a problem once its relative primal and dual infeasibilities and
+    // its relative duality gap are all below this tolerance
+    Real targetTol=Pow(limits::Epsilon<Real>(),Real(0.5));
+
+    // The maximum number of predictor-corrector steps taken for each problem
+    Int maxIts=100;
+
+    // If a step of length alpha would hit the boundary, instead step a distance
+    // of 'maxStepRatio*alpha'.
+    Real maxStepRatio=Real(0.99);
+
+    // The (permanent) regularization of the primal and dual blocks of the
+    // augmented KKT systems, which makes them quasi-definite so that they may
+    // be factored without pivoting
+    Real reg=Pow(limits::Epsilon<Real>(),Real(0.75));
+
+    // The number of problems to keep workspaces for at a time
+    Int batchSize=1000;
+
+    bool progress=false;
+};
+
 // Alternating Direction Method of Multipliers
 // ===========================================
 template<typename Real>
@@ -176,6 +225,23 @@ struct ADMMCtrl
     bool print=true;
 };
 
+// Matrix-free first-order methods (FISTA and PDHG)
+// ================================================
+template<typename Real>
+struct FirstOrderCtrl
+{
+    Int maxIter=5000;
+    // Stop once || x - xOld ||_F <= tol max(|| x ||_F,1)
+    Real tol=Real(1e-6);
+    // If non-positive, the step size is chosen from a power-method estimate
+    // of the relevant operator norm
+    Real stepSize=Real(0);
+    Int numPowerIts=20;
+    // Restart the momentum of FISTA when it opposes the proximal step
+    bool adaptiveRestart=true;
+    bool progress=false;
+};
+
 } // namespace El
 
 #endif // ifndef EL_OPTIMIZATION_SOLVERS_UTIL_HPP
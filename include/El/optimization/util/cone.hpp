@@ -12,6 +12,72 @@
 namespace El {
 namespace cone {
 
+// Compact cone tables
+// ===================
+// A description of a product of cones over a DistMultiVec which avoids the
+// per-entry 'orders' and 'firstInds' vectors. The cones which lie entirely
+// within this process's block of rows are stored as (local offset, order)
+// pairs and can be handled without any communication, while the (typically
+// few) cones which straddle a process boundary are enumerated globally so
+// that an entire cone-wise operation over them requires a single reduction
+// of length 'numSplitCones'.
+struct Table
+{
+    Int height=0;
+    Int numCones=0;
+    Int firstLocalRow=0;
+    Int localHeight=0;
+
+    // The cones owned entirely by this process
+    vector<Int> localBegins;
+    vector<Int> localOrders;
+
+    // The cones which straddle process boundaries. 'splitIndices' maps each
+    // locally-touched split cone to its position within the global list of
+    // split cones, and [splitLocalBegins[k],splitLocalEnds[k]) is the local
+    // row range of its intersection with this process.
+    Int numSplitCones=0;
+    vector<Int> splitIndices;
+    vector<Int> splitFirstInds;
+    vector<Int> splitLocalBegins;
+    vector<Int> splitLocalEnds;
+};
+
+// Form a cone table from the per-entry cone descriptions
+void BuildTable
+( const DistMultiVec<Int>& orders,
+  const DistMultiVec<Int>& firstInds,
+        Table& table );
+// Form a cone table from the (replicated) list of cone orders, where the
+// cones are assumed to be contiguous and listed in order (cones of order zero
+// are skipped)
+void BuildTable
+( const vector<Int>& coneOrders,
+  const Grid& grid,
+        Table& table );
+
+// Call 'func(begin,end,root)' for the local row range [begin,end) of each
+// (possibly partial) cone which intersects this process's block of rows, where
+// 'root' is true if and only if 'begin' is the root of the cone
+template<typename Function>
+void ForEachLocalCone( const Table& table, Function func )
+{
+    const Int numLocalCones = table.localBegins.size();
+    for( Int k=0; k<numLocalCones; ++k )
+    {
+        const Int begin = table.localBegins[k];
+        func( begin, begin+table.localOrders[k], true );
+    }
+    const Int numLocalSplits = table.splitIndices.size();
+    for( Int k=0; k<numLocalSplits; ++k )
+    {
+        const Int begin = table.splitLocalBegins[k];
+        func
+        ( begin, table.splitLocalEnds[k],
+          begin+table.firstLocalRow == table.splitFirstInds[k] );
+    }
+}
+
 // Broadcast
 // =========
 // Replicate the entry in the root position in each cone over the entire cone
@@ -30,6 +96,8 @@ void Broadcast
 (       DistMultiVec<Field>& x,
   const DistMultiVec<Int>& orders,
   const DistMultiVec<Int>& firstInds, Int cutoff=1000 );
+template<typename Field>
+void Broadcast( DistMultiVec<Field>& x, const Table& table );
 
 // AllReduce
 // =========
@@ -52,6 +120,9 @@ void AllReduce
   const DistMultiVec<Int>& orders,
   const DistMultiVec<Int>& firstInds,
   mpi::Op op=mpi::SUM, Int cutoff=1000 );
+template<typename Field>
+void AllReduce
+( DistMultiVec<Field>& x, const Table& table, mpi::Op op=mpi::SUM );
 
 // A specialization of Ruiz scaling which respects a product of cones
 // ==================================================================
@@ -42,6 +42,13 @@ void Apply
   const DistMultiVec<Int>& orders,
   const DistMultiVec<Int>& firstInds,
         Int cutoff=1000 );
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>>
+void Apply
+( const DistMultiVec<Real>& x,
+  const DistMultiVec<Real>& y,
+        DistMultiVec<Real>& z,
+  const cone::Table& table );
 
 // Overwrite y with x o y
 // ----------------------
@@ -68,6 +75,12 @@ void Apply
   const DistMultiVec<Int>& orders,
   const DistMultiVec<Int>& firstInds,
   Int cutoff=1000 );
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>>
+void Apply
+( const DistMultiVec<Real>& x,
+        DistMultiVec<Real>& y,
+  const cone::Table& table );
 
 // Apply the quadratic representation of a product of SOCs to a vector
 // ===================================================================
@@ -97,6 +110,13 @@ void ApplyQuadratic
   const DistMultiVec<Int>& orders,
   const DistMultiVec<Int>& firstInds,
   Int cutoff=1000 );
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>>
+void ApplyQuadratic
+( const DistMultiVec<Real>& x,
+  const DistMultiVec<Real>& y,
+        DistMultiVec<Real>& z,
+  const cone::Table& table );
 
 // Overwrite y with Q_x y
 // ----------------------
@@ -123,12 +143,19 @@ void ApplyQuadratic
   const DistMultiVec<Int>& orders,
   const DistMultiVec<Int>& firstInds,
   Int cutoff=1000 );
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>>
+void ApplyQuadratic
+( const DistMultiVec<Real>& x,
+        DistMultiVec<Real>& y,
+  const cone::Table& table );
 
 // Degree
 // ======
 Int Degree( const Matrix<Int>& firstInds );
 Int Degree( const AbstractDistMatrix<Int>& firstInds );
 Int Degree( const DistMultiVec<Int>& firstInds );
+Int Degree( const cone::Table& table );
 
 // Determinants
 // ============
@@ -155,6 +182,12 @@ void Dets
   const DistMultiVec<Int>& orders,
   const DistMultiVec<Int>& firstInds,
   Int cutoff=1000 );
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>>
+void Dets
+( const DistMultiVec<Real>& x,
+        DistMultiVec<Real>& d,
+  const cone::Table& table );
 
 // Dot products of sequences of second-order cones
 // ===============================================
@@ -184,6 +217,13 @@ void Dots
   const DistMultiVec<Int>& orders,
   const DistMultiVec<Int>& firstInds,
   Int cutoff=1000 );
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>>
+void Dots
+( const DistMultiVec<Real>& x,
+  const DistMultiVec<Real>& y,
+        DistMultiVec<Real>& z,
+  const cone::Table& table );
 
 // Embedding maps
 // ==============
@@ -254,6 +294,12 @@ void Inverse
   const DistMultiVec<Int>& orders,
   const DistMultiVec<Int>& firstInds,
   Int cutoff=1000 );
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>>
+void Inverse
+( const DistMultiVec<Real>& x,
+        DistMultiVec<Real>& xInv,
+  const cone::Table& table );
 
 // Lower norms
 // ===========
@@ -280,6 +326,12 @@ void LowerNorms
   const DistMultiVec<Int>& orders,
   const DistMultiVec<Int>& firstInds,
   Int cutoff=1000 );
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>>
+void LowerNorms
+( const DistMultiVec<Real>& x,
+        DistMultiVec<Real>& lowerNorms,
+  const cone::Table& table );
 
 // Max eigenvalues
 // ===============
@@ -356,6 +408,13 @@ Real MaxStep
   const DistMultiVec<Int>& firstInds,
   Real upperBound=limits::Max<Real>(),
   Int cutoff=1000 );
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>>
+Real MaxStep
+( const DistMultiVec<Real>& x,
+  const DistMultiVec<Real>& y,
+  const cone::Table& table,
+  Real upperBound=limits::Max<Real>() );
 
 // Min eigenvalues
 // ===============
@@ -403,6 +462,9 @@ Real MinEig
   const DistMultiVec<Int>& orders,
   const DistMultiVec<Int>& firstInds,
   Int cutoff=1000 );
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>>
+Real MinEig( const DistMultiVec<Real>& x, const cone::Table& table );
 
 // Compute an SOC Nesterov-Todd point
 // ==================================
@@ -434,6 +496,13 @@ void NesterovTodd
   const DistMultiVec<Int>& orders,
   const DistMultiVec<Int>& firstInds,
   Int cutoff=1000 );
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>>
+void NesterovTodd
+( const DistMultiVec<Real>& s,
+  const DistMultiVec<Real>& z,
+        DistMultiVec<Real>& w,
+  const cone::Table& table );
 
 // Number of non-SOC members
 // =========================
@@ -458,6 +527,9 @@ Int NumOutside
   const DistMultiVec<Int>& orders,
   const DistMultiVec<Int>& firstInds,
   Int cutoff=1000 );
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>>
+Int NumOutside( const DistMultiVec<Real>& x, const cone::Table& table );
 
 // Push into SOC
 // ==============
@@ -484,6 +556,12 @@ void PushInto
   const DistMultiVec<Int>& firstInds,
   Real minDist=0,
   Int cutoff=1000 );
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>>
+void PushInto
+(       DistMultiVec<Real>& x,
+  const cone::Table& table,
+  Real minDist=0 );
 
 // Push pair into SOC
 // ==================
@@ -516,6 +594,14 @@ void PushPairInto
   const DistMultiVec<Int>& firstInds,
   Real wMaxNormLimit,
   Int cutoff=1000 );
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>>
+void PushPairInto
+(       DistMultiVec<Real>& s,
+        DistMultiVec<Real>& z,
+  const DistMultiVec<Real>& w,
+  const cone::Table& table,
+  Real wMaxNormLimit );
 
 // Reflect
 // =======
@@ -537,6 +623,9 @@ void Reflect
 (       DistMultiVec<Real>& x,
   const DistMultiVec<Int>& orders,
   const DistMultiVec<Int>& firstInds );
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>>
+void Reflect( DistMultiVec<Real>& x, const cone::Table& table );
 
 // Shift
 // =====
@@ -562,6 +651,12 @@ void Shift
         Real shift,
   const DistMultiVec<Int>& orders,
   const DistMultiVec<Int>& firstInds );
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>>
+void Shift
+(       DistMultiVec<Real>& x,
+        Real shift,
+  const cone::Table& table );
 
 // Compute the square-root in the product SOC Jordan algebra
 // =========================================================
@@ -588,6 +683,12 @@ void SquareRoot
   const DistMultiVec<Int>& orders,
   const DistMultiVec<Int>& firstInds,
   Int cutoff=1000 );
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>>
+void SquareRoot
+( const DistMultiVec<Real>& x,
+        DistMultiVec<Real>& xRoot,
+  const cone::Table& table );
 
 } // namespace soc
 } // namespace El
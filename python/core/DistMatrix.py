@@ -585,6 +585,20 @@ class DistMatrix(object):
       else: DataExcept()
     return A
 
+  # A (zero-copy) NumPy view of the local matrix
+  def LocalToNumPy(self,locked=False):
+    return self.Matrix(locked).ToNumPy()
+
+  # Overwrite the local matrix using a NumPy array
+  def SetLocalFromNumPy(self,array):
+    arr = np.asarray(array)
+    if arr.ndim == 1:
+      arr = arr.reshape((arr.size,1))
+    if arr.shape != (self.LocalHeight(),self.LocalWidth()):
+      raise Exception('Array did not match the local dimensions')
+    if arr.size > 0:
+      self.LocalToNumPy()[:,:] = arr
+
   # Return the amount of locally allocated memory
   # ---------------------------------------------
   lib.ElDistMatrixAllocatedMemory_i.argtypes = \
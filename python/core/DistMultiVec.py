@@ -179,7 +179,7 @@ class DistMultiVec(object):
   lib.ElDistMultiVecLockedMatrix_z.argtypes = \
     [c_void_p,POINTER(c_void_p)]
   def Matrix(self,locked=False):
-    A = M.Matrix(dTag,False)
+    A = M.Matrix(self.tag,False)
     args = [self.obj,pointer(A.obj)]
     if locked:
       if   self.tag == iTag: lib.ElDistMultiVecLockedMatrix_i(*args)
@@ -197,6 +197,20 @@ class DistMultiVec(object):
       else: DataExcept()
     return A
 
+  # A (zero-copy) NumPy view of the local rows
+  def LocalToNumPy(self,locked=False):
+    return self.Matrix(locked).ToNumPy()
+
+  # Overwrite the local rows using a NumPy array
+  def SetLocalFromNumPy(self,array):
+    arr = np.asarray(array)
+    if arr.ndim == 1:
+      arr = arr.reshape((arr.size,1))
+    if arr.shape != (self.LocalHeight(),self.Width()):
+      raise Exception('Array did not match the local dimensions')
+    if arr.size > 0:
+      self.LocalToNumPy()[:,:] = arr
+
   lib.ElDistMultiVecGrid_i.argtypes = \
   lib.ElDistMultiVecGrid_s.argtypes = \
   lib.ElDistMultiVecGrid_d.argtypes = \
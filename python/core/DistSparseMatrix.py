@@ -268,6 +268,92 @@ class DistSparseMatrix(object):
     elif self.tag == zTag: lib.ElDistSparseMatrixProcessLocalQueues_z(*args)
     else: DataExcept()
 
+  # Bulk ingestion
+  # --------------
+  lib.ElDistSparseMatrixQueueUpdates_i.argtypes = \
+    [c_void_p,iType,POINTER(iType),POINTER(iType),POINTER(iType),bType]
+  lib.ElDistSparseMatrixQueueUpdates_s.argtypes = \
+    [c_void_p,iType,POINTER(iType),POINTER(iType),POINTER(sType),bType]
+  lib.ElDistSparseMatrixQueueUpdates_d.argtypes = \
+    [c_void_p,iType,POINTER(iType),POINTER(iType),POINTER(dType),bType]
+  lib.ElDistSparseMatrixQueueUpdates_c.argtypes = \
+    [c_void_p,iType,POINTER(iType),POINTER(iType),POINTER(cType),bType]
+  lib.ElDistSparseMatrixQueueUpdates_z.argtypes = \
+    [c_void_p,iType,POINTER(iType),POINTER(iType),POINTER(zType),bType]
+  def QueueUpdates(self,rows,cols,values,passive=False):
+    rowArr, rowBuf = NumPyBuffer(rows,iTag)
+    colArr, colBuf = NumPyBuffer(cols,iTag)
+    valArr, valBuf = NumPyBuffer(values,self.tag)
+    if rowArr.size != colArr.size or rowArr.size != valArr.size:
+      raise Exception('Coordinate arrays must be of the same length')
+    args = [self.obj,rowArr.size,rowBuf,colBuf,valBuf,passive]
+    if   self.tag == iTag: lib.ElDistSparseMatrixQueueUpdates_i(*args)
+    elif self.tag == sTag: lib.ElDistSparseMatrixQueueUpdates_s(*args)
+    elif self.tag == dTag: lib.ElDistSparseMatrixQueueUpdates_d(*args)
+    elif self.tag == cTag: lib.ElDistSparseMatrixQueueUpdates_c(*args)
+    elif self.tag == zTag: lib.ElDistSparseMatrixQueueUpdates_z(*args)
+    else: DataExcept()
+
+  lib.ElDistSparseMatrixQueueLocalUpdates_i.argtypes = \
+    [c_void_p,iType,POINTER(iType),POINTER(iType),POINTER(iType)]
+  lib.ElDistSparseMatrixQueueLocalUpdates_s.argtypes = \
+    [c_void_p,iType,POINTER(iType),POINTER(iType),POINTER(sType)]
+  lib.ElDistSparseMatrixQueueLocalUpdates_d.argtypes = \
+    [c_void_p,iType,POINTER(iType),POINTER(iType),POINTER(dType)]
+  lib.ElDistSparseMatrixQueueLocalUpdates_c.argtypes = \
+    [c_void_p,iType,POINTER(iType),POINTER(iType),POINTER(cType)]
+  lib.ElDistSparseMatrixQueueLocalUpdates_z.argtypes = \
+    [c_void_p,iType,POINTER(iType),POINTER(iType),POINTER(zType)]
+  def QueueLocalUpdates(self,localRows,cols,values):
+    rowArr, rowBuf = NumPyBuffer(localRows,iTag)
+    colArr, colBuf = NumPyBuffer(cols,iTag)
+    valArr, valBuf = NumPyBuffer(values,self.tag)
+    if rowArr.size != colArr.size or rowArr.size != valArr.size:
+      raise Exception('Coordinate arrays must be of the same length')
+    args = [self.obj,rowArr.size,rowBuf,colBuf,valBuf]
+    if   self.tag == iTag: lib.ElDistSparseMatrixQueueLocalUpdates_i(*args)
+    elif self.tag == sTag: lib.ElDistSparseMatrixQueueLocalUpdates_s(*args)
+    elif self.tag == dTag: lib.ElDistSparseMatrixQueueLocalUpdates_d(*args)
+    elif self.tag == cTag: lib.ElDistSparseMatrixQueueLocalUpdates_c(*args)
+    elif self.tag == zTag: lib.ElDistSparseMatrixQueueLocalUpdates_z(*args)
+    else: DataExcept()
+
+  lib.ElDistSparseMatrixImportLocalCSR_i.argtypes = \
+    [c_void_p,iType,iType,POINTER(iType),POINTER(iType),POINTER(iType)]
+  lib.ElDistSparseMatrixImportLocalCSR_s.argtypes = \
+    [c_void_p,iType,iType,POINTER(iType),POINTER(iType),POINTER(sType)]
+  lib.ElDistSparseMatrixImportLocalCSR_d.argtypes = \
+    [c_void_p,iType,iType,POINTER(iType),POINTER(iType),POINTER(dType)]
+  lib.ElDistSparseMatrixImportLocalCSR_c.argtypes = \
+    [c_void_p,iType,iType,POINTER(iType),POINTER(iType),POINTER(cType)]
+  lib.ElDistSparseMatrixImportLocalCSR_z.argtypes = \
+    [c_void_p,iType,iType,POINTER(iType),POINTER(iType),POINTER(zType)]
+  def ImportLocalCSR(self,height,width,localRowOffsets,cols,values):
+    offArr, offBuf = NumPyBuffer(localRowOffsets,iTag)
+    colArr, colBuf = NumPyBuffer(cols,iTag)
+    valArr, valBuf = NumPyBuffer(values,self.tag)
+    # The number of locally-owned rows is determined by the new height
+    self.Resize(height,width)
+    if offArr.size != self.LocalHeight()+1:
+      raise Exception('Expected LocalHeight()+1 row offsets')
+    numLocalEntries = offArr[-1] - offArr[0]
+    if colArr.size < numLocalEntries or valArr.size < numLocalEntries:
+      raise Exception('Column and value arrays were too short')
+    args = [self.obj,height,width,offBuf,colBuf,valBuf]
+    if   self.tag == iTag: lib.ElDistSparseMatrixImportLocalCSR_i(*args)
+    elif self.tag == sTag: lib.ElDistSparseMatrixImportLocalCSR_s(*args)
+    elif self.tag == dTag: lib.ElDistSparseMatrixImportLocalCSR_d(*args)
+    elif self.tag == cTag: lib.ElDistSparseMatrixImportLocalCSR_c(*args)
+    elif self.tag == zTag: lib.ElDistSparseMatrixImportLocalCSR_z(*args)
+    else: DataExcept()
+
+  # Import the locally-owned rows of a height x width matrix from any
+  # scipy.sparse matrix (CSR arrays are passed through directly)
+  def ImportLocalSciPy(self,height,width,ALoc):
+    if ALoc.format != 'csr':
+      ALoc = ALoc.tocsr()
+    self.ImportLocalCSR(height,width,ALoc.indptr,ALoc.indices,ALoc.data)
+
   # Queries
   # =======
   lib.ElDistSparseMatrixHeight_i.argtypes = \
@@ -437,11 +437,29 @@ class Matrix(object):
     entrySize = TagToSize(self.tag)
     npType = TagToNumpyType(self.tag)
     bufSize = entrySize*ldim*n
-    if locked: buf = buffer_from_memory(self.LockedBuffer(),bufSize)
+    if locked: buf = buffer_from_memory(self.Buffer(True),bufSize)
     else:      buf = buffer_from_memory_RW(self.Buffer(),bufSize)
     return np.ndarray(shape=(m,n),strides=(entrySize,ldim*entrySize),
                         buffer=buf,dtype=npType)
 
+  # Fill the matrix from a two-dimensional NumPy array. If 'view' is true and
+  # the array is already column-major with the appropriate datatype, the
+  # matrix simply attaches to its buffer (and the array must then outlive the
+  # matrix); otherwise the entries are copied.
+  def FromNumPy(self,array,view=False):
+    arr = np.asarray(array)
+    if arr.ndim == 1:
+      arr = arr.reshape((arr.size,1))
+    m, n = arr.shape
+    if view and arr.dtype == TagToNumpyType(self.tag) and \
+       arr.flags['F_CONTIGUOUS']:
+      buf = arr.ctypes.data_as(POINTER(TagToType(self.tag)))
+      self.Attach(m,n,buf,max(m,1),not arr.flags['WRITEABLE'])
+    else:
+      self.Resize(m,n)
+      if m > 0 and n > 0:
+        self.ToNumPy()[:,:] = arr
+
   lib.ElView_i.argtypes = \
   lib.ElView_s.argtypes = \
   lib.ElView_d.argtypes = \
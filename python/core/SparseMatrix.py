@@ -166,6 +166,66 @@ class SparseMatrix(object):
     elif self.tag == zTag: lib.ElSparseMatrixProcessQueues_z(*args)
     else: DataExcept()
 
+  # Bulk ingestion
+  # --------------
+  lib.ElSparseMatrixQueueUpdates_i.argtypes = \
+    [c_void_p,iType,POINTER(iType),POINTER(iType),POINTER(iType)]
+  lib.ElSparseMatrixQueueUpdates_s.argtypes = \
+    [c_void_p,iType,POINTER(iType),POINTER(iType),POINTER(sType)]
+  lib.ElSparseMatrixQueueUpdates_d.argtypes = \
+    [c_void_p,iType,POINTER(iType),POINTER(iType),POINTER(dType)]
+  lib.ElSparseMatrixQueueUpdates_c.argtypes = \
+    [c_void_p,iType,POINTER(iType),POINTER(iType),POINTER(cType)]
+  lib.ElSparseMatrixQueueUpdates_z.argtypes = \
+    [c_void_p,iType,POINTER(iType),POINTER(iType),POINTER(zType)]
+  def QueueUpdates(self,rows,cols,values):
+    rowArr, rowBuf = NumPyBuffer(rows,iTag)
+    colArr, colBuf = NumPyBuffer(cols,iTag)
+    valArr, valBuf = NumPyBuffer(values,self.tag)
+    if rowArr.size != colArr.size or rowArr.size != valArr.size:
+      raise Exception('Coordinate arrays must be of the same length')
+    args = [self.obj,rowArr.size,rowBuf,colBuf,valBuf]
+    if   self.tag == iTag: lib.ElSparseMatrixQueueUpdates_i(*args)
+    elif self.tag == sTag: lib.ElSparseMatrixQueueUpdates_s(*args)
+    elif self.tag == dTag: lib.ElSparseMatrixQueueUpdates_d(*args)
+    elif self.tag == cTag: lib.ElSparseMatrixQueueUpdates_c(*args)
+    elif self.tag == zTag: lib.ElSparseMatrixQueueUpdates_z(*args)
+    else: DataExcept()
+
+  lib.ElSparseMatrixImportCSR_i.argtypes = \
+    [c_void_p,iType,iType,POINTER(iType),POINTER(iType),POINTER(iType)]
+  lib.ElSparseMatrixImportCSR_s.argtypes = \
+    [c_void_p,iType,iType,POINTER(iType),POINTER(iType),POINTER(sType)]
+  lib.ElSparseMatrixImportCSR_d.argtypes = \
+    [c_void_p,iType,iType,POINTER(iType),POINTER(iType),POINTER(dType)]
+  lib.ElSparseMatrixImportCSR_c.argtypes = \
+    [c_void_p,iType,iType,POINTER(iType),POINTER(iType),POINTER(cType)]
+  lib.ElSparseMatrixImportCSR_z.argtypes = \
+    [c_void_p,iType,iType,POINTER(iType),POINTER(iType),POINTER(zType)]
+  def ImportCSR(self,height,width,rowOffsets,cols,values):
+    offArr, offBuf = NumPyBuffer(rowOffsets,iTag)
+    colArr, colBuf = NumPyBuffer(cols,iTag)
+    valArr, valBuf = NumPyBuffer(values,self.tag)
+    if offArr.size != height+1:
+      raise Exception('Expected height+1 row offsets')
+    numEntries = offArr[-1] - offArr[0]
+    if colArr.size < numEntries or valArr.size < numEntries:
+      raise Exception('Column and value arrays were too short')
+    args = [self.obj,height,width,offBuf,colBuf,valBuf]
+    if   self.tag == iTag: lib.ElSparseMatrixImportCSR_i(*args)
+    elif self.tag == sTag: lib.ElSparseMatrixImportCSR_s(*args)
+    elif self.tag == dTag: lib.ElSparseMatrixImportCSR_d(*args)
+    elif self.tag == cTag: lib.ElSparseMatrixImportCSR_c(*args)
+    elif self.tag == zTag: lib.ElSparseMatrixImportCSR_z(*args)
+    else: DataExcept()
+
+  # Import any scipy.sparse matrix (CSR arrays are passed through directly)
+  def ImportSciPy(self,A):
+    if A.format != 'csr':
+      A = A.tocsr()
+    height, width = A.shape
+    self.ImportCSR(height,width,A.indptr,A.indices,A.data)
+
   # Queries
   # =======
   lib.ElSparseMatrixHeight_i.argtypes = \
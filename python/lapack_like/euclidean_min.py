@@ -8,6 +8,7 @@
 #
 from ..core import *
 from factor import *
+from util import *
 import ctypes
 
 # Least squares
@@ -31,14 +32,18 @@ class SQSDCtrl_d(ctypes.Structure):
   def __init__(self):
     lib.ElSQSDCtrlDefault_d(pointer(self))
 
+(LS_AUGMENTED,LS_SPARSE_QR)=(0,1)
+
 class LeastSquaresCtrl_s(ctypes.Structure):
-  _fields_ = [("scaleTwoNorm",bType),("basisSize",iType),("alpha",sType),
+  _fields_ = [("alg",c_uint),("qrCtrl",BisectCtrl),
+              ("scaleTwoNorm",bType),("basisSize",iType),("alpha",sType),
               ("sqsdCtrl",SQSDCtrl_s),
               ("equilibrate",bType),("progress",bType),("time",bType)]
   def __init__(self):
     lib.ElLeastSquaresCtrlDefault_s(pointer(self))
 class LeastSquaresCtrl_d(ctypes.Structure):
-  _fields_ = [("scaleTwoNorm",bType),("basisSize",iType),("alpha",dType),
+  _fields_ = [("alg",c_uint),("qrCtrl",BisectCtrl),
+              ("scaleTwoNorm",bType),("basisSize",iType),("alpha",dType),
               ("sqsdCtrl",SQSDCtrl_d),
               ("equilibrate",bType),("progress",bType),("time",bType)]
   def __init__(self):
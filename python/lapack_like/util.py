@@ -9,6 +9,19 @@
 from ..core import *
 import ctypes
 
+# Graph reordering
+# ================
+(SPARSE_ORDERING_AUTO,SPARSE_NESTED_DISSECTION,SPARSE_MINIMUM_DEGREE)=(0,1,2)
+
+lib.ElBisectCtrlDefault.argtypes = [c_void_p]
+class BisectCtrl(ctypes.Structure):
+  _fields_ = [("sequential",bType),("numDistSeps",iType),
+              ("numSeqSeps",iType),("cutoff",iType),
+              ("storeFactRecvInds",bType),("native",bType),
+              ("ordering",c_uint),("minDegreeCutoff",iType)]
+  def __init__(self):
+    lib.ElBisectCtrlDefault(pointer(self))
+
 # Median
 # ======
 lib.ElMedian_i.argtypes = [c_void_p,POINTER(iType)]
@@ -622,19 +622,21 @@ def RNNLS(A,b,rho,ctrl=None):
 lib.ElNNLSCtrlDefault_s.argtypes = \
 lib.ElNNLSCtrlDefault_d.argtypes = \
   [c_void_p]
-(NNLS_ADMM,NNLS_QP,NNLS_SOCP)=(0,1,2)
+(NNLS_ADMM,NNLS_QP,NNLS_SOCP,NNLS_FISTA)=(0,1,2,3)
 class NNLSCtrl_s(ctypes.Structure):
   _fields_ = [("approach",c_uint),
               ("admmCtrl",ADMMCtrl_s),
               ("qpCtrl",QPDirectCtrl_s),
-              ("socpCtrl",SOCPAffineCtrl_s)]
+              ("socpCtrl",SOCPAffineCtrl_s),
+              ("fistaCtrl",FirstOrderCtrl_s)]
   def __init__(self):
     lib.ElNNLSCtrlDefault_s(pointer(self))
 class NNLSCtrl_d(ctypes.Structure):
   _fields_ = [("approach",c_uint),
               ("admmCtrl",ADMMCtrl_d),
               ("qpCtrl",QPDirectCtrl_d),
-              ("socpCtrl",SOCPAffineCtrl_d)]
+              ("socpCtrl",SOCPAffineCtrl_d),
+              ("fistaCtrl",FirstOrderCtrl_d)]
   def __init__(self):
     lib.ElNNLSCtrlDefault_d(pointer(self))
 
@@ -721,15 +723,19 @@ def NNLS(A,b,ctrl=None):
 
 # Non-negative matrix factorization
 # =================================
+(NMF_NNLS,NMF_HALS,NMF_MULTIPLICATIVE)=(0,1,2)
+
 lib.ElNMFCtrlDefault_s.argtypes = \
 lib.ElNMFCtrlDefault_d.argtypes = \
   [c_void_p]
 class NMFCtrl_s(ctypes.Structure):
-  _fields_ = [("nnlsCtrl",NNLSCtrl_s),("maxIter",iType)]
+  _fields_ = [("nnlsCtrl",NNLSCtrl_s),("maxIter",iType),
+              ("approach",c_uint),("tol",sType),("progress",bType)]
   def __init__(self):
     lib.ElNMFCtrlDefault_s(pointer(self))
 class NMFCtrl_d(ctypes.Structure):
-  _fields_ = [("nnlsCtrl",NNLSCtrl_d),("maxIter",iType)]
+  _fields_ = [("nnlsCtrl",NNLSCtrl_d),("maxIter",iType),
+              ("approach",c_uint),("tol",dType),("progress",bType)]
   def __init__(self):
     lib.ElNMFCtrlDefault_d(pointer(self))
 
@@ -740,9 +746,13 @@ lib.ElNMFDist_d.argtypes = \
   [c_void_p,c_void_p,c_void_p]
 lib.ElNMFX_s.argtypes = \
 lib.ElNMFXDist_s.argtypes = \
+lib.ElNMFXSparse_s.argtypes = \
+lib.ElNMFXDistSparse_s.argtypes = \
   [c_void_p,c_void_p,c_void_p,NMFCtrl_s]
 lib.ElNMFX_d.argtypes = \
 lib.ElNMFXDist_d.argtypes = \
+lib.ElNMFXSparse_d.argtypes = \
+lib.ElNMFXDistSparse_d.argtypes = \
   [c_void_p,c_void_p,c_void_p,NMFCtrl_d]
 
 def NMF(A,ctrl=None):
@@ -788,13 +798,15 @@ lib.ElBPDNCtrlDefault_s.argtypes = \
 lib.ElBPDNCtrlDefault_d.argtypes = \
   [c_void_p]
 class BPDNCtrl_s(ctypes.Structure):
-  _fields_ = [("useIPM",bType),
-              ("admmCtrl",BPDNADMMCtrl_s),("ipmCtrl",QPAffineCtrl_s)]
+  _fields_ = [("useIPM",bType),("useFISTA",bType),
+              ("admmCtrl",BPDNADMMCtrl_s),("ipmCtrl",QPAffineCtrl_s),
+              ("fistaCtrl",FirstOrderCtrl_s)]
   def __init__(self):
     lib.ElBPDNCtrlDefault_s(pointer(self))
 class BPDNCtrl_d(ctypes.Structure):
-  _fields_ = [("useIPM",bType),
-              ("admmCtrl",BPDNADMMCtrl_d),("ipmCtrl",QPAffineCtrl_d)]
+  _fields_ = [("useIPM",bType),("useFISTA",bType),
+              ("admmCtrl",BPDNADMMCtrl_d),("ipmCtrl",QPAffineCtrl_d),
+              ("fistaCtrl",FirstOrderCtrl_d)]
   def __init__(self):
     lib.ElBPDNCtrlDefault_d(pointer(self))
 
@@ -978,14 +990,16 @@ lib.ElRPCACtrlDefault_s.argtypes = \
 lib.ElRPCACtrlDefault_d.argtypes = \
   [c_void_p]
 class RPCACtrl_s(ctypes.Structure):
-  _fields_ = [("useALM",bType),("usePivQR",bType),("progress",bType),
-              ("numPivSteps",iType),("maxIts",iType),
+  _fields_ = [("useALM",bType),("usePivQR",bType),("useSubspace",bType),
+              ("progress",bType),
+              ("numPivSteps",iType),("numSubspaceIts",iType),("maxIts",iType),
               ("tau",sType),("beta",sType),("rho",sType),("tol",sType)]
   def __init__(self):
     lib.ElRPCACtrlDefault_s(pointer(self))
 class RPCACtrl_d(ctypes.Structure):
-  _fields_ = [("useALM",bType),("usePivQR",bType),("progress",bType),
-              ("numPivSteps",iType),("maxIts",iType),
+  _fields_ = [("useALM",bType),("usePivQR",bType),("useSubspace",bType),
+              ("progress",bType),
+              ("numPivSteps",iType),("numSubspaceIts",iType),("maxIts",iType),
               ("tau",dType),("beta",dType),("rho",dType),("tol",dType)]
   def __init__(self):
     lib.ElRPCACtrlDefault_d(pointer(self))
@@ -1061,14 +1075,16 @@ class SparseInvCovCtrl_s(ctypes.Structure):
   _fields_ = [("rho",sType),("alpha",sType),
               ("maxIter",iType),
               ("absTol",sType),("relTol",sType),
-              ("progress",bType)]
+              ("progress",bType),
+              ("screen",bType),("maxLocalBlockSize",iType)]
   def __init__(self):
     lib.ElSparseInvCovCtrlDefault_s(pointer(self))
 class SparseInvCovCtrl_d(ctypes.Structure):
   _fields_ = [("rho",dType),("alpha",dType),
               ("maxIter",iType),
               ("absTol",dType),("relTol",dType),
-              ("progress",bType)]
+              ("progress",bType),
+              ("screen",bType),("maxLocalBlockSize",iType)]
   def __init__(self):
     lib.ElSparseInvCovCtrlDefault_d(pointer(self))
 
@@ -1137,15 +1153,33 @@ def SparseInvCov(D,lambdaPre,ctrl=None):
 
 # Support Vector Machine
 # ======================
+(SVM_IPM,SVM_COORDINATE_DESCENT)=(0,1)
+
+lib.ElSVMCoordinateDescentCtrlDefault_s.argtypes = \
+lib.ElSVMCoordinateDescentCtrlDefault_d.argtypes = \
+  [c_void_p]
+class SVMCoordinateDescentCtrl_s(ctypes.Structure):
+  _fields_ = [("squaredHinge",bType),("shrink",bType),
+              ("maxIter",iType),("tol",sType),("progress",bType)]
+  def __init__(self):
+    lib.ElSVMCoordinateDescentCtrlDefault_s(pointer(self))
+class SVMCoordinateDescentCtrl_d(ctypes.Structure):
+  _fields_ = [("squaredHinge",bType),("shrink",bType),
+              ("maxIter",iType),("tol",dType),("progress",bType)]
+  def __init__(self):
+    lib.ElSVMCoordinateDescentCtrlDefault_d(pointer(self))
+
 lib.ElSVMCtrlDefault_s.argtypes = \
 lib.ElSVMCtrlDefault_d.argtypes = \
   [c_void_p]
 class SVMCtrl_s(ctypes.Structure):
-  _fields_ = [("ipmCtrl",QPAffineCtrl_s)]
+  _fields_ = [("approach",c_uint),("ipmCtrl",QPAffineCtrl_s),
+              ("cdCtrl",SVMCoordinateDescentCtrl_s)]
   def __init__(self):
     lib.ElSVMCtrlDefault_s(pointer(self))
 class SVMCtrl_d(ctypes.Structure):
-  _fields_ = [("ipmCtrl",QPAffineCtrl_d)]
+  _fields_ = [("approach",c_uint),("ipmCtrl",QPAffineCtrl_d),
+              ("cdCtrl",SVMCoordinateDescentCtrl_d)]
   def __init__(self):
     lib.ElSVMCtrlDefault_d(pointer(self))
 
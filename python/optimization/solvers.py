@@ -25,6 +25,11 @@ class MehrotraCtrl_s(ctypes.Structure):
               ("maxIts",iType),
               ("maxStepRatio",sType),
               ("system",c_uint),
+              ("splitDenseColumns",bType),
+              ("denseColumnRatio",sType),
+              ("maxDenseColumns",iType),
+              ("reuseFactorization",bType),
+              ("maxReuseIts",iType),
               ("mehrotra",bType),
               ("centralityRule",CFUNCTYPE(sType,sType,sType,sType,sType)),
               ("standardInitShift",bType),
@@ -52,6 +57,11 @@ class MehrotraCtrl_d(ctypes.Structure):
               ("maxIts",iType),
               ("maxStepRatio",dType),
               ("system",c_uint),
+              ("splitDenseColumns",bType),
+              ("denseColumnRatio",dType),
+              ("maxDenseColumns",iType),
+              ("reuseFactorization",bType),
+              ("maxReuseIts",iType),
               ("mehrotra",bType),
               ("centralityRule",CFUNCTYPE(dType,dType,dType,dType,dType)),
               ("standardInitShift",bType),
@@ -94,6 +104,24 @@ class ADMMCtrl_d(ctypes.Structure):
   def __init__(self):
     lib.ElADMMCtrlDefault_d(pointer(self))
 
+# Matrix-free first-order methods
+# ===============================
+lib.ElFirstOrderCtrlDefault_s.argtypes = \
+lib.ElFirstOrderCtrlDefault_d.argtypes = \
+  [c_void_p]
+class FirstOrderCtrl_s(ctypes.Structure):
+  _fields_ = [("maxIter",iType),("tol",sType),("stepSize",sType),
+              ("numPowerIts",iType),
+              ("adaptiveRestart",bType),("progress",bType)]
+  def __init__(self):
+    lib.ElFirstOrderCtrlDefault_s(pointer(self))
+class FirstOrderCtrl_d(ctypes.Structure):
+  _fields_ = [("maxIter",iType),("tol",dType),("stepSize",dType),
+              ("numPowerIts",iType),
+              ("adaptiveRestart",bType),("progress",bType)]
+  def __init__(self):
+    lib.ElFirstOrderCtrlDefault_d(pointer(self))
+
 # Linear program
 # ==============
 
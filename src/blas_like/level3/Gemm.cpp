@@ -9,10 +9,12 @@
 #include <El-lite.hpp>
 #include <El/blas_like/level3.hpp>
 
+#include "./Gemm/Skinny.hpp"
 #include "./Gemm/NN.hpp"
 #include "./Gemm/NT.hpp"
 #include "./Gemm/TN.hpp"
 #include "./Gemm/TT.hpp"
+#include "./Gemm/Mixed.hpp"
 
 namespace El {
 
@@ -297,4 +299,35 @@ void LocalGemm
 #define EL_ENABLE_BIGFLOAT
 #include <El/macros/Instantiate.h>
 
+#define PROTO_MIXED_GEMM(TA,TB,TC) \
+  template void Gemm \
+  ( Orientation orientA, Orientation orientB, \
+    TC alpha, const Matrix<TA>& A, \
+              const Matrix<TB>& B, \
+    TC beta,        Matrix<TC>& C ); \
+  template void Gemm \
+  ( Orientation orientA, Orientation orientB, \
+    TC alpha, const AbstractDistMatrix<TA>& A, \
+              const AbstractDistMatrix<TB>& B, \
+    TC beta,        AbstractDistMatrix<TC>& C );
+
+#define PROTO_MIXED(Lo,Hi) \
+  PROTO_MIXED_GEMM(Lo,Lo,Hi) \
+  PROTO_MIXED_GEMM(Lo,Hi,Hi) \
+  PROTO_MIXED_GEMM(Hi,Lo,Hi)
+
+PROTO_MIXED(float,double)
+PROTO_MIXED(Complex<float>,Complex<double>)
+#ifdef EL_HAVE_QD
+PROTO_MIXED(double,DoubleDouble)
+PROTO_MIXED(double,QuadDouble)
+#endif
+#ifdef EL_HAVE_QUAD
+PROTO_MIXED(double,Quad)
+PROTO_MIXED(Complex<double>,Complex<Quad>)
+#endif
+#ifdef EL_HAVE_MPC
+PROTO_MIXED(double,BigFloat)
+#endif
+
 } // namespace El
@@ -0,0 +1,139 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace El {
+
+// Mixed-precision Gemm
+// ====================
+// A and B are stored (and, in the distributed case, communicated) in their
+// own datatypes, and only one panel of each (of width Blocksize() in the
+// summation dimension) is converted to the datatype of C at a time.
+
+namespace gemm {
+
+inline void AssertMixedConformal
+( Orientation orientA, Orientation orientB,
+  Int AHeight, Int AWidth, Int BHeight, Int BWidth, Int CHeight, Int CWidth )
+{
+    const Int m = ( orientA == NORMAL ? AHeight : AWidth );
+    const Int kA = ( orientA == NORMAL ? AWidth : AHeight );
+    const Int kB = ( orientB == NORMAL ? BHeight : BWidth );
+    const Int n = ( orientB == NORMAL ? BWidth : BHeight );
+    if( m != CHeight || n != CWidth || kA != kB )
+        LogicError
+        ("Nonconformal mixed-precision Gemm: op(A) is ",m," x ",kA,
+         ", op(B) is ",kB," x ",n,", and C is ",CHeight," x ",CWidth);
+}
+
+} // namespace gemm
+
+template<typename TA,typename TB,typename TC>
+void Gemm
+( Orientation orientA, Orientation orientB,
+  TC alpha, const Matrix<TA>& A,
+            const Matrix<TB>& B,
+  TC beta,        Matrix<TC>& C )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      gemm::AssertMixedConformal
+      ( orientA, orientB,
+        A.Height(), A.Width(), B.Height(), B.Width(), C.Height(), C.Width() );
+    )
+    const Int sumDim = ( orientA == NORMAL ? A.Width() : A.Height() );
+    const Int bsize = Blocksize();
+
+    C *= beta;
+    Matrix<TC> A1Conv, B1Conv;
+    for( Int k=0; k<sumDim; k+=bsize )
+    {
+        const Int nb = Min(bsize,sumDim-k);
+        const Range<Int> ind1( k, k+nb );
+
+        auto A1 = ( orientA == NORMAL ? A( ALL, ind1 ) : A( ind1, ALL ) );
+        auto B1 = ( orientB == NORMAL ? B( ind1, ALL ) : B( ALL, ind1 ) );
+        Copy( A1, A1Conv );
+        Copy( B1, B1Conv );
+        Gemm( orientA, orientB, alpha, A1Conv, B1Conv, TC(1), C );
+    }
+}
+
+// A stationary-C SUMMA where the panels of A and B are communicated in their
+// own datatypes and converted after they arrive
+template<typename TA,typename TB,typename TC>
+void Gemm
+( Orientation orientA, Orientation orientB,
+  TC alpha, const AbstractDistMatrix<TA>& APre,
+            const AbstractDistMatrix<TB>& BPre,
+  TC beta,        AbstractDistMatrix<TC>& CPre )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      AssertSameGrids( APre, BPre, CPre );
+      gemm::AssertMixedConformal
+      ( orientA, orientB,
+        APre.Height(), APre.Width(), BPre.Height(), BPre.Width(),
+        CPre.Height(), CPre.Width() );
+    )
+    const Int sumDim = ( orientA == NORMAL ? APre.Width() : APre.Height() );
+    const Int bsize = Blocksize();
+    const Grid& g = APre.Grid();
+
+    DistMatrixReadProxy<TA,TA,MC,MR> AProx( APre );
+    DistMatrixReadProxy<TB,TB,MC,MR> BProx( BPre );
+    DistMatrixReadWriteProxy<TC,TC,MC,MR> CProx( CPre );
+    auto& A = AProx.GetLocked();
+    auto& B = BProx.GetLocked();
+    auto& C = CProx.Get();
+
+    // Temporary distributions
+    DistMatrix<TA,MC,STAR> A1_MC_STAR(g);
+    DistMatrix<TA,STAR,MC> A1_STAR_MC(g);
+    DistMatrix<TB,STAR,MR> B1_STAR_MR(g);
+    DistMatrix<TB,MR,STAR> B1_MR_STAR(g);
+
+    A1_MC_STAR.AlignWith( C );
+    A1_STAR_MC.AlignWith( C );
+    B1_STAR_MR.AlignWith( C );
+    B1_MR_STAR.AlignWith( C );
+
+    C *= beta;
+    for( Int k=0; k<sumDim; k+=bsize )
+    {
+        const Int nb = Min(bsize,sumDim-k);
+        const Range<Int> ind1( k, k+nb );
+
+        // C[MC,MR] += alpha op(A1)[MC,*] op(B1)[*,MR]
+        const Matrix<TA>* A1Loc;
+        const Matrix<TB>* B1Loc;
+        if( orientA == NORMAL )
+        {
+            A1_MC_STAR = A( ALL, ind1 );
+            A1Loc = &A1_MC_STAR.LockedMatrix();
+        }
+        else
+        {
+            A1_STAR_MC = A( ind1, ALL );
+            A1Loc = &A1_STAR_MC.LockedMatrix();
+        }
+        if( orientB == NORMAL )
+        {
+            B1_STAR_MR = B( ind1, ALL );
+            B1Loc = &B1_STAR_MR.LockedMatrix();
+        }
+        else
+        {
+            B1_MR_STAR = B( ALL, ind1 );
+            B1Loc = &B1_MR_STAR.LockedMatrix();
+        }
+        Gemm( orientA, orientB, alpha, *A1Loc, *B1Loc, TC(1), C.Matrix() );
+    }
+}
+
+} // namespace El
@@ -302,7 +302,12 @@ void SUMMA_NN
     switch( alg )
     {
     case GEMM_DEFAULT:
-        if( weightAwayFromDot*m <= sumDim && weightAwayFromDot*n <= sumDim )
+        if( UseSkinnyInner( m, n, sumDim, blockSizeDot ) )
+            SkinnyInner( NORMAL, NORMAL, alpha, A, B, C );
+        else if( UseSkinnyOuter( m, n, sumDim ) )
+            SkinnyOuter( NORMAL, NORMAL, alpha, A, B, C );
+        else if( weightAwayFromDot*m <= sumDim &&
+                 weightAwayFromDot*n <= sumDim )
             SUMMA_NNDot( alpha, A, B, C, blockSizeDot );
         else if( m <= n && weightTowardsC*m <= sumDim )
             SUMMA_NNB( alpha, A, B, C );    
@@ -315,6 +320,12 @@ void SUMMA_NN
     case GEMM_SUMMA_B:   SUMMA_NNB( alpha, A, B, C ); break;
     case GEMM_SUMMA_C:   SUMMA_NNC( alpha, A, B, C ); break;
     case GEMM_SUMMA_DOT: SUMMA_NNDot( alpha, A, B, C, blockSizeDot ); break;
+    case GEMM_SKINNY_INNER:
+        SkinnyInner( NORMAL, NORMAL, alpha, A, B, C );
+        break;
+    case GEMM_SKINNY_OUTER:
+        SkinnyOuter( NORMAL, NORMAL, alpha, A, B, C );
+        break;
     default: LogicError("Unsupported Gemm option");
     }
 }
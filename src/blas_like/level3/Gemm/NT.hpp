@@ -236,7 +236,12 @@ void SUMMA_NT
     switch( alg )
     {
     case GEMM_DEFAULT:
-        if( weightAwayFromDot*m <= sumDim && weightAwayFromDot*n <= sumDim )
+        if( UseSkinnyInner( m, n, sumDim, blockSizeDot ) )
+            SkinnyInner( NORMAL, orientB, alpha, A, B, C );
+        else if( UseSkinnyOuter( m, n, sumDim ) )
+            SkinnyOuter( NORMAL, orientB, alpha, A, B, C );
+        else if( weightAwayFromDot*m <= sumDim &&
+                 weightAwayFromDot*n <= sumDim )
             SUMMA_NTDot( orientB, alpha, A, B, C, blockSizeDot );
         else if( m <= n && weightTowardsC*m <= sumDim )
             SUMMA_NTB( orientB, alpha, A, B, C );
@@ -249,6 +254,12 @@ void SUMMA_NT
     case GEMM_SUMMA_B: SUMMA_NTB( orientB, alpha, A, B, C ); break;
     case GEMM_SUMMA_C: SUMMA_NTC( orientB, alpha, A, B, C ); break;
     case GEMM_SUMMA_DOT: SUMMA_NTDot( orientB, alpha, A, B, C ); break;
+    case GEMM_SKINNY_INNER:
+        SkinnyInner( NORMAL, orientB, alpha, A, B, C );
+        break;
+    case GEMM_SKINNY_OUTER:
+        SkinnyOuter( NORMAL, orientB, alpha, A, B, C );
+        break;
     default: LogicError("Unsupported Gemm option");
     }
 }
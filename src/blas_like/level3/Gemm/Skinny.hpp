@@ -0,0 +1,214 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace El {
+namespace gemm {
+
+// Products whose large dimension is only one of {m,n,sumDim} are formed from
+// 1D distributions of the large operands, e.g., [VC,STAR] for a tall-skinny
+// matrix, so that data which is already in such a distribution (as is the case
+// for block Krylov bases) is never redistributed over the 2D grid. The choice
+// between VC and VR follows the large operands.
+
+// The result is small enough to be formed redundantly on every process and
+// the summation dimension is much larger than both of its dimensions
+inline bool UseSkinnyInner( Int m, Int n, Int sumDim, Int maxResultDim )
+{
+    const double weightAwayFromDot = 10.;
+    return weightAwayFromDot*m <= sumDim && weightAwayFromDot*n <= sumDim &&
+           Max(m,n) <= maxResultDim;
+}
+
+// One of the dimensions of the result is much larger than both the other and
+// the summation dimension
+inline bool UseSkinnyOuter( Int m, Int n, Int sumDim )
+{
+    const double weightAwayFromDot = 10.;
+    return ( weightAwayFromDot*sumDim <= m && weightAwayFromDot*n <= m ) ||
+           ( weightAwayFromDot*sumDim <= n && weightAwayFromDot*m <= n );
+}
+
+// C += alpha op(A) op(B), where the summation dimension is distributed over
+// the 1D distribution U and the partial results are summed over the grid
+template<typename T,Dist U>
+void SkinnyInnerImpl
+( Orientation orientA, Orientation orientB,
+  T alpha,
+  const AbstractDistMatrix<T>& APre,
+  const AbstractDistMatrix<T>& BPre,
+        AbstractDistMatrix<T>& C )
+{
+    EL_DEBUG_CSE
+    const Grid& g = APre.Grid();
+
+    // Form the local contributions, D[*,*] := alpha op(A) op(B)
+    DistMatrix<T,STAR,STAR> D(g);
+    ElementalProxyCtrl BCtrl;
+    if( orientA == NORMAL )
+    {
+        DistMatrixReadProxy<T,T,STAR,U> AProx( APre );
+        auto& A = AProx.GetLocked();
+        if( orientB == NORMAL )
+        {
+            BCtrl.colConstrain = true;
+            BCtrl.colAlign = A.RowAlign();
+            DistMatrixReadProxy<T,T,U,STAR> BProx( BPre, BCtrl );
+            LocalGemm( orientA, orientB, alpha, A, BProx.GetLocked(), D );
+        }
+        else
+        {
+            BCtrl.rowConstrain = true;
+            BCtrl.rowAlign = A.RowAlign();
+            DistMatrixReadProxy<T,T,STAR,U> BProx( BPre, BCtrl );
+            LocalGemm( orientA, orientB, alpha, A, BProx.GetLocked(), D );
+        }
+    }
+    else
+    {
+        DistMatrixReadProxy<T,T,U,STAR> AProx( APre );
+        auto& A = AProx.GetLocked();
+        if( orientB == NORMAL )
+        {
+            BCtrl.colConstrain = true;
+            BCtrl.colAlign = A.ColAlign();
+            DistMatrixReadProxy<T,T,U,STAR> BProx( BPre, BCtrl );
+            LocalGemm( orientA, orientB, alpha, A, BProx.GetLocked(), D );
+        }
+        else
+        {
+            BCtrl.rowConstrain = true;
+            BCtrl.rowAlign = A.ColAlign();
+            DistMatrixReadProxy<T,T,STAR,U> BProx( BPre, BCtrl );
+            LocalGemm( orientA, orientB, alpha, A, BProx.GetLocked(), D );
+        }
+    }
+
+    // Sum the contributions into C
+    if( C.ColDist() == STAR && C.RowDist() == STAR )
+    {
+        AllReduce( D.Matrix(), g.VCComm() );
+        Axpy( T(1), D.LockedMatrix(), C.Matrix() );
+    }
+    else if( C.Wrap() == ELEMENT && C.ColDist() != CIRC )
+    {
+        // The contraction only sums over the distribution communicator of C,
+        // so the contributions of the redundant copies must be summed first
+        if( C.RedundantSize() != 1 )
+            AllReduce( D.Matrix(), C.RedundantComm() );
+        AxpyContract( T(1), D, static_cast<ElementalMatrix<T>&>(C) );
+    }
+    else
+    {
+        DistMatrixReadWriteProxy<T,T,MC,MR> CProx( C );
+        AxpyContract( T(1), D, CProx.Get() );
+    }
+}
+
+template<typename T>
+void SkinnyInner
+( Orientation orientA, Orientation orientB,
+  T alpha,
+  const AbstractDistMatrix<T>& A,
+  const AbstractDistMatrix<T>& B,
+        AbstractDistMatrix<T>& C )
+{
+    EL_DEBUG_CSE
+    const Dist sumDist = ( orientA == NORMAL ? A.RowDist() : A.ColDist() );
+    if( sumDist == VR )
+        SkinnyInnerImpl<T,VR>( orientA, orientB, alpha, A, B, C );
+    else
+        SkinnyInnerImpl<T,VC>( orientA, orientB, alpha, A, B, C );
+}
+
+// C += alpha op(A) op(B), where the large dimension of C (and of the
+// corresponding operand) is distributed over the 1D distribution U, the other
+// operand is broadcast, and the product is then formed locally
+template<typename T,Dist U>
+void SkinnyOuterImpl
+( Orientation orientA, Orientation orientB,
+  T alpha,
+  const AbstractDistMatrix<T>& APre,
+  const AbstractDistMatrix<T>& BPre,
+        AbstractDistMatrix<T>& CPre )
+{
+    EL_DEBUG_CSE
+    const Grid& g = APre.Grid();
+    ElementalProxyCtrl ctrl;
+
+    if( CPre.Height() >= CPre.Width() )
+    {
+        // C[U,*] += alpha op(A)[U,*] op(B)[*,*]
+        DistMatrixReadWriteProxy<T,T,U,STAR> CProx( CPre );
+        auto& C = CProx.Get();
+        DistMatrix<T,STAR,STAR> B_STAR_STAR( BPre );
+        if( orientA == NORMAL )
+        {
+            ctrl.colConstrain = true;
+            ctrl.colAlign = C.ColAlign();
+            DistMatrixReadProxy<T,T,U,STAR> AProx( APre, ctrl );
+            LocalGemm
+            ( orientA, orientB,
+              alpha, AProx.GetLocked(), B_STAR_STAR, T(1), C );
+        }
+        else
+        {
+            ctrl.rowConstrain = true;
+            ctrl.rowAlign = C.ColAlign();
+            DistMatrixReadProxy<T,T,STAR,U> AProx( APre, ctrl );
+            LocalGemm
+            ( orientA, orientB,
+              alpha, AProx.GetLocked(), B_STAR_STAR, T(1), C );
+        }
+    }
+    else
+    {
+        // C[*,U] += alpha op(A)[*,*] op(B)[*,U]
+        DistMatrixReadWriteProxy<T,T,STAR,U> CProx( CPre );
+        auto& C = CProx.Get();
+        DistMatrix<T,STAR,STAR> A_STAR_STAR( APre );
+        if( orientB == NORMAL )
+        {
+            ctrl.rowConstrain = true;
+            ctrl.rowAlign = C.RowAlign();
+            DistMatrixReadProxy<T,T,STAR,U> BProx( BPre, ctrl );
+            LocalGemm
+            ( orientA, orientB,
+              alpha, A_STAR_STAR, BProx.GetLocked(), T(1), C );
+        }
+        else
+        {
+            ctrl.colConstrain = true;
+            ctrl.colAlign = C.RowAlign();
+            DistMatrixReadProxy<T,T,U,STAR> BProx( BPre, ctrl );
+            LocalGemm
+            ( orientA, orientB,
+              alpha, A_STAR_STAR, BProx.GetLocked(), T(1), C );
+        }
+    }
+}
+
+template<typename T>
+void SkinnyOuter
+( Orientation orientA, Orientation orientB,
+  T alpha,
+  const AbstractDistMatrix<T>& A,
+  const AbstractDistMatrix<T>& B,
+        AbstractDistMatrix<T>& C )
+{
+    EL_DEBUG_CSE
+    const Dist largeDist =
+      ( C.Height() >= C.Width() ? C.ColDist() : C.RowDist() );
+    if( largeDist == VR )
+        SkinnyOuterImpl<T,VR>( orientA, orientB, alpha, A, B, C );
+    else
+        SkinnyOuterImpl<T,VC>( orientA, orientB, alpha, A, B, C );
+}
+
+} // namespace gemm
+} // namespace El
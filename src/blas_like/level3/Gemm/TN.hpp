@@ -231,7 +231,12 @@ void SUMMA_TN
     switch( alg )
     {
     case GEMM_DEFAULT:
-        if( weightAwayFromDot*m <= sumDim && weightAwayFromDot*n <= sumDim )
+        if( UseSkinnyInner( m, n, sumDim, blockSizeDot ) )
+            SkinnyInner( orientA, NORMAL, alpha, A, B, C );
+        else if( UseSkinnyOuter( m, n, sumDim ) )
+            SkinnyOuter( orientA, NORMAL, alpha, A, B, C );
+        else if( weightAwayFromDot*m <= sumDim &&
+                 weightAwayFromDot*n <= sumDim )
             SUMMA_TNDot( orientA, alpha, A, B, C, blockSizeDot );
         else if( m <= n && weightTowardsC*m <= sumDim )
             SUMMA_TNB( orientA, alpha, A, B, C );
@@ -244,6 +249,12 @@ void SUMMA_TN
     case GEMM_SUMMA_B: SUMMA_TNB( orientA, alpha, A, B, C ); break;
     case GEMM_SUMMA_C: SUMMA_TNC( orientA, alpha, A, B, C ); break;
     case GEMM_SUMMA_DOT: SUMMA_TNDot( orientA, alpha, A, B, C ); break;
+    case GEMM_SKINNY_INNER:
+        SkinnyInner( orientA, NORMAL, alpha, A, B, C );
+        break;
+    case GEMM_SKINNY_OUTER:
+        SkinnyOuter( orientA, NORMAL, alpha, A, B, C );
+        break;
     default: LogicError("Unsupported Gemm option");
     }
 }
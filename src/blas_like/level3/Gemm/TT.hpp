@@ -248,7 +248,12 @@ void SUMMA_TT
     switch( alg )
     {
     case GEMM_DEFAULT:
-        if( weightAwayFromDot*m <= sumDim && weightAwayFromDot*n <= sumDim )
+        if( UseSkinnyInner( m, n, sumDim, blockSizeDot ) )
+            SkinnyInner( orientA, orientB, alpha, A, B, C );
+        else if( UseSkinnyOuter( m, n, sumDim ) )
+            SkinnyOuter( orientA, orientB, alpha, A, B, C );
+        else if( weightAwayFromDot*m <= sumDim &&
+                 weightAwayFromDot*n <= sumDim )
             SUMMA_TTDot( orientA, orientB, alpha, A, B, C, blockSizeDot );
         else if( m <= n && weightTowardsC*m <= sumDim )
             SUMMA_TTB( orientA, orientB, alpha, A, B, C );
@@ -269,6 +274,12 @@ void SUMMA_TT
     case GEMM_SUMMA_DOT:
         SUMMA_TTDot( orientA, orientB, alpha, A, B, C );
         break;
+    case GEMM_SKINNY_INNER:
+        SkinnyInner( orientA, orientB, alpha, A, B, C );
+        break;
+    case GEMM_SKINNY_OUTER:
+        SkinnyOuter( orientA, orientB, alpha, A, B, C );
+        break;
     default: LogicError("Unsupported Gemm option");
     }
 }
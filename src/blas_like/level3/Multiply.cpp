@@ -11,6 +11,10 @@
 #include <El-lite.hpp>
 #include <El/blas_like/level3.hpp>
 
+#include "./Multiply/Sparse.hpp"
+#include "./Multiply/RowWise.hpp"
+#include "./Multiply/SUMMA.hpp"
+
 namespace El {
 
 namespace {
@@ -694,6 +698,123 @@ void Multiply
         Output("Multiply total time: ",totalTimer.Stop());
 }
 
+template<typename T>
+void Multiply
+( T alpha,
+  const SparseMatrix<T>& A,
+  const SparseMatrix<T>& B,
+        SparseMatrix<T>& C )
+{
+    EL_DEBUG_CSE
+    const auto ALoc = spgemm::LockedCSR( A );
+    const auto BLoc = spgemm::LockedCSR( B );
+    vector<Int> offsets, cols;
+    spgemm::Symbolic( ALoc, BLoc, offsets, cols );
+    vector<T> values( cols.size() );
+    spgemm::Numeric
+    ( alpha, ALoc, BLoc, offsets.data(), cols.data(), values.data() );
+
+    // A and B are no longer needed, so C may alias either of them
+    const Int height = A.Height();
+    const Int width = B.Width();
+    C.ImportCSR( height, width, offsets.data(), cols.data(), values.data() );
+}
+
+template<typename T>
+void Multiply
+( T alpha,
+  const DistSparseMatrix<T>& A,
+  const DistSparseMatrix<T>& B,
+        DistSparseMatrix<T>& C,
+  SparseMultiplyAlgorithm alg )
+{
+    EL_DEBUG_CSE
+    if( A.Width() != B.Height() )
+        LogicError
+        ("Nonconformal sparse product: ",A.Height()," x ",A.Width(),
+         " times ",B.Height()," x ",B.Width());
+    if( &A.Grid() != &B.Grid() )
+        LogicError("A and B must be distributed over the same grid");
+    if( alg == SPARSE_MULTIPLY_SUMMA )
+        spgemm::SUMMA( alpha, A, B, C );
+    else
+        spgemm::RowWise( alpha, A, B, C );
+}
+
+template<typename T>
+void MultiplySymbolic
+( const SparseMatrix<T>& A,
+  const SparseMatrix<T>& B,
+        SparseMatrix<T>& C )
+{
+    EL_DEBUG_CSE
+    vector<Int> offsets, cols;
+    spgemm::Symbolic
+    ( spgemm::LockedCSR(A), spgemm::LockedCSR(B), offsets, cols );
+    vector<T> values( cols.size(), T(0) );
+    const Int height = A.Height();
+    const Int width = B.Width();
+    C.ImportCSR( height, width, offsets.data(), cols.data(), values.data() );
+}
+
+template<typename T>
+void MultiplySymbolic
+( const DistSparseMatrix<T>& A,
+  const DistSparseMatrix<T>& B,
+        DistSparseMatrix<T>& C )
+{
+    EL_DEBUG_CSE
+    if( A.Width() != B.Height() )
+        LogicError
+        ("Nonconformal sparse product: ",A.Height()," x ",A.Width(),
+         " times ",B.Height()," x ",B.Width());
+    if( &A.Grid() != &B.Grid() )
+        LogicError("A and B must be distributed over the same grid");
+    spgemm::RowWiseSymbolic( A, B, C );
+}
+
+template<typename T>
+void MultiplyNumeric
+( T alpha,
+  const SparseMatrix<T>& A,
+  const SparseMatrix<T>& B,
+        SparseMatrix<T>& C )
+{
+    EL_DEBUG_CSE
+    if( &C == &A || &C == &B )
+        LogicError("C cannot alias A or B in MultiplyNumeric");
+    if( C.Height() != A.Height() || C.Width() != B.Width() )
+        LogicError
+        ("C was ",C.Height()," x ",C.Width()," but A B is ",A.Height()," x ",
+         B.Width());
+    spgemm::Numeric
+    ( alpha, spgemm::LockedCSR(A), spgemm::LockedCSR(B),
+      C.LockedOffsetBuffer(), C.LockedTargetBuffer(), C.ValueBuffer() );
+}
+
+template<typename T>
+void MultiplyNumeric
+( T alpha,
+  const DistSparseMatrix<T>& A,
+  const DistSparseMatrix<T>& B,
+        DistSparseMatrix<T>& C )
+{
+    EL_DEBUG_CSE
+    if( &C == &A || &C == &B )
+        LogicError("C cannot alias A or B in MultiplyNumeric");
+    if( A.Width() != B.Height() )
+        LogicError
+        ("Nonconformal sparse product: ",A.Height()," x ",A.Width(),
+         " times ",B.Height()," x ",B.Width());
+    if( C.Height() != A.Height() || C.Width() != B.Width() )
+        LogicError
+        ("C was ",C.Height()," x ",C.Width()," but A B is ",A.Height()," x ",
+         B.Width());
+    if( &A.Grid() != &B.Grid() || &A.Grid() != &C.Grid() )
+        LogicError("A, B, and C must be distributed over the same grid");
+    spgemm::RowWiseNumeric( alpha, A, B, C );
+}
+
 #define PROTO(T) \
     template void Multiply \
     ( Orientation orientation, \
@@ -715,7 +836,36 @@ void Multiply
       const DistSparseMatrix<T>& A, \
       const DistMultiVec<T>& X, \
             T beta, \
-            DistMultiVec<T>& Y );
+            DistMultiVec<T>& Y ); \
+    template void Multiply \
+    ( T alpha, \
+      const SparseMatrix<T>& A, \
+      const SparseMatrix<T>& B, \
+            SparseMatrix<T>& C ); \
+    template void Multiply \
+    ( T alpha, \
+      const DistSparseMatrix<T>& A, \
+      const DistSparseMatrix<T>& B, \
+            DistSparseMatrix<T>& C, \
+      SparseMultiplyAlgorithm alg ); \
+    template void MultiplySymbolic \
+    ( const SparseMatrix<T>& A, \
+      const SparseMatrix<T>& B, \
+            SparseMatrix<T>& C ); \
+    template void MultiplySymbolic \
+    ( const DistSparseMatrix<T>& A, \
+      const DistSparseMatrix<T>& B, \
+            DistSparseMatrix<T>& C ); \
+    template void MultiplyNumeric \
+    ( T alpha, \
+      const SparseMatrix<T>& A, \
+      const SparseMatrix<T>& B, \
+            SparseMatrix<T>& C ); \
+    template void MultiplyNumeric \
+    ( T alpha, \
+      const DistSparseMatrix<T>& A, \
+      const DistSparseMatrix<T>& B, \
+            DistSparseMatrix<T>& C );
 
 #define EL_ENABLE_DOUBLEDOUBLE
 #define EL_ENABLE_QUADDOUBLE
@@ -0,0 +1,225 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace El {
+namespace spgemm {
+
+// 1D row-wise sparse-times-sparse products
+// ========================================
+// Since row i of A B only depends upon row i of A and the rows of B indexed by
+// the nonzero columns of row i of A, each process fetches the (unique) rows of
+// B referenced by its local rows of A and then forms its rows of the product
+// locally. The product inherits the row distribution of A.
+
+// The rows of B referenced by the local columns of A, in CSR form
+template<typename T>
+struct FetchedRows
+{
+    vector<Int> rows;
+    vector<Int> offsets;
+    vector<Int> cols;
+    vector<T> values;
+};
+
+// Fetch the rows of B referenced by the local entries of A and overwrite
+// 'mappedCols' with the local column indices of A mapped to their positions
+// within the fetched rows
+template<typename T>
+void FetchRows
+( const DistSparseMatrix<T>& A,
+  const DistSparseMatrix<T>& B,
+        FetchedRows<T>& fetched,
+        vector<Int>& mappedCols,
+  bool fetchValues=true )
+{
+    EL_DEBUG_CSE
+    const Grid& grid = B.Grid();
+    mpi::Comm comm = grid.Comm();
+    const int commSize = grid.Size();
+
+    // Determine the unique rows of B that we need
+    const Int numLocalEntriesA = A.NumLocalEntries();
+    const Int* colBufA = A.LockedTargetBuffer();
+    auto& rows = fetched.rows;
+    rows.assign( colBufA, colBufA+numLocalEntriesA );
+    std::sort( rows.begin(), rows.end() );
+    rows.erase( std::unique( rows.begin(), rows.end() ), rows.end() );
+    const Int numRows = rows.size();
+    mappedCols.resize( numLocalEntriesA );
+    for( Int e=0; e<numLocalEntriesA; ++e )
+        mappedCols[e] =
+          std::lower_bound( rows.begin(), rows.end(), colBufA[e] ) -
+          rows.begin();
+
+    // Request them from their owners (since the rows are sorted, they are
+    // already packed by owner)
+    vector<int> sendCounts(commSize,0), recvCounts(commSize);
+    for( const Int& k : rows )
+        ++sendCounts[B.RowOwner(k)];
+    vector<int> sendOffs, recvOffs;
+    Scan( sendCounts, sendOffs );
+    mpi::AllToAll( sendCounts.data(), 1, recvCounts.data(), 1, comm );
+    Scan( recvCounts, recvOffs );
+    auto requests = mpi::AllToAll( rows, sendCounts, sendOffs, comm );
+    const Int numRequests = requests.size();
+
+    // Respond with the number of entries in each of the requested rows...
+    const Int firstLocalRow = B.FirstLocalRow();
+    vector<Int> requestSizes(numRequests);
+    for( Int s=0; s<numRequests; ++s )
+        requestSizes[s] = B.NumConnections( requests[s]-firstLocalRow );
+    vector<Int> rowSizes(numRows);
+    mpi::AllToAll
+    ( requestSizes.data(), recvCounts.data(), recvOffs.data(),
+      rowSizes.data(), sendCounts.data(), sendOffs.data(), comm );
+
+    // ...and then with their contents
+    vector<int> entrySendCounts(commSize,0), entryRecvCounts(commSize,0);
+    for( int q=0; q<commSize; ++q )
+    {
+        for( Int s=recvOffs[q]; s<recvOffs[q]+recvCounts[q]; ++s )
+            entrySendCounts[q] += requestSizes[s];
+        for( Int s=sendOffs[q]; s<sendOffs[q]+sendCounts[q]; ++s )
+            entryRecvCounts[q] += rowSizes[s];
+    }
+    vector<int> entrySendOffs, entryRecvOffs;
+    const int totalSend = Scan( entrySendCounts, entrySendOffs );
+    const int totalRecv = Scan( entryRecvCounts, entryRecvOffs );
+    const Int* colBufB = B.LockedTargetBuffer();
+    const T* valBufB = B.LockedValueBuffer();
+    vector<Int> sendCols(totalSend);
+    vector<T> sendValues( fetchValues ? totalSend : 0 );
+    Int off = 0;
+    for( Int s=0; s<numRequests; ++s )
+    {
+        const Int rowOff = B.RowOffset( requests[s]-firstLocalRow );
+        for( Int t=0; t<requestSizes[s]; ++t, ++off )
+        {
+            sendCols[off] = colBufB[rowOff+t];
+            if( fetchValues )
+                sendValues[off] = valBufB[rowOff+t];
+        }
+    }
+    fetched.cols.resize( totalRecv );
+    mpi::AllToAll
+    ( sendCols.data(), entrySendCounts.data(), entrySendOffs.data(),
+      fetched.cols.data(), entryRecvCounts.data(), entryRecvOffs.data(),
+      comm );
+    fetched.values.resize( fetchValues ? totalRecv : 0 );
+    if( fetchValues )
+        mpi::AllToAll
+        ( sendValues.data(), entrySendCounts.data(), entrySendOffs.data(),
+          fetched.values.data(), entryRecvCounts.data(), entryRecvOffs.data(),
+          comm );
+
+    fetched.offsets.resize( numRows+1 );
+    Int numFetched = 0;
+    for( Int s=0; s<numRows; ++s )
+    {
+        fetched.offsets[s] = numFetched;
+        numFetched += rowSizes[s];
+    }
+    fetched.offsets[numRows] = numFetched;
+}
+
+// Views of the local rows of A (with their columns mapped into the fetched
+// rows) and of the fetched rows of B
+template<typename T>
+void LocalViews
+( const DistSparseMatrix<T>& A,
+  const DistSparseMatrix<T>& B,
+  const FetchedRows<T>& fetched,
+  const vector<Int>& mappedCols,
+        CSR<T>& ALoc,
+        CSR<T>& BLoc )
+{
+    ALoc.height = A.LocalHeight();
+    ALoc.width = fetched.rows.size();
+    ALoc.offsets = A.LockedOffsetBuffer();
+    ALoc.cols = mappedCols.data();
+    ALoc.values = A.LockedValueBuffer();
+
+    BLoc.height = fetched.rows.size();
+    BLoc.width = B.Width();
+    BLoc.offsets = fetched.offsets.data();
+    BLoc.cols = fetched.cols.data();
+    BLoc.values = fetched.values.data();
+}
+
+template<typename T>
+void RowWiseSymbolic
+( const DistSparseMatrix<T>& A,
+  const DistSparseMatrix<T>& B,
+        DistSparseMatrix<T>& C )
+{
+    EL_DEBUG_CSE
+    FetchedRows<T> fetched;
+    vector<Int> mappedCols;
+    FetchRows( A, B, fetched, mappedCols, false );
+    CSR<T> ALoc, BLoc;
+    LocalViews( A, B, fetched, mappedCols, ALoc, BLoc );
+
+    vector<Int> offsets, cols;
+    Symbolic( ALoc, BLoc, offsets, cols );
+    vector<T> values( cols.size(), T(0) );
+
+    const Int height = A.Height();
+    const Int width = B.Width();
+    C.SetGrid( A.Grid() );
+    C.ImportLocalCSR
+    ( height, width, offsets.data(), cols.data(), values.data() );
+}
+
+template<typename T>
+void RowWiseNumeric
+( T alpha,
+  const DistSparseMatrix<T>& A,
+  const DistSparseMatrix<T>& B,
+        DistSparseMatrix<T>& C )
+{
+    EL_DEBUG_CSE
+    FetchedRows<T> fetched;
+    vector<Int> mappedCols;
+    FetchRows( A, B, fetched, mappedCols );
+    CSR<T> ALoc, BLoc;
+    LocalViews( A, B, fetched, mappedCols, ALoc, BLoc );
+    Numeric
+    ( alpha, ALoc, BLoc,
+      C.LockedOffsetBuffer(), C.LockedTargetBuffer(), C.ValueBuffer() );
+}
+
+template<typename T>
+void RowWise
+( T alpha,
+  const DistSparseMatrix<T>& A,
+  const DistSparseMatrix<T>& B,
+        DistSparseMatrix<T>& C )
+{
+    EL_DEBUG_CSE
+    FetchedRows<T> fetched;
+    vector<Int> mappedCols;
+    FetchRows( A, B, fetched, mappedCols );
+    CSR<T> ALoc, BLoc;
+    LocalViews( A, B, fetched, mappedCols, ALoc, BLoc );
+
+    vector<Int> offsets, cols;
+    Symbolic( ALoc, BLoc, offsets, cols );
+    vector<T> values( cols.size() );
+    Numeric( alpha, ALoc, BLoc, offsets.data(), cols.data(), values.data() );
+
+    // A and B are no longer needed, so C may alias either of them
+    const Int height = A.Height();
+    const Int width = B.Width();
+    C.SetGrid( A.Grid() );
+    C.ImportLocalCSR
+    ( height, width, offsets.data(), cols.data(), values.data() );
+}
+
+} // namespace spgemm
+} // namespace El
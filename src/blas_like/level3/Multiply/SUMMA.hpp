@@ -0,0 +1,249 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace El {
+namespace spgemm {
+
+// 2D sparse SUMMA
+// ===============
+// On an r x c process grid, the rows of A and C are split into r contiguous
+// blocks and the columns of A (i.e., the summation dimension) and of B and C
+// are split into c contiguous blocks. Process (s,t) owns A(I_s,K_t),
+// C(I_s,J_t), and the blocks B(K_k,J_t) with k = s (mod r). In stage k,
+// A(I_s,K_k) is broadcast within process row s, B(K_k,J_t) is broadcast within
+// process column t, and their product is accumulated into C(I_s,J_t), so
+// that each process only communicates O(1/sqrt(p)) of the operands rather
+// than an arbitrary subset of the rows of B. The operands are redistributed
+// from, and the product back into, the 1D row distribution.
+
+// The first index of block 'part' of a partition of [0,n) into 'numParts'
+// nearly equal contiguous blocks
+inline Int BlockBegin( Int n, Int numParts, Int part )
+{ return Int((double(n)*part)/numParts); }
+
+inline Int BlockOwner( Int n, Int numParts, Int i )
+{
+    Int part = Int((double(i)*numParts)/Max(n,Int(1)));
+    while( part > 0 && BlockBegin(n,numParts,part) > i )
+        --part;
+    while( part+1 < numParts && BlockBegin(n,numParts,part+1) <= i )
+        ++part;
+    return part;
+}
+
+// The rank of process (row,col) within Grid::Comm()
+inline int GridRank( const Grid& grid, int row, int col )
+{
+    if( grid.Order() == COLUMN_MAJOR )
+        return row + col*grid.Height();
+    else
+        return col + row*grid.Width();
+}
+
+// Send each of the local entries (i,j,value) of A to the process returned by
+// owner(i,j) and return the received entries
+template<typename T,class Owner>
+void ScatterEntries
+( const DistSparseMatrix<T>& A,
+  Owner owner,
+  vector<Int>& rows,
+  vector<Int>& cols,
+  vector<T>& values )
+{
+    EL_DEBUG_CSE
+    const Grid& grid = A.Grid();
+    mpi::Comm comm = grid.Comm();
+    const int commSize = grid.Size();
+    const Int numLocalEntries = A.NumLocalEntries();
+    const Int* rowBuf = A.LockedSourceBuffer();
+    const Int* colBuf = A.LockedTargetBuffer();
+    const T* valBuf = A.LockedValueBuffer();
+
+    vector<int> owners(numLocalEntries);
+    vector<int> sendCounts(commSize,0);
+    for( Int e=0; e<numLocalEntries; ++e )
+    {
+        owners[e] = owner( rowBuf[e], colBuf[e] );
+        ++sendCounts[owners[e]];
+    }
+    vector<int> sendOffs;
+    const int totalSend = Scan( sendCounts, sendOffs );
+    vector<Int> sendRows(totalSend), sendCols(totalSend);
+    vector<T> sendValues(totalSend);
+    auto offs = sendOffs;
+    for( Int e=0; e<numLocalEntries; ++e )
+    {
+        const int off = offs[owners[e]]++;
+        sendRows[off] = rowBuf[e];
+        sendCols[off] = colBuf[e];
+        sendValues[off] = valBuf[e];
+    }
+    rows = mpi::AllToAll( sendRows, sendCounts, sendOffs, comm );
+    cols = mpi::AllToAll( sendCols, sendCounts, sendOffs, comm );
+    values = mpi::AllToAll( sendValues, sendCounts, sendOffs, comm );
+}
+
+// Broadcast a sequential sparse matrix from the root of the communicator
+template<typename T>
+void BroadcastSparse( SparseMatrix<T>& A, int root, mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    const bool isRoot = ( mpi::Rank(comm) == root );
+    Int sizes[3];
+    if( isRoot )
+    {
+        sizes[0] = A.Height();
+        sizes[1] = A.Width();
+        sizes[2] = A.NumEntries();
+    }
+    mpi::Broadcast( sizes, 3, root, comm );
+    const Int height = sizes[0];
+    const Int width = sizes[1];
+    const Int numEntries = sizes[2];
+
+    vector<Int> offsets(height+1), cols(numEntries);
+    vector<T> values(numEntries);
+    if( isRoot )
+    {
+        std::copy
+        ( A.LockedOffsetBuffer(), A.LockedOffsetBuffer()+height+1,
+          offsets.begin() );
+        std::copy
+        ( A.LockedTargetBuffer(), A.LockedTargetBuffer()+numEntries,
+          cols.begin() );
+        std::copy
+        ( A.LockedValueBuffer(), A.LockedValueBuffer()+numEntries,
+          values.begin() );
+    }
+    mpi::Broadcast( offsets.data(), height+1, root, comm );
+    mpi::Broadcast( cols.data(), numEntries, root, comm );
+    mpi::Broadcast( values.data(), numEntries, root, comm );
+    if( !isRoot )
+        A.ImportCSR
+        ( height, width, offsets.data(), cols.data(), values.data() );
+}
+
+template<typename T>
+void SUMMA
+( T alpha,
+  const DistSparseMatrix<T>& A,
+  const DistSparseMatrix<T>& B,
+        DistSparseMatrix<T>& C )
+{
+    EL_DEBUG_CSE
+    const Grid& grid = A.Grid();
+    const int gridHeight = grid.Height();
+    const int gridWidth = grid.Width();
+    const int gridRow = grid.Row();
+    const int gridCol = grid.Col();
+    const Int m = A.Height();
+    const Int n = B.Width();
+    const Int sumDim = A.Width();
+
+    // Redistribute A(I_s,K_t) to process (s,t)
+    const Int rowBeg = BlockBegin( m, gridHeight, gridRow );
+    const Int rowEnd = BlockBegin( m, gridHeight, gridRow+1 );
+    const Int colBeg = BlockBegin( n, gridWidth, gridCol );
+    const Int colEnd = BlockBegin( n, gridWidth, gridCol+1 );
+    vector<Int> rows, cols;
+    vector<T> values;
+    ScatterEntries
+    ( A,
+      [&]( Int i, Int k )
+      { return GridRank
+               ( grid, BlockOwner(m,gridHeight,i),
+                 BlockOwner(sumDim,gridWidth,k) ); },
+      rows, cols, values );
+    SparseMatrix<T> ABlock;
+    {
+        const Int sumBeg = BlockBegin( sumDim, gridWidth, gridCol );
+        const Int sumEnd = BlockBegin( sumDim, gridWidth, gridCol+1 );
+        const Int numEntries = rows.size();
+        ABlock.Resize( rowEnd-rowBeg, sumEnd-sumBeg );
+        ABlock.Reserve( numEntries );
+        for( Int e=0; e<numEntries; ++e )
+            ABlock.QueueUpdate( rows[e]-rowBeg, cols[e]-sumBeg, values[e] );
+        ABlock.ProcessQueues();
+    }
+
+    // Redistribute B(K_k,J_t) to process (k mod r,t)
+    ScatterEntries
+    ( B,
+      [&]( Int k, Int j )
+      { return GridRank
+               ( grid, BlockOwner(sumDim,gridWidth,k) % gridHeight,
+                 BlockOwner(n,gridWidth,j) ); },
+      rows, cols, values );
+    vector<SparseMatrix<T>> BBlocks(gridWidth);
+    {
+        vector<Int> blockSizes(gridWidth,0);
+        const Int numEntries = rows.size();
+        for( Int e=0; e<numEntries; ++e )
+            ++blockSizes[BlockOwner(sumDim,gridWidth,rows[e])];
+        for( Int k=gridRow; k<gridWidth; k+=gridHeight )
+        {
+            const Int sumBeg = BlockBegin( sumDim, gridWidth, k );
+            const Int sumEnd = BlockBegin( sumDim, gridWidth, k+1 );
+            BBlocks[k].Resize( sumEnd-sumBeg, colEnd-colBeg );
+            BBlocks[k].Reserve( blockSizes[k] );
+        }
+        for( Int e=0; e<numEntries; ++e )
+        {
+            const Int k = BlockOwner( sumDim, gridWidth, rows[e] );
+            const Int sumBeg = BlockBegin( sumDim, gridWidth, k );
+            BBlocks[k].QueueUpdate
+            ( rows[e]-sumBeg, cols[e]-colBeg, values[e] );
+        }
+        for( Int k=gridRow; k<gridWidth; k+=gridHeight )
+            BBlocks[k].ProcessQueues();
+    }
+    SwapClear( rows );
+    SwapClear( cols );
+    SwapClear( values );
+
+    // C(I_s,J_t) := alpha sum_k A(I_s,K_k) B(K_k,J_t)
+    SparseMatrix<T> APanel, BPanel, CUpdate, CBlock;
+    CBlock.Resize( rowEnd-rowBeg, colEnd-colBeg );
+    for( Int k=0; k<gridWidth; ++k )
+    {
+        if( gridCol == k )
+            APanel = ABlock;
+        BroadcastSparse( APanel, k, grid.RowComm() );
+        if( gridRow == k % gridHeight )
+            BPanel = BBlocks[k];
+        BroadcastSparse( BPanel, k % gridHeight, grid.ColComm() );
+
+        Multiply( alpha, APanel, BPanel, CUpdate );
+        CBlock.QueueUpdates
+        ( CUpdate.NumEntries(), CUpdate.LockedSourceBuffer(),
+          CUpdate.LockedTargetBuffer(), CUpdate.LockedValueBuffer() );
+    }
+    CBlock.ProcessQueues();
+
+    // Return the product to the 1D row distribution
+    const Int numEntries = CBlock.NumEntries();
+    const Int* rowBuf = CBlock.LockedSourceBuffer();
+    const Int* colBuf = CBlock.LockedTargetBuffer();
+    const T* valBuf = CBlock.LockedValueBuffer();
+    C.SetGrid( grid );
+    C.Empty( false );
+    C.Resize( m, n );
+    const int commRank = mpi::Rank( grid.Comm() );
+    Int numLocal = 0;
+    for( Int e=0; e<numEntries; ++e )
+        if( C.RowOwner(rowBeg+rowBuf[e]) == commRank )
+            ++numLocal;
+    C.Reserve( numLocal, numEntries-numLocal );
+    for( Int e=0; e<numEntries; ++e )
+        C.QueueUpdate( rowBeg+rowBuf[e], colBeg+colBuf[e], valBuf[e] );
+    C.ProcessQueues();
+}
+
+} // namespace spgemm
+} // namespace El
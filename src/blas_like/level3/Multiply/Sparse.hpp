@@ -0,0 +1,291 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <atomic>
+
+namespace El {
+namespace spgemm {
+
+// Local sparse-times-sparse products
+// ==================================
+// Each row of C := alpha A B is formed as a linear combination of the rows of
+// B selected by the nonzero columns of the corresponding row of A (Gustavson's
+// algorithm), with the columns of the row of C accumulated in a hash table
+// sized to the number of multiply-adds in the row. The product is formed in
+// a symbolic phase, which only determines the sparsity pattern of C, and a
+// numeric phase, which fills in the values of an existing pattern, so that
+// repeated products with a fixed pattern only pay for the latter.
+
+// A read-only view of a matrix in compressed sparse row format
+template<typename T>
+struct CSR
+{
+    Int height=0, width=0;
+    const Int* offsets=nullptr;
+    const Int* cols=nullptr;
+    const T* values=nullptr;
+};
+
+template<typename T>
+CSR<T> LockedCSR( const SparseMatrix<T>& A )
+{
+    CSR<T> csr;
+    csr.height = A.Height();
+    csr.width = A.Width();
+    csr.offsets = A.LockedOffsetBuffer();
+    csr.cols = A.LockedTargetBuffer();
+    csr.values = A.LockedValueBuffer();
+    return csr;
+}
+
+// An open-addressing (linear probing) hash table from the column indices of a
+// row of the product to their positions within the row
+class ColumnHash
+{
+public:
+    // Empty the table and make room for (at least) 'maxKeys' distinct keys
+    void Reset( Int maxKeys )
+    {
+        Int capacity = 16;
+        while( capacity < 2*maxKeys )
+            capacity *= 2;
+        if( Int(keys_.size()) < capacity )
+        {
+            keys_.resize( capacity );
+            positions_.resize( capacity );
+        }
+        mask_ = capacity-1;
+        std::fill( keys_.begin(), keys_.begin()+capacity, Int(-1) );
+    }
+
+    // Return the slot of 'key', inserting it if it was not already present
+    Int Insert( Int key, bool& inserted )
+    {
+        Int slot = Hash( key );
+        while( keys_[slot] != key )
+        {
+            if( keys_[slot] == -1 )
+            {
+                keys_[slot] = key;
+                inserted = true;
+                return slot;
+            }
+            slot = (slot+1) & mask_;
+        }
+        inserted = false;
+        return slot;
+    }
+
+    // Return the slot of 'key', or -1 if it is not present
+    Int Find( Int key ) const
+    {
+        Int slot = Hash( key );
+        while( keys_[slot] != key )
+        {
+            if( keys_[slot] == -1 )
+                return -1;
+            slot = (slot+1) & mask_;
+        }
+        return slot;
+    }
+
+    Int& Position( Int slot ) { return positions_[slot]; }
+
+private:
+    vector<Int> keys_, positions_;
+    Int mask_=0;
+
+    Int Hash( Int key ) const
+    { return Int((unsigned long long)(key)*2654435761ULL) & mask_; }
+};
+
+// Fill flopOffsets[i] with the number of multiply-adds required by rows
+// [0,i) of A B, which is an upper bound on their number of nonzeros
+template<typename T>
+void FlopOffsets( const CSR<T>& A, const CSR<T>& B, vector<Int>& flopOffsets )
+{
+    EL_DEBUG_CSE
+    flopOffsets.resize( A.height+1 );
+    Int numFlops = 0;
+    for( Int i=0; i<A.height; ++i )
+    {
+        flopOffsets[i] = numFlops;
+        for( Int e=A.offsets[i]; e<A.offsets[i+1]; ++e )
+        {
+            const Int k = A.cols[e];
+            numFlops += B.offsets[k+1] - B.offsets[k];
+        }
+    }
+    flopOffsets[A.height] = numFlops;
+}
+
+// Call func(rowBeg,rowEnd) on contiguous chunks of rows requiring roughly
+// equal numbers of multiply-adds, one chunk per thread
+template<class Function>
+void ForEachRowChunk( const vector<Int>& flopOffsets, Function func )
+{
+    EL_DEBUG_CSE
+    const Int height = flopOffsets.size()-1;
+    const Int numFlops = flopOffsets[height];
+    auto chunk = [&]( Int thread, Int numThreads )
+      {
+        const Int flopBeg = Int((double(numFlops)*thread)/numThreads);
+        const Int flopEnd = Int((double(numFlops)*(thread+1))/numThreads);
+        const Int rowBeg =
+          std::lower_bound
+          ( flopOffsets.begin(), flopOffsets.begin()+height, flopBeg ) -
+          flopOffsets.begin();
+        const Int rowEnd =
+          ( thread == numThreads-1 ? height :
+            std::lower_bound
+            ( flopOffsets.begin(), flopOffsets.begin()+height, flopEnd ) -
+            flopOffsets.begin() );
+        func( rowBeg, rowEnd );
+      };
+
+#ifdef EL_HYBRID
+    const Int minParallelFlops = 4096;
+    const Int maxThreads =
+      ( numFlops >= minParallelFlops ? omp_get_max_threads() : 1 );
+    if( maxThreads > 1 )
+    {
+        #pragma omp parallel
+        {
+            chunk( omp_get_thread_num(), omp_get_num_threads() );
+        }
+    }
+    else
+#endif
+        chunk( 0, 1 );
+}
+
+// Form the sparsity pattern of A B, with the column indices of each row in
+// increasing order
+template<typename T>
+void Symbolic
+( const CSR<T>& A, const CSR<T>& B,
+  vector<Int>& offsets, vector<Int>& cols )
+{
+    EL_DEBUG_CSE
+    if( A.width != B.height )
+        LogicError
+        ("Nonconformal sparse product: ",A.height," x ",A.width," times ",
+         B.height," x ",B.width);
+    const Int height = A.height;
+    vector<Int> flopOffsets;
+    FlopOffsets( A, B, flopOffsets );
+
+    // Count the number of unique columns in each row
+    offsets.resize( height+1 );
+    ForEachRowChunk( flopOffsets, [&]( Int rowBeg, Int rowEnd )
+      {
+        ColumnHash hash;
+        bool inserted;
+        for( Int i=rowBeg; i<rowEnd; ++i )
+        {
+            hash.Reset( flopOffsets[i+1]-flopOffsets[i] );
+            Int numCols = 0;
+            for( Int e=A.offsets[i]; e<A.offsets[i+1]; ++e )
+            {
+                const Int k = A.cols[e];
+                for( Int f=B.offsets[k]; f<B.offsets[k+1]; ++f )
+                {
+                    hash.Insert( B.cols[f], inserted );
+                    if( inserted )
+                        ++numCols;
+                }
+            }
+            offsets[i] = numCols;
+        }
+      });
+    Int numEntries = 0;
+    for( Int i=0; i<height; ++i )
+    {
+        const Int numCols = offsets[i];
+        offsets[i] = numEntries;
+        numEntries += numCols;
+    }
+    offsets[height] = numEntries;
+
+    // Fill and sort the columns of each row
+    cols.resize( numEntries );
+    ForEachRowChunk( flopOffsets, [&]( Int rowBeg, Int rowEnd )
+      {
+        ColumnHash hash;
+        bool inserted;
+        for( Int i=rowBeg; i<rowEnd; ++i )
+        {
+            hash.Reset( flopOffsets[i+1]-flopOffsets[i] );
+            Int off = offsets[i];
+            for( Int e=A.offsets[i]; e<A.offsets[i+1]; ++e )
+            {
+                const Int k = A.cols[e];
+                for( Int f=B.offsets[k]; f<B.offsets[k+1]; ++f )
+                {
+                    hash.Insert( B.cols[f], inserted );
+                    if( inserted )
+                        cols[off++] = B.cols[f];
+                }
+            }
+            std::sort( cols.begin()+offsets[i], cols.begin()+offsets[i+1] );
+        }
+      });
+}
+
+// Overwrite the values of the existing sparsity pattern (offsets, cols) with
+// those of alpha A B. Every nonzero of the product must lie in the pattern.
+template<typename T>
+void Numeric
+( T alpha, const CSR<T>& A, const CSR<T>& B,
+  const Int* offsets, const Int* cols, T* values )
+{
+    EL_DEBUG_CSE
+    if( A.width != B.height )
+        LogicError
+        ("Nonconformal sparse product: ",A.height," x ",A.width," times ",
+         B.height," x ",B.width);
+    vector<Int> flopOffsets;
+    FlopOffsets( A, B, flopOffsets );
+
+    // Exceptions cannot escape a parallel region, so record a miss instead
+    std::atomic<bool> missing(false);
+    ForEachRowChunk( flopOffsets, [&]( Int rowBeg, Int rowEnd )
+      {
+        ColumnHash hash;
+        bool inserted;
+        for( Int i=rowBeg; i<rowEnd; ++i )
+        {
+            hash.Reset( offsets[i+1]-offsets[i] );
+            for( Int s=offsets[i]; s<offsets[i+1]; ++s )
+            {
+                hash.Position( hash.Insert( cols[s], inserted ) ) = s;
+                values[s] = 0;
+            }
+            for( Int e=A.offsets[i]; e<A.offsets[i+1]; ++e )
+            {
+                const Int k = A.cols[e];
+                const T& A_ik = A.values[e];
+                for( Int f=B.offsets[k]; f<B.offsets[k+1]; ++f )
+                {
+                    const Int slot = hash.Find( B.cols[f] );
+                    if( slot == -1 )
+                        missing = true;
+                    else
+                        values[hash.Position(slot)] += A_ik*B.values[f];
+                }
+            }
+            for( Int s=offsets[i]; s<offsets[i+1]; ++s )
+                values[s] *= alpha;
+        }
+      });
+    if( missing )
+        LogicError("The product does not fit in the given sparsity pattern");
+}
+
+} // namespace spgemm
+} // namespace El
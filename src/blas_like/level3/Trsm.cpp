@@ -18,6 +18,7 @@
 #include "./Trsm/RLT.hpp"
 #include "./Trsm/RUN.hpp"
 #include "./Trsm/RUT.hpp"
+#include "./Trsm/Mixed.hpp"
 
 namespace El {
 
@@ -434,4 +435,38 @@ void LocalTrsm
 #define EL_ENABLE_BIGFLOAT
 #include <El/macros/Instantiate.h>
 
+#define PROTO_MIXED(FA,FB) \
+  template void Trsm \
+  ( LeftOrRight side, \
+    UpperOrLower uplo, \
+    Orientation orientation, \
+    UnitOrNonUnit diag, \
+    FB alpha, \
+    const Matrix<FA>& A, \
+          Matrix<FB>& B, \
+    bool checkIfSingular ); \
+  template void Trsm \
+  ( LeftOrRight side, \
+    UpperOrLower uplo, \
+    Orientation orientation, \
+    UnitOrNonUnit diag, \
+    FB alpha, \
+    const AbstractDistMatrix<FA>& A, \
+          AbstractDistMatrix<FB>& B, \
+    bool checkIfSingular );
+
+PROTO_MIXED(float,double)
+PROTO_MIXED(Complex<float>,Complex<double>)
+#ifdef EL_HAVE_QD
+PROTO_MIXED(double,DoubleDouble)
+PROTO_MIXED(double,QuadDouble)
+#endif
+#ifdef EL_HAVE_QUAD
+PROTO_MIXED(double,Quad)
+PROTO_MIXED(Complex<double>,Complex<Quad>)
+#endif
+#ifdef EL_HAVE_MPC
+PROTO_MIXED(double,BigFloat)
+#endif
+
 } // namespace El
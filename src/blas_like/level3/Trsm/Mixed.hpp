@@ -0,0 +1,183 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace El {
+
+// Mixed-precision Trsm
+// ====================
+// The triangular matrix A is stored (and communicated) in its own datatype,
+// and the right-hand sides B are solved for in theirs. Each diagonal block of
+// A is converted as it is needed, and the off-diagonal blocks are applied
+// with the mixed-precision Gemm.
+
+namespace trsm {
+
+// Whether the blocks of op(A) are eliminated in increasing order
+inline bool MixedForward
+( LeftOrRight side, UpperOrLower uplo, Orientation orientation )
+{
+    if( side == LEFT )
+        return (uplo == LOWER) == (orientation == NORMAL);
+    else
+        return (uplo == UPPER) == (orientation == NORMAL);
+}
+
+} // namespace trsm
+
+template<typename FA,typename FB>
+void Trsm
+( LeftOrRight side,
+  UpperOrLower uplo,
+  Orientation orientation,
+  UnitOrNonUnit diag,
+  FB alpha,
+  const Matrix<FA>& A,
+        Matrix<FB>& B,
+  bool checkIfSingular )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( A.Height() != A.Width() )
+          LogicError("Triangular matrix must be square");
+      if( side == LEFT && A.Height() != B.Height() )
+          LogicError("Nonconformal Trsm");
+      if( side == RIGHT && A.Height() != B.Width() )
+          LogicError("Nonconformal Trsm");
+    )
+    const Int n = A.Height();
+    const Int bsize = Blocksize();
+    const Int numBlocks = (n+bsize-1) / bsize;
+    const bool forward = trsm::MixedForward( side, uplo, orientation );
+
+    B *= alpha;
+    Matrix<FB> A11Conv;
+    for( Int step=0; step<numBlocks; ++step )
+    {
+        const Int block = ( forward ? step : numBlocks-1-step );
+        const Int k = block*bsize;
+        const Int nb = Min(bsize,n-k);
+        const Range<Int> ind1( k, k+nb );
+        const Range<Int> indRest =
+          ( forward ? Range<Int>(k+nb,n) : Range<Int>(0,k) );
+
+        // Solve against the (converted) diagonal block
+        Copy( A( ind1, ind1 ), A11Conv );
+        if( side == LEFT )
+        {
+            auto B1 = B( ind1, ALL );
+            Trsm
+            ( side, uplo, orientation, diag,
+              FB(1), A11Conv, B1, checkIfSingular );
+
+            // B_rest -= op(A)(rest,1) B1
+            auto BRest = B( indRest, ALL );
+            auto A21 = ( orientation == NORMAL ?
+                         A( indRest, ind1 ) : A( ind1, indRest ) );
+            Gemm( orientation, NORMAL, FB(-1), A21, B1, FB(1), BRest );
+        }
+        else
+        {
+            auto B1 = B( ALL, ind1 );
+            Trsm
+            ( side, uplo, orientation, diag,
+              FB(1), A11Conv, B1, checkIfSingular );
+
+            // B_rest -= B1 op(A)(1,rest)
+            auto BRest = B( ALL, indRest );
+            auto A12 = ( orientation == NORMAL ?
+                         A( ind1, indRest ) : A( indRest, ind1 ) );
+            Gemm( NORMAL, orientation, FB(-1), B1, A12, FB(1), BRest );
+        }
+    }
+}
+
+template<typename FA,typename FB>
+void Trsm
+( LeftOrRight side,
+  UpperOrLower uplo,
+  Orientation orientation,
+  UnitOrNonUnit diag,
+  FB alpha,
+  const AbstractDistMatrix<FA>& APre,
+        AbstractDistMatrix<FB>& BPre,
+  bool checkIfSingular )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      AssertSameGrids( APre, BPre );
+      if( APre.Height() != APre.Width() )
+          LogicError("A must be square");
+      if( side == LEFT && APre.Height() != BPre.Height() )
+          LogicError("Nonconformal Trsm");
+      if( side == RIGHT && APre.Height() != BPre.Width() )
+          LogicError("Nonconformal Trsm");
+    )
+    const Int n = APre.Height();
+    const Int bsize = Blocksize();
+    const Int numBlocks = (n+bsize-1) / bsize;
+    const bool forward = trsm::MixedForward( side, uplo, orientation );
+    const Grid& g = APre.Grid();
+
+    DistMatrixReadProxy<FA,FA,MC,MR> AProx( APre );
+    DistMatrixReadWriteProxy<FB,FB,MC,MR> BProx( BPre );
+    auto& A = AProx.GetLocked();
+    auto& B = BProx.Get();
+
+    DistMatrix<FA,STAR,STAR> A11_STAR_STAR(g);
+    DistMatrix<FB,STAR,VR> B1_STAR_VR(g);
+    DistMatrix<FB,VC,STAR> B1_VC_STAR(g);
+    Matrix<FB> A11Conv;
+
+    B *= alpha;
+    for( Int step=0; step<numBlocks; ++step )
+    {
+        const Int block = ( forward ? step : numBlocks-1-step );
+        const Int k = block*bsize;
+        const Int nb = Min(bsize,n-k);
+        const Range<Int> ind1( k, k+nb );
+        const Range<Int> indRest =
+          ( forward ? Range<Int>(k+nb,n) : Range<Int>(0,k) );
+
+        // Broadcast the diagonal block in the datatype of A
+        A11_STAR_STAR = A( ind1, ind1 );
+        Copy( A11_STAR_STAR.LockedMatrix(), A11Conv );
+        if( side == LEFT )
+        {
+            // B1[*,VR] := inv(op(A11))[*,*] B1[*,VR]
+            auto B1 = B( ind1, ALL );
+            B1_STAR_VR = B1;
+            Trsm
+            ( side, uplo, orientation, diag,
+              FB(1), A11Conv, B1_STAR_VR.Matrix(), checkIfSingular );
+            B1 = B1_STAR_VR;
+
+            auto BRest = B( indRest, ALL );
+            auto A21 = ( orientation == NORMAL ?
+                         A( indRest, ind1 ) : A( ind1, indRest ) );
+            Gemm( orientation, NORMAL, FB(-1), A21, B1, FB(1), BRest );
+        }
+        else
+        {
+            // B1[VC,*] := B1[VC,*] inv(op(A11))[*,*]
+            auto B1 = B( ALL, ind1 );
+            B1_VC_STAR = B1;
+            Trsm
+            ( side, uplo, orientation, diag,
+              FB(1), A11Conv, B1_VC_STAR.Matrix(), checkIfSingular );
+            B1 = B1_VC_STAR;
+
+            auto BRest = B( ALL, indRest );
+            auto A12 = ( orientation == NORMAL ?
+                         A( ind1, indRest ) : A( indRest, ind1 ) );
+            Gemm( NORMAL, orientation, FB(-1), B1, A12, FB(1), BRest );
+        }
+    }
+}
+
+} // namespace El
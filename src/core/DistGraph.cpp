@@ -286,7 +286,7 @@ EL_NO_RELEASE_EXCEPT
     )
     if( localSource == END ) localSource = numLocalSources_ - 1;
     if( target == END ) target = numTargets_ - 1;
-    EL_DEBUG_ONLY(
+    EL_DEBUG_SAMPLED(
       if( localSource < 0 || localSource >= numLocalSources_ )
           LogicError
           ("Local source out of bounds: ",localSource," is not in [0,",
@@ -330,7 +330,7 @@ EL_NO_RELEASE_EXCEPT
     // TODO(poulson): Use FrozenSparsity()
     if( localSource == END ) localSource = numLocalSources_ - 1;
     if( target == END ) target = numTargets_ - 1;
-    EL_DEBUG_ONLY(
+    EL_DEBUG_SAMPLED(
       if( localSource < 0 || localSource >= numLocalSources_ )
           LogicError
           ("Local source out of bounds: ",localSource," is not in [0,",
@@ -433,52 +433,17 @@ void DistGraph::ProcessQueues()
     ProcessLocalQueues();
 }
 
-void DistGraph::ProcessLocalQueues()
+void DistGraph::ProcessLocalQueues( bool sorted )
 {
     EL_DEBUG_CSE
     if( locallyConsistent_ )
         return;
 
-    const Int numLocalEdges = sources_.size();
-    Int numRemoved = 0;
-    vector<pair<Int,Int>> pairs( numLocalEdges );
-    if( markedForRemoval_.size() != 0 )
-    {
-        for( Int e=0; e<numLocalEdges; ++e )
-        {
-            pair<Int,Int> candidate(sources_[e],targets_[e]);
-            if( markedForRemoval_.find(candidate) == markedForRemoval_.end() )
-                pairs[e-numRemoved] = candidate;
-            else
-                ++numRemoved;
-        }
-        SwapClear( markedForRemoval_ );
-        pairs.resize( numLocalEdges-numRemoved );
-    }
-    else
-    {
-        for( Int e=0; e<numLocalEdges; ++e )
-            pairs[e] = pair<Int,Int>{sources_[e],targets_[e]};
-    }
-    std::sort( pairs.begin(), pairs.end() );
-    const Int numSorted = pairs.size();
-
-    // Compress out duplicates
-    Int lastUnique=0;
-    for( Int e=1; e<numSorted; ++e )
-        if( pairs[e] != pairs[lastUnique] )
-            pairs[++lastUnique] = pairs[e];
-    const Int numUnique = lastUnique+1;
-    pairs.resize( numUnique );
-
-    sources_.resize( numUnique );
-    targets_.resize( numUnique );
-    for( Int e=0; e<numUnique; ++e )
-    {
-        sources_[e] = pairs[e].first;
-        targets_[e] = pairs[e].second;
-    }
-    ComputeSourceOffsets();
+    vector<Int>* noValues = nullptr;
+    assembly::RemoveMarked( sources_, targets_, noValues, markedForRemoval_ );
+    assembly::Consolidate
+    ( numLocalSources_, FirstLocalSource(), sources_, targets_, noValues,
+      localSourceOffsets_, sorted );
     locallyConsistent_ = true;
 }
 
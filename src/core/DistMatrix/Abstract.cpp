@@ -61,6 +61,8 @@ AbstractDistMatrix<T>::Empty( bool freeMemory )
     SetShifts();
 
     SwapClear( remoteUpdates );
+    SwapClear( threadUpdates_ );
+    SwapClear( blockUpdates_ );
 }
 
 template<typename T>
@@ -72,6 +74,8 @@ AbstractDistMatrix<T>::EmptyData( bool freeMemory )
     height_ = 0;
     width_ = 0;
     SwapClear( remoteUpdates );
+    SwapClear( threadUpdates_ );
+    SwapClear( blockUpdates_ );
 }
 
 template<typename T>
@@ -558,12 +562,40 @@ void AbstractDistMatrix<T>::Reserve( Int numRemoteUpdates )
     EL_DEBUG_CSE
     const Int currSize = remoteUpdates.size();
     remoteUpdates.reserve( currSize+numRemoteUpdates );
+#ifdef EL_HYBRID
+    // Prepare a queue for each thread so that QueueUpdate can be called from
+    // within a subsequent parallel region
+    if( !omp_in_parallel() )
+    {
+        const Int numThreads = omp_get_max_threads();
+        threadUpdates_.resize( numThreads );
+        const Int numPerThread = (numRemoteUpdates+numThreads-1) / numThreads;
+        for( auto& threadQueue : threadUpdates_ )
+            threadQueue.reserve( threadQueue.size()+numPerThread );
+    }
+#endif
 }
 
 template<typename T>
 void AbstractDistMatrix<T>::QueueUpdate( const Entry<T>& entry )
 EL_NO_RELEASE_EXCEPT
 {
+#ifdef EL_HYBRID
+    // Concurrent local updates could race, so every update is queued (and the
+    // call stack is left untouched)
+    if( omp_in_parallel() )
+    {
+        const Int thread = omp_get_thread_num();
+        if( thread < Int(threadUpdates_.size()) )
+            threadUpdates_[thread].push_back( entry );
+        else
+        {
+            #pragma omp critical
+            remoteUpdates.push_back( entry );
+        }
+        return;
+    }
+#endif
     EL_DEBUG_CSE
     // NOTE: We cannot always simply locally update since it can (and has)
     //       lead to the processors in the same redundant communicator having
@@ -579,6 +611,29 @@ void AbstractDistMatrix<T>::QueueUpdate( Int i, Int j, T value )
 EL_NO_RELEASE_EXCEPT
 { QueueUpdate( Entry<T>{i,j,value} ); }
 
+template<typename T>
+void AbstractDistMatrix<T>::QueueUpdate
+( Int i, Int j, const El::Matrix<T>& block )
+{
+    if( block.Height() == 0 || block.Width() == 0 )
+        return;
+#ifdef EL_HYBRID
+    // The block is validated by ProcessQueues rather than from within the
+    // parallel region
+    if( omp_in_parallel() )
+    {
+        #pragma omp critical
+        blockUpdates_.push_back( BlockUpdate{i,j,block} );
+        return;
+    }
+#endif
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      AssertValidSubmatrix( i, j, block.Height(), block.Width() );
+    )
+    blockUpdates_.push_back( BlockUpdate{i,j,block} );
+}
+
 template<typename T>
 void AbstractDistMatrix<T>::ProcessQueues( bool includeViewers )
 {
@@ -586,49 +641,51 @@ void AbstractDistMatrix<T>::ProcessQueues( bool includeViewers )
     const auto& grid = Grid();
     const Dist colDist = ColDist();
     const Dist rowDist = RowDist();
-    const Int totalSend = remoteUpdates.size();
+    const Int colStride = ColStride();
 
     // We will first push to redundant rank 0
     const int redundantRoot = 0;
 
-    // Compute the metadata
-    // ====================
     mpi::Comm comm;
-    vector<int> sendCounts, owners(totalSend);
     if( includeViewers )
-    {
         comm = grid.ViewingComm();
-        const int viewingSize = mpi::Size( grid.ViewingComm() );
-        sendCounts.resize(viewingSize,0);
-        for( Int k=0; k<totalSend; ++k )
-        {
-            const Entry<T>& entry = remoteUpdates[k];
-            const int distOwner = Owner(entry.i,entry.j);
-            const int vcOwner =
-              grid.CoordsToVC(colDist,rowDist,distOwner,redundantRoot);
-            owners[k] = grid.VCToViewing(vcOwner);
-            ++sendCounts[owners[k]];
-        }
-    }
     else
     {
         if( !Participating() )
             return;
         comm = grid.VCComm();
-        const int vcSize = mpi::Size( grid.VCComm() );
-        sendCounts.resize(vcSize,0);
-        for( Int k=0; k<totalSend; ++k )
-        {
-            const Entry<T>& entry = remoteUpdates[k];
-            const int distOwner = Owner(entry.i,entry.j);
-            owners[k] =
-              grid.CoordsToVC(colDist,rowDist,distOwner,redundantRoot);
-            ++sendCounts[owners[k]];
-        }
     }
+    const int commSize = mpi::Size( comm );
+    const int commRank = mpi::Rank( comm );
+    auto destination = [&]( int distOwner )
+      {
+        const int vcOwner =
+          grid.CoordsToVC(colDist,rowDist,distOwner,redundantRoot);
+        return includeViewers ? grid.VCToViewing(vcOwner) : vcOwner;
+      };
+
+    // Gather the per-thread queues
+    // ============================
+    for( auto& threadQueue : threadUpdates_ )
+    {
+        remoteUpdates.insert
+        ( remoteUpdates.end(), threadQueue.begin(), threadQueue.end() );
+        threadQueue.clear();
+    }
+    const Int totalSend = remoteUpdates.size();
 
-    // Pack the data
-    // =============
+    // Pack the individual updates
+    // ===========================
+    vector<int> owners(totalSend);
+    EL_PARALLEL_FOR
+    for( Int k=0; k<totalSend; ++k )
+    {
+        const Entry<T>& entry = remoteUpdates[k];
+        owners[k] = destination( Owner(entry.i,entry.j) );
+    }
+    vector<int> sendCounts(commSize,0);
+    for( Int k=0; k<totalSend; ++k )
+        ++sendCounts[owners[k]];
     vector<int> sendOffs;
     Scan( sendCounts, sendOffs );
     vector<Entry<T>> sendBuf(totalSend);
@@ -636,18 +693,247 @@ void AbstractDistMatrix<T>::ProcessQueues( bool includeViewers )
     for( Int k=0; k<totalSend; ++k )
         sendBuf[offs[owners[k]]++] = remoteUpdates[k];
     SwapClear( remoteUpdates );
+    SwapClear( owners );
 
-    // Exchange and unpack the data
-    // ============================
-    auto recvBuf = mpi::AllToAll( sendBuf, sendCounts, sendOffs, comm );
-    Int recvBufSize = recvBuf.size();
-    mpi::Broadcast( recvBufSize, redundantRoot, RedundantComm() );
-    recvBuf.resize( recvBufSize );
+    // Sum the duplicate updates destined for each process
+    // ---------------------------------------------------
+    EL_PARALLEL_FOR
+    for( int q=0; q<commSize; ++q )
+    {
+        auto first = sendBuf.begin() + sendOffs[q];
+        auto last = first + sendCounts[q];
+        std::sort
+        ( first, last,
+          []( const Entry<T>& a, const Entry<T>& b )
+          { return a.j < b.j || (a.j == b.j && a.i < b.i); } );
+        Int numUnique = 0;
+        for( auto it=first; it!=last; ++it )
+        {
+            if( numUnique > 0 &&
+                first[numUnique-1].i == it->i &&
+                first[numUnique-1].j == it->j )
+                first[numUnique-1].value += it->value;
+            else
+                first[numUnique++] = *it;
+        }
+        sendCounts[q] = numUnique;
+    }
+
+    // Pack the block updates
+    // ======================
+    // For each block and each process owning a portion of it, the block
+    // location and dimensions are sent along with the owned entries in
+    // column-major order, which the owner can reconstruct from its local
+    // row and column offsets
+    vector<vector<Int>> blockHeaders(commSize);
+    vector<vector<T>> blockValues(commSize);
+    const Int rowStride = RowStride();
+    vector<Int> rowOwnerOffs, colOwnerOffs;
+    vector<Int> rowOrder, colOrder;
+    for( const auto& update : blockUpdates_ )
+    {
+        const Int height = update.block.Height();
+        const Int width = update.block.Width();
+        EL_DEBUG_ONLY(
+          AssertValidSubmatrix( update.i, update.j, height, width );
+        )
+
+        // Bucket the rows and columns of the block by their owners
+        rowOwnerOffs.assign( colStride+1, 0 );
+        colOwnerOffs.assign( rowStride+1, 0 );
+        for( Int iBlock=0; iBlock<height; ++iBlock )
+            ++rowOwnerOffs[RowOwner(update.i+iBlock)+1];
+        for( Int jBlock=0; jBlock<width; ++jBlock )
+            ++colOwnerOffs[ColOwner(update.j+jBlock)+1];
+        for( Int r=0; r<colStride; ++r )
+            rowOwnerOffs[r+1] += rowOwnerOffs[r];
+        for( Int c=0; c<rowStride; ++c )
+            colOwnerOffs[c+1] += colOwnerOffs[c];
+        rowOrder.resize( height );
+        colOrder.resize( width );
+        {
+            auto rowPos = rowOwnerOffs;
+            for( Int iBlock=0; iBlock<height; ++iBlock )
+                rowOrder[rowPos[RowOwner(update.i+iBlock)]++] = iBlock;
+            auto colPos = colOwnerOffs;
+            for( Int jBlock=0; jBlock<width; ++jBlock )
+                colOrder[colPos[ColOwner(update.j+jBlock)]++] = jBlock;
+        }
+
+        for( Int c=0; c<rowStride; ++c )
+        {
+            if( colOwnerOffs[c] == colOwnerOffs[c+1] )
+                continue;
+            for( Int r=0; r<colStride; ++r )
+            {
+                if( rowOwnerOffs[r] == rowOwnerOffs[r+1] )
+                    continue;
+                const int q = destination( r+c*colStride );
+                auto& headers = blockHeaders[q];
+                headers.push_back( update.i );
+                headers.push_back( update.j );
+                headers.push_back( height );
+                headers.push_back( width );
+                auto& values = blockValues[q];
+                for( Int t=colOwnerOffs[c]; t<colOwnerOffs[c+1]; ++t )
+                {
+                    const T* blockCol =
+                      update.block.LockedBuffer(0,colOrder[t]);
+                    for( Int s=rowOwnerOffs[r]; s<rowOwnerOffs[r+1]; ++s )
+                        values.push_back( blockCol[rowOrder[s]] );
+                }
+            }
+        }
+    }
+    SwapClear( blockUpdates_ );
+
+    // Exchange the data
+    // =================
+    // Only the (typically few) nonzero messages are sent point-to-point after
+    // an exchange of the message sizes
+    const int numStreams = 3;
+    vector<int> sendSizes(numStreams*commSize), recvSizes(numStreams*commSize);
+    for( int q=0; q<commSize; ++q )
+    {
+        sendSizes[numStreams*q  ] = sendCounts[q];
+        sendSizes[numStreams*q+1] = blockHeaders[q].size();
+        sendSizes[numStreams*q+2] = blockValues[q].size();
+    }
+    mpi::AllToAll
+    ( sendSizes.data(), numStreams, recvSizes.data(), numStreams, comm );
+    vector<int> recvOffs(numStreams*commSize);
+    Int numRecvEntries=0, numRecvHeaders=0, numRecvValues=0;
+    for( int q=0; q<commSize; ++q )
+    {
+        recvOffs[numStreams*q  ] = numRecvEntries;
+        recvOffs[numStreams*q+1] = numRecvHeaders;
+        recvOffs[numStreams*q+2] = numRecvValues;
+        numRecvEntries += recvSizes[numStreams*q  ];
+        numRecvHeaders += recvSizes[numStreams*q+1];
+        numRecvValues  += recvSizes[numStreams*q+2];
+    }
+    vector<Entry<T>> recvBuf( numRecvEntries );
+    vector<Int> recvHeaders( numRecvHeaders );
+    vector<T> recvValues( numRecvValues );
+
+    vector<mpi::Request<Entry<T>>> entryRequests;
+    vector<mpi::Request<Int>> headerRequests;
+    vector<mpi::Request<T>> valueRequests;
+    entryRequests.reserve( 2*commSize );
+    headerRequests.reserve( 2*commSize );
+    valueRequests.reserve( 2*commSize );
+    for( int q=0; q<commSize; ++q )
+    {
+        const int* sizes = &recvSizes[numStreams*q];
+        const int* rOffs = &recvOffs[numStreams*q];
+        if( q == commRank )
+        {
+            std::copy
+            ( sendBuf.data()+sendOffs[q],
+              sendBuf.data()+sendOffs[q]+sizes[0],
+              recvBuf.data()+rOffs[0] );
+            std::copy
+            ( blockHeaders[q].begin(), blockHeaders[q].end(),
+              recvHeaders.data()+rOffs[1] );
+            std::copy
+            ( blockValues[q].begin(), blockValues[q].end(),
+              recvValues.data()+rOffs[2] );
+            continue;
+        }
+        if( sizes[0] != 0 )
+        {
+            entryRequests.emplace_back();
+            mpi::TaggedIRecv
+            ( &recvBuf[rOffs[0]], sizes[0], q, 0, comm,
+              entryRequests.back() );
+        }
+        if( sizes[1] != 0 )
+        {
+            headerRequests.emplace_back();
+            mpi::TaggedIRecv
+            ( &recvHeaders[rOffs[1]], sizes[1], q, 1, comm,
+              headerRequests.back() );
+        }
+        if( sizes[2] != 0 )
+        {
+            valueRequests.emplace_back();
+            mpi::TaggedIRecv
+            ( &recvValues[rOffs[2]], sizes[2], q, 2, comm,
+              valueRequests.back() );
+        }
+    }
+    for( int q=0; q<commSize; ++q )
+    {
+        if( q == commRank )
+            continue;
+        if( sendCounts[q] != 0 )
+        {
+            entryRequests.emplace_back();
+            mpi::TaggedISend
+            ( &sendBuf[sendOffs[q]], sendCounts[q], q, 0, comm,
+              entryRequests.back() );
+        }
+        if( !blockHeaders[q].empty() )
+        {
+            headerRequests.emplace_back();
+            mpi::TaggedISend
+            ( blockHeaders[q].data(), int(blockHeaders[q].size()), q, 1, comm,
+              headerRequests.back() );
+        }
+        if( !blockValues[q].empty() )
+        {
+            valueRequests.emplace_back();
+            mpi::TaggedISend
+            ( blockValues[q].data(), int(blockValues[q].size()), q, 2, comm,
+              valueRequests.back() );
+        }
+    }
+    mpi::WaitAll( entryRequests.size(), entryRequests.data() );
+    mpi::WaitAll( headerRequests.size(), headerRequests.data() );
+    mpi::WaitAll( valueRequests.size(), valueRequests.data() );
+    SwapClear( sendBuf );
+    SwapClear( blockHeaders );
+    SwapClear( blockValues );
+
+    // Share the received data with the redundant copies
+    // =================================================
+    Int recvBufSizes[numStreams] =
+      { numRecvEntries, numRecvHeaders, numRecvValues };
+    mpi::Broadcast( recvBufSizes, numStreams, redundantRoot, RedundantComm() );
+    recvBuf.resize( recvBufSizes[0] );
+    recvHeaders.resize( recvBufSizes[1] );
+    recvValues.resize( recvBufSizes[2] );
+    mpi::Broadcast
+    ( recvBuf.data(), recvBufSizes[0], redundantRoot, RedundantComm() );
+    mpi::Broadcast
+    ( recvHeaders.data(), recvBufSizes[1], redundantRoot, RedundantComm() );
     mpi::Broadcast
-    ( recvBuf.data(), recvBufSize, redundantRoot, RedundantComm() );
-    // TODO: Make this loop faster
+    ( recvValues.data(), recvBufSizes[2], redundantRoot, RedundantComm() );
+
+    // Unpack the data
+    // ===============
+    T* localBuf = Buffer();
+    const Int ldim = LDim();
     for( const auto& entry : recvBuf )
-        UpdateLocal( LocalRow(entry.i), LocalCol(entry.j), entry.value );
+        localBuf[LocalRow(entry.i)+LocalCol(entry.j)*ldim] += entry.value;
+    Int valueOff = 0;
+    for( Int k=0; k<recvBufSizes[1]; k+=4 )
+    {
+        const Int i = recvHeaders[k];
+        const Int j = recvHeaders[k+1];
+        const Int height = recvHeaders[k+2];
+        const Int width = recvHeaders[k+3];
+        const Int iLocBeg = LocalRowOffset(i);
+        const Int iLocEnd = LocalRowOffset(i+height);
+        const Int jLocBeg = LocalColOffset(j);
+        const Int jLocEnd = LocalColOffset(j+width);
+        for( Int jLoc=jLocBeg; jLoc<jLocEnd; ++jLoc )
+        {
+            T* localCol = &localBuf[jLoc*ldim];
+            for( Int iLoc=iLocBeg; iLoc<iLocEnd; ++iLoc )
+                localCol[iLoc] += recvValues[valueOff++];
+        }
+    }
 }
 
 template<typename T>
@@ -65,6 +65,26 @@ extern "C" {
   ElError ElDistSparseMatrixProcessLocalQueues_ ## SIG \
   ( ElDistSparseMatrix_ ## SIG A ) \
   { EL_TRY( CReflect(A)->ProcessLocalQueues() ) } \
+  ElError ElDistSparseMatrixQueueUpdates_ ## SIG \
+  ( ElDistSparseMatrix_ ## SIG A, ElInt numEntries, \
+    const ElInt* rows, const ElInt* cols, const CREFLECT(T)* values, \
+    bool passive ) \
+  { EL_TRY( \
+      CReflect(A)->QueueUpdates \
+      (numEntries,rows,cols,CReflect(values),passive) ) } \
+  ElError ElDistSparseMatrixQueueLocalUpdates_ ## SIG \
+  ( ElDistSparseMatrix_ ## SIG A, ElInt numEntries, \
+    const ElInt* localRows, const ElInt* cols, const CREFLECT(T)* values ) \
+  { EL_TRY( \
+      CReflect(A)->QueueLocalUpdates \
+      (numEntries,localRows,cols,CReflect(values)) ) } \
+  ElError ElDistSparseMatrixImportLocalCSR_ ## SIG \
+  ( ElDistSparseMatrix_ ## SIG A, ElInt height, ElInt width, \
+    const ElInt* localRowOffsets, const ElInt* cols, \
+    const CREFLECT(T)* values ) \
+  { EL_TRY( \
+      CReflect(A)->ImportLocalCSR \
+      (height,width,localRowOffsets,cols,CReflect(values)) ) } \
   ElError ElDistSparseMatrixHeight_ ## SIG \
   ( ElConstDistSparseMatrix_ ## SIG A, ElInt* height ) \
   { EL_TRY( *height = CReflect(A)->Height() ) } \
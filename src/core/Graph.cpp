@@ -193,7 +193,7 @@ void Graph::QueueConnection( Int source, Int target )
     )
     if( source == END ) source = numSources_ - 1;
     if( target == END ) target = numTargets_ - 1;
-    EL_DEBUG_ONLY(
+    EL_DEBUG_SAMPLED(
       if( source < 0 || source >= numSources_ )
           LogicError
           ("Source out of bounds: ",source," not in [0,",numSources_,")");
@@ -221,7 +221,7 @@ void Graph::QueueDisconnection( Int source, Int target )
     }
 }
 
-void Graph::ProcessQueues()
+void Graph::ProcessQueues( bool sorted )
 {
     EL_DEBUG_CSE
     EL_DEBUG_ONLY(
@@ -231,47 +231,11 @@ void Graph::ProcessQueues()
     if( consistent_ )
         return;
 
-    Int numRemoved=0;
-    const Int numEdges = sources_.size();
-    vector<pair<Int,Int>> pairs( numEdges );
-    if( markedForRemoval_.size() != 0 )
-    {
-        for( Int e=0; e<numEdges; ++e )
-        {
-            pair<Int,Int> candidate(sources_[e],targets_[e]);
-            if( markedForRemoval_.find(candidate) == markedForRemoval_.end() )
-                pairs[e-numRemoved] = candidate;
-            else
-                ++numRemoved;
-        }
-        markedForRemoval_.clear();
-        pairs.resize( numEdges-numRemoved );
-    }
-    else
-    {
-        for( Int e=0; e<numEdges; ++e )
-            pairs[e] = pair<Int,Int>{sources_[e],targets_[e]};
-    }
-    std::sort( pairs.begin(), pairs.end() );
-    const Int numSorted = pairs.size();
-
-    // Compress out duplicates
-    Int lastUnique=0;
-    for( Int e=1; e<numSorted; ++e )
-        if( pairs[e] != pairs[lastUnique] )
-            pairs[++lastUnique] = pairs[e];
-    const Int numUnique = lastUnique+1;
-    pairs.resize( numUnique );
-
-    sources_.resize( numUnique );
-    targets_.resize( numUnique );
-    for( Int e=0; e<numUnique; ++e )
-    {
-        sources_[e] = pairs[e].first;
-        targets_[e] = pairs[e].second;
-    }
-
-    ComputeSourceOffsets();
+    vector<Int>* noValues = nullptr;
+    assembly::RemoveMarked( sources_, targets_, noValues, markedForRemoval_ );
+    assembly::Consolidate
+    ( numSources_, Int(0), sources_, targets_, noValues, sourceOffsets_,
+      sorted );
     consistent_ = true;
 }
 
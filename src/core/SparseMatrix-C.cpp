@@ -39,6 +39,17 @@ extern "C" {
   { EL_TRY( CReflect(A)->QueueZero(row,col) ) } \
   ElError ElSparseMatrixProcessQueues_ ## SIG ( ElSparseMatrix_ ## SIG A ) \
   { EL_TRY( CReflect(A)->ProcessQueues() ) } \
+  ElError ElSparseMatrixQueueUpdates_ ## SIG \
+  ( ElSparseMatrix_ ## SIG A, ElInt numEntries, \
+    const ElInt* rows, const ElInt* cols, const CREFLECT(T)* values ) \
+  { EL_TRY( \
+      CReflect(A)->QueueUpdates(numEntries,rows,cols,CReflect(values)) ) } \
+  ElError ElSparseMatrixImportCSR_ ## SIG \
+  ( ElSparseMatrix_ ## SIG A, ElInt height, ElInt width, \
+    const ElInt* rowOffsets, const ElInt* cols, const CREFLECT(T)* values ) \
+  { EL_TRY( \
+      CReflect(A)->ImportCSR \
+      (height,width,rowOffsets,cols,CReflect(values)) ) } \
   ElError ElSparseMatrixHeight_ ## SIG \
   ( ElConstSparseMatrix_ ## SIG A, ElInt* height ) \
   { EL_TRY( *height = CReflect(A)->Height() ) } \
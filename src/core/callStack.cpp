@@ -2,91 +2,118 @@
    Copyright (c) 2009-2016, Jack Poulson
    All rights reserved.
 
-   This file is part of Elemental and is under the BSD 2-Clause License, 
-   which can be found in the LICENSE file in the root directory, or at 
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
    http://opensource.org/licenses/BSD-2-Clause
 */
 #include <El-lite.hpp>
-#include <stack>
+#include <set>
 
 namespace {
 
-// Debugging
-EL_DEBUG_ONLY(
-  std::stack<std::string> callStack;
+#ifndef EL_RELEASE
+  const El::Int callStackCapacity = 256;
+
+  // The frames are stored in a per-thread ring buffer of static strings. Since
+  // this structure is trivially constructible, each thread's copy is
+  // zero-initialized without any dynamic initialization, and so it may be
+  // pushed to even before main is entered (e.g., by the construction of a
+  // global BigInt).
+  struct CallStack
+  {
+      const char* frames[callStackCapacity];
+      El::Int depth;
+  };
+  thread_local CallStack callStack;
+
+  // Frames pushed as (dynamic) strings are interned so that their addresses
+  // remain valid for as long as they could be on the stack
+  thread_local std::set<std::string>* internedFrames = nullptr;
+
+  thread_local El::Int debugCheckCounter = 0;
+  El::Int debugCheckPeriod = 1;
+
   bool tracingEnabled = false;
-)
+#endif // ifndef EL_RELEASE
 
 }
 
 namespace El {
 
 // If we are not in RELEASE mode, then implement wrappers for a call stack
-EL_DEBUG_ONLY(
+#ifndef EL_RELEASE
 
   void EnableTracing() { ::tracingEnabled = true; }
   void DisableTracing() { ::tracingEnabled = false; }
 
-  void PushCallStack( string s )
-  { 
-      // [1]:
-      // It was discovered that a global instantiation of a BigInt
-      // (::bigIntZero) led to pushing to the call stack in global scope
-      // before entering main, and this could possibly have been before the
-      // call stack was constructed, leading to PopCallStack() causing an
-      // exception due to the stack being empty. But this isn't completely
-      // verified.
-      if( !Initialized() )
-          return;
-#ifdef EL_HYBRID
-      if( omp_get_thread_num() != 0 )
-          return;
-#endif
-      const size_t maxStackSize = 300;
-      if( ::callStack.size() > maxStackSize )
-      {
-          DumpCallStack();
-          return;
-      }
-      ::callStack.push(s); 
+  void PushCallStack( const char* s )
+  {
+      auto& stack = ::callStack;
+      stack.frames[stack.depth % callStackCapacity] = s;
+      ++stack.depth;
       if( ::tracingEnabled )
       {
-          const int stackSize = ::callStack.size();
           ostringstream os;
-          for( int j=0; j<stackSize; ++j )
-              os << " "; 
+#ifdef EL_HYBRID
+          os << "[" << omp_get_thread_num() << "]";
+#endif
+          for( Int j=0; j<stack.depth; ++j )
+              os << " ";
           os << s << endl;
-          cout <<  os.str();
+          cout << os.str();
       }
   }
 
+  void PushCallStack( const string& s )
+  {
+      if( ::internedFrames == nullptr )
+          ::internedFrames = new std::set<std::string>;
+      PushCallStack( ::internedFrames->insert(s).first->c_str() );
+  }
+
   void PopCallStack()
-  { 
-      // See note [1] above.
-      if( !Initialized() )
-          return;
-#ifdef EL_HYBRID
-      if( omp_get_thread_num() != 0 )
-          return;
-#endif
-      if( ::callStack.empty() )
+  {
+      if( ::callStack.depth == 0 )
           LogicError("Attempted to pop an empty call stack");
-      ::callStack.pop(); 
+      --::callStack.depth;
   }
 
   void DumpCallStack( ostream& os )
   {
+      auto& stack = ::callStack;
       ostringstream msg;
-      while( ! ::callStack.empty() )
-      {
-          msg << "[" << ::callStack.size() << "]: " << ::callStack.top() 
+      const Int numKept = Min(stack.depth,callStackCapacity);
+      for( Int j=stack.depth; j>stack.depth-numKept; --j )
+          msg << "[" << j << "]: " << stack.frames[(j-1) % callStackCapacity]
               << "\n";
-          ::callStack.pop();
-      }
+      if( stack.depth > numKept )
+          msg << "(" << stack.depth-numKept << " older frames were dropped)\n";
+      stack.depth = 0;
       os << msg.str();
       os.flush();
   }
 
-) // EL_DEBUG_ONLY
+  void SetDebugCheckPeriod( Int period )
+  {
+      if( period < 1 )
+          LogicError("Debug check period must be positive");
+      ::debugCheckPeriod = period;
+  }
+
+  Int DebugCheckPeriod() { return ::debugCheckPeriod; }
+
+  bool SampleDebugCheck()
+  {
+      if( ::debugCheckPeriod == 1 )
+          return true;
+      if( ++::debugCheckCounter >= ::debugCheckPeriod )
+      {
+          ::debugCheckCounter = 0;
+          return true;
+      }
+      return false;
+  }
+
+#endif // ifndef EL_RELEASE
 
 } // namespace El
@@ -2311,6 +2311,100 @@ void AllReduce( T* buf, int count, Comm comm )
 EL_NO_RELEASE_EXCEPT
 { AllReduce( buf, count, SUM, comm ); }
 
+template<typename Real,
+         typename/*=EnableIf<IsPacked<Real>>*/>
+void IAllReduce
+( Real* buf, int count, Op op, Comm comm, Request<Real>& request )
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    request.backend = MPI_REQUEST_NULL;
+    if( count == 0 || Size(comm) == 1 )
+        return;
+#ifdef EL_HAVE_MPI3_NONBLOCKING_COLLECTIVES
+    MPI_Op opC = NativeOp<Real>( op );
+    SafeMpi
+    ( MPI_Iallreduce
+      ( MPI_IN_PLACE, buf, count, TypeMap<Real>(), opC, comm.comm,
+        &request.backend ) );
+#else
+    AllReduce( buf, count, op, comm );
+#endif
+}
+
+template<typename Real,
+         typename/*=EnableIf<IsPacked<Real>>*/>
+void IAllReduce
+( Complex<Real>* buf, int count, Op op, Comm comm,
+  Request<Complex<Real>>& request )
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    request.backend = MPI_REQUEST_NULL;
+    if( count == 0 || Size(comm) == 1 )
+        return;
+#ifdef EL_HAVE_MPI3_NONBLOCKING_COLLECTIVES
+#ifdef EL_AVOID_COMPLEX_MPI
+    if( op == SUM )
+    {
+        MPI_Op opC = NativeOp<Real>( op );
+        SafeMpi
+        ( MPI_Iallreduce
+          ( MPI_IN_PLACE, buf, 2*count, TypeMap<Real>(), opC, comm.comm,
+            &request.backend ) );
+    }
+    else
+    {
+        MPI_Op opC = NativeOp<Complex<Real>>( op );
+        SafeMpi
+        ( MPI_Iallreduce
+          ( MPI_IN_PLACE, buf, count, TypeMap<Complex<Real>>(), opC,
+            comm.comm, &request.backend ) );
+    }
+#else
+    MPI_Op opC = NativeOp<Complex<Real>>( op );
+    SafeMpi
+    ( MPI_Iallreduce
+      ( MPI_IN_PLACE, buf, count, TypeMap<Complex<Real>>(), opC,
+        comm.comm, &request.backend ) );
+#endif
+#else
+    AllReduce( buf, count, op, comm );
+#endif
+}
+
+template<typename T,
+         typename/*=DisableIf<IsPacked<T>>*/,
+         typename/*=void*/>
+void IAllReduce
+( T* buf, int count, Op op, Comm comm, Request<T>& request )
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    request.backend = MPI_REQUEST_NULL;
+    if( count == 0 )
+        return;
+#ifdef EL_HAVE_MPI3_NONBLOCKING_COLLECTIVES
+    // The packed result is unpacked into 'buf' by Wait
+    MPI_Op opC = NativeOp<T>( op );
+    Serialize( count, buf, request.buffer );
+    request.receivingPacked = true;
+    request.recvCount = count;
+    request.unpackedRecvBuf = buf;
+    SafeMpi
+    ( MPI_Iallreduce
+      ( MPI_IN_PLACE, request.buffer.data(), count, TypeMap<T>(), opC,
+        comm.comm, &request.backend ) );
+#else
+    AllReduce( buf, count, op, comm );
+#endif
+}
+
+template<typename T>
+void IAllReduce( T* buf, int count, Comm comm, Request<T>& request )
+EL_NO_RELEASE_EXCEPT
+{ IAllReduce( buf, count, SUM, comm, request ); }
+
 template<typename Real,
          typename/*=EnableIf<IsPacked<Real>>*/>
 void ReduceScatter( Real* sbuf, Real* rbuf, int rc, Op op, Comm comm )
@@ -2951,6 +3045,9 @@ EL_NO_RELEASE_EXCEPT
   EL_NO_RELEASE_EXCEPT; \
   template void AllReduce<T>( T* buf, int count, Comm comm ) \
   EL_NO_RELEASE_EXCEPT; \
+  template void IAllReduce<T> \
+  ( T* buf, int count, Comm comm, Request<T>& request ) \
+  EL_NO_RELEASE_EXCEPT; \
   template void ReduceScatter<T>( T* sbuf, T* rbuf, int rc, Op op, Comm comm ) \
   EL_NO_RELEASE_EXCEPT; \
   template void ReduceScatter<T>( T* sbuf, T* rbuf, int rc, Comm comm ) \
@@ -3022,6 +3119,9 @@ EL_NO_RELEASE_EXCEPT
   ( const T* sbuf, T* rbuf, int count, Op op, Comm comm ) \
   EL_NO_RELEASE_EXCEPT; \
   template void AllReduce<S>( T* buf, int count, Op op, Comm comm ) \
+  EL_NO_RELEASE_EXCEPT; \
+  template void IAllReduce<S> \
+  ( T* buf, int count, Op op, Comm comm, Request<T>& request ) \
   EL_NO_RELEASE_EXCEPT;
 
 #define MPI_PROTO_REAL(T) \
@@ -3030,7 +3130,10 @@ EL_NO_RELEASE_EXCEPT
   
 #define MPI_PROTO_COMPLEX(T) \
   MPI_PROTO_BASE(Complex<T>) \
-  MPI_PROTO_DIFF(T, Complex<T>)
+  MPI_PROTO_DIFF(T, Complex<T>) \
+  template void TaggedIRecv<T> \
+  ( Complex<T>* buf, int count, int from, int tag, Comm comm, \
+    Request<Complex<T>>& request ) EL_NO_RELEASE_EXCEPT;
 
 MPI_PROTO_REAL(byte)
 MPI_PROTO_REAL(int)
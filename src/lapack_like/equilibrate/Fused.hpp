@@ -0,0 +1,610 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_EQUILIBRATE_FUSED_HPP
+#define EL_EQUILIBRATE_FUSED_HPP
+
+// Each half-sweep of an equilibration algorithm applies the scaling computed
+// by the previous half-sweep and then computes the row (or column) statistics
+// which determine the next one. Rather than making separate passes over the
+// matrix for each DiagonalSolve, ColumnMaxNorms, ColumnMinAbsNonzero, etc.,
+// the routines below apply the pending scalings, A := inv(R) A inv(C), and
+// accumulate the maximum and minimum nonzero magnitudes of each row (or
+// column) of the result in a single (threaded) traversal. In the distributed
+// sparse case, the maxima and minima of the columns are exchanged using a
+// single AllToAll.
+//
+// An empty scaling vector is interpreted as the identity. The minima are only
+// formed if 'wantMin' is true; rows (columns) without any nonzeros have both
+// their maximum and minimum set to zero.
+
+namespace El {
+namespace equil {
+
+// Raw kernels
+// ===========
+
+// Sparse matrices in CSR format, where column indices may be either global
+// or offsets into a packed array of (remote) column values
+// -----------------------------------------------------------------------
+template<typename Field>
+void ScaleAndRowExtrema
+( Int numRows,
+  const Int* offsetBuf,
+  const Int* colBuf,
+        Field* valBuf,
+  const Base<Field>* rowScale,
+  const Base<Field>* colScale,
+        Base<Field>* rowMax,
+        Base<Field>* rowMin )
+{
+    typedef Base<Field> Real;
+    EL_PARALLEL_FOR
+    for( Int i=0; i<numRows; ++i )
+    {
+        const Real rowDelta = ( rowScale ? rowScale[i] : Real(1) );
+        Real maxAbs = 0, minAbs = limits::Max<Real>();
+        for( Int e=offsetBuf[i]; e<offsetBuf[i+1]; ++e )
+        {
+            Field& value = valBuf[e];
+            if( colScale )
+                value /= rowDelta*colScale[colBuf[e]];
+            else if( rowScale )
+                value /= rowDelta;
+            const Real absVal = Abs(value);
+            maxAbs = Max(maxAbs,absVal);
+            if( absVal > Real(0) )
+                minAbs = Min(minAbs,absVal);
+        }
+        rowMax[i] = maxAbs;
+        if( rowMin )
+            rowMin[i] = Min(minAbs,maxAbs);
+    }
+}
+
+template<typename Field>
+void ScaleAndColumnExtrema
+( Int numRows,
+  const Int* offsetBuf,
+  const Int* colBuf,
+        Field* valBuf,
+  const Base<Field>* rowScale,
+  const Base<Field>* colScale,
+        Int numCols,
+        Base<Field>* colMax,
+        Base<Field>* colMin )
+{
+    typedef Base<Field> Real;
+    const Real maxVal = limits::Max<Real>();
+    auto localPass =
+      [&]( Int rowBeg, Int rowEnd, Real* maxBuf, Real* minBuf )
+      {
+        for( Int i=rowBeg; i<rowEnd; ++i )
+        {
+            const Real rowDelta = ( rowScale ? rowScale[i] : Real(1) );
+            for( Int e=offsetBuf[i]; e<offsetBuf[i+1]; ++e )
+            {
+                const Int j = colBuf[e];
+                Field& value = valBuf[e];
+                if( colScale )
+                    value /= rowDelta*colScale[j];
+                else if( rowScale )
+                    value /= rowDelta;
+                const Real absVal = Abs(value);
+                maxBuf[j] = Max(maxBuf[j],absVal);
+                if( minBuf && absVal > Real(0) )
+                    minBuf[j] = Min(minBuf[j],absVal);
+            }
+        }
+      };
+
+    for( Int j=0; j<numCols; ++j )
+    {
+        colMax[j] = 0;
+        if( colMin )
+            colMin[j] = maxVal;
+    }
+#ifdef EL_HYBRID
+    const Int maxThreads = omp_get_max_threads();
+    if( maxThreads > 1 && numRows > 1 )
+    {
+        // Each thread accumulates the extrema of its block of rows into a
+        // private buffer, and the buffers are then combined column-wise
+        vector<Real> maxBufs( maxThreads*numCols, Real(0) );
+        vector<Real> minBufs( colMin ? maxThreads*numCols : 0, maxVal );
+        Int numThreads = 1;
+        #pragma omp parallel
+        {
+            const Int thread = omp_get_thread_num();
+            #pragma omp single
+            numThreads = omp_get_num_threads();
+            const Int chunk = (numRows + numThreads - 1) / numThreads;
+            const Int rowBeg = Min(chunk*thread,numRows);
+            const Int rowEnd = Min(chunk*(thread+1),numRows);
+            localPass
+            ( rowBeg, rowEnd, &maxBufs[thread*numCols],
+              colMin ? &minBufs[thread*numCols] : nullptr );
+        }
+        EL_PARALLEL_FOR
+        for( Int j=0; j<numCols; ++j )
+        {
+            for( Int t=0; t<numThreads; ++t )
+            {
+                colMax[j] = Max(colMax[j],maxBufs[t*numCols+j]);
+                if( colMin )
+                    colMin[j] = Min(colMin[j],minBufs[t*numCols+j]);
+            }
+        }
+    }
+    else
+        localPass( 0, numRows, colMax, colMin );
+#else
+    localPass( 0, numRows, colMax, colMin );
+#endif
+}
+
+// Dense column-major matrices
+// ---------------------------
+template<typename Field>
+void ScaleAndRowExtrema
+( Int m, Int n, Field* ABuf, Int ALDim,
+  const Base<Field>* rowScale,
+  const Base<Field>* colScale,
+        Base<Field>* rowMax,
+        Base<Field>* rowMin )
+{
+    typedef Base<Field> Real;
+    // Threads are assigned disjoint blocks of rows so that the accumulation
+    // into the row statistics is race-free while still traversing the
+    // columns contiguously
+    const Int blockSize = 64;
+    const Int numBlocks = (m + blockSize - 1) / blockSize;
+    EL_PARALLEL_FOR
+    for( Int block=0; block<numBlocks; ++block )
+    {
+        const Int iBeg = block*blockSize;
+        const Int iEnd = Min(iBeg+blockSize,m);
+        for( Int i=iBeg; i<iEnd; ++i )
+        {
+            rowMax[i] = 0;
+            if( rowMin )
+                rowMin[i] = limits::Max<Real>();
+        }
+        for( Int j=0; j<n; ++j )
+        {
+            Field* aCol = &ABuf[j*ALDim];
+            const Real colDelta = ( colScale ? colScale[j] : Real(1) );
+            for( Int i=iBeg; i<iEnd; ++i )
+            {
+                if( rowScale )
+                    aCol[i] /= rowScale[i]*colDelta;
+                else if( colScale )
+                    aCol[i] /= colDelta;
+                const Real absVal = Abs(aCol[i]);
+                rowMax[i] = Max(rowMax[i],absVal);
+                if( rowMin && absVal > Real(0) )
+                    rowMin[i] = Min(rowMin[i],absVal);
+            }
+        }
+        if( rowMin )
+            for( Int i=iBeg; i<iEnd; ++i )
+                rowMin[i] = Min(rowMin[i],rowMax[i]);
+    }
+}
+
+template<typename Field>
+void ScaleAndColumnExtrema
+( Int m, Int n, Field* ABuf, Int ALDim,
+  const Base<Field>* rowScale,
+  const Base<Field>* colScale,
+        Base<Field>* colMax,
+        Base<Field>* colMin )
+{
+    typedef Base<Field> Real;
+    EL_PARALLEL_FOR
+    for( Int j=0; j<n; ++j )
+    {
+        Field* aCol = &ABuf[j*ALDim];
+        const Real colDelta = ( colScale ? colScale[j] : Real(1) );
+        Real maxAbs = 0, minAbs = limits::Max<Real>();
+        for( Int i=0; i<m; ++i )
+        {
+            if( rowScale )
+                aCol[i] /= rowScale[i]*colDelta;
+            else if( colScale )
+                aCol[i] /= colDelta;
+            const Real absVal = Abs(aCol[i]);
+            maxAbs = Max(maxAbs,absVal);
+            if( absVal > Real(0) )
+                minAbs = Min(minAbs,absVal);
+        }
+        colMax[j] = maxAbs;
+        if( colMin )
+            colMin[j] = Min(minAbs,maxAbs);
+    }
+}
+
+template<typename Real>
+const Real* ScaleBuffer( const Matrix<Real>& scale )
+{ return scale.Height() == 0 ? nullptr : scale.LockedBuffer(); }
+
+// Sequential dense matrices
+// =========================
+template<typename Field>
+void RowExtrema
+( Matrix<Field>& A,
+  const Matrix<Base<Field>>& rowScale,
+  const Matrix<Base<Field>>& colScale,
+        Matrix<Base<Field>>& rowMax,
+        Matrix<Base<Field>>& rowMin,
+        bool wantMin )
+{
+    EL_DEBUG_CSE
+    rowMax.Resize( A.Height(), 1 );
+    if( wantMin )
+        rowMin.Resize( A.Height(), 1 );
+    ScaleAndRowExtrema
+    ( A.Height(), A.Width(), A.Buffer(), A.LDim(),
+      ScaleBuffer(rowScale), ScaleBuffer(colScale),
+      rowMax.Buffer(), wantMin ? rowMin.Buffer() : nullptr );
+}
+
+template<typename Field>
+void ColumnExtrema
+( Matrix<Field>& A,
+  const Matrix<Base<Field>>& rowScale,
+  const Matrix<Base<Field>>& colScale,
+        Matrix<Base<Field>>& colMax,
+        Matrix<Base<Field>>& colMin,
+        bool wantMin )
+{
+    EL_DEBUG_CSE
+    colMax.Resize( A.Width(), 1 );
+    if( wantMin )
+        colMin.Resize( A.Width(), 1 );
+    ScaleAndColumnExtrema
+    ( A.Height(), A.Width(), A.Buffer(), A.LDim(),
+      ScaleBuffer(rowScale), ScaleBuffer(colScale),
+      colMax.Buffer(), wantMin ? colMin.Buffer() : nullptr );
+}
+
+// Distributed dense matrices
+// ==========================
+// The local extrema are combined with a single AllReduce, where the minima
+// are negated so that both reductions are maxima.
+template<typename Real>
+void AllReduceExtrema
+( Matrix<Real>& maxLoc, Matrix<Real>& minLoc, bool wantMin, mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    const Int n = maxLoc.Height();
+    if( !wantMin )
+    {
+        mpi::AllReduce( maxLoc.Buffer(), n, mpi::MAX, comm );
+        return;
+    }
+    vector<Real> buf( 2*n );
+    for( Int j=0; j<n; ++j )
+    {
+        // Temporarily treat rows without nonzeros as having an infinite
+        // minimum so that they do not pollute the reduction
+        buf[j] = maxLoc(j);
+        buf[n+j] = ( maxLoc(j) > Real(0) ? -minLoc(j) : -limits::Max<Real>() );
+    }
+    mpi::AllReduce( buf.data(), 2*n, mpi::MAX, comm );
+    for( Int j=0; j<n; ++j )
+    {
+        maxLoc(j) = buf[j];
+        minLoc(j) = Min(-buf[n+j],buf[j]);
+    }
+}
+
+template<typename Field>
+void RowExtrema
+( DistMatrix<Field>& A,
+  const DistMatrix<Base<Field>,MC,STAR>& rowScale,
+  const DistMatrix<Base<Field>,MR,STAR>& colScale,
+        DistMatrix<Base<Field>,MC,STAR>& rowMax,
+        DistMatrix<Base<Field>,MC,STAR>& rowMin,
+        bool wantMin )
+{
+    EL_DEBUG_CSE
+    rowMax.AlignWith( A );
+    rowMax.Resize( A.Height(), 1 );
+    if( wantMin )
+    {
+        rowMin.AlignWith( A );
+        rowMin.Resize( A.Height(), 1 );
+    }
+    ScaleAndRowExtrema
+    ( A.LocalHeight(), A.LocalWidth(), A.Buffer(), A.LDim(),
+      ScaleBuffer(rowScale.LockedMatrix()),
+      ScaleBuffer(colScale.LockedMatrix()),
+      rowMax.Buffer(), wantMin ? rowMin.Buffer() : nullptr );
+    AllReduceExtrema( rowMax.Matrix(), rowMin.Matrix(), wantMin, A.RowComm() );
+}
+
+template<typename Field>
+void ColumnExtrema
+( DistMatrix<Field>& A,
+  const DistMatrix<Base<Field>,MC,STAR>& rowScale,
+  const DistMatrix<Base<Field>,MR,STAR>& colScale,
+        DistMatrix<Base<Field>,MR,STAR>& colMax,
+        DistMatrix<Base<Field>,MR,STAR>& colMin,
+        bool wantMin )
+{
+    EL_DEBUG_CSE
+    colMax.AlignWith( A );
+    colMax.Resize( A.Width(), 1 );
+    if( wantMin )
+    {
+        colMin.AlignWith( A );
+        colMin.Resize( A.Width(), 1 );
+    }
+    ScaleAndColumnExtrema
+    ( A.LocalHeight(), A.LocalWidth(), A.Buffer(), A.LDim(),
+      ScaleBuffer(rowScale.LockedMatrix()),
+      ScaleBuffer(colScale.LockedMatrix()),
+      colMax.Buffer(), wantMin ? colMin.Buffer() : nullptr );
+    AllReduceExtrema( colMax.Matrix(), colMin.Matrix(), wantMin, A.ColComm() );
+}
+
+// Sequential sparse matrices
+// ==========================
+template<typename Field>
+void RowExtrema
+( SparseMatrix<Field>& A,
+  const Matrix<Base<Field>>& rowScale,
+  const Matrix<Base<Field>>& colScale,
+        Matrix<Base<Field>>& rowMax,
+        Matrix<Base<Field>>& rowMin,
+        bool wantMin )
+{
+    EL_DEBUG_CSE
+    rowMax.Resize( A.Height(), 1 );
+    if( wantMin )
+        rowMin.Resize( A.Height(), 1 );
+    ScaleAndRowExtrema
+    ( A.Height(), A.LockedOffsetBuffer(), A.LockedTargetBuffer(),
+      A.ValueBuffer(), ScaleBuffer(rowScale), ScaleBuffer(colScale),
+      rowMax.Buffer(), wantMin ? rowMin.Buffer() : nullptr );
+}
+
+template<typename Field>
+void ColumnExtrema
+( SparseMatrix<Field>& A,
+  const Matrix<Base<Field>>& rowScale,
+  const Matrix<Base<Field>>& colScale,
+        Matrix<Base<Field>>& colMax,
+        Matrix<Base<Field>>& colMin,
+        bool wantMin )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int n = A.Width();
+    colMax.Resize( n, 1 );
+    if( wantMin )
+        colMin.Resize( n, 1 );
+    ScaleAndColumnExtrema
+    ( A.Height(), A.LockedOffsetBuffer(), A.LockedTargetBuffer(),
+      A.ValueBuffer(), ScaleBuffer(rowScale), ScaleBuffer(colScale),
+      n, colMax.Buffer(), wantMin ? colMin.Buffer() : nullptr );
+    if( wantMin )
+        for( Int j=0; j<n; ++j )
+            colMin(j) = Min(colMin(j),colMax(j));
+}
+
+// Distributed sparse matrices
+// ===========================
+// Gather the entries of a column scaling needed by the local nonzeros, in the
+// packed ordering of the communication metadata for sparse multiplication
+template<typename Field>
+void PackColumnScale
+( const DistSparseMatrix<Field>& A,
+  const DistMultiVec<Base<Field>>& colScale,
+        vector<Base<Field>>& packedScale )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const auto& meta = A.LockedDistGraph().multMeta;
+    const Int numSendInds = meta.sendInds.size();
+    const Int firstLocalRow = colScale.FirstLocalRow();
+    const Real* scaleBuf = colScale.LockedMatrix().LockedBuffer();
+    vector<Real> sendVals( numSendInds );
+    for( Int s=0; s<numSendInds; ++s )
+        sendVals[s] = scaleBuf[meta.sendInds[s]-firstLocalRow];
+    packedScale.resize( meta.numRecvInds );
+    mpi::AllToAll
+    ( sendVals.data(), meta.sendSizes.data(), meta.sendOffs.data(),
+      packedScale.data(), meta.recvSizes.data(), meta.recvOffs.data(),
+      A.Grid().Comm() );
+}
+
+template<typename Field>
+void RowExtrema
+( DistSparseMatrix<Field>& A,
+  const DistMultiVec<Base<Field>>& rowScale,
+  const DistMultiVec<Base<Field>>& colScale,
+        DistMultiVec<Base<Field>>& rowMax,
+        DistMultiVec<Base<Field>>& rowMin,
+        bool wantMin )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Grid& grid = A.Grid();
+    vector<Real> packedColScale;
+    if( colScale.Height() != 0 )
+    {
+        A.InitializeMultMeta();
+        PackColumnScale( A, colScale, packedColScale );
+    }
+    rowMax.SetGrid( grid );
+    rowMax.Resize( A.Height(), 1 );
+    if( wantMin )
+    {
+        rowMin.SetGrid( grid );
+        rowMin.Resize( A.Height(), 1 );
+    }
+    const Int* colBuf =
+      ( colScale.Height() != 0 ?
+        A.LockedDistGraph().multMeta.colOffs.data() : nullptr );
+    ScaleAndRowExtrema
+    ( A.LocalHeight(), A.LockedOffsetBuffer(), colBuf, A.ValueBuffer(),
+      ScaleBuffer(rowScale.LockedMatrix()),
+      colScale.Height() != 0 ? packedColScale.data() : nullptr,
+      rowMax.Matrix().Buffer(),
+      wantMin ? rowMin.Matrix().Buffer() : nullptr );
+}
+
+template<typename Field>
+void ColumnExtrema
+( DistSparseMatrix<Field>& A,
+  const DistMultiVec<Base<Field>>& rowScale,
+  const DistMultiVec<Base<Field>>& colScale,
+        DistMultiVec<Base<Field>>& colMax,
+        DistMultiVec<Base<Field>>& colMin,
+        bool wantMin )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Grid& grid = A.Grid();
+    A.InitializeMultMeta();
+    const auto& meta = A.LockedDistGraph().multMeta;
+    vector<Real> packedColScale;
+    if( colScale.Height() != 0 )
+        PackColumnScale( A, colScale, packedColScale );
+
+    // Accumulate the extrema of the (packed) columns touched locally
+    // --------------------------------------------------------------
+    const Int numRecvInds = meta.numRecvInds;
+    vector<Real> packedMax( numRecvInds ),
+                 packedMin( wantMin ? numRecvInds : 0 );
+    ScaleAndColumnExtrema
+    ( A.LocalHeight(), A.LockedOffsetBuffer(), meta.colOffs.data(),
+      A.ValueBuffer(), ScaleBuffer(rowScale.LockedMatrix()),
+      colScale.Height() != 0 ? packedColScale.data() : nullptr,
+      numRecvInds, packedMax.data(), wantMin ? packedMin.data() : nullptr );
+
+    // Send the maxima and minima to the owners of the columns at once
+    // ---------------------------------------------------------------
+    const int commSize = grid.Size();
+    const int numPerInd = ( wantMin ? 2 : 1 );
+    vector<int> sendSizes(commSize), sendOffs(commSize),
+                recvSizes(commSize), recvOffs(commSize);
+    for( int q=0; q<commSize; ++q )
+    {
+        sendSizes[q] = numPerInd*meta.recvSizes[q];
+        sendOffs[q] = numPerInd*meta.recvOffs[q];
+        recvSizes[q] = numPerInd*meta.sendSizes[q];
+        recvOffs[q] = numPerInd*meta.sendOffs[q];
+    }
+    vector<Real> sendVals( numPerInd*numRecvInds );
+    for( Int k=0; k<numRecvInds; ++k )
+    {
+        sendVals[numPerInd*k] = packedMax[k];
+        if( wantMin )
+            sendVals[numPerInd*k+1] = packedMin[k];
+    }
+    const Int numSendInds = meta.sendInds.size();
+    vector<Real> recvVals( numPerInd*numSendInds );
+    mpi::AllToAll
+    ( sendVals.data(), sendSizes.data(), sendOffs.data(),
+      recvVals.data(), recvSizes.data(), recvOffs.data(), grid.Comm() );
+
+    // Combine the contributions
+    // -------------------------
+    colMax.SetGrid( grid );
+    Zeros( colMax, A.Width(), 1 );
+    auto& colMaxLoc = colMax.Matrix();
+    const Int firstLocalRow = colMax.FirstLocalRow();
+    if( wantMin )
+    {
+        colMin.SetGrid( grid );
+        colMin.Resize( A.Width(), 1 );
+        Fill( colMin, limits::Max<Real>() );
+    }
+    auto& colMinLoc = colMin.Matrix();
+    for( Int s=0; s<numSendInds; ++s )
+    {
+        const Int jLoc = meta.sendInds[s] - firstLocalRow;
+        colMaxLoc(jLoc) = Max(colMaxLoc(jLoc),recvVals[numPerInd*s]);
+        if( wantMin )
+            colMinLoc(jLoc) = Min(colMinLoc(jLoc),recvVals[numPerInd*s+1]);
+    }
+    if( wantMin )
+    {
+        const Int localWidth = colMax.LocalHeight();
+        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+            colMinLoc(jLoc) = Min(colMinLoc(jLoc),colMaxLoc(jLoc));
+    }
+}
+
+// The maximum and minimum nonzero magnitudes over all rows (or columns) given
+// their individual extrema
+// =======================================================================
+template<typename Real>
+void LocalGlobalExtrema
+( const Matrix<Real>& maxs, const Matrix<Real>& mins,
+  Real& maxAbs, Real& minAbs )
+{
+    maxAbs = 0;
+    minAbs = limits::Max<Real>();
+    const Int n = maxs.Height();
+    for( Int j=0; j<n; ++j )
+    {
+        if( maxs(j) > Real(0) )
+        {
+            maxAbs = Max(maxAbs,maxs(j));
+            minAbs = Min(minAbs,mins(j));
+        }
+    }
+}
+
+template<typename Real>
+void GlobalExtrema
+( const Matrix<Real>& maxs, const Matrix<Real>& mins,
+  Real& maxAbs, Real& minAbs )
+{
+    EL_DEBUG_CSE
+    LocalGlobalExtrema( maxs, mins, maxAbs, minAbs );
+    if( maxAbs == Real(0) )
+        minAbs = 0;
+}
+
+template<typename Real>
+void GlobalExtrema
+( const DistMultiVec<Real>& maxs, const DistMultiVec<Real>& mins,
+  Real& maxAbs, Real& minAbs )
+{
+    EL_DEBUG_CSE
+    LocalGlobalExtrema
+    ( maxs.LockedMatrix(), mins.LockedMatrix(), maxAbs, minAbs );
+    Real buf[2] = { maxAbs, -minAbs };
+    mpi::AllReduce( buf, 2, mpi::MAX, maxs.Grid().Comm() );
+    maxAbs = buf[0];
+    minAbs = ( maxAbs == Real(0) ? Real(0) : -buf[1] );
+}
+
+template<typename Real,Dist U>
+void GlobalExtrema
+( const DistMatrix<Real,U,STAR>& maxs, const DistMatrix<Real,U,STAR>& mins,
+  Real& maxAbs, Real& minAbs )
+{
+    EL_DEBUG_CSE
+    LocalGlobalExtrema
+    ( maxs.LockedMatrix(), mins.LockedMatrix(), maxAbs, minAbs );
+    Real buf[2] = { maxAbs, -minAbs };
+    mpi::AllReduce( buf, 2, mpi::MAX, maxs.ColComm() );
+    maxAbs = buf[0];
+    minAbs = ( maxAbs == Real(0) ? Real(0) : -buf[1] );
+}
+
+} // namespace equil
+} // namespace El
+
+#endif // ifndef EL_EQUILIBRATE_FUSED_HPP
@@ -8,6 +8,7 @@
 */
 #include <El.hpp>
 #include "./Util.hpp"
+#include "./Fused.hpp"
 
 // The following routines are adaptations of the approach uses by
 // Saunders et al. (originally recommended by Joseph Fourer) for iteratively
@@ -23,6 +24,58 @@ namespace El {
 
 // TODO(poulson): Make this consistent with ConeGeomEquil
 
+// Overwrite the maximum magnitudes of each row (or column) with the damped
+// geometric mean of its extreme nonzero magnitudes (or one, if it is zero)
+template<typename Real>
+void DampedGeometricScaling
+( Matrix<Real>& scales, const Matrix<Real>& minAbsVals, const Real& sqrtDamp )
+{
+    EL_DEBUG_CSE
+    const Int height = scales.Height();
+    for( Int i=0; i<height; ++i )
+    {
+        const Real maxAbs = scales(i);
+        if( maxAbs > Real(0) )
+        {
+            const Real minAbs = minAbsVals(i);
+            const Real propScale = Sqrt(minAbs*maxAbs);
+            scales(i) = Max(propScale,sqrtDamp*maxAbs);
+        }
+        else
+            scales(i) = Real(1);
+    }
+}
+
+// Replace the zero scalings of empty rows (or columns) with one
+template<typename Real>
+void ReplaceZeroScalings( Matrix<Real>& scales )
+{
+    const Int height = scales.Height();
+    for( Int i=0; i<height; ++i )
+        if( scales(i) == Real(0) )
+            scales(i) = Real(1);
+}
+
+template<typename Real,Dist U>
+void DampedGeometricScaling
+( DistMatrix<Real,U,STAR>& scales,
+  const DistMatrix<Real,U,STAR>& minAbsVals,
+  const Real& sqrtDamp )
+{ DampedGeometricScaling
+  ( scales.Matrix(), minAbsVals.LockedMatrix(), sqrtDamp ); }
+
+template<typename Real>
+void DampedGeometricScaling
+( DistMultiVec<Real>& scales,
+  const DistMultiVec<Real>& minAbsVals,
+  const Real& sqrtDamp )
+{ DampedGeometricScaling
+  ( scales.Matrix(), minAbsVals.LockedMatrix(), sqrtDamp ); }
+
+template<typename Real,Dist U>
+void ReplaceZeroScalings( DistMatrix<Real,U,STAR>& scales )
+{ ReplaceZeroScalings( scales.Matrix() ); }
+
 template<typename Field>
 void GeomEquil
 ( Matrix<Field>& A,
@@ -43,12 +96,19 @@ void GeomEquil
     const Real damp = Real(1)/Real(1000);
     const Real relTol = Real(9)/Real(10);
 
+    // Each row (column) scaling is applied during the traversal which
+    // computes the extrema of the columns (rows), and the extrema of the
+    // columns also yield the ratio of the largest to smallest nonzero
+    Matrix<Real> rowScale, colScale, noScale,
+                 maxAbsValsRow, minAbsValsRow, maxAbsValsCol, minAbsValsCol;
+
     // Compute the original ratio of the maximum to minimum nonzero
-    auto maxAbs = MaxAbsLoc( A );
-    const Real maxAbsVal = maxAbs.value;
+    equil::ColumnExtrema
+    ( A, noScale, noScale, maxAbsValsCol, minAbsValsCol, true );
+    Real maxAbsVal, minAbsVal;
+    equil::GlobalExtrema( maxAbsValsCol, minAbsValsCol, maxAbsVal, minAbsVal );
     if( maxAbsVal == Real(0) )
         return;
-    const Real minAbsVal = MinAbsNonzero( A, maxAbsVal );
     Real ratio = maxAbsVal / minAbsVal;
     if( progress )
         Output("Original ratio is ",maxAbsVal,"/",minAbsVal,"=",ratio);
@@ -57,41 +117,27 @@ void GeomEquil
     const Int indent = PushIndent();
     for( Int iter=0; iter<maxIter; ++iter )
     {
-        // Geometrically equilibrate the columns
-        for( Int j=0; j<n; ++j )
-        {
-            auto aCol = A( ALL, IR(j) );
-            auto maxColAbs = VectorMaxAbsLoc( aCol );
-            const Real maxColAbsVal = maxColAbs.value;
-            if( maxColAbsVal > Real(0) )
-            {
-                const Real minColAbsVal = MinAbsNonzero( aCol, maxColAbsVal );
-                const Real propScale = Sqrt(minColAbsVal*maxColAbsVal);
-                const Real scale = Max(propScale,sqrtDamp*maxColAbsVal);
-                aCol *= 1/scale;
-                dCol(j) *= scale;
-            }
-        }
+        // Geometrically rescale the columns
+        // ---------------------------------
+        colScale = maxAbsValsCol;
+        DampedGeometricScaling( colScale, minAbsValsCol, sqrtDamp );
+        DiagonalScale( LEFT, NORMAL, colScale, dCol );
 
-        // Geometrically equilibrate the rows
-        for( Int i=0; i<m; ++i )
-        {
-            auto aRow = A( IR(i), ALL );
-            auto maxRowAbs = VectorMaxAbsLoc( aRow );
-            const Real maxRowAbsVal = maxRowAbs.value;
-            if( maxRowAbsVal > Real(0) )
-            {
-                const Real minRowAbsVal = MinAbsNonzero( aRow, maxRowAbsVal );
-                const Real propScale = Sqrt(minRowAbsVal*maxRowAbsVal);
-                const Real scale = Max(propScale,sqrtDamp*maxRowAbsVal);
-                aRow *= 1/scale;
-                dRow(i) *= scale;
-            }
-        }
+        // Geometrically rescale the rows
+        // ------------------------------
+        equil::RowExtrema
+        ( A, noScale, colScale, maxAbsValsRow, minAbsValsRow, true );
+        rowScale = maxAbsValsRow;
+        DampedGeometricScaling( rowScale, minAbsValsRow, sqrtDamp );
+        DiagonalScale( LEFT, NORMAL, rowScale, dRow );
 
-        auto newMaxAbs = MaxAbsLoc( A );
-        const Real newMaxAbsVal = newMaxAbs.value;
-        const Real newMinAbsVal = MinAbsNonzero( A, newMaxAbsVal );
+        // Determine whether we are done or not
+        // ------------------------------------
+        equil::ColumnExtrema
+        ( A, rowScale, noScale, maxAbsValsCol, minAbsValsCol, true );
+        Real newMaxAbsVal, newMinAbsVal;
+        equil::GlobalExtrema
+        ( maxAbsValsCol, minAbsValsCol, newMaxAbsVal, newMinAbsVal );
         const Real newRatio = newMaxAbsVal / newMinAbsVal;
         if( progress )
             Output("New ratio is ",newMaxAbsVal,"/",newMinAbsVal,"=",newRatio);
@@ -101,18 +147,11 @@ void GeomEquil
     }
     SetIndent( indent );
 
-    // Scale each column so that its maximum entry is 1 or 0
-    for( Int j=0; j<n; ++j )
-    {
-        auto aCol = A( ALL, IR(j) );
-        auto maxColAbs = VectorMaxAbsLoc( aCol );
-        const Real maxColAbsVal = maxColAbs.value;
-        if( maxColAbsVal > Real(0) )
-        {
-            aCol *= 1/maxColAbsVal;
-            dCol(j) *= maxColAbsVal;
-        }
-    }
+    // Scale each column so that its maximum entry is 1 or 0, reusing the
+    // column maxima from the last sweep
+    ReplaceZeroScalings( maxAbsValsCol );
+    DiagonalScale( LEFT, NORMAL, maxAbsValsCol, dCol );
+    DiagonalSolve( RIGHT, NORMAL, maxAbsValsCol, A );
 }
 
 template<typename Field>
@@ -264,62 +303,62 @@ void GeomEquil
 
     const Int m = A.Height();
     const Int n = A.Width();
-    const Int mLocal = A.LocalHeight();
-    const Int nLocal = A.LocalWidth();
     Ones( dRow, m, 1 );
     Ones( dCol, n, 1 );
 
     // TODO(poulson): Expose these as control parameters
     const Int minIter = 3;
     const Int maxIter = 6;
+    const Real damp = Real(1)/Real(1000);
     const Real relTol = Real(9)/Real(10);
 
-    // TODO(poulson): Incorporate damping
-    //const Real damp = Real(1)/Real(1000);
-    //const Real sqrtDamp = Sqrt(damp);
+    // Each row (column) scaling is applied during the traversal which
+    // computes the extrema of the columns (rows), and the extrema of the
+    // columns also yield the ratio of the largest to smallest nonzero
+    const Grid& g = A.Grid();
+    DistMatrix<Real,MC,STAR> rowScale(g), noScaleRow(g),
+                             maxAbsValsRow(g), minAbsValsRow(g);
+    DistMatrix<Real,MR,STAR> colScale(g), noScaleCol(g),
+                             maxAbsValsCol(g), minAbsValsCol(g);
 
     // Compute the original ratio of the maximum to minimum nonzero
-    auto maxAbs = MaxAbsLoc( A );
-    const Real maxAbsVal = maxAbs.value;
+    equil::ColumnExtrema
+    ( A, noScaleRow, noScaleCol, maxAbsValsCol, minAbsValsCol, true );
+    Real maxAbsVal, minAbsVal;
+    equil::GlobalExtrema( maxAbsValsCol, minAbsValsCol, maxAbsVal, minAbsVal );
     if( maxAbsVal == Real(0) )
         return;
-    const Real minAbsVal = MinAbsNonzero( A, maxAbsVal );
     Real ratio = maxAbsVal / minAbsVal;
-    if( progress && A.Grid().Rank() == 0 )
+    if( progress && g.Rank() == 0 )
         Output("Original ratio is ",maxAbsVal,"/",minAbsVal,"=",ratio);
 
-    DistMatrix<Real,MC,STAR> rowScale(A.Grid());
-    DistMatrix<Real,MR,STAR> colScale(A.Grid());
-    auto& colScaleLoc = colScale.Matrix();
-    auto& rowScaleLoc = rowScale.Matrix();
+    const Real sqrtDamp = Sqrt(damp);
     const Int indent = PushIndent();
     for( Int iter=0; iter<maxIter; ++iter )
     {
-        // Geometrically equilibrate the columns
-        // -------------------------------------
-        // TODO(poulson): Remove GeometricColumnScaling
-        GeometricColumnScaling( A, colScale );
-        for( Int jLoc=0; jLoc<nLocal; ++jLoc )
-            if( colScaleLoc(jLoc) == Real(0) )
-                colScaleLoc(jLoc) = Real(1);
+        // Geometrically rescale the columns
+        // ---------------------------------
+        colScale = maxAbsValsCol;
+        DampedGeometricScaling( colScale, minAbsValsCol, sqrtDamp );
         DiagonalScale( LEFT, NORMAL, colScale, dCol );
-        DiagonalSolve( RIGHT, NORMAL, colScale, A );
 
-        // Geometrically equilibrate the rows
-        // ----------------------------------
-        // TODO(poulson): Remove GeometricRowScaling
-        GeometricRowScaling( A, rowScale );
-        for( Int iLoc=0; iLoc<mLocal; ++iLoc )
-            if( rowScaleLoc(iLoc) == Real(0) )
-                rowScaleLoc(iLoc) = Real(1);
+        // Geometrically rescale the rows
+        // ------------------------------
+        equil::RowExtrema
+        ( A, noScaleRow, colScale, maxAbsValsRow, minAbsValsRow, true );
+        rowScale = maxAbsValsRow;
+        DampedGeometricScaling( rowScale, minAbsValsRow, sqrtDamp );
         DiagonalScale( LEFT, NORMAL, rowScale, dRow );
-        DiagonalSolve( LEFT, NORMAL, rowScale, A );
 
-        auto newMaxAbs = MaxAbsLoc( A );
-        const Real newMaxAbsVal = newMaxAbs.value;
-        const Real newMinAbsVal = MinAbsNonzero( A, newMaxAbsVal );
+        // Determine whether we are done or not
+        // ------------------------------------
+        equil::ColumnExtrema
+        ( A, rowScale, noScaleCol, maxAbsValsCol, minAbsValsCol, true );
+        Real newMaxAbsVal, newMinAbsVal;
+        equil::GlobalExtrema
+        ( maxAbsValsCol, minAbsValsCol, newMaxAbsVal, newMinAbsVal );
         const Real newRatio = newMaxAbsVal / newMinAbsVal;
-        if( progress && A.Grid().Rank() == 0 )
+        if( progress && g.Rank() == 0 )
             Output("New ratio is ",newMaxAbsVal,"/",newMinAbsVal,"=",newRatio);
         if( iter >= minIter && newRatio >= ratio*relTol )
             break;
@@ -327,13 +366,11 @@ void GeomEquil
     }
     SetIndent( indent );
 
-    // Scale each column so that its maximum entry is 1 or 0
-    ColumnMaxNorms( A, colScale );
-    for( Int jLoc=0; jLoc<nLocal; ++jLoc )
-        if( colScaleLoc(jLoc) == Real(0) )
-            colScaleLoc(jLoc) = Real(1);
-    DiagonalScale( LEFT, NORMAL, colScale, dCol );
-    DiagonalSolve( RIGHT, NORMAL, colScale, A );
+    // Scale each column so that its maximum entry is 1 or 0, reusing the
+    // column maxima from the last sweep
+    ReplaceZeroScalings( maxAbsValsCol );
+    DiagonalScale( LEFT, NORMAL, maxAbsValsCol, dCol );
+    DiagonalSolve( RIGHT, NORMAL, maxAbsValsCol, A );
 }
 
 template<typename Field>
@@ -488,68 +525,48 @@ void GeomEquil
     const Real damp = Real(1)/Real(1000);
     const Real relTol = Real(9)/Real(10);
 
+    // Each row (column) scaling is applied during the traversal which
+    // computes the extrema of the columns (rows), and the extrema of the
+    // columns also yield the ratio of the largest to smallest nonzero
+    Matrix<Real> rowScale, colScale, noScale,
+                 maxAbsValsRow, minAbsValsRow, maxAbsValsCol, minAbsValsCol;
+
     // Compute the original ratio of the maximum to minimum nonzero
-    auto maxAbs = MaxAbsLoc( A );
-    const Real maxAbsVal = maxAbs.value;
+    equil::ColumnExtrema
+    ( A, noScale, noScale, maxAbsValsCol, minAbsValsCol, true );
+    Real maxAbsVal, minAbsVal;
+    equil::GlobalExtrema( maxAbsValsCol, minAbsValsCol, maxAbsVal, minAbsVal );
     if( maxAbsVal == Real(0) )
         return;
-    const Real minAbsVal = MinAbsNonzero( A, maxAbsVal );
     Real ratio = maxAbsVal / minAbsVal;
     if( progress )
         Output("Original ratio is ",maxAbsVal,"/",minAbsVal,"=",ratio);
 
     const Real sqrtDamp = Sqrt(damp);
-    Matrix<Real> rowScale(m,1), colScale(n,1), maxAbsVals, minAbsVals;
     const Int indent = PushIndent();
     for( Int iter=0; iter<maxIter; ++iter )
     {
         // Geometrically rescale the columns
         // ---------------------------------
-        ColumnMaxNorms( A, maxAbsVals );
-        ColumnMinAbsNonzero( A, maxAbsVals, minAbsVals );
-        for( Int j=0; j<n; ++j )
-        {
-            const Real maxAbs = maxAbsVals(j);
-            if( maxAbs > Real(0) )
-            {
-                const Real minAbs = minAbsVals(j);
-                const Real propScale = Sqrt(minAbs*maxAbs);
-                const Real scale = Max(propScale,sqrtDamp*maxAbs);
-                colScale(j) = scale;
-            }
-            else
-            {
-                colScale(j) = 1;
-            }
-        }
+        colScale = maxAbsValsCol;
+        DampedGeometricScaling( colScale, minAbsValsCol, sqrtDamp );
         DiagonalScale( LEFT, NORMAL, colScale, dCol );
-        DiagonalSolve( RIGHT, NORMAL, colScale, A );
 
         // Geometrically rescale the rows
         // ------------------------------
-        RowMaxNorms( A, maxAbsVals );
-        RowMinAbsNonzero( A, maxAbsVals, minAbsVals );
-        for( Int i=0; i<m; ++i )
-        {
-            const Real maxAbs = maxAbsVals(i);
-            if( maxAbs > Real(0) )
-            {
-                const Real minAbs = minAbsVals(i);
-                const Real propScale = Sqrt(minAbs*maxAbs);
-                const Real scale = Max(propScale,sqrtDamp*maxAbs);
-                rowScale(i) = scale;
-            }
-            else
-                rowScale(i) = Real(1);
-        }
+        equil::RowExtrema
+        ( A, noScale, colScale, maxAbsValsRow, minAbsValsRow, true );
+        rowScale = maxAbsValsRow;
+        DampedGeometricScaling( rowScale, minAbsValsRow, sqrtDamp );
         DiagonalScale( LEFT, NORMAL, rowScale, dRow );
-        DiagonalSolve( LEFT, NORMAL, rowScale, A );
 
         // Determine whether we are done or not
         // ------------------------------------
-        auto newMaxAbs = MaxAbsLoc( A );
-        const Real newMaxAbsVal = newMaxAbs.value;
-        const Real newMinAbsVal = MinAbsNonzero( A, newMaxAbsVal );
+        equil::ColumnExtrema
+        ( A, rowScale, noScale, maxAbsValsCol, minAbsValsCol, true );
+        Real newMaxAbsVal, newMinAbsVal;
+        equil::GlobalExtrema
+        ( maxAbsValsCol, minAbsValsCol, newMaxAbsVal, newMinAbsVal );
         const Real newRatio = newMaxAbsVal / newMinAbsVal;
         if( progress )
             Output("New ratio is ",newMaxAbsVal,"/",newMinAbsVal,"=",newRatio);
@@ -561,20 +578,24 @@ void GeomEquil
 
     // Scale each row so that its maximum entry is 1 or 0
     Field* valBuf = A.ValueBuffer();
-    for( Int i=0; i<m; ++i )
+    const Int* offsetBuf = A.LockedOffsetBuffer();
+    const Int localHeight = A.Height();
+    auto& dRowLoc = dRow;
+    EL_PARALLEL_FOR
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
     {
-        const Int offset = A.RowOffset(i);
-        const Int numConnect = A.NumConnections(i);
+        const Int offset = offsetBuf[iLoc];
+        const Int nextOffset = offsetBuf[iLoc+1];
 
         // Compute the maximum value in this row
         Real maxRowAbs = 0;
-        for( Int e=offset; e<offset+numConnect; ++e )
-            maxRowAbs = Max(maxRowAbs,Abs(A.Value(e)));
+        for( Int e=offset; e<nextOffset; ++e )
+            maxRowAbs = Max(maxRowAbs,Abs(valBuf[e]));
 
         if( maxRowAbs > Real(0) )
         {
-            dRow(i) *= maxRowAbs;
-            for( Int e=offset; e<offset+numConnect; ++e )
+            dRowLoc(iLoc) *= maxRowAbs;
+            for( Int e=offset; e<nextOffset; ++e )
                 valBuf[e] /= maxRowAbs;
         }
     }
@@ -756,7 +777,6 @@ void GeomEquil
     const Int m = A.Height();
     const Int n = A.Width();
     const Grid& grid = A.Grid();
-    const int commRank = grid.Rank();
     dRow.SetGrid(grid);
     dCol.SetGrid(grid);
     Ones( dRow, m, 1 );
@@ -768,75 +788,51 @@ void GeomEquil
     const Real damp = Real(1)/Real(1000);
     const Real relTol = Real(9)/Real(10);
 
+    // Each row (column) scaling is applied during the traversal which
+    // computes the extrema of the columns (rows), and the extrema of the
+    // columns also yield the ratio of the largest to smallest nonzero
+    DistMultiVec<Real> rowScale(grid), colScale(grid), noScale(grid),
+                       maxAbsValsRow(grid), minAbsValsRow(grid),
+                       maxAbsValsCol(grid), minAbsValsCol(grid);
+
     // Compute the original ratio of the maximum to minimum nonzero
-    auto maxAbs = MaxAbsLoc( A );
-    const Real maxAbsVal = maxAbs.value;
+    equil::ColumnExtrema
+    ( A, noScale, noScale, maxAbsValsCol, minAbsValsCol, true );
+    Real maxAbsVal, minAbsVal;
+    equil::GlobalExtrema( maxAbsValsCol, minAbsValsCol, maxAbsVal, minAbsVal );
     if( maxAbsVal == Real(0) )
         return;
-    const Real minAbsVal = MinAbsNonzero( A, maxAbsVal );
     Real ratio = maxAbsVal / minAbsVal;
-    if( progress && commRank == 0 )
+    if( progress && grid.Rank() == 0 )
         Output("Original ratio is ",maxAbsVal,"/",minAbsVal,"=",ratio);
 
     const Real sqrtDamp = Sqrt(damp);
-    DistMultiVec<Real> maxAbsVals(grid), minAbsVals(grid), scales(grid);
-    auto& scalesLoc = scales.Matrix();
     const Int indent = PushIndent();
     for( Int iter=0; iter<maxIter; ++iter )
     {
         // Geometrically rescale the columns
         // ---------------------------------
-        ColumnMaxNorms( A, maxAbsVals );
-        ColumnMinAbsNonzero( A, maxAbsVals, minAbsVals );
-        auto& maxAbsValsLoc = maxAbsVals.Matrix();
-        auto& minAbsValsLoc = minAbsVals.Matrix();
-        scales.Resize( n, 1 );
-        const Int localWidth = maxAbsVals.LocalHeight();
-        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
-        {
-            const Real maxAbs = maxAbsValsLoc(jLoc);
-            if( maxAbs > Real(0) )
-            {
-                const Real minAbs = minAbsValsLoc(jLoc);
-                const Real propScale = Sqrt(minAbs*maxAbs);
-                const Real scale = Max(propScale,sqrtDamp*maxAbs);
-                scalesLoc(jLoc) = scale;
-            }
-            else
-                scalesLoc(jLoc) = 1;
-        }
-        DiagonalScale( LEFT, NORMAL, scales, dCol );
-        DiagonalSolve( RIGHT, NORMAL, scales, A );
+        colScale = maxAbsValsCol;
+        DampedGeometricScaling( colScale, minAbsValsCol, sqrtDamp );
+        DiagonalScale( LEFT, NORMAL, colScale, dCol );
 
         // Geometrically rescale the rows
         // ------------------------------
-        RowMaxNorms( A, maxAbsVals );
-        RowMinAbsNonzero( A, maxAbsVals, minAbsVals );
-        scales.Resize( m, 1 );
-        const Int localHeight = maxAbsVals.LocalHeight();
-        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
-        {
-            const Real maxAbs = maxAbsValsLoc(iLoc);
-            if( maxAbs > Real(0) )
-            {
-                const Real minAbs = minAbsValsLoc(iLoc);
-                const Real propScale = Sqrt(minAbs*maxAbs);
-                const Real scale = Max(propScale,sqrtDamp*maxAbs);
-                scalesLoc(iLoc) = scale;
-            }
-            else
-                scalesLoc(iLoc) = 1;
-        }
-        DiagonalScale( LEFT, NORMAL, scales, dRow );
-        DiagonalSolve( LEFT, NORMAL, scales, A );
+        equil::RowExtrema
+        ( A, noScale, colScale, maxAbsValsRow, minAbsValsRow, true );
+        rowScale = maxAbsValsRow;
+        DampedGeometricScaling( rowScale, minAbsValsRow, sqrtDamp );
+        DiagonalScale( LEFT, NORMAL, rowScale, dRow );
 
         // Determine whether we are done or not
         // ------------------------------------
-        auto newMaxAbs = MaxAbsLoc( A );
-        const Real newMaxAbsVal = newMaxAbs.value;
-        const Real newMinAbsVal = MinAbsNonzero( A, newMaxAbsVal );
+        equil::ColumnExtrema
+        ( A, rowScale, noScale, maxAbsValsCol, minAbsValsCol, true );
+        Real newMaxAbsVal, newMinAbsVal;
+        equil::GlobalExtrema
+        ( maxAbsValsCol, minAbsValsCol, newMaxAbsVal, newMinAbsVal );
         const Real newRatio = newMaxAbsVal / newMinAbsVal;
-        if( progress && commRank == 0 )
+        if( progress && grid.Rank() == 0 )
             Output("New ratio is ",newMaxAbsVal,"/",newMinAbsVal,"=",newRatio);
         if( iter >= minIter && newRatio >= ratio*relTol )
             break;
@@ -846,22 +842,24 @@ void GeomEquil
 
     // Scale each row so that its maximum entry is 1 or 0
     Field* valBuf = A.ValueBuffer();
+    const Int* offsetBuf = A.LockedOffsetBuffer();
     const Int localHeight = A.LocalHeight();
     auto& dRowLoc = dRow.Matrix();
+    EL_PARALLEL_FOR
     for( Int iLoc=0; iLoc<localHeight; ++iLoc )
     {
-        const Int offset = A.RowOffset(iLoc);
-        const Int numConnect = A.NumConnections(iLoc);
+        const Int offset = offsetBuf[iLoc];
+        const Int nextOffset = offsetBuf[iLoc+1];
 
         // Compute the maximum value in this row
         Real maxRowAbs = 0;
-        for( Int e=offset; e<offset+numConnect; ++e )
-            maxRowAbs = Max(maxRowAbs,Abs(A.Value(e)));
+        for( Int e=offset; e<nextOffset; ++e )
+            maxRowAbs = Max(maxRowAbs,Abs(valBuf[e]));
 
         if( maxRowAbs > Real(0) )
         {
             dRowLoc(iLoc) *= maxRowAbs;
-            for( Int e=offset; e<offset+numConnect; ++e )
+            for( Int e=offset; e<nextOffset; ++e )
                 valBuf[e] /= maxRowAbs;
         }
     }
@@ -7,6 +7,7 @@
    http://opensource.org/licenses/BSD-2-Clause
 */
 #include <El.hpp>
+#include "./Fused.hpp"
 
 namespace El {
 
@@ -38,24 +39,27 @@ void RuizEquil
     // For now, simply hard-code the number of iterations
     const Int maxIter = 4;
 
-    Matrix<Real> rowScale, colScale;
+    // Each row (column) scaling is applied during the traversal which
+    // computes the next column (row) scaling
+    Matrix<Real> rowScale, colScale, noScale, noMin;
     const Int indent = PushIndent();
     for( Int iter=0; iter<maxIter; ++iter )
     {
-        // Rescale the columns
-        // -------------------
-        ColumnMaxNorms( A, colScale );
+        // Apply the pending row scaling and rescale the columns
+        // -----------------------------------------------------
+        equil::ColumnExtrema
+        ( A, rowScale, noScale, colScale, noMin, false );
         EntrywiseMap( colScale, MakeFunction(DampScaling<Real>) );
         DiagonalScale( LEFT, NORMAL, colScale, dCol );
-        DiagonalSolve( RIGHT, NORMAL, colScale, A );
 
-        // Rescale the rows
-        // ----------------
-        RowMaxNorms( A, rowScale );
+        // Apply the column scaling and rescale the rows
+        // ---------------------------------------------
+        equil::RowExtrema
+        ( A, noScale, colScale, rowScale, noMin, false );
         EntrywiseMap( rowScale, MakeFunction(DampScaling<Real>) );
         DiagonalScale( LEFT, NORMAL, rowScale, dRow );
-        DiagonalSolve( LEFT, NORMAL, rowScale, A );
     }
+    DiagonalSolve( LEFT, NORMAL, rowScale, A );
     SetIndent( indent );
 }
 
@@ -91,25 +95,29 @@ void RuizEquil
     // For now, simply hard-code the number of iterations
     const Int maxIter = 4;
 
-    DistMatrix<Real,MC,STAR> rowScale(A.Grid());
-    DistMatrix<Real,MR,STAR> colScale(A.Grid());
+    // Each row (column) scaling is applied during the traversal which
+    // computes the next column (row) scaling
+    const Grid& g = A.Grid();
+    DistMatrix<Real,MC,STAR> rowScale(g), noScaleRow(g), noMinRow(g);
+    DistMatrix<Real,MR,STAR> colScale(g), noScaleCol(g), noMinCol(g);
     const Int indent = PushIndent();
     for( Int iter=0; iter<maxIter; ++iter )
     {
-        // Rescale the columns
-        // -------------------
-        ColumnMaxNorms( A, colScale );
+        // Apply the pending row scaling and rescale the columns
+        // -----------------------------------------------------
+        equil::ColumnExtrema
+        ( A, rowScale, noScaleCol, colScale, noMinCol, false );
         EntrywiseMap( colScale, MakeFunction(DampScaling<Real>) );
         DiagonalScale( LEFT, NORMAL, colScale, dCol );
-        DiagonalSolve( RIGHT, NORMAL, colScale, A );
 
-        // Rescale the rows
-        // ----------------
-        RowMaxNorms( A, rowScale );
+        // Apply the column scaling and rescale the rows
+        // ---------------------------------------------
+        equil::RowExtrema
+        ( A, noScaleRow, colScale, rowScale, noMinRow, false );
         EntrywiseMap( rowScale, MakeFunction(DampScaling<Real>) );
         DiagonalScale( LEFT, NORMAL, rowScale, dRow );
-        DiagonalSolve( LEFT, NORMAL, rowScale, A );
     }
+    DiagonalSolve( LEFT, NORMAL, rowScale, A );
     SetIndent( indent );
 }
 
@@ -131,24 +139,27 @@ void RuizEquil
     // For now, simply hard-code the number of iterations
     const Int maxIter = 4;
 
-    Matrix<Real> scales;
+    // Each row (column) scaling is applied during the traversal which
+    // computes the next column (row) scaling
+    Matrix<Real> rowScale, colScale, noScale, noMin;
     const Int indent = PushIndent();
     for( Int iter=0; iter<maxIter; ++iter )
     {
-        // Rescale the columns
-        // -------------------
-        ColumnMaxNorms( A, scales );
-        EntrywiseMap( scales, MakeFunction(DampScaling<Real>) );
-        DiagonalScale( LEFT, NORMAL, scales, dCol );
-        DiagonalSolve( RIGHT, NORMAL, scales, A );
+        // Apply the pending row scaling and rescale the columns
+        // -----------------------------------------------------
+        equil::ColumnExtrema
+        ( A, rowScale, noScale, colScale, noMin, false );
+        EntrywiseMap( colScale, MakeFunction(DampScaling<Real>) );
+        DiagonalScale( LEFT, NORMAL, colScale, dCol );
 
-        // Rescale the rows
-        // ----------------
-        RowMaxNorms( A, scales );
-        EntrywiseMap( scales, MakeFunction(DampScaling<Real>) );
-        DiagonalScale( LEFT, NORMAL, scales, dRow );
-        DiagonalSolve( LEFT, NORMAL, scales, A );
+        // Apply the column scaling and rescale the rows
+        // ---------------------------------------------
+        equil::RowExtrema
+        ( A, noScale, colScale, rowScale, noMin, false );
+        EntrywiseMap( rowScale, MakeFunction(DampScaling<Real>) );
+        DiagonalScale( LEFT, NORMAL, rowScale, dRow );
     }
+    DiagonalSolve( LEFT, NORMAL, rowScale, A );
     SetIndent( indent );
 }
 
@@ -173,24 +184,29 @@ void RuizEquil
     // For, simply hard-code a small number of iterations
     const Int maxIter = 4;
 
-    DistMultiVec<Real> scales(grid);
+    // Each row (column) scaling is applied during the traversal which
+    // computes the next column (row) scaling; in particular, each half-sweep
+    // only requires a single AllToAll
+    DistMultiVec<Real> rowScale(grid), colScale(grid), noScale(grid),
+                       noMin(grid);
     const Int indent = PushIndent();
     for( Int iter=0; iter<maxIter; ++iter )
     {
-        // Rescale the columns
-        // -------------------
-        ColumnMaxNorms( A, scales );
-        EntrywiseMap( scales, MakeFunction(DampScaling<Real>) );
-        DiagonalScale( LEFT, NORMAL, scales, dCol );
-        DiagonalSolve( RIGHT, NORMAL, scales, A );
+        // Apply the pending row scaling and rescale the columns
+        // -----------------------------------------------------
+        equil::ColumnExtrema
+        ( A, rowScale, noScale, colScale, noMin, false );
+        EntrywiseMap( colScale, MakeFunction(DampScaling<Real>) );
+        DiagonalScale( LEFT, NORMAL, colScale, dCol );
 
-        // Rescale the rows
-        // ----------------
-        RowMaxNorms( A, scales );
-        EntrywiseMap( scales, MakeFunction(DampScaling<Real>) );
-        DiagonalScale( LEFT, NORMAL, scales, dRow );
-        DiagonalSolve( LEFT, NORMAL, scales, A );
+        // Apply the column scaling and rescale the rows
+        // ---------------------------------------------
+        equil::RowExtrema
+        ( A, noScale, colScale, rowScale, noMin, false );
+        EntrywiseMap( rowScale, MakeFunction(DampScaling<Real>) );
+        DiagonalScale( LEFT, NORMAL, rowScale, dRow );
     }
+    DiagonalSolve( LEFT, NORMAL, rowScale, A );
     SetIndent( indent );
 }
 
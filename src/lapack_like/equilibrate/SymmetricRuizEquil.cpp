@@ -7,6 +7,7 @@
    http://opensource.org/licenses/BSD-2-Clause
 */
 #include <El.hpp>
+#include "./Fused.hpp"
 
 namespace El {
 
@@ -37,19 +38,24 @@ void SymmetricRuizEquil
     const Int n = A.Height();
     Ones( d, n, 1 );
 
-    Matrix<Real> scales;
+    // Each symmetric scaling is applied during the traversal which computes
+    // the column maxima that determine the next one
+    Matrix<Real> scales, colMax, noMin;
     const Int indent = PushIndent();
     for( Int iter=0; iter<maxIter; ++iter )
     {
         // Rescale the columns (and rows)
         // ------------------------------
-        ColumnMaxNorms( A, scales );
+        equil::ColumnExtrema( A, scales, scales, colMax, noMin, false );
+        scales = colMax;
         EntrywiseMap( scales, MakeFunction(DampScaling<Real>) );
         EntrywiseMap( scales, MakeFunction(SquareRootScaling<Real>) );
         DiagonalScale( LEFT, NORMAL, scales, d );
-        // TODO(poulson): Replace with SymmetricDiagonalSolve
-        DiagonalSolve( RIGHT, NORMAL, scales, A );
+    }
+    if( maxIter > 0 )
+    {
         DiagonalSolve( LEFT, NORMAL, scales, A );
+        DiagonalSolve( RIGHT, NORMAL, scales, A );
     }
     SetIndent( indent );
 }
@@ -77,19 +83,28 @@ void SymmetricRuizEquil
     const Int n = A.Height();
     Ones( d, n, 1 );
 
-    DistMatrix<Real,MR,STAR> scales(A.Grid());
+    // Each symmetric scaling is applied during the traversal which computes
+    // the column maxima that determine the next one
+    const Grid& g = A.Grid();
+    DistMatrix<Real,MC,STAR> rowScales(g);
+    DistMatrix<Real,MR,STAR> scales(g), colMax(g), noMin(g);
     const Int indent = PushIndent();
     for( Int iter=0; iter<maxIter; ++iter )
     {
         // Rescale the columns (and rows)
         // ------------------------------
-        ColumnMaxNorms( A, scales );
+        equil::ColumnExtrema( A, rowScales, scales, colMax, noMin, false );
+        scales = colMax;
         EntrywiseMap( scales, MakeFunction(DampScaling<Real>) );
         EntrywiseMap( scales, MakeFunction(SquareRootScaling<Real>) );
         DiagonalScale( LEFT, NORMAL, scales, d );
-        // TODO(poulson): Replace with SymmetricDiagonalSolve
+        rowScales.AlignWith( A );
+        rowScales = scales;
+    }
+    if( maxIter > 0 )
+    {
+        DiagonalSolve( LEFT, NORMAL, rowScales, A );
         DiagonalSolve( RIGHT, NORMAL, scales, A );
-        DiagonalSolve( LEFT, NORMAL, scales, A );
     }
     SetIndent( indent );
 }
@@ -105,18 +120,22 @@ void SymmetricRuizEquil
     const Int n = A.Height();
     Ones( d, n, 1 );
 
-    Matrix<Real> scales;
+    // Each symmetric scaling is applied during the traversal which computes
+    // the column maxima that determine the next one
+    Matrix<Real> scales, colMax, noMin;
     const Int indent = PushIndent();
     for( Int iter=0; iter<maxIter; ++iter )
     {
         // Rescale the columns (and rows)
         // ------------------------------
-        ColumnMaxNorms( A, scales );
+        equil::ColumnExtrema( A, scales, scales, colMax, noMin, false );
+        scales = colMax;
         EntrywiseMap( scales, MakeFunction(DampScaling<Real>) );
         EntrywiseMap( scales, MakeFunction(SquareRootScaling<Real>) );
         DiagonalScale( LEFT, NORMAL, scales, d );
-        SymmetricDiagonalSolve( scales, A );
     }
+    if( maxIter > 0 )
+        SymmetricDiagonalSolve( scales, A );
     SetIndent( indent );
 }
 
@@ -133,18 +152,22 @@ void SymmetricRuizEquil
     d.SetGrid( grid );
     Ones( d, n, 1 );
 
-    DistMultiVec<Real> scales(grid);
+    // Each symmetric scaling is applied during the traversal which computes
+    // the column maxima that determine the next one
+    DistMultiVec<Real> scales(grid), colMax(grid), noMin(grid);
     const Int indent = PushIndent();
     for( Int iter=0; iter<maxIter; ++iter )
     {
         // Rescale the columns (and rows)
         // ------------------------------
-        ColumnMaxNorms( A, scales );
+        equil::ColumnExtrema( A, scales, scales, colMax, noMin, false );
+        scales = colMax;
         EntrywiseMap( scales, MakeFunction(DampScaling<Real>) );
         EntrywiseMap( scales, MakeFunction(SquareRootScaling<Real>) );
         DiagonalScale( LEFT, NORMAL, scales, d );
-        SymmetricDiagonalSolve( scales, A );
     }
+    if( maxIter > 0 )
+        SymmetricDiagonalSolve( scales, A );
     SetIndent( indent );
 }
 
@@ -48,6 +48,8 @@ ElError ElSQSDCtrlDefault_d( ElSQSDCtrl_d* ctrl )
 ElError ElLeastSquaresCtrlDefault_s( ElLeastSquaresCtrl_s* ctrl )
 {
     const float eps = limits::Epsilon<float>();
+    ctrl->alg = EL_LS_AUGMENTED;
+    ElBisectCtrlDefault( &ctrl->qrCtrl );
     ctrl->scaleTwoNorm = true;
     ctrl->basisSize = 15;
     ctrl->alpha = Pow(eps,float(0.25));
@@ -61,6 +63,8 @@ ElError ElLeastSquaresCtrlDefault_s( ElLeastSquaresCtrl_s* ctrl )
 ElError ElLeastSquaresCtrlDefault_d( ElLeastSquaresCtrl_d* ctrl )
 {
     const double eps = limits::Epsilon<double>();
+    ctrl->alg = EL_LS_AUGMENTED;
+    ElBisectCtrlDefault( &ctrl->qrCtrl );
     ctrl->scaleTwoNorm = true;
     ctrl->basisSize = 15;
     ctrl->alpha = Pow(eps,double(0.25));
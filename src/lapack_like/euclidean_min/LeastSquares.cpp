@@ -236,6 +236,29 @@ void Equilibrated
     }
 }
 
+template<typename F>
+void EquilibratedQR
+( const SparseMatrix<F>& A,
+  const Matrix<F>& B,
+        Matrix<F>& X,
+  const LeastSquaresCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    SparseQRFactorization<F> qrFact;
+    if( A.Height() >= A.Width() )
+    {
+        qrFact.Factor( A, ctrl.qrCtrl );
+        qrFact.LeastSquares( B, X );
+    }
+    else
+    {
+        SparseMatrix<F> AAdj;
+        Adjoint( A, AAdj );
+        qrFact.Factor( AAdj, ctrl.qrCtrl );
+        qrFact.MinimumNorm( B, X );
+    }
+}
+
 } // namespace ls
 
 template<typename F>
@@ -303,7 +326,10 @@ void LeastSquares
 
     // Solve the equilibrated least squares problem
     // ============================================
-    ls::Equilibrated( ABar, BBar, X, ctrl );
+    if( ctrl.alg == LS_SPARSE_QR )
+        ls::EquilibratedQR( ABar, BBar, X, ctrl );
+    else
+        ls::Equilibrated( ABar, BBar, X, ctrl );
 
     // Unequilibrate the solution
     // ==========================
@@ -412,6 +438,29 @@ void Equilibrated
         X = D( IR(0,n),   ALL );
 }
 
+template<typename F>
+void EquilibratedQR
+( const DistSparseMatrix<F>& A,
+  const DistMultiVec<F>& B,
+        DistMultiVec<F>& X,
+  const LeastSquaresCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    DistSparseQRFactorization<F> qrFact;
+    if( A.Height() >= A.Width() )
+    {
+        qrFact.Factor( A, ctrl.qrCtrl );
+        qrFact.LeastSquares( B, X );
+    }
+    else
+    {
+        DistSparseMatrix<F> AAdj(A.Grid());
+        Adjoint( A, AAdj );
+        qrFact.Factor( AAdj, ctrl.qrCtrl );
+        qrFact.MinimumNorm( B, X );
+    }
+}
+
 } // namespace ls
 
 template<typename F>
@@ -481,7 +530,10 @@ void LeastSquares
 
     // Solve the equilibrated least squares problem
     // ============================================
-    ls::Equilibrated( ABar, BBar, X, ctrl );
+    if( ctrl.alg == LS_SPARSE_QR )
+        ls::EquilibratedQR( ABar, BBar, X, ctrl );
+    else
+        ls::Equilibrated( ABar, BBar, X, ctrl );
 
     // Unequilibrate the solution
     // ==========================
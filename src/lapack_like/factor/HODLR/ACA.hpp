@@ -0,0 +1,212 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_HODLR_ACA_HPP
+#define EL_HODLR_ACA_HPP
+
+#include <set>
+
+namespace El {
+namespace hodlr {
+
+// Extend A with zero columns (geometrically) so that it has at least 'width'
+template<typename Field>
+void EnsureWidth( Matrix<Field>& A, Int width )
+{
+    EL_DEBUG_CSE
+    if( A.Width() >= width )
+        return;
+    Matrix<Field> B;
+    Zeros( B, A.Height(), Max(width,2*A.Width()) );
+    auto BL = B( ALL, IR(0,A.Width()) );
+    BL = A;
+    A = std::move(B);
+}
+
+template<typename Field>
+void Truncate( Matrix<Field>& A, Int width )
+{
+    EL_DEBUG_CSE
+    Matrix<Field> B;
+    B = A( ALL, IR(0,width) );
+    A = std::move(B);
+}
+
+// Compute A(rows,cols) ~= U V^H with the partially-pivoted adaptive cross
+// approximation. Each process stores the rows 'localRows' of U and the rows
+// 'localCols' of V (when a block is shared between two teams of processes,
+// one of these ranges is empty), and the pivot rows and columns are exchanged
+// over 'comm', which is not used if it only contains a single process.
+//
+// A pivot row whose residual vanishes is skipped in favor of the next unused
+// row, but only a few times, so that an exactly low-rank block is not
+// entirely evaluated.
+template<typename Field>
+void ACA
+( const function<Field(Int,Int)>& entry,
+  const Range<Int>& rows,
+  const Range<Int>& cols,
+  const Range<Int>& localRows,
+  const Range<Int>& localCols,
+  Base<Field> relTol,
+  Int maxRank,
+  mpi::Comm comm,
+  Matrix<Field>& U,
+  Matrix<Field>& V )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int m = rows.end - rows.beg;
+    const Int n = cols.end - cols.beg;
+    const Int mLoc = localRows.end - localRows.beg;
+    const Int nLoc = localCols.end - localCols.beg;
+    const bool distributed = ( mpi::Size(comm) > 1 );
+    const Int maxZeroRows = 4;
+    if( maxRank < 0 )
+        maxRank = Min(m,n);
+    else
+        maxRank = Min(maxRank,Min(m,n));
+
+    Zeros( U, mLoc, Min(maxRank,Int(8)) );
+    Zeros( V, nLoc, Min(maxRank,Int(8)) );
+    if( maxRank == 0 )
+        return;
+
+    std::set<Int> pivotRows;
+    Matrix<Field> uPivot, buffer;
+    Real approxNormSquared = 0;
+    Int pivotRow = rows.beg, numZeroRows = 0, rank = 0;
+    while( rank < maxRank )
+    {
+        pivotRows.insert( pivotRow );
+        EnsureWidth( U, rank+1 );
+        EnsureWidth( V, rank+1 );
+
+        // Gather U(pivotRow,:) from its owner
+        Zeros( uPivot, rank, 1 );
+        if( pivotRow >= localRows.beg && pivotRow < localRows.end )
+            for( Int l=0; l<rank; ++l )
+                uPivot(l) = U(pivotRow-localRows.beg,l);
+        if( distributed && rank > 0 )
+            AllReduce( uPivot, comm );
+
+        // Store the conjugate of the residual of the pivot row,
+        // A(pivotRow,cols) - U(pivotRow,:) V^H, as the next column of V and
+        // find its entry of largest magnitude
+        ValueInt<Real> pivot;
+        pivot.value = -1;
+        pivot.index = -1;
+        for( Int jLoc=0; jLoc<nLoc; ++jLoc )
+        {
+            const Int j = localCols.beg + jLoc;
+            Field rho = entry( pivotRow, j );
+            for( Int l=0; l<rank; ++l )
+                rho -= uPivot(l)*Conj(V(jLoc,l));
+            V(jLoc,rank) = Conj(rho);
+            if( Abs(rho) > pivot.value )
+            {
+                pivot.value = Abs(rho);
+                pivot.index = j;
+            }
+        }
+        if( distributed )
+            pivot = mpi::AllReduce( pivot, mpi::MaxLocOp<Real>(), comm );
+
+        if( pivot.value == Real(0) )
+        {
+            // The residual of this row vanishes, so try the next unused one
+            if( ++numZeroRows > maxZeroRows ||
+                Int(pivotRows.size()) == m )
+                break;
+            do
+            {
+                pivotRow = ( pivotRow+1 == rows.end ? rows.beg : pivotRow+1 );
+            } while( pivotRows.count(pivotRow) );
+            continue;
+        }
+        const Int pivotCol = pivot.index;
+
+        // Gather the pivot, r(pivotCol), and V(pivotCol,:) from their owner
+        Zeros( buffer, rank+1, 1 );
+        if( pivotCol >= localCols.beg && pivotCol < localCols.end )
+        {
+            const Int jLoc = pivotCol - localCols.beg;
+            buffer(0) = Conj(V(jLoc,rank));
+            for( Int l=0; l<rank; ++l )
+                buffer(l+1) = V(jLoc,l);
+        }
+        if( distributed )
+            AllReduce( buffer, comm );
+        const Field delta = buffer(0);
+
+        // The next column of U is the residual of the pivot column,
+        // A(rows,pivotCol) - U V(pivotCol,:)^H, divided by the pivot
+        for( Int iLoc=0; iLoc<mLoc; ++iLoc )
+        {
+            Field gamma = entry( localRows.beg+iLoc, pivotCol );
+            for( Int l=0; l<rank; ++l )
+                gamma -= U(iLoc,l)*Conj(buffer(l+1));
+            U(iLoc,rank) = gamma / delta;
+        }
+
+        // Update || U V^H ||_F^2 using || u ||_2, || v ||_2, U^H u, and v^H V
+        Zeros( buffer, 2*rank+2, 1 );
+        for( Int iLoc=0; iLoc<mLoc; ++iLoc )
+        {
+            const Field upsilon = U(iLoc,rank);
+            buffer(0) += Conj(upsilon)*upsilon;
+            for( Int l=0; l<rank; ++l )
+                buffer(l+2) += Conj(U(iLoc,l))*upsilon;
+        }
+        for( Int jLoc=0; jLoc<nLoc; ++jLoc )
+        {
+            const Field nu = V(jLoc,rank);
+            buffer(1) += Conj(nu)*nu;
+            for( Int l=0; l<rank; ++l )
+                buffer(rank+l+2) += Conj(nu)*V(jLoc,l);
+        }
+        if( distributed )
+            AllReduce( buffer, comm );
+        const Real uNormSquared = RealPart(buffer(0));
+        const Real vNormSquared = RealPart(buffer(1));
+        Field cross = 0;
+        for( Int l=0; l<rank; ++l )
+            cross += buffer(l+2)*buffer(rank+l+2);
+        approxNormSquared += 2*RealPart(cross) + uNormSquared*vNormSquared;
+        ++rank;
+        if( uNormSquared*vNormSquared <=
+            relTol*relTol*approxNormSquared )
+            break;
+
+        // The next pivot row is the unused row of largest magnitude in u
+        pivot.value = -1;
+        pivot.index = -1;
+        for( Int iLoc=0; iLoc<mLoc; ++iLoc )
+        {
+            const Int i = localRows.beg + iLoc;
+            const Real upsilonAbs = Abs(U(iLoc,rank-1));
+            if( upsilonAbs > pivot.value && !pivotRows.count(i) )
+            {
+                pivot.value = upsilonAbs;
+                pivot.index = i;
+            }
+        }
+        if( distributed )
+            pivot = mpi::AllReduce( pivot, mpi::MaxLocOp<Real>(), comm );
+        if( pivot.index < 0 )
+            break;
+        pivotRow = pivot.index;
+    }
+    Truncate( U, rank );
+    Truncate( V, rank );
+}
+
+} // namespace hodlr
+} // namespace El
+
+#endif // ifndef EL_HODLR_ACA_HPP
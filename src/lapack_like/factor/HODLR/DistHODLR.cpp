@@ -0,0 +1,265 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+#include "./ACA.hpp"
+
+namespace El {
+
+namespace hodlr {
+
+namespace {
+
+// Sum the products of the local rows of V^H with those of B into the block of
+// T corresponding to the other child, i.e., form
+//
+//   T = | V12^H B2 |
+//       | V21^H B1 |
+//
+// over the team of the node
+template<typename Field>
+void FormCoupling
+( const DistNode<Field>& node, const Matrix<Field>& B, Matrix<Field>& T )
+{
+    EL_DEBUG_CSE
+    const Int rank12 = node.rank12;
+    const Int rank21 = node.rank21;
+    Zeros( T, rank12+rank21, B.Width() );
+    auto TOther =
+      ( node.first ? T( IR(rank12,rank12+rank21), ALL )
+                   : T( IR(0,rank12), ALL ) );
+    Gemm( ADJOINT, NORMAL, Field(1), node.V, B, Field(0), TOther );
+    AllReduce( T, node.comm );
+}
+
+// The block of T corresponding to this process's child
+template<typename Field>
+Matrix<Field> OwnBlock( const DistNode<Field>& node, Matrix<Field>& T )
+{
+    return node.first ? T( IR(0,node.rank12), ALL )
+                      : T( IR(node.rank12,node.rank12+node.rank21), ALL );
+}
+
+} // anonymous namespace
+
+} // namespace hodlr
+
+template<typename Field>
+DistHODLR<Field>::DistHODLR( const El::Grid& grid )
+: grid_(&grid)
+{ }
+
+template<typename Field>
+DistHODLR<Field>::~DistHODLR()
+{
+    if( !mpi::Finalized() )
+        FreeNodes();
+}
+
+template<typename Field>
+void DistHODLR<Field>::FreeNodes()
+{
+    EL_DEBUG_CSE
+    for( auto& node : nodes_ )
+        mpi::Free( node->comm );
+    nodes_.clear();
+}
+
+template<typename Field>
+void DistHODLR<Field>::Compress
+( Int n,
+  const function<Field(Int,Int)>& entry,
+  const HODLRCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    FreeNodes();
+    height_ = n;
+    factored_ = false;
+
+    // Match the row distribution of DistMultiVec
+    const int commSize = grid_->Size();
+    const int commRank = mpi::Rank( grid_->Comm() );
+    Int blocksize = n / commSize;
+    if( blocksize*commSize < n || n == 0 )
+        ++blocksize;
+    auto firstRow = [&]( int q ) { return Min(blocksize*q,n); };
+    const Range<Int> localInd( firstRow(commRank), firstRow(commRank+1) );
+    const Range<Int> empty( localInd.beg, localInd.beg );
+
+    // Bisect the processes (and their rows) until reaching this process
+    maxRank_ = 0;
+    int qBeg=0, qEnd=commSize;
+    mpi::Comm comm;
+    mpi::Dup( grid_->Comm(), comm );
+    while( qEnd-qBeg > 1 )
+    {
+        const int qMid = qBeg + (qEnd-qBeg)/2;
+        const Range<Int> ind1( firstRow(qBeg), firstRow(qMid) );
+        const Range<Int> ind2( firstRow(qMid), firstRow(qEnd) );
+
+        nodes_.emplace_back( new hodlr::DistNode<Field> );
+        auto& node = *nodes_.back();
+        node.comm = comm;
+        node.first = ( commRank < qMid );
+
+        Matrix<Field> U12, V12, U21, V21;
+        hodlr::ACA
+        ( entry, ind1, ind2,
+          node.first ? localInd : empty,
+          node.first ? empty : localInd,
+          ctrl.relTol, ctrl.maxRank, comm, U12, V12 );
+        hodlr::ACA
+        ( entry, ind2, ind1,
+          node.first ? empty : localInd,
+          node.first ? localInd : empty,
+          ctrl.relTol, ctrl.maxRank, comm, U21, V21 );
+        node.rank12 = U12.Width();
+        node.rank21 = U21.Width();
+        maxRank_ = Max( maxRank_, Max(node.rank12,node.rank21) );
+        if( ctrl.progress && commRank == qBeg )
+            Output
+            ("DistHODLR: processes [",qBeg,",",qEnd,") have ranks ",
+             node.rank12," and ",node.rank21);
+        if( node.first )
+        {
+            node.U = std::move(U12);
+            node.V = std::move(V21);
+            qEnd = qMid;
+        }
+        else
+        {
+            node.U = std::move(U21);
+            node.V = std::move(V12);
+            qBeg = qMid;
+        }
+
+        mpi::Comm childComm;
+        mpi::Split( comm, node.first ? 0 : 1, commRank, childComm );
+        comm = childComm;
+    }
+    mpi::Free( comm );
+
+    const Int offset = localInd.beg;
+    local_.Compress
+    ( localInd.end-localInd.beg,
+      [&]( Int i, Int j ) { return entry( i+offset, j+offset ); }, ctrl );
+    maxRank_ = mpi::AllReduce( Max(maxRank_,local_.MaxRank()), mpi::MAX,
+                               grid_->Comm() );
+}
+
+template<typename Field>
+void DistHODLR<Field>::Multiply
+( Field alpha, const DistMultiVec<Field>& X,
+  Field beta,        DistMultiVec<Field>& Y ) const
+{
+    EL_DEBUG_CSE
+    if( X.Height() != height_ || Y.Height() != height_ )
+        LogicError("Heights of X and Y must match that of the HODLR matrix");
+    if( X.Width() != Y.Width() )
+        LogicError("Widths of X and Y must match");
+    if( X.Grid() != *grid_ || Y.Grid() != *grid_ )
+        LogicError("X and Y must be distributed over the HODLR matrix's grid");
+    const auto& XLoc = X.LockedMatrix();
+    auto& YLoc = Y.Matrix();
+
+    local_.Multiply( alpha, XLoc, beta, YLoc );
+    Matrix<Field> T;
+    for( const auto& node : nodes_ )
+    {
+        // The local rows of U12 (V12^H X2) or U21 (V21^H X1)
+        hodlr::FormCoupling( *node, XLoc, T );
+        auto TOwn = hodlr::OwnBlock( *node, T );
+        Gemm( NORMAL, NORMAL, alpha, node->U, TOwn, Field(1), YLoc );
+    }
+}
+
+template<typename Field>
+void DistHODLR<Field>::SolveBelow( Int depth, Matrix<Field>& B ) const
+{
+    EL_DEBUG_CSE
+    local_.Solve( B );
+    Matrix<Field> T;
+    const Int numNodes = nodes_.size();
+    for( Int d=numNodes-1; d>=depth; --d )
+    {
+        const auto& node = *nodes_[d];
+        if( node.rank12+node.rank21 == 0 )
+            continue;
+        hodlr::FormCoupling( node, B, T );
+        lu::SolveAfter( NORMAL, node.K, node.PK, T );
+        auto TOwn = hodlr::OwnBlock( node, T );
+        Gemm( NORMAL, NORMAL, Field(-1), node.Y, TOwn, Field(1), B );
+    }
+}
+
+template<typename Field>
+void DistHODLR<Field>::Factor()
+{
+    EL_DEBUG_CSE
+    local_.Factor();
+    const Int numNodes = nodes_.size();
+    for( Int d=numNodes-1; d>=0; --d )
+    {
+        auto& node = *nodes_[d];
+        node.Y = node.U;
+        SolveBelow( d+1, node.Y );
+
+        // Sum V21^H Y12 and V12^H Y21 into the off-diagonal blocks of K
+        const Int rank12 = node.rank12;
+        const Int rank21 = node.rank21;
+        Zeros( node.K, rank12+rank21, rank12+rank21 );
+        if( rank12+rank21 == 0 )
+            continue;
+        auto KOff =
+          ( node.first ? node.K( IR(rank12,rank12+rank21), IR(0,rank12) )
+                       : node.K( IR(0,rank12), IR(rank12,rank12+rank21) ) );
+        Gemm( ADJOINT, NORMAL, Field(1), node.V, node.Y, Field(0), KOff );
+        AllReduce( node.K, node.comm );
+        ShiftDiagonal( node.K, Field(1) );
+        LU( node.K, node.PK );
+    }
+    factored_ = true;
+}
+
+template<typename Field>
+void DistHODLR<Field>::Solve( DistMultiVec<Field>& B ) const
+{
+    EL_DEBUG_CSE
+    if( !factored_ )
+        LogicError("The HODLR matrix has not been factored");
+    if( B.Height() != height_ )
+        LogicError("Height of B must match that of the HODLR matrix");
+    if( B.Grid() != *grid_ )
+        LogicError("B must be distributed over the HODLR matrix's grid");
+    SolveBelow( 0, B.Matrix() );
+}
+
+template<typename Field>
+Int DistHODLR<Field>::Height() const { return height_; }
+template<typename Field>
+bool DistHODLR<Field>::Factored() const { return factored_; }
+template<typename Field>
+Int DistHODLR<Field>::MaxRank() const { return maxRank_; }
+template<typename Field>
+const El::Grid& DistHODLR<Field>::Grid() const { return *grid_; }
+
+template<typename Field>
+const HODLR<Field>& DistHODLR<Field>::LocalMatrix() const { return local_; }
+
+#define PROTO(Field) \
+  template class DistHODLR<Field>;
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -0,0 +1,277 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+#include "./ACA.hpp"
+
+namespace El {
+
+namespace hodlr {
+
+namespace {
+
+template<typename Field>
+void Build
+( Node<Field>& node,
+  Int beg,
+  Int end,
+  const function<Field(Int,Int)>& entry,
+  const HODLRCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    node.beg = beg;
+    node.end = end;
+    const Int n = end - beg;
+    if( n <= ctrl.maxLeafSize )
+    {
+        node.D.Resize( n, n );
+        for( Int j=0; j<n; ++j )
+            for( Int i=0; i<n; ++i )
+                node.D(i,j) = entry( beg+i, beg+j );
+        return;
+    }
+
+    const Int mid = beg + n/2;
+    const Range<Int> ind1(beg,mid), ind2(mid,end);
+    ACA
+    ( entry, ind1, ind2, ind1, ind2, ctrl.relTol, ctrl.maxRank,
+      mpi::COMM_SELF, node.U12, node.V12 );
+    ACA
+    ( entry, ind2, ind1, ind2, ind1, ctrl.relTol, ctrl.maxRank,
+      mpi::COMM_SELF, node.U21, node.V21 );
+
+    node.left.reset( new Node<Field> );
+    node.right.reset( new Node<Field> );
+    Build( *node.left, beg, mid, entry, ctrl );
+    Build( *node.right, mid, end, entry, ctrl );
+}
+
+// Y := Y + alpha A X
+template<typename Field>
+void Multiply
+( const Node<Field>& node,
+  Field alpha,
+  const Matrix<Field>& X,
+        Matrix<Field>& Y )
+{
+    EL_DEBUG_CSE
+    if( node.Leaf() )
+    {
+        Gemm( NORMAL, NORMAL, alpha, node.D, X, Field(1), Y );
+        return;
+    }
+    const Int n1 = node.left->end - node.left->beg;
+    const Int n = node.end - node.beg;
+    auto X1 = X( IR(0,n1), ALL );
+    auto X2 = X( IR(n1,n), ALL );
+    auto Y1 = Y( IR(0,n1), ALL );
+    auto Y2 = Y( IR(n1,n), ALL );
+
+    // Y1 += alpha U12 (V12^H X2) and Y2 += alpha U21 (V21^H X1)
+    Matrix<Field> T;
+    Gemm( ADJOINT, NORMAL, Field(1), node.V12, X2, T );
+    Gemm( NORMAL, NORMAL, alpha, node.U12, T, Field(1), Y1 );
+    Gemm( ADJOINT, NORMAL, Field(1), node.V21, X1, T );
+    Gemm( NORMAL, NORMAL, alpha, node.U21, T, Field(1), Y2 );
+
+    Multiply( *node.left, alpha, X1, Y1 );
+    Multiply( *node.right, alpha, X2, Y2 );
+}
+
+template<typename Field>
+void Solve( const Node<Field>& node, Matrix<Field>& B )
+{
+    EL_DEBUG_CSE
+    if( node.Leaf() )
+    {
+        lu::SolveAfter( NORMAL, node.DFact, node.P, B );
+        return;
+    }
+    const Int n1 = node.left->end - node.left->beg;
+    const Int n = node.end - node.beg;
+    auto B1 = B( IR(0,n1), ALL );
+    auto B2 = B( IR(n1,n), ALL );
+
+    // Apply the inverse of the block diagonal
+    Solve( *node.left, B1 );
+    Solve( *node.right, B2 );
+
+    // Apply the Sherman-Morrison-Woodbury correction,
+    //
+    //   B := B - | Y12, 0   | inv(K) | 0,     V12^H | B
+    //            | 0,   Y21 |        | V21^H, 0     |
+    const Int rank12 = node.U12.Width();
+    const Int rank21 = node.U21.Width();
+    if( rank12+rank21 == 0 )
+        return;
+    Matrix<Field> T;
+    Zeros( T, rank12+rank21, B.Width() );
+    auto T1 = T( IR(0,rank12), ALL );
+    auto T2 = T( IR(rank12,rank12+rank21), ALL );
+    Gemm( ADJOINT, NORMAL, Field(1), node.V12, B2, Field(0), T1 );
+    Gemm( ADJOINT, NORMAL, Field(1), node.V21, B1, Field(0), T2 );
+    lu::SolveAfter( NORMAL, node.K, node.PK, T );
+    Gemm( NORMAL, NORMAL, Field(-1), node.Y12, T1, Field(1), B1 );
+    Gemm( NORMAL, NORMAL, Field(-1), node.Y21, T2, Field(1), B2 );
+}
+
+template<typename Field>
+void Factor( Node<Field>& node )
+{
+    EL_DEBUG_CSE
+    if( node.Leaf() )
+    {
+        node.DFact = node.D;
+        LU( node.DFact, node.P );
+        return;
+    }
+    Factor( *node.left );
+    Factor( *node.right );
+
+    node.Y12 = node.U12;
+    node.Y21 = node.U21;
+    Solve( *node.left, node.Y12 );
+    Solve( *node.right, node.Y21 );
+
+    const Int rank12 = node.U12.Width();
+    const Int rank21 = node.U21.Width();
+    Identity( node.K, rank12+rank21, rank12+rank21 );
+    if( rank12+rank21 == 0 )
+        return;
+    auto K12 = node.K( IR(0,rank12), IR(rank12,rank12+rank21) );
+    auto K21 = node.K( IR(rank12,rank12+rank21), IR(0,rank12) );
+    Gemm( ADJOINT, NORMAL, Field(1), node.V12, node.Y21, Field(1), K12 );
+    Gemm( ADJOINT, NORMAL, Field(1), node.V21, node.Y12, Field(1), K21 );
+    LU( node.K, node.PK );
+}
+
+template<typename Field>
+Int MaxRank( const Node<Field>& node )
+{
+    if( node.Leaf() )
+        return 0;
+    const Int rank = Max( node.U12.Width(), node.U21.Width() );
+    return Max( rank, Max( MaxRank(*node.left), MaxRank(*node.right) ) );
+}
+
+template<typename Field>
+Int NumEntries( const Node<Field>& node )
+{
+    if( node.Leaf() )
+        return node.D.Height()*node.D.Width();
+    const Int n = node.end - node.beg;
+    return n*(node.U12.Width()+node.U21.Width()) +
+           NumEntries(*node.left) + NumEntries(*node.right);
+}
+
+} // anonymous namespace
+
+} // namespace hodlr
+
+template<typename Field>
+HODLR<Field>::HODLR() { }
+
+template<typename Field>
+HODLR<Field>::HODLR
+( Int n,
+  const function<Field(Int,Int)>& entry,
+  const HODLRCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    Compress( n, entry, ctrl );
+}
+
+template<typename Field>
+void HODLR<Field>::Compress
+( Int n,
+  const function<Field(Int,Int)>& entry,
+  const HODLRCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( ctrl.maxLeafSize < 1 )
+        LogicError("The maximum leaf size must be positive");
+    height_ = n;
+    factored_ = false;
+    root_.reset( new hodlr::Node<Field> );
+    hodlr::Build( *root_, 0, n, entry, ctrl );
+    if( ctrl.progress )
+        Output
+        ("HODLR: max rank of ",MaxRank(),", ",NumEntries()," entries (",
+         double(NumEntries())/(double(n)*n)," of dense)");
+}
+
+template<typename Field>
+void HODLR<Field>::Multiply
+( Field alpha, const Matrix<Field>& X, Field beta, Matrix<Field>& Y ) const
+{
+    EL_DEBUG_CSE
+    if( !root_ )
+        LogicError("The HODLR matrix has not been formed");
+    if( X.Height() != height_ || Y.Height() != height_ )
+        LogicError("Heights of X and Y must match that of the HODLR matrix");
+    if( X.Width() != Y.Width() )
+        LogicError("Widths of X and Y must match");
+    Y *= beta;
+    hodlr::Multiply( *root_, alpha, X, Y );
+}
+
+template<typename Field>
+void HODLR<Field>::Factor()
+{
+    EL_DEBUG_CSE
+    if( !root_ )
+        LogicError("The HODLR matrix has not been formed");
+    hodlr::Factor( *root_ );
+    factored_ = true;
+}
+
+template<typename Field>
+void HODLR<Field>::Solve( Matrix<Field>& B ) const
+{
+    EL_DEBUG_CSE
+    if( !factored_ )
+        LogicError("The HODLR matrix has not been factored");
+    if( B.Height() != height_ )
+        LogicError("Height of B must match that of the HODLR matrix");
+    hodlr::Solve( *root_, B );
+}
+
+template<typename Field>
+Int HODLR<Field>::Height() const { return height_; }
+template<typename Field>
+bool HODLR<Field>::Factored() const { return factored_; }
+
+template<typename Field>
+Int HODLR<Field>::MaxRank() const
+{ return root_ ? hodlr::MaxRank( *root_ ) : 0; }
+
+template<typename Field>
+Int HODLR<Field>::NumEntries() const
+{ return root_ ? hodlr::NumEntries( *root_ ) : 0; }
+
+template<typename Field>
+const hodlr::Node<Field>& HODLR<Field>::Root() const
+{
+    EL_DEBUG_CSE
+    if( !root_ )
+        LogicError("The HODLR matrix has not been formed");
+    return *root_;
+}
+
+#define PROTO(Field) \
+  template class HODLR<Field>;
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -48,8 +48,12 @@ void SparseLDLFactorization<Field>::Initialize
     EL_DEBUG_CSE
     info_.reset( new ldl::NodeInfo );
     separator_.reset( new ldl::Separator );
-    ldl::NestedDissection
-    ( A.LockedGraph(), map_, *separator_, *info_, bisectCtrl );
+    if( ldl::UseMinimumDegree( A.Height(), bisectCtrl ) )
+        ldl::MinimumDegree
+        ( A.LockedGraph(), map_, *separator_, *info_, bisectCtrl );
+    else
+        ldl::NestedDissection
+        ( A.LockedGraph(), map_, *separator_, *info_, bisectCtrl );
     InvertMap( map_, inverseMap_ );
     front_.reset( new ldl::Front<Field>(A,map_,*info_,hermitian) );
 
@@ -0,0 +1,387 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+#include <set>
+
+// The supernodal tree is formed from an approximate minimum degree reordering
+// in the manner of, e.g.,
+//
+//   Joseph W.H. Liu, Esmond G. Ng, and Barry W. Peyton,
+//   "On finding supernodes for sparse matrix computations",
+//   SIAM J. Matrix Anal. Appl., 14(1), pp. 242--252, 1993.
+//
+// The elimination tree is postordered (which preserves the fill) so that each
+// subtree is a contiguous range of indices, chains of (relaxed) fundamental
+// supernodes become dense fronts, and runs of sibling subtrees with at most
+// 'cutoff' vertices are amalgamated into sparse leaves, which are factored
+// just as the leaves of nested dissection are.
+
+namespace El {
+namespace ldl {
+
+namespace {
+
+// Chains of vertices are merged into a single supernode regardless of their
+// column counts as long as the result is at most this wide
+const Int relaxedSupernodeSize = 16;
+
+// Since the relaxed supernodes are narrow, chain-like graphs (e.g., those of
+// banded matrices) would otherwise lead to one supernode per few vertices, and
+// the tree, which is traversed recursively, would be as deep as the graph is
+// long. Every subtree beneath this many nested supernodes is instead
+// amalgamated into a single sparse leaf.
+const Int maxSupernodeDepth = 32;
+
+struct EliminationTree
+{
+    // The vertex of the subgraph eliminated at each (postordered) step
+    vector<Int> order, orderInv;
+
+    vector<Int> parents, numChildren, subtreeSizes, colCounts;
+};
+
+void FormEliminationTree( const Graph& graph, EliminationTree& etree )
+{
+    EL_DEBUG_CSE
+    const Int numSources = graph.NumSources();
+    const Int* offsetBuf = graph.LockedOffsetBuffer();
+    const Int* targetBuf = graph.LockedTargetBuffer();
+
+    // Filter out the graph of the diagonal block (without self-loops)
+    vector<Int> subOffsets(numSources+1), subTargets;
+    subTargets.reserve( graph.NumEdges() );
+    for( Int s=0; s<numSources; ++s )
+    {
+        subOffsets[s] = subTargets.size();
+        for( Int e=offsetBuf[s]; e<offsetBuf[s+1]; ++e )
+        {
+            const Int target = targetBuf[e];
+            if( target < numSources && target != s )
+                subTargets.push_back( target );
+        }
+    }
+    subOffsets[numSources] = subTargets.size();
+    if( subTargets.empty() )
+        subTargets.resize( 1 );
+
+    vector<Int> amdPerm;
+    AMDOrder( subOffsets, subTargets, amdPerm );
+
+    // Compute the elimination tree and the column counts of the reordering
+    vector<Int> LOffsets(numSources+1), parents(numSources),
+                colCounts(numSources), flag(numSources), amdPermInv(numSources);
+    suite_sparse::ldl::Symbolic
+    ( numSources, subOffsets.data(), subTargets.data(),
+      LOffsets.data(), parents.data(), colCounts.data(),
+      flag.data(), amdPerm.data(), amdPermInv.data() );
+
+    // Postorder the elimination tree with a nonrecursive depth-first search
+    vector<Int> firstChild(numSources,-1), nextSibling(numSources,-1),
+                numChildren(numSources,0), roots;
+    for( Int j=numSources-1; j>=0; --j )
+    {
+        const Int parent = parents[j];
+        if( parent >= 0 )
+        {
+            nextSibling[j] = firstChild[parent];
+            firstChild[parent] = j;
+            ++numChildren[parent];
+        }
+        else
+            roots.push_back( j );
+    }
+    vector<Int> post(numSources), stack;
+    Int numVisited = 0;
+    for( auto rootIt=roots.rbegin(); rootIt!=roots.rend(); ++rootIt )
+    {
+        stack.push_back( *rootIt );
+        while( !stack.empty() )
+        {
+            const Int j = stack.back();
+            const Int child = firstChild[j];
+            if( child == -1 )
+            {
+                stack.pop_back();
+                post[numVisited++] = j;
+            }
+            else
+            {
+                firstChild[j] = nextSibling[child];
+                stack.push_back( child );
+            }
+        }
+    }
+
+    // Compose the reorderings and relabel the tree
+    vector<Int> postInv(numSources);
+    for( Int i=0; i<numSources; ++i )
+        postInv[post[i]] = i;
+    etree.order.resize( numSources );
+    etree.orderInv.resize( numSources );
+    etree.parents.resize( numSources );
+    etree.numChildren.resize( numSources );
+    etree.colCounts.resize( numSources );
+    etree.subtreeSizes.resize( numSources, 1 );
+    for( Int i=0; i<numSources; ++i )
+    {
+        const Int j = post[i];
+        etree.order[i] = amdPerm[j];
+        etree.orderInv[amdPerm[j]] = i;
+        etree.parents[i] = ( parents[j] >= 0 ? postInv[parents[j]] : -1 );
+        etree.numChildren[i] = numChildren[j];
+        etree.colCounts[i] = colCounts[j];
+    }
+    for( Int i=0; i<numSources; ++i )
+        if( etree.parents[i] >= 0 )
+            etree.subtreeSizes[etree.parents[i]] += etree.subtreeSizes[i];
+}
+
+// Fill in a sparse leaf containing the contiguous range of postordered
+// indices [first,first+size), which must be a union of complete subtrees
+void FormLeaf
+( const Graph& graph,
+  const vector<Int>& perm,
+  const EliminationTree& etree,
+        Int first,
+        Int size,
+        Separator& sep,
+        NodeInfo& info,
+        Int off )
+{
+    EL_DEBUG_CSE
+    const Int numSources = graph.NumSources();
+    const Int* offsetBuf = graph.LockedOffsetBuffer();
+    const Int* targetBuf = graph.LockedTargetBuffer();
+
+    sep.off = off + first;
+    sep.inds.resize( size );
+    for( Int i=0; i<size; ++i )
+        sep.inds[i] = perm[etree.order[first+i]];
+    SwapClear( sep.children );
+
+    info.size = size;
+    info.off = off + first;
+    SwapClear( info.children );
+
+    // Form the graph of the diagonal block and the original lower structure
+    vector<Int> subOffsets(size+1), subTargets;
+    set<Int> lowerStruct;
+    for( Int i=0; i<size; ++i )
+    {
+        subOffsets[i] = subTargets.size();
+        const Int source = etree.order[first+i];
+        for( Int e=offsetBuf[source]; e<offsetBuf[source+1]; ++e )
+        {
+            const Int target = targetBuf[e];
+            if( target >= numSources )
+            {
+                lowerStruct.insert( off+target );
+                continue;
+            }
+            const Int j = etree.orderInv[target];
+            EL_DEBUG_ONLY(
+              if( j < first )
+                  LogicError("Leaf was not a union of subtrees");
+            )
+            if( j >= first+size )
+                lowerStruct.insert( off+j );
+            else if( j != first+i )
+                subTargets.push_back( j-first );
+        }
+    }
+    subOffsets[size] = subTargets.size();
+    if( subTargets.empty() )
+        subTargets.resize( 1 );
+    CopySTL( lowerStruct, info.origLowerStruct );
+
+    // Compute the symbolic factorization of the leaf in its existing order
+    info.LOffsets.resize( size+1 );
+    info.LParents.resize( size );
+    vector<Int> LNnz( size ), flag( size );
+    suite_sparse::ldl::Symbolic
+    ( size, subOffsets.data(), subTargets.data(),
+      info.LOffsets.data(), info.LParents.data(), LNnz.data(), flag.data(),
+      (const Int*)nullptr, (Int*)nullptr );
+}
+
+// Fill in the supernode whose last (postordered) index is 'top', along with
+// its descendants. If 'isRoot' is true, every index before the supernode
+// (rather than just those of its subtree) is placed beneath it.
+void FormSupernode
+( const Graph& graph,
+  const vector<Int>& perm,
+  const EliminationTree& etree,
+        Int top,
+        bool isRoot,
+        Separator& sep,
+        NodeInfo& info,
+        Int off,
+        Int depth,
+  const BisectCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int numSources = graph.NumSources();
+    const Int* offsetBuf = graph.LockedOffsetBuffer();
+    const Int* targetBuf = graph.LockedTargetBuffer();
+    const auto& subtreeSizes = etree.subtreeSizes;
+
+    // Extend the supernode downwards through its chain of only-children
+    Int first = top;
+    while( etree.numChildren[first] == 1 && first > 0 )
+    {
+        const Int child = first-1;
+        if( subtreeSizes[child] <= ctrl.cutoff )
+            break;
+        const bool fundamental =
+          etree.colCounts[child] == etree.colCounts[first]+1;
+        if( !fundamental && top-child+1 > relaxedSupernodeSize )
+            break;
+        first = child;
+    }
+    const Int size = top-first+1;
+
+    sep.off = off + first;
+    sep.inds.resize( size );
+    for( Int i=0; i<size; ++i )
+        sep.inds[i] = perm[etree.order[first+i]];
+
+    info.size = size;
+    info.off = off + first;
+    set<Int> lowerStruct;
+    for( Int i=first; i<=top; ++i )
+    {
+        const Int source = etree.order[i];
+        for( Int e=offsetBuf[source]; e<offsetBuf[source+1]; ++e )
+        {
+            const Int target = targetBuf[e];
+            if( target >= numSources )
+                lowerStruct.insert( off+target );
+            else if( etree.orderInv[target] > top )
+                lowerStruct.insert( off+etree.orderInv[target] );
+        }
+    }
+    CopySTL( lowerStruct, info.origLowerStruct );
+
+    // Walk backwards over the roots of the child subtrees (and, for the root,
+    // those of the other trees of the forest)
+    const Int begin = ( isRoot ? 0 : first-subtreeSizes[first]+1 );
+    if( depth+1 >= maxSupernodeDepth )
+    {
+        if( first > begin )
+        {
+            sep.children.emplace_back( new Separator(&sep) );
+            info.children.emplace_back( new NodeInfo(&info) );
+            FormLeaf
+            ( graph, perm, etree, begin, first-begin,
+              *sep.children.back(), *info.children.back(), off );
+        }
+        return;
+    }
+    vector<Int> childRoots;
+    for( Int child=first-1; child>=begin; child-=subtreeSizes[child] )
+        childRoots.push_back( child );
+    std::reverse( childRoots.begin(), childRoots.end() );
+
+    // Amalgamate runs of small subtrees into sparse leaves
+    Int leafFirst = begin, leafSize = 0;
+    auto flushLeaf = [&]()
+      {
+        if( leafSize == 0 )
+            return;
+        sep.children.emplace_back( new Separator(&sep) );
+        info.children.emplace_back( new NodeInfo(&info) );
+        FormLeaf
+        ( graph, perm, etree, leafFirst, leafSize,
+          *sep.children.back(), *info.children.back(), off );
+        leafSize = 0;
+      };
+    for( const Int child : childRoots )
+    {
+        const Int childSize = subtreeSizes[child];
+        if( childSize <= ctrl.cutoff )
+        {
+            if( leafSize+childSize > ctrl.cutoff )
+                flushLeaf();
+            if( leafSize == 0 )
+                leafFirst = child-childSize+1;
+            leafSize += childSize;
+        }
+        else
+        {
+            flushLeaf();
+            sep.children.emplace_back( new Separator(&sep) );
+            info.children.emplace_back( new NodeInfo(&info) );
+            FormSupernode
+            ( graph, perm, etree, child, false,
+              *sep.children.back(), *info.children.back(), off, depth+1,
+              ctrl );
+        }
+    }
+    flushLeaf();
+}
+
+} // anonymous namespace
+
+bool UseMinimumDegree
+( Int numSources, const BisectCtrl& ctrl, int numProcesses )
+{
+    EL_DEBUG_CSE
+    if( ctrl.ordering == SPARSE_MINIMUM_DEGREE )
+        return true;
+    else if( ctrl.ordering == SPARSE_NESTED_DISSECTION )
+        return false;
+    else
+        // The subtrees of the processes are factored concurrently, so the
+        // imbalance between the irregular minimum degree subtrees matters
+        // more (and their reduced fill less) as the number of processes grows
+        return numSources <= ctrl.minDegreeCutoff/numProcesses;
+}
+
+void MinimumDegreeSubtree
+( const Graph& graph,
+  const vector<Int>& perm,
+        Separator& sep,
+        NodeInfo& info,
+        Int off,
+  const BisectCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int numSources = graph.NumSources();
+    EliminationTree etree;
+    FormEliminationTree( graph, etree );
+    if( numSources <= ctrl.cutoff )
+        FormLeaf( graph, perm, etree, 0, numSources, sep, info, off );
+    else
+        FormSupernode
+        ( graph, perm, etree, numSources-1, true, sep, info, off, 0, ctrl );
+}
+
+void MinimumDegree
+( const Graph& graph,
+        vector<Int>& map,
+        Separator& sep,
+        NodeInfo& info,
+  const BisectCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int numSources = graph.NumSources();
+    vector<Int> perm(numSources);
+    for( Int s=0; s<numSources; ++s )
+        perm[s] = s;
+
+    MinimumDegreeSubtree( graph, perm, sep, info, 0, ctrl );
+
+    sep.BuildMap( map );
+    EL_DEBUG_ONLY(EnsurePermutation(map))
+
+    Analysis( info );
+}
+
+} // namespace ldl
+} // namespace El
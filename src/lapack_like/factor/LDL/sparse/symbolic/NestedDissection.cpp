@@ -375,8 +375,16 @@ NestedDissectionRecursion
 
         sep.duplicate.reset( new Separator(&sep) );
         info.duplicate.reset( new NodeInfo(&info) );
-        NestedDissectionRecursion
-        ( seqGraph, perm.Map(), *sep.duplicate, *info.duplicate, off, ctrl );
+        // The ordering of the subgraph owned by each process was resolved
+        // (consistently across the processes) before the recursion
+        if( UseMinimumDegree( seqGraph.NumSources(), ctrl ) )
+            MinimumDegreeSubtree
+            ( seqGraph, perm.Map(), *sep.duplicate, *info.duplicate, off,
+              ctrl );
+        else
+            NestedDissectionRecursion
+            ( seqGraph, perm.Map(), *sep.duplicate, *info.duplicate, off,
+              ctrl );
 
         // Pull information up from the duplicates
         sep.off = sep.duplicate->off;
@@ -426,8 +434,16 @@ void NestedDissection
     for( Int s=0; s<numLocalSources; ++s )
         perm.SetLocal( s, s+firstLocalSource );
 
+    // Decide between nested dissection and minimum degree for the subgraphs
+    // owned by the individual processes from their typical size
+    BisectCtrl resolvedCtrl( ctrl );
+    if( ctrl.ordering == SPARSE_ORDERING_AUTO )
+        resolvedCtrl.ordering =
+          UseMinimumDegree( graph.Blocksize(), ctrl, graph.Grid().Size() ) ?
+          SPARSE_MINIMUM_DEGREE : SPARSE_NESTED_DISSECTION;
+
     info.SetRootGrid( graph.Grid() );
-    NestedDissectionRecursion( graph, perm, sep, info, 0, ctrl );
+    NestedDissectionRecursion( graph, perm, sep, info, 0, resolvedCtrl );
 
     // Construct the distributed reordering
     sep.BuildMap( info, map );
@@ -174,20 +174,23 @@ void LU( AbstractDistMatrix<F>& APre, DistPermutation& P )
     P.ReserveSwaps( minDim );
 
     DistPermutation PB(g);
+    PermutationExchange<F> leftExchange;
 
     vector<F> panelBuf, pivotBuf;
     const Int bsize = Blocksize();
     for( Int k=0; k<minDim; k+=bsize )
     {
         const Int nb = Min(bsize,minDim-k);
-        const IR ind1( k, k+nb ), ind2( k+nb, END ), indB( k, END );
+        const IR ind0( 0, k ), ind1( k, k+nb ), ind2( k+nb, END ),
+                 indB( k, END );
 
         auto A11 = A( ind1, ind1 );
         auto A12 = A( ind1, ind2 );
         auto A21 = A( ind2, ind1 );
         auto A22 = A( ind2, ind2 );
 
-        auto AB  = A( indB, ALL );
+        auto AB0 = A( indB, ind0 );
+        auto AB2 = A( indB, ind2 );
 
         const Int A21Height = A21.Height();
         const Int A21LocHeight = A21.LocalHeight();
@@ -201,7 +204,12 @@ void LU( AbstractDistMatrix<F>& APre, DistPermutation& P )
         A21_MC_STAR = A21;
         lu::Panel( A11_STAR_STAR, A21_MC_STAR, P, PB, k, pivotBuf );
 
-        PB.PermuteRows( AB );
+        // The panel columns are overwritten below, so only the columns to the
+        // left and right need to be pivoted. The left columns are not needed
+        // until the next iteration, so their exchange is overlapped with the
+        // trailing update.
+        PB.StartPermuteRows( AB0, leftExchange );
+        PB.PermuteRows( AB2 );
 
         // Perhaps we should give up perfectly distributing this operation since
         // it's total contribution is only O(n^2)
@@ -217,6 +225,8 @@ void LU( AbstractDistMatrix<F>& APre, DistPermutation& P )
         A11 = A11_STAR_STAR;
         A12 = A12_STAR_MR;
         A21 = A21_MC_STAR;
+
+        PB.FinishPermutation( leftExchange );
     }
 }
 
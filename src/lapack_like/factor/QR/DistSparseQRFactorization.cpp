@@ -0,0 +1,284 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+
+namespace qr {
+
+namespace {
+
+template<typename Field>
+void SendTriangle( const SparseMatrix<Field>& R, int to, mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    const Int numEntries = R.NumEntries();
+    mpi::Send( numEntries, to, comm );
+    mpi::Send( R.LockedSourceBuffer(), numEntries, to, comm );
+    mpi::Send( R.LockedTargetBuffer(), numEntries, to, comm );
+    mpi::Send( R.LockedValueBuffer(), numEntries, to, comm );
+}
+
+// Overwrite S with the (2n x n) matrix [R; RPartner], where RPartner is
+// received from process 'from'
+template<typename Field>
+void StackTriangles
+( const SparseMatrix<Field>& R,
+        SparseMatrix<Field>& S,
+  int from, mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    const Int n = R.Width();
+    const Int numEntries = R.NumEntries();
+    const Int numPartnerEntries = mpi::Recv<Int>( from, comm );
+    vector<Int> rows(numEntries+numPartnerEntries),
+                cols(numEntries+numPartnerEntries);
+    vector<Field> values(numEntries+numPartnerEntries);
+    std::copy
+    ( R.LockedSourceBuffer(), R.LockedSourceBuffer()+numEntries,
+      rows.begin() );
+    std::copy
+    ( R.LockedTargetBuffer(), R.LockedTargetBuffer()+numEntries,
+      cols.begin() );
+    std::copy
+    ( R.LockedValueBuffer(), R.LockedValueBuffer()+numEntries,
+      values.begin() );
+    mpi::Recv( &rows[numEntries], numPartnerEntries, from, comm );
+    mpi::Recv( &cols[numEntries], numPartnerEntries, from, comm );
+    mpi::Recv( &values[numEntries], numPartnerEntries, from, comm );
+    for( Int e=numEntries; e<numEntries+numPartnerEntries; ++e )
+        rows[e] += n;
+
+    Zeros( S, 2*n, n );
+    S.Reserve( numEntries+numPartnerEntries );
+    S.QueueUpdates
+    ( numEntries+numPartnerEntries, rows.data(), cols.data(), values.data() );
+    S.ProcessQueues();
+}
+
+} // anonymous namespace
+
+} // namespace qr
+
+template<typename Field>
+DistSparseQRFactorization<Field>::DistSparseQRFactorization() { }
+
+template<typename Field>
+void DistSparseQRFactorization<Field>::Factor
+( const DistSparseMatrix<Field>& A, const BisectCtrl& bisectCtrl )
+{
+    EL_DEBUG_CSE
+    grid_ = &A.Grid();
+    height_ = A.Height();
+    width_ = A.Width();
+    const int commSize = grid_->Size();
+    const int commRank = grid_->Rank();
+    mpi::Comm comm = grid_->Comm();
+
+    SparseMatrix<Field> ALoc;
+    ALoc.ImportCSR
+    ( A.LocalHeight(), width_,
+      A.LockedOffsetBuffer(), A.LockedTargetBuffer(), A.LockedValueBuffer() );
+    localFact_.SetRankTolerance( rankTol_ );
+    localFact_.Factor( ALoc, bisectCtrl );
+
+    // Combine the triangular factors up a binary tree rooted at process 0
+    SparseMatrix<Field> R, S;
+    localFact_.ExplicitR( R );
+    combinedFacts_.clear();
+    partners_.clear();
+    parent_ = -1;
+    for( int stride=1; stride<commSize; stride*=2 )
+    {
+        if( commRank % (2*stride) == stride )
+        {
+            parent_ = commRank - stride;
+            qr::SendTriangle( R, parent_, comm );
+            break;
+        }
+        else if( commRank+stride < commSize )
+        {
+            const int partner = commRank + stride;
+            qr::StackTriangles( R, S, partner, comm );
+            combinedFacts_.emplace_back( new SparseQRFactorization<Field> );
+            combinedFacts_.back()->SetRankTolerance( rankTol_ );
+            combinedFacts_.back()->Factor( S, bisectCtrl );
+            combinedFacts_.back()->ExplicitR( R );
+            partners_.push_back( partner );
+        }
+    }
+    factored_ = true;
+}
+
+template<typename Field>
+const SparseQRFactorization<Field>&
+DistSparseQRFactorization<Field>::RootFactorization() const
+{ return combinedFacts_.empty() ? localFact_ : *combinedFacts_.back(); }
+
+template<typename Field>
+void DistSparseQRFactorization<Field>::ReduceAdjointQ
+( const Matrix<Field>& BLoc, Matrix<Field>& C ) const
+{
+    EL_DEBUG_CSE
+    mpi::Comm comm = grid_->Comm();
+    const Int numRHS = BLoc.Width();
+
+    localFact_.ApplyAdjointQ( BLoc, C );
+    Matrix<Field> W;
+    const Int numLevels = combinedFacts_.size();
+    for( Int level=0; level<numLevels; ++level )
+    {
+        Zeros( W, 2*width_, numRHS );
+        auto WT = W( IR(0,width_), ALL );
+        WT = C;
+        Matrix<Field> CPartner( width_, numRHS );
+        mpi::Recv
+        ( CPartner.Buffer(), width_*numRHS, partners_[level], comm );
+        auto WB = W( IR(width_,2*width_), ALL );
+        WB = CPartner;
+        combinedFacts_[level]->ApplyAdjointQ( W, C );
+    }
+    if( parent_ >= 0 )
+    {
+        Matrix<Field> CCopy( C );
+        mpi::Send( CCopy.LockedBuffer(), width_*numRHS, parent_, comm );
+    }
+}
+
+template<typename Field>
+void DistSparseQRFactorization<Field>::ExpandQ
+( const Matrix<Field>& C, Matrix<Field>& BLoc ) const
+{
+    EL_DEBUG_CSE
+    mpi::Comm comm = grid_->Comm();
+    const Int numRHS = C.Width();
+
+    Matrix<Field> CLevel( width_, numRHS );
+    if( parent_ >= 0 )
+        mpi::Recv( CLevel.Buffer(), width_*numRHS, parent_, comm );
+    else
+        CLevel = C;
+
+    Matrix<Field> W, CPartner;
+    const Int numLevels = combinedFacts_.size();
+    for( Int level=numLevels-1; level>=0; --level )
+    {
+        combinedFacts_[level]->ApplyQ( CLevel, W );
+        CPartner = W( IR(width_,2*width_), ALL );
+        mpi::Send
+        ( CPartner.LockedBuffer(), width_*numRHS, partners_[level], comm );
+        CLevel = W( IR(0,width_), ALL );
+    }
+    localFact_.ApplyQ( CLevel, BLoc );
+}
+
+template<typename Field>
+void DistSparseQRFactorization<Field>::LeastSquares
+( const DistMultiVec<Field>& B, DistMultiVec<Field>& X ) const
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( !factored_ )
+          LogicError("Sparse QR factorization has not been computed");
+      if( B.Height() != height_ )
+          LogicError("B was ",B.Height()," x ",B.Width()," but A has ",
+                     height_," rows");
+    )
+    const Int numRHS = B.Width();
+    Matrix<Field> C;
+    ReduceAdjointQ( B.LockedMatrix(), C );
+    if( grid_->Rank() == 0 )
+    {
+        const auto& rootFact = RootFactorization();
+        rootFact.SolveAgainstR( NORMAL, C );
+        rootFact.PermuteToOriginal( C );
+    }
+    else
+        Zeros( C, width_, numRHS );
+    mpi::Broadcast( C.Buffer(), width_*numRHS, 0, grid_->Comm() );
+
+    X.SetGrid( *grid_ );
+    X.Resize( width_, numRHS );
+    const Int firstLocalRow = X.FirstLocalRow();
+    const Int localHeight = X.LocalHeight();
+    auto& XLoc = X.Matrix();
+    for( Int j=0; j<numRHS; ++j )
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+            XLoc(iLoc,j) = C(firstLocalRow+iLoc,j);
+}
+
+template<typename Field>
+void DistSparseQRFactorization<Field>::MinimumNorm
+( const DistMultiVec<Field>& B, DistMultiVec<Field>& X ) const
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( !factored_ )
+          LogicError("Sparse QR factorization has not been computed");
+      if( B.Height() != width_ )
+          LogicError("B was ",B.Height()," x ",B.Width()," but A has ",
+                     width_," columns");
+    )
+    const Int numRHS = B.Width();
+
+    // Gather B onto every process (only the root needs it)
+    Matrix<Field> C;
+    Zeros( C, width_, numRHS );
+    const Int firstLocalRow = B.FirstLocalRow();
+    const Int localHeight = B.LocalHeight();
+    const auto& BLoc = B.LockedMatrix();
+    for( Int j=0; j<numRHS; ++j )
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+            C(firstLocalRow+iLoc,j) = BLoc(iLoc,j);
+    mpi::AllReduce( C.Buffer(), width_*numRHS, grid_->Comm() );
+
+    if( grid_->Rank() == 0 )
+    {
+        const auto& rootFact = RootFactorization();
+        rootFact.PermuteToReordered( C );
+        rootFact.SolveAgainstR( ADJOINT, C );
+    }
+
+    X.SetGrid( *grid_ );
+    X.Resize( height_, numRHS );
+    ExpandQ( C, X.Matrix() );
+}
+
+template<typename Field>
+void DistSparseQRFactorization<Field>::SetRankTolerance( Base<Field> tol )
+{
+    rankTol_ = tol;
+    localFact_.SetRankTolerance( tol );
+    for( auto& fact : combinedFacts_ )
+        fact->SetRankTolerance( tol );
+}
+
+template<typename Field>
+Int DistSparseQRFactorization<Field>::Height() const { return height_; }
+template<typename Field>
+Int DistSparseQRFactorization<Field>::Width() const { return width_; }
+template<typename Field>
+bool DistSparseQRFactorization<Field>::Factored() const { return factored_; }
+
+template<typename Field>
+const SparseQRFactorization<Field>&
+DistSparseQRFactorization<Field>::LocalFactorization() const
+{ return localFact_; }
+
+#define PROTO(Field) \
+  template class DistSparseQRFactorization<Field>;
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -0,0 +1,676 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+
+namespace qr {
+
+template<typename Field>
+SparseFront<Field>::SparseFront( SparseFront<Field>* parentNode )
+: parent(parentNode)
+{ }
+
+namespace {
+
+// Form the graph of A^H A (without self-loops), which has an edge between
+// each pair of columns of A which share a row
+template<typename Field>
+void FormNormalGraph( const SparseMatrix<Field>& A, Graph& graph )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int numEntries = A.NumEntries();
+    const Int* rowOffsets = A.LockedOffsetBuffer();
+    const Int* colBuf = A.LockedTargetBuffer();
+
+    // Form the row indices of each column
+    vector<Int> colOffsets(n+1,0), colRows(numEntries);
+    for( Int e=0; e<numEntries; ++e )
+        ++colOffsets[colBuf[e]+1];
+    for( Int j=0; j<n; ++j )
+        colOffsets[j+1] += colOffsets[j];
+    {
+        vector<Int> positions( colOffsets.begin(), colOffsets.end()-1 );
+        for( Int i=0; i<m; ++i )
+            for( Int e=rowOffsets[i]; e<rowOffsets[i+1]; ++e )
+                colRows[positions[colBuf[e]]++] = i;
+    }
+
+    graph.Empty();
+    graph.Resize( n );
+    vector<Int> marks(n,-1), targets;
+    for( Int j=0; j<n; ++j )
+    {
+        targets.clear();
+        marks[j] = j;
+        for( Int f=colOffsets[j]; f<colOffsets[j+1]; ++f )
+        {
+            const Int i = colRows[f];
+            for( Int e=rowOffsets[i]; e<rowOffsets[i+1]; ++e )
+            {
+                const Int k = colBuf[e];
+                if( marks[k] != j )
+                {
+                    marks[k] = j;
+                    targets.push_back( k );
+                }
+            }
+        }
+        std::sort( targets.begin(), targets.end() );
+        for( const Int k : targets )
+            graph.QueueConnection( j, k );
+    }
+    graph.ProcessQueues( true );
+}
+
+// Return the index of the reordered column 'k' within the front
+inline Int RelativeIndex( const ldl::NodeInfo& info, Int k )
+{
+    if( k < info.off+info.size )
+        return k - info.off;
+    auto it = std::lower_bound
+      ( info.lowerStruct.begin(), info.lowerStruct.end(), k );
+    EL_DEBUG_ONLY(
+      if( it == info.lowerStruct.end() || *it != k )
+          LogicError("Column ",k," was not in the front's structure");
+    )
+    return info.size + (it-info.lowerStruct.begin());
+}
+
+// Return the reordered column of the front's j'th column
+inline Int FrontIndex( const ldl::NodeInfo& info, Int j )
+{ return j < info.size ? info.off+j : info.lowerStruct[j-info.size]; }
+
+template<typename Field>
+void BuildFronts
+( const ldl::NodeInfo& info,
+        SparseFront<Field>& front,
+        vector<SparseFront<Field>*>& frontOfIndex )
+{
+    EL_DEBUG_CSE
+    for( Int s=0; s<info.size; ++s )
+        frontOfIndex[info.off+s] = &front;
+    SwapClear( front.children );
+    front.rows.clear();
+    const Int numChildren = info.children.size();
+    front.children.reserve( numChildren );
+    for( Int c=0; c<numChildren; ++c )
+    {
+        front.children.emplace_back( new SparseFront<Field>(&front) );
+        BuildFronts( *info.children[c], *front.children.back(), frontOfIndex );
+    }
+}
+
+// Factor the front, treating each pivot column whose remaining norm is at most
+// 'deadTol' as dependent in the manner of
+//
+//   Michael T. Heath,
+//   "Some extensions of an algorithm for sparse linear least squares
+//    problems", SIAM J. Sci. Stat. Comput., 3(2), pp. 223--237, 1982.
+//
+// Such columns are moved behind the remaining pivots (and refactored) so that
+// their rows are passed to the parent rather than consumed.
+template<typename Field>
+void FactorFront
+( const SparseMatrix<Field>& A,
+  const vector<Int>& map,
+  const ldl::NodeInfo& info,
+        SparseFront<Field>& front,
+        Base<Field> deadTol )
+{
+    EL_DEBUG_CSE
+    const Int numChildren = info.children.size();
+    for( Int c=0; c<numChildren; ++c )
+        FactorFront( A, map, *info.children[c], *front.children[c], deadTol );
+
+    const Int size = info.size;
+    const Int width = size + info.lowerStruct.size();
+    const Int numRows = front.rows.size();
+    Int height = numRows;
+    for( Int c=0; c<numChildren; ++c )
+        height += front.children[c]->numUpdates;
+
+    // The column of the front holding each relative index
+    vector<Int> position(width);
+    for( Int j=0; j<width; ++j )
+        position[j] = j;
+
+    auto& F = front.F;
+    const Int* rowOffsets = A.LockedOffsetBuffer();
+    const Int* colBuf = A.LockedTargetBuffer();
+    const Field* valBuf = A.LockedValueBuffer();
+    auto assemble = [&]()
+      {
+        // Assemble the rows of A...
+        Zeros( F, height, width );
+        for( Int r=0; r<numRows; ++r )
+        {
+            const Int i = front.rows[r];
+            for( Int e=rowOffsets[i]; e<rowOffsets[i+1]; ++e )
+                F( r, position[RelativeIndex(info,map[colBuf[e]])] ) =
+                  valBuf[e];
+        }
+
+        // ...and stack the (upper-trapezoidal) update blocks of the children
+        Int rowOff = numRows;
+        for( Int c=0; c<numChildren; ++c )
+        {
+            const auto& child = *front.children[c];
+            const Int childSize = info.children[c]->size;
+            const Int childUpdateSize = info.children[c]->lowerStruct.size();
+            const auto& relInds = info.childRelInds[c];
+            for( Int j=0; j<childUpdateSize; ++j )
+            {
+                const Int iEnd =
+                  Min(childSize+j-child.numPivots+1,child.numUpdates);
+                for( Int i=0; i<iEnd; ++i )
+                    F( rowOff+i, position[relInds[j]] ) =
+                      child.F( child.numPivots+i, childSize+j );
+            }
+            rowOff += child.numUpdates;
+        }
+      };
+
+    assemble();
+    front.pivotOrder.resize( size );
+    for( Int j=0; j<size; ++j )
+        front.pivotOrder[j] = j;
+    Int numLive = size;
+    if( height > 0 && width > 0 )
+    {
+        QR( F, front.householderScalars, front.signature );
+
+        vector<Int> live, dead;
+        for( Int j=0; j<size; ++j )
+        {
+            if( j < height && Abs(F(j,j)) <= deadTol )
+                dead.push_back( j );
+            else
+                live.push_back( j );
+        }
+        if( !dead.empty() )
+        {
+            numLive = live.size();
+            front.pivotOrder = live;
+            front.pivotOrder.insert
+            ( front.pivotOrder.end(), dead.begin(), dead.end() );
+            for( Int k=0; k<size; ++k )
+                position[front.pivotOrder[k]] = k;
+            assemble();
+            QR( F, front.householderScalars, front.signature );
+        }
+    }
+    front.numPivots = Min(height,numLive);
+    front.numUpdates = Max(Min(height,width)-front.numPivots,Int(0));
+}
+
+template<typename Field>
+void ApplyAdjointQFront
+( const ldl::NodeInfo& info,
+  const SparseFront<Field>& front,
+  const Matrix<Field>& B,
+        Matrix<Field>& C,
+        Matrix<Field>& update )
+{
+    EL_DEBUG_CSE
+    const Int numChildren = info.children.size();
+    vector<Matrix<Field>> childUpdates( numChildren );
+    for( Int c=0; c<numChildren; ++c )
+        ApplyAdjointQFront
+        ( *info.children[c], *front.children[c], B, C, childUpdates[c] );
+
+    const Int numRHS = B.Width();
+    const Int numRows = front.rows.size();
+    Matrix<Field> W;
+    Zeros( W, front.F.Height(), numRHS );
+    for( Int j=0; j<numRHS; ++j )
+        for( Int r=0; r<numRows; ++r )
+            W(r,j) = B(front.rows[r],j);
+    Int rowOff = numRows;
+    for( Int c=0; c<numChildren; ++c )
+    {
+        const Int childUpdateHeight = childUpdates[c].Height();
+        auto WChild = W( IR(rowOff,rowOff+childUpdateHeight), ALL );
+        WChild = childUpdates[c];
+        rowOff += childUpdateHeight;
+    }
+
+    if( front.F.Width() > 0 )
+        ApplyQ
+        ( LEFT, ADJOINT, front.F, front.householderScalars, front.signature,
+          W );
+
+    for( Int j=0; j<numRHS; ++j )
+        for( Int i=0; i<front.numPivots; ++i )
+            C(info.off+front.pivotOrder[i],j) = W(i,j);
+    update = W( IR(front.numPivots,front.numPivots+front.numUpdates), ALL );
+}
+
+template<typename Field>
+void ApplyQFront
+( const ldl::NodeInfo& info,
+  const SparseFront<Field>& front,
+  const Matrix<Field>& C,
+  const Matrix<Field>& update,
+        Matrix<Field>& B )
+{
+    EL_DEBUG_CSE
+    const Int numRHS = C.Width();
+    Matrix<Field> W;
+    Zeros( W, front.F.Height(), numRHS );
+    for( Int j=0; j<numRHS; ++j )
+        for( Int i=0; i<front.numPivots; ++i )
+            W(i,j) = C(info.off+front.pivotOrder[i],j);
+    if( front.numUpdates > 0 )
+    {
+        auto WUpdate =
+          W( IR(front.numPivots,front.numPivots+front.numUpdates), ALL );
+        WUpdate = update;
+    }
+
+    if( front.F.Width() > 0 )
+        ApplyQ
+        ( LEFT, NORMAL, front.F, front.householderScalars, front.signature,
+          W );
+
+    const Int numRows = front.rows.size();
+    for( Int j=0; j<numRHS; ++j )
+        for( Int r=0; r<numRows; ++r )
+            B(front.rows[r],j) = W(r,j);
+
+    Int rowOff = numRows;
+    const Int numChildren = info.children.size();
+    for( Int c=0; c<numChildren; ++c )
+    {
+        const Int childUpdateHeight = front.children[c]->numUpdates;
+        auto childUpdate = W( IR(rowOff,rowOff+childUpdateHeight), ALL );
+        ApplyQFront( *info.children[c], *front.children[c], C, childUpdate, B );
+        rowOff += childUpdateHeight;
+    }
+}
+
+} // anonymous namespace
+
+} // namespace qr
+
+template<typename Field>
+SparseQRFactorization<Field>::SparseQRFactorization() { }
+
+template<typename Field>
+void SparseQRFactorization<Field>::Factor
+( const SparseMatrix<Field>& A, const BisectCtrl& bisectCtrl )
+{
+    EL_DEBUG_CSE
+    height_ = A.Height();
+    width_ = A.Width();
+
+    // Reorder the columns using the graph of A^H A
+    Graph graph;
+    qr::FormNormalGraph( A, graph );
+    info_.reset( new ldl::NodeInfo );
+    separator_.reset( new ldl::Separator );
+    if( ldl::UseMinimumDegree( width_, bisectCtrl ) )
+        ldl::MinimumDegree( graph, map_, *separator_, *info_, bisectCtrl );
+    else
+        ldl::NestedDissection( graph, map_, *separator_, *info_, bisectCtrl );
+    InvertMap( map_, inverseMap_ );
+
+    // Assign each nonzero row of A to the front of its first column
+    front_.reset( new qr::SparseFront<Field> );
+    vector<qr::SparseFront<Field>*> frontOfIndex( width_ );
+    qr::BuildFronts( *info_, *front_, frontOfIndex );
+    const Int* rowOffsets = A.LockedOffsetBuffer();
+    const Int* colBuf = A.LockedTargetBuffer();
+    for( Int i=0; i<height_; ++i )
+    {
+        if( rowOffsets[i] == rowOffsets[i+1] )
+            continue;
+        Int first = width_;
+        for( Int e=rowOffsets[i]; e<rowOffsets[i+1]; ++e )
+            first = Min( first, map_[colBuf[e]] );
+        frontOfIndex[first]->rows.push_back( i );
+    }
+
+    // Columns are treated as dependent relative to the largest column norm
+    typedef Base<Field> Real;
+    vector<Real> colNormsSquared( width_, Real(0) );
+    const Field* valBuf = A.LockedValueBuffer();
+    const Int numEntries = A.NumEntries();
+    for( Int e=0; e<numEntries; ++e )
+        colNormsSquared[colBuf[e]] += RealPart(valBuf[e]*Conj(valBuf[e]));
+    maxColNorm_ = 0;
+    for( Int j=0; j<width_; ++j )
+        maxColNorm_ = Max( maxColNorm_, Sqrt(colNormsSquared[j]) );
+
+    qr::FactorFront( A, map_, *info_, *front_, DependenceTolerance() );
+
+
+    factored_ = true;
+}
+
+template<typename Field>
+Base<Field> SparseQRFactorization<Field>::DependenceTolerance() const
+{
+    typedef Base<Field> Real;
+    const Real tol = ( rankTol_ > Real(0) ? rankTol_ :
+      20*(height_+width_)*limits::Epsilon<Real>() );
+    return tol*maxColNorm_;
+}
+
+template<typename Field>
+bool SparseQRFactorization<Field>::Dependent( const Field& diagonal ) const
+{ return Abs(diagonal) <= DependenceTolerance(); }
+
+template<typename Field>
+void SparseQRFactorization<Field>::ApplyAdjointQ
+( const Matrix<Field>& B, Matrix<Field>& C ) const
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( !factored_ )
+          LogicError("Sparse QR factorization has not been computed");
+      if( B.Height() != height_ )
+          LogicError("B was ",B.Height()," x ",B.Width()," but A has ",
+                     height_," rows");
+    )
+    Zeros( C, width_, B.Width() );
+    Matrix<Field> update;
+    qr::ApplyAdjointQFront( *info_, *front_, B, C, update );
+}
+
+template<typename Field>
+void SparseQRFactorization<Field>::ApplyQ
+( const Matrix<Field>& C, Matrix<Field>& B ) const
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( !factored_ )
+          LogicError("Sparse QR factorization has not been computed");
+      if( C.Height() != width_ )
+          LogicError("C was ",C.Height()," x ",C.Width()," but A has ",
+                     width_," columns");
+    )
+    Zeros( B, height_, C.Width() );
+    Matrix<Field> update;
+    qr::ApplyQFront( *info_, *front_, C, update, B );
+}
+
+template<typename Field>
+void SparseQRFactorization<Field>::SolveAgainstR
+( Orientation orientation, Matrix<Field>& C ) const
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( !factored_ )
+          LogicError("Sparse QR factorization has not been computed");
+      if( C.Height() != width_ )
+          LogicError("C was ",C.Height()," x ",C.Width()," but A has ",
+                     width_," columns");
+    )
+    const Int numRHS = C.Width();
+    const bool conjugate = ( orientation == ADJOINT );
+    auto op =
+      [&]( const Field& alpha ) { return conjugate ? Conj(alpha) : alpha; };
+
+    // The front is triangular solved in place unless one of its diagonal
+    // entries is negligible, in which case the coefficient of its column is
+    // zeroed
+    auto solveDiagonalBlock =
+      [&]( const Matrix<Field>& R11, Matrix<Field>& C1 )
+      {
+        const Int numPivots = R11.Height();
+        bool dependent = false;
+        for( Int i=0; i<numPivots; ++i )
+            if( Dependent(R11(i,i)) )
+                dependent = true;
+        if( !dependent )
+        {
+            Trsm
+            ( LEFT, UPPER, orientation, NON_UNIT, Field(1), R11, C1, true );
+            return;
+        }
+        if( orientation == NORMAL )
+        {
+            for( Int i=numPivots-1; i>=0; --i )
+            {
+                const Field delta = R11(i,i);
+                const bool zero = Dependent(delta);
+                for( Int j=0; j<numRHS; ++j )
+                {
+                    if( zero )
+                        C1(i,j) = 0;
+                    else
+                        C1(i,j) /= delta;
+                    for( Int l=0; l<i; ++l )
+                        C1(l,j) -= R11(l,i)*C1(i,j);
+                }
+            }
+        }
+        else
+        {
+            for( Int i=0; i<numPivots; ++i )
+            {
+                const Field delta = op(R11(i,i));
+                const bool zero = Dependent(delta);
+                for( Int j=0; j<numRHS; ++j )
+                {
+                    if( zero )
+                        C1(i,j) = 0;
+                    else
+                        C1(i,j) /= delta;
+                    for( Int l=i+1; l<numPivots; ++l )
+                        C1(l,j) -= op(R11(i,l))*C1(i,j);
+                }
+            }
+        }
+      };
+
+    Matrix<Field> CLower, CNode;
+    function<void(const ldl::NodeInfo&,const qr::SparseFront<Field>&)>
+      solve =
+      [&]( const ldl::NodeInfo& info, const qr::SparseFront<Field>& front )
+      {
+        const Int numChildren = info.children.size();
+        if( orientation != NORMAL )
+            for( Int c=0; c<numChildren; ++c )
+                solve( *info.children[c], *front.children[c] );
+
+        const Int size = info.size;
+        const Int updateSize = info.lowerStruct.size();
+        const Int numPivots = front.numPivots;
+        auto R11 = front.F( IR(0,numPivots), IR(0,numPivots) );
+        auto R12 = front.F( IR(0,numPivots), IR(size,size+updateSize) );
+
+        Zeros( CLower, updateSize, numRHS );
+        CNode.Resize( numPivots, numRHS );
+        for( Int j=0; j<numRHS; ++j )
+            for( Int i=0; i<numPivots; ++i )
+                CNode(i,j) = C(info.off+front.pivotOrder[i],j);
+        if( orientation == NORMAL )
+        {
+            // Eliminate the (already solved) coefficients of the ancestors
+            for( Int j=0; j<numRHS; ++j )
+                for( Int i=0; i<updateSize; ++i )
+                    CLower(i,j) = C(info.lowerStruct[i],j);
+            Gemm( NORMAL, NORMAL, Field(-1), R12, CLower, Field(1), CNode );
+            solveDiagonalBlock( R11, CNode );
+        }
+        else
+        {
+            // Solve and then update the coefficients of the ancestors
+            solveDiagonalBlock( R11, CNode );
+            Gemm( orientation, NORMAL, Field(-1), R12, CNode, CLower );
+            for( Int j=0; j<numRHS; ++j )
+                for( Int i=0; i<updateSize; ++i )
+                    C(info.lowerStruct[i],j) += CLower(i,j);
+        }
+        auto CNodeFull = C( IR(info.off,info.off+size), ALL );
+        Zero( CNodeFull );
+        for( Int j=0; j<numRHS; ++j )
+            for( Int i=0; i<numPivots; ++i )
+                C(info.off+front.pivotOrder[i],j) = CNode(i,j);
+
+        if( orientation == NORMAL )
+            for( Int c=0; c<numChildren; ++c )
+                solve( *info.children[c], *front.children[c] );
+      };
+    solve( *info_, *front_ );
+}
+
+template<typename Field>
+void SparseQRFactorization<Field>::PermuteToOriginal( Matrix<Field>& C ) const
+{
+    EL_DEBUG_CSE
+    Matrix<Field> CReordered( C );
+    const Int numRHS = C.Width();
+    for( Int j=0; j<numRHS; ++j )
+        for( Int i=0; i<width_; ++i )
+            C(i,j) = CReordered(map_[i],j);
+}
+
+template<typename Field>
+void SparseQRFactorization<Field>::PermuteToReordered( Matrix<Field>& C ) const
+{
+    EL_DEBUG_CSE
+    Matrix<Field> COrig( C );
+    const Int numRHS = C.Width();
+    for( Int j=0; j<numRHS; ++j )
+        for( Int i=0; i<width_; ++i )
+            C(map_[i],j) = COrig(i,j);
+}
+
+template<typename Field>
+void SparseQRFactorization<Field>::LeastSquares
+( const Matrix<Field>& B, Matrix<Field>& X ) const
+{
+    EL_DEBUG_CSE
+    ApplyAdjointQ( B, X );
+    SolveAgainstR( NORMAL, X );
+    PermuteToOriginal( X );
+}
+
+template<typename Field>
+void SparseQRFactorization<Field>::MinimumNorm
+( const Matrix<Field>& B, Matrix<Field>& X ) const
+{
+    EL_DEBUG_CSE
+    Matrix<Field> C( B );
+    PermuteToReordered( C );
+    SolveAgainstR( ADJOINT, C );
+    ApplyQ( C, X );
+}
+
+template<typename Field>
+void SparseQRFactorization<Field>::ExplicitR( SparseMatrix<Field>& R ) const
+{
+    EL_DEBUG_CSE
+    Zeros( R, width_, width_ );
+    R.Reserve( NumEntries() );
+    function<void(const ldl::NodeInfo&,const qr::SparseFront<Field>&)>
+      queue =
+      [&]( const ldl::NodeInfo& info, const qr::SparseFront<Field>& front )
+      {
+        const Int numChildren = info.children.size();
+        for( Int c=0; c<numChildren; ++c )
+            queue( *info.children[c], *front.children[c] );
+        const Int width = front.F.Width();
+        for( Int j=0; j<width; ++j )
+        {
+            const Int relInd = ( j < info.size ? front.pivotOrder[j] : j );
+            const Int col = inverseMap_[qr::FrontIndex(info,relInd)];
+            for( Int i=0; i<Min(j+1,front.numPivots); ++i )
+            {
+                const Field value = front.F(i,j);
+                if( value != Field(0) )
+                    R.QueueUpdate
+                    ( info.off+front.pivotOrder[i], col, value );
+            }
+        }
+      };
+    queue( *info_, *front_ );
+    R.ProcessQueues();
+}
+
+template<typename Field>
+void SparseQRFactorization<Field>::SetRankTolerance( Base<Field> tol )
+{ rankTol_ = tol; }
+
+template<typename Field>
+Int SparseQRFactorization<Field>::Rank() const
+{
+    EL_DEBUG_CSE
+    Int rank = 0;
+    function<void(const qr::SparseFront<Field>&)> count =
+      [&]( const qr::SparseFront<Field>& front )
+      {
+          for( const auto& child : front.children )
+              count( *child );
+          for( Int i=0; i<front.numPivots; ++i )
+              if( !Dependent(front.F(i,i)) )
+                  ++rank;
+      };
+    count( *front_ );
+    return rank;
+}
+
+template<typename Field>
+Int SparseQRFactorization<Field>::Height() const { return height_; }
+template<typename Field>
+Int SparseQRFactorization<Field>::Width() const { return width_; }
+template<typename Field>
+bool SparseQRFactorization<Field>::Factored() const { return factored_; }
+
+template<typename Field>
+Int SparseQRFactorization<Field>::NumEntries() const
+{
+    EL_DEBUG_CSE
+    Int numEntries = 0;
+    function<void(const qr::SparseFront<Field>&)> count =
+      [&]( const qr::SparseFront<Field>& front )
+      {
+          for( const auto& child : front.children )
+              count( *child );
+          const Int width = front.F.Width();
+          for( Int j=0; j<width; ++j )
+              numEntries += Min(j+1,front.numPivots);
+      };
+    count( *front_ );
+    return numEntries;
+}
+
+template<typename Field>
+const ldl::NodeInfo& SparseQRFactorization<Field>::NodeInfo() const
+{ return *info_; }
+
+template<typename Field>
+const qr::SparseFront<Field>& SparseQRFactorization<Field>::Front() const
+{ return *front_; }
+
+template<typename Field>
+const vector<Int>& SparseQRFactorization<Field>::Map() const
+{ return map_; }
+
+template<typename Field>
+const vector<Int>& SparseQRFactorization<Field>::InverseMap() const
+{ return inverseMap_; }
+
+#define PROTO(Field) \
+  template struct qr::SparseFront<Field>; \
+  template class SparseQRFactorization<Field>;
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
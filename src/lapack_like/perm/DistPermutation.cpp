@@ -12,6 +12,10 @@ namespace El {
 
 namespace {
 
+// Distinguish the point-to-point messages of split-phase permutations from
+// any others posted on the same communicator before they are finished
+const int exchangeTag = 7;
+
 template<typename T>
 void PermuteCols
 (       AbstractDistMatrix<T>& A,
@@ -336,6 +340,9 @@ void DistPermutation::Empty()
     invPerm_.Empty();
     staleInverse_ = false;
 
+    swapPerm_.Empty();
+    swapInvPerm_.Empty();
+    staleSwapPerm_ = true;
     rowMeta_.clear();
     colMeta_.clear();
     staleMeta_ = false;
@@ -362,6 +369,7 @@ void DistPermutation::MakeIdentity( Int size )
 
     numSwaps_ = 0;
     implicitSwapOrigins_ = true;
+    staleMeta_ = true;
 }
 
 void DistPermutation::ReserveSwaps( Int maxSwaps )
@@ -400,6 +408,7 @@ void DistPermutation::Swap( Int origin, Int dest )
         staleMeta_ = true;
         return;
     }
+    staleMeta_ = true;
 
     if( !implicitSwapOrigins_ )
     {
@@ -614,6 +623,7 @@ const DistPermutation& DistPermutation::operator=( const Permutation& P )
     parity_ = P.parity_;
     staleParity_ = P.staleParity_;
     staleInverse_ = P.staleInverse_;
+    staleSwapPerm_ = true;
     staleMeta_ = true;
 
     return *this;
@@ -639,6 +649,7 @@ const DistPermutation& DistPermutation::operator=( const DistPermutation& P )
     staleParity_ = P.staleParity_;
     staleInverse_ = P.staleInverse_;
 
+    staleSwapPerm_ = true;
     colMeta_ = P.colMeta_;
     rowMeta_ = P.rowMeta_;
     staleMeta_ = P.staleMeta_;
@@ -720,263 +731,199 @@ const DistMatrix<Int,VC,STAR> DistPermutation::SwapDestinations() const
     return swapDests_(IR(0,numSwaps_),ALL);
 }
 
-template<typename T>
-void DistPermutation::PermuteCols( AbstractDistMatrix<T>& A, Int offset ) const
+void DistPermutation::FormSwapPermutation() const
 {
     EL_DEBUG_CSE
-    // TODO(poulson): Use an (MC,MR) proxy for A?
-    if( swapSequence_ )
-    {
-        const Int height = A.Height();
-        const Int width = A.Width();
-        if( height == 0 || width == 0 )
-            return;
-
-        auto activeInd = IR(0,numSwaps_);
-
-        // TODO(poulson): Introduce an std::map for caching the pivots this
-        // process needs to care about to avoid redundant [STAR,STAR] formations
-        //
-        // TODO(poulson): Decide on the data structure; an std::vector of pivot
-        // origins and destinations?
+    staleSwapPerm_ = false;
+    monotoneSwaps_ = false;
+    if( !swapSequence_ || !implicitSwapOrigins_ )
+        return;
 
-        DistMatrix<Int,STAR,STAR> dests_STAR_STAR( swapDests_(activeInd,ALL) );
-        auto& destsLoc = dests_STAR_STAR.Matrix();
-        if( implicitSwapOrigins_ )
+    const Int numSwaps = numSwaps_;
+    DistMatrix<Int,STAR,STAR> dests_STAR_STAR =
+      swapDests_(IR(0,numSwaps),ALL);
+    auto& destsLoc = dests_STAR_STAR.LockedMatrix();
+    for( Int j=0; j<numSwaps; ++j )
+        if( destsLoc(j) < j )
+            return;
+    monotoneSwaps_ = true;
+
+    // Track which original row lies in each position. The positions beyond
+    // the swap range are only ever occupied by rows from within the range.
+    vector<Int> rowAt( numSwaps );
+    for( Int j=0; j<numSwaps; ++j )
+        rowAt[j] = j;
+    std::map<Int,Int> outerRowAt;
+    for( Int j=0; j<numSwaps; ++j )
+    {
+        const Int dest = destsLoc(j);
+        if( dest < numSwaps )
         {
-            for( Int j=0; j<numSwaps_; ++j )
-            {
-                const Int origin = j+offset;
-                const Int dest = destsLoc(j)+offset;
-                ColSwap( A, origin, dest );
-            }
+            std::swap( rowAt[j], rowAt[dest] );
         }
         else
         {
-            DistMatrix<Int,STAR,STAR> origins_STAR_STAR =
-              swapOrigins_(activeInd,ALL);
-            auto& originsLoc = origins_STAR_STAR.Matrix();
-            for( Int j=0; j<numSwaps_; ++j )
-            {
-                const Int origin = originsLoc(j)+offset;
-                const Int dest = destsLoc(j)+offset;
-                ColSwap( A, origin, dest );
-            }
+            auto it = outerRowAt.find( dest );
+            const Int destRow = ( it == outerRowAt.end() ? dest : it->second );
+            outerRowAt[dest] = rowAt[j];
+            rowAt[j] = destRow;
         }
     }
-    else
-    {
-        if( offset != 0 )
-            LogicError
-            ("General permutations are not supported with nonzero offsets");
-
-        if( staleMeta_ )
-        {
-            rowMeta_.clear();
-            colMeta_.clear();
-            staleMeta_ = false;
-        }
 
-        // TODO(poulson): Move El::InversePermutation into this class
-        if( staleInverse_ )
-        {
-            InvertPermutation( perm_, invPerm_ );
-            staleInverse_ = false;
-        }
-
-        // TODO(poulson): Query/maintain the unordered_map
-        const Int align = A.RowAlign();
-        mpi::Comm comm = A.RowComm();
-        keyType_ key = std::pair<Int,mpi::Comm>(align,comm);
-        auto data = colMeta_.find( key );
-        if( data == colMeta_.end() )
-        {
-// TODO(poulson): Enable this branch; it apparently is not possible with
-// GCC 4.7.1
-#ifdef EL_HAVE_STD_EMPLACE
-            colMeta_.emplace
-            ( std::piecewise_construct,
-              std::forward_as_tuple(key),
-              std::forward_as_tuple(perm_,invPerm_,align,comm) );
-#else
-            auto newPair =
-              std::make_pair(key,PermutationMeta(perm_,invPerm_,align,comm));
-            colMeta_.insert( newPair );
-#endif
-            data = colMeta_.find( key );
-        }
-        // TODO(poulson): Move El::PermuteCols into this class
-        El::PermuteCols( A, data->second );
+    swapPerm_.SetGrid( *grid_ );
+    swapInvPerm_.SetGrid( *grid_ );
+    swapPerm_.Resize( numSwaps, 1 );
+    swapInvPerm_.Resize( numSwaps, 1 );
+    auto& permLoc = swapPerm_.Matrix();
+    auto& invPermLoc = swapInvPerm_.Matrix();
+    for( Int j=0; j<numSwaps; ++j )
+    {
+        permLoc(j) = rowAt[j];
+        if( rowAt[j] < numSwaps )
+            invPermLoc(rowAt[j]) = j;
     }
+    for( const auto& entry : outerRowAt )
+        invPermLoc(entry.second) = entry.first;
 }
 
-template<typename T>
-void DistPermutation::InversePermuteCols
-( AbstractDistMatrix<T>& A, Int offset ) const
+const PermutationMeta*
+DistPermutation::Meta( bool rows, Int align, mpi::Comm comm ) const
 {
     EL_DEBUG_CSE
-    // TODO(poulson): Use an (MC,MR) proxy for A?
-    if( swapSequence_ )
+    if( staleMeta_ )
     {
-        const Int height = A.Height();
-        const Int width = A.Width();
-        if( height == 0 || width == 0 )
-            return;
+        rowMeta_.clear();
+        colMeta_.clear();
+        staleSwapPerm_ = true;
+        staleMeta_ = false;
+    }
 
-        auto activeInd = IR(0,numSwaps_);
+    auto& metaMap = ( rows ? rowMeta_ : colMeta_ );
+    keyType_ key = std::pair<Int,mpi::Comm>(align,comm);
+    auto data = metaMap.find( key );
+    if( data != metaMap.end() )
+        return &data->second;
 
-        DistMatrix<Int,STAR,STAR> dests_STAR_STAR( swapDests_(activeInd,ALL) );
-        auto& destsLoc = dests_STAR_STAR.Matrix();
-        if( implicitSwapOrigins_ )
-        {
-            for( Int j=numSwaps_-1; j>=0; --j )
-            {
-                const Int origin = j+offset;
-                const Int dest = destsLoc(j)+offset;
-                ColSwap( A, origin, dest );
-            }
-        }
-        else
-        {
-            DistMatrix<Int,STAR,STAR> origins_STAR_STAR =
-              swapOrigins_(activeInd,ALL);
-            auto& originsLoc = origins_STAR_STAR.Matrix();
-            for( Int j=numSwaps_-1; j>=0; --j )
-            {
-                const Int origin = originsLoc(j)+offset;
-                const Int dest = destsLoc(j)+offset;
-                ColSwap( A, origin, dest );
-            }
-        }
+    if( swapSequence_ )
+    {
+        if( staleSwapPerm_ )
+            FormSwapPermutation();
+        if( !monotoneSwaps_ )
+            return nullptr;
+        auto newPair =
+          std::make_pair
+          (key,PermutationMeta(swapPerm_,swapInvPerm_,align,comm));
+        metaMap.insert( newPair );
     }
     else
     {
-        if( offset != 0 )
-            LogicError
-            ("General permutations are not supported with nonzero offsets");
-
-        if( staleMeta_ )
-        {
-            rowMeta_.clear();
-            colMeta_.clear();
-            staleMeta_ = false;
-        }
-
         // TODO(poulson): Move El::InversePermutation into this class
         if( staleInverse_ )
         {
             InvertPermutation( perm_, invPerm_ );
             staleInverse_ = false;
         }
-
-        // TODO(poulson): Query/maintain the unordered_map
-        const Int align = A.RowAlign();
-        mpi::Comm comm = A.RowComm();
-        keyType_ key = std::pair<Int,mpi::Comm>(align,comm);
-        auto data = colMeta_.find( key );
-        if( data == colMeta_.end() )
-        {
 // TODO(poulson): Enable this branch; it apparently is not possible with
 // GCC 4.7.1
 #ifdef EL_HAVE_STD_EMPLACE
-            colMeta_.emplace
-            ( std::piecewise_construct,
-              std::forward_as_tuple(key),
-              std::forward_as_tuple(perm_,invPerm_,align,comm) );
+        metaMap.emplace
+        ( std::piecewise_construct,
+          std::forward_as_tuple(key),
+          std::forward_as_tuple(perm_,invPerm_,align,comm) );
 #else
-            auto newPair =
-              std::make_pair(key,PermutationMeta(perm_,invPerm_,align,comm));
-            colMeta_.insert( newPair );
+        auto newPair =
+          std::make_pair(key,PermutationMeta(perm_,invPerm_,align,comm));
+        metaMap.insert( newPair );
 #endif
-            data = colMeta_.find( key );
-        }
-        // TODO(poulson): Move El::PermuteCols into this class
-        El::PermuteCols( A, data->second, true );
     }
+    return &metaMap.find( key )->second;
 }
 
 template<typename T>
-void DistPermutation::PermuteRows( AbstractDistMatrix<T>& A, Int offset ) const
+void DistPermutation::ApplySwaps
+( AbstractDistMatrix<T>& A, bool rows, bool inverse, Int offset ) const
 {
     EL_DEBUG_CSE
-    // TODO(poulson): Use an (MC,MR) proxy for A?
-    if( swapSequence_ )
+    auto activeInd = IR(0,numSwaps_);
+
+    // TODO(poulson): Introduce an std::map for caching the pivots this
+    // process needs to care about to avoid redundant [STAR,STAR] formations
+    DistMatrix<Int,STAR,STAR> dests_STAR_STAR( swapDests_(activeInd,ALL) );
+    DistMatrix<Int,STAR,STAR> origins_STAR_STAR( *grid_ );
+    if( !implicitSwapOrigins_ )
+        origins_STAR_STAR = swapOrigins_(activeInd,ALL);
+    auto& destsLoc = dests_STAR_STAR.Matrix();
+    auto& originsLoc = origins_STAR_STAR.Matrix();
+
+    for( Int k=0; k<numSwaps_; ++k )
     {
-        const Int height = A.Height();
-        const Int width = A.Width();
-        if( height == 0 || width == 0 )
-            return;
+        const Int j = ( inverse ? numSwaps_-1-k : k );
+        const Int origin =
+          ( implicitSwapOrigins_ ? j : originsLoc(j) ) + offset;
+        const Int dest = destsLoc(j)+offset;
+        if( rows )
+            El::RowSwap( A, origin, dest );
+        else
+            ColSwap( A, origin, dest );
+    }
+}
 
-        auto activeInd = IR(0,numSwaps_);
+template<typename T>
+void DistPermutation::ApplyPermutation
+( AbstractDistMatrix<T>& A, bool rows, bool inverse, Int offset ) const
+{
+    EL_DEBUG_CSE
+    // TODO(poulson): Use an (MC,MR) proxy for A?
+    if( A.Height() == 0 || A.Width() == 0 )
+        return;
+    if( !swapSequence_ && offset != 0 )
+        LogicError
+        ("General permutations are not supported with nonzero offsets");
 
-        DistMatrix<Int,STAR,STAR> dests_STAR_STAR = swapDests_(activeInd,ALL);
-        auto& destsLoc = dests_STAR_STAR.Matrix();
-        if( implicitSwapOrigins_ )
-        {
-            for( Int j=0; j<numSwaps_; ++j )
-            {
-                const Int origin = j+offset;
-                const Int dest = destsLoc(j)+offset;
-                El::RowSwap( A, origin, dest );
-            }
-        }
+    // Swap sequences are applied to the trailing portion of the matrix
+    unique_ptr<AbstractDistMatrix<T>> view;
+    AbstractDistMatrix<T>* APerm = &A;
+    if( offset != 0 )
+    {
+        view.reset( A.Construct(A.Grid(),A.Root()) );
+        if( rows )
+            View( *view, A, IR(offset,END), ALL );
         else
-        {
-            DistMatrix<Int,STAR,STAR> origins_STAR_STAR =
-              swapOrigins_(activeInd,ALL);
-            auto& originsLoc = origins_STAR_STAR.Matrix();
-            for( Int j=0; j<numSwaps_; ++j )
-            {
-                const Int origin = originsLoc(j)+offset;
-                const Int dest = destsLoc(j)+offset;
-                El::RowSwap( A, origin, dest );
-            }
-        }
+            View( *view, A, ALL, IR(offset,END) );
+        APerm = view.get();
     }
+
+    const PermutationMeta* meta =
+      ( rows ? Meta( true, APerm->ColAlign(), APerm->ColComm() )
+             : Meta( false, APerm->RowAlign(), APerm->RowComm() ) );
+    if( meta == nullptr )
+        ApplySwaps( A, rows, inverse, offset );
+    else if( rows )
+        El::PermuteRows( *APerm, *meta, inverse );
     else
-    {
-        if( offset != 0 )
-            LogicError
-            ("General permutations are not supported with nonzero offsets");
+        El::PermuteCols( *APerm, *meta, inverse );
+}
 
-        if( staleMeta_ )
-        {
-            rowMeta_.clear();
-            colMeta_.clear();
-            staleMeta_ = false;
-        }
+template<typename T>
+void DistPermutation::PermuteCols( AbstractDistMatrix<T>& A, Int offset ) const
+{
+    EL_DEBUG_CSE
+    ApplyPermutation( A, false, false, offset );
+}
 
-        // TODO(poulson): Move El::InversePermutation into this class
-        if( staleInverse_ )
-        {
-            InvertPermutation( perm_, invPerm_ );
-            staleInverse_ = false;
-        }
+template<typename T>
+void DistPermutation::InversePermuteCols
+( AbstractDistMatrix<T>& A, Int offset ) const
+{
+    EL_DEBUG_CSE
+    ApplyPermutation( A, false, true, offset );
+}
 
-        // TODO(poulson): Query/maintain the unordered_map
-        const Int align = A.ColAlign();
-        mpi::Comm comm = A.ColComm();
-        keyType_ key = std::pair<Int,mpi::Comm>(align,comm);
-        auto data = rowMeta_.find( key );
-        if( data == rowMeta_.end() )
-        {
-// TODO(poulson): Enable this branch; it apparently is not possible with
-// GCC 4.7.1
-#ifdef EL_HAVE_STD_EMPLACE
-            rowMeta_.emplace
-            ( std::piecewise_construct,
-              std::forward_as_tuple(key),
-              std::forward_as_tuple(perm_,invPerm_,align,comm) );
-#else
-            auto newPair =
-              std::make_pair(key,PermutationMeta(perm_,invPerm_,align,comm));
-            rowMeta_.insert( newPair );
-#endif
-            data = rowMeta_.find( key );
-        }
-        // TODO(poulson): Move El::PermuteRows into this class
-        El::PermuteRows( A, data->second );
-    }
+template<typename T>
+void DistPermutation::PermuteRows( AbstractDistMatrix<T>& A, Int offset ) const
+{
+    EL_DEBUG_CSE
+    ApplyPermutation( A, true, false, offset );
 }
 
 template<typename T>
@@ -984,86 +931,200 @@ void DistPermutation::InversePermuteRows
 ( AbstractDistMatrix<T>& A, Int offset ) const
 {
     EL_DEBUG_CSE
-    // TODO(poulson): Use an (MC,MR) proxy for A?
-    if( swapSequence_ )
-    {
-        const Int height = A.Height();
-        const Int width = A.Width();
-        if( height == 0 || width == 0 )
-            return;
+    ApplyPermutation( A, true, true, offset );
+}
 
-        auto activeInd = IR(0,numSwaps_);
+// Split-phase application
+// =======================
+template<typename T>
+void DistPermutation::StartPermutation
+( AbstractDistMatrix<T>& A,
+  PermutationExchange<T>& exchange,
+  bool rows,
+  bool inverse,
+  Int offset ) const
+{
+    EL_DEBUG_CSE
+    if( exchange.Active() )
+        LogicError("The previous exchange was not yet finished");
+    if( A.Height() == 0 || A.Width() == 0 )
+        return;
+    if( !swapSequence_ && offset != 0 )
+        LogicError
+        ("General permutations are not supported with nonzero offsets");
 
-        DistMatrix<Int,STAR,STAR> dests_STAR_STAR = swapDests_(activeInd,ALL);
-        auto& destsLoc = dests_STAR_STAR.Matrix();
-        if( implicitSwapOrigins_ )
-        {
-            for( Int j=numSwaps_-1; j>=0; --j )
-            {
-                const Int origin = j+offset;
-                const Int dest = destsLoc(j)+offset;
-                El::RowSwap( A, origin, dest );
-            }
-        }
+    AbstractDistMatrix<T>* APerm = &A;
+    exchange.view.reset();
+    if( offset != 0 )
+    {
+        exchange.view.reset( A.Construct(A.Grid(),A.Root()) );
+        if( rows )
+            View( *exchange.view, A, IR(offset,END), ALL );
         else
-        {
-            DistMatrix<Int,STAR,STAR> origins_STAR_STAR =
-              swapOrigins_(activeInd,ALL);
-            auto& originsLoc = origins_STAR_STAR.Matrix();
-            for( Int j=numSwaps_-1; j>=0; --j )
-            {
-                const Int origin = originsLoc(j)+offset;
-                const Int dest = destsLoc(j)+offset;
-                El::RowSwap( A, origin, dest );
-            }
-        }
+            View( *exchange.view, A, ALL, IR(offset,END) );
+        APerm = exchange.view.get();
     }
-    else
+
+    const PermutationMeta* meta =
+      ( rows ? Meta( true, APerm->ColAlign(), APerm->ColComm() )
+             : Meta( false, APerm->RowAlign(), APerm->RowComm() ) );
+    if( meta == nullptr )
     {
-        if( offset != 0 )
-            LogicError
-            ("General permutations are not supported with nonzero offsets");
+        exchange.view.reset();
+        ApplySwaps( A, rows, inverse, offset );
+        return;
+    }
+    if( !APerm->Participating() )
+    {
+        exchange.view.reset();
+        return;
+    }
 
-        if( staleMeta_ )
+    exchange.A = APerm;
+    exchange.rows = rows;
+    exchange.inverse = inverse;
+    exchange.meta = *meta;
+    const Int length = ( rows ? APerm->LocalWidth() : APerm->LocalHeight() );
+    exchange.meta.ScaleUp( length );
+
+    // The inverse permutation simply reverses the roles of the sends and recvs
+    const auto& m = exchange.meta;
+    const auto& sendIdx = ( inverse ? m.recvIdx : m.sendIdx );
+    const auto& sendRanks = ( inverse ? m.recvRanks : m.sendRanks );
+    const auto& sendCounts = ( inverse ? m.recvCounts : m.sendCounts );
+    const auto& sendDispls = ( inverse ? m.recvDispls : m.sendDispls );
+    const auto& recvCounts = ( inverse ? m.sendCounts : m.recvCounts );
+    const auto& recvDispls = ( inverse ? m.sendDispls : m.recvDispls );
+    const int totalSend = sendCounts.back() + sendDispls.back();
+    const int totalRecv = recvCounts.back() + recvDispls.back();
+
+    // Pack the send data
+    const T* ABuf = APerm->LockedBuffer();
+    const Int ALDim = APerm->LDim();
+    FastResize( exchange.sendBuf, totalSend );
+    FastResize( exchange.recvBuf, totalRecv );
+    auto offsets = sendDispls;
+    const int numSends = sendIdx.size();
+    for( int send=0; send<numSends; ++send )
+    {
+        const int index = sendIdx[send];
+        const int rank = sendRanks[send];
+        if( rows )
+            StridedMemCopy
+            ( &exchange.sendBuf[offsets[rank]], 1,
+              &ABuf[index], ALDim, length );
+        else
+            MemCopy
+            ( &exchange.sendBuf[offsets[rank]], &ABuf[index*ALDim], length );
+        offsets[rank] += length;
+    }
+
+    // Post the nonblocking exchange, directly copying the local portion
+    const int commSize = mpi::Size( m.comm );
+    const int commRank = mpi::Rank( m.comm );
+    exchange.requests.clear();
+    exchange.requests.reserve( 2*commSize );
+    for( int q=0; q<commSize; ++q )
+    {
+        if( q == commRank )
         {
-            rowMeta_.clear();
-            colMeta_.clear();
-            staleMeta_ = false;
+            MemCopy
+            ( &exchange.recvBuf[recvDispls[q]],
+              &exchange.sendBuf[sendDispls[q]], recvCounts[q] );
+            continue;
         }
-
-        // TODO(poulson): Move El::InversePermutation into this class
-        if( staleInverse_ )
+        if( recvCounts[q] > 0 )
         {
-            InvertPermutation( perm_, invPerm_ );
-            staleInverse_ = false;
+            exchange.requests.emplace_back();
+            mpi::TaggedIRecv
+            ( &exchange.recvBuf[recvDispls[q]], recvCounts[q], q,
+              exchangeTag, m.comm, exchange.requests.back() );
         }
-
-        // TODO(poulson): Query/maintain the unordered_map
-        const Int align = A.ColAlign();
-        mpi::Comm comm = A.ColComm();
-        keyType_ key = std::pair<Int,mpi::Comm>(align,comm);
-        auto data = rowMeta_.find( key );
-        if( data == rowMeta_.end() )
+        if( sendCounts[q] > 0 )
         {
-// TODO(poulson): Enable this branch; it apparently is not possible with
-// GCC 4.7.1
-#ifdef EL_HAVE_STD_EMPLACE
-            rowMeta_.emplace
-            ( std::piecewise_construct,
-              std::forward_as_tuple(key),
-              std::forward_as_tuple(perm_,invPerm_,align,comm) );
-#else
-            auto newPair =
-              std::make_pair(key,PermutationMeta(perm_,invPerm_,align,comm));
-            rowMeta_.insert( newPair );
-#endif
-            data = rowMeta_.find( key );
+            exchange.requests.emplace_back();
+            mpi::TaggedISend
+            ( &exchange.sendBuf[sendDispls[q]], sendCounts[q], q,
+              exchangeTag, m.comm, exchange.requests.back() );
         }
-        // TODO(poulson): Move El::PermuteRows into this class
-        El::PermuteRows( A, data->second, true );
     }
 }
 
+template<typename T>
+void DistPermutation::StartPermuteCols
+( AbstractDistMatrix<T>& A, PermutationExchange<T>& exchange, Int offset ) const
+{
+    EL_DEBUG_CSE
+    StartPermutation( A, exchange, false, false, offset );
+}
+
+template<typename T>
+void DistPermutation::StartInversePermuteCols
+( AbstractDistMatrix<T>& A, PermutationExchange<T>& exchange, Int offset ) const
+{
+    EL_DEBUG_CSE
+    StartPermutation( A, exchange, false, true, offset );
+}
+
+template<typename T>
+void DistPermutation::StartPermuteRows
+( AbstractDistMatrix<T>& A, PermutationExchange<T>& exchange, Int offset ) const
+{
+    EL_DEBUG_CSE
+    StartPermutation( A, exchange, true, false, offset );
+}
+
+template<typename T>
+void DistPermutation::StartInversePermuteRows
+( AbstractDistMatrix<T>& A, PermutationExchange<T>& exchange, Int offset ) const
+{
+    EL_DEBUG_CSE
+    StartPermutation( A, exchange, true, true, offset );
+}
+
+template<typename T>
+void DistPermutation::FinishPermutation
+( PermutationExchange<T>& exchange ) const
+{
+    EL_DEBUG_CSE
+    if( !exchange.Active() )
+        return;
+    mpi::WaitAll( exchange.requests.size(), exchange.requests.data() );
+
+    const bool rows = exchange.rows;
+    const bool inverse = exchange.inverse;
+    const auto& m = exchange.meta;
+    const auto& recvIdx = ( inverse ? m.sendIdx : m.recvIdx );
+    const auto& recvRanks = ( inverse ? m.sendRanks : m.recvRanks );
+    const auto& recvDispls = ( inverse ? m.sendDispls : m.recvDispls );
+
+    auto& A = *exchange.A;
+    T* ABuf = A.Buffer();
+    const Int ALDim = A.LDim();
+    const Int length = ( rows ? A.LocalWidth() : A.LocalHeight() );
+    auto offsets = recvDispls;
+    const int numRecvs = recvIdx.size();
+    for( int recv=0; recv<numRecvs; ++recv )
+    {
+        const int index = recvIdx[recv];
+        const int rank = recvRanks[recv];
+        if( rows )
+            StridedMemCopy
+            ( &ABuf[index], ALDim,
+              &exchange.recvBuf[offsets[rank]], 1, length );
+        else
+            MemCopy
+            ( &ABuf[index*ALDim], &exchange.recvBuf[offsets[rank]], length );
+        offsets[rank] += length;
+    }
+
+    exchange.A = nullptr;
+    exchange.view.reset();
+    exchange.requests.clear();
+    SwapClear( exchange.sendBuf );
+    SwapClear( exchange.recvBuf );
+}
+
 template<typename T>
 void DistPermutation::PermuteSymmetrically
 ( UpperOrLower uplo,
@@ -1241,6 +1302,24 @@ void DistPermutation::ExplicitMatrix( AbstractDistMatrix<Int>& P ) const
   template void DistPermutation::InversePermuteRows \
   ( AbstractDistMatrix<T>& A, \
     Int offset ) const; \
+  template void DistPermutation::StartPermuteCols \
+  ( AbstractDistMatrix<T>& A, \
+    PermutationExchange<T>& exchange, \
+    Int offset ) const; \
+  template void DistPermutation::StartInversePermuteCols \
+  ( AbstractDistMatrix<T>& A, \
+    PermutationExchange<T>& exchange, \
+    Int offset ) const; \
+  template void DistPermutation::StartPermuteRows \
+  ( AbstractDistMatrix<T>& A, \
+    PermutationExchange<T>& exchange, \
+    Int offset ) const; \
+  template void DistPermutation::StartInversePermuteRows \
+  ( AbstractDistMatrix<T>& A, \
+    PermutationExchange<T>& exchange, \
+    Int offset ) const; \
+  template void DistPermutation::FinishPermutation \
+  ( PermutationExchange<T>& exchange ) const; \
   template void DistPermutation::PermuteSymmetrically \
   ( UpperOrLower uplo, \
     AbstractDistMatrix<T>& A, \
@@ -0,0 +1,466 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+
+namespace amg {
+
+template<typename Field>
+Level<Field>::Level( const El::Grid& grid )
+: A(grid), P(grid), R(grid)
+{ }
+
+namespace {
+
+// Overwrite 'invDiag' with the inverse of the local diagonal of A
+template<typename Field>
+void LocalInverseDiagonal
+( const DistSparseMatrix<Field>& A, Matrix<Field>& invDiag )
+{
+    EL_DEBUG_CSE
+    const Int localHeight = A.LocalHeight();
+    const Int firstLocalRow = A.FirstLocalRow();
+    const Int* offsetBuf = A.LockedOffsetBuffer();
+    const Int* colBuf = A.LockedTargetBuffer();
+    const Field* valBuf = A.LockedValueBuffer();
+    Zeros( invDiag, localHeight, 1 );
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        const Int i = firstLocalRow + iLoc;
+        for( Int e=offsetBuf[iLoc]; e<offsetBuf[iLoc+1]; ++e )
+            if( colBuf[e] == i )
+                invDiag(iLoc) += valBuf[e];
+        if( invDiag(iLoc) == Field(0) )
+            LogicError("AMG requires a nonzero diagonal, but a_ii = 0 for ",i);
+        invDiag(iLoc) = Field(1) / invDiag(iLoc);
+    }
+}
+
+// D := alpha inv(D) R + beta D
+template<typename Field>
+void DiagonalUpdate
+( Field alpha,
+  const Matrix<Field>& invDiag,
+  const DistMultiVec<Field>& R,
+  Field beta,
+        DistMultiVec<Field>& D )
+{
+    EL_DEBUG_CSE
+    const Int localHeight = R.LocalHeight();
+    const Int width = R.Width();
+    const Field* invDiagBuf = invDiag.LockedBuffer();
+    const Field* RBuf = R.LockedMatrix().LockedBuffer();
+    Field* DBuf = D.Matrix().Buffer();
+    const Int RLDim = R.LockedMatrix().LDim();
+    const Int DLDim = D.Matrix().LDim();
+    for( Int j=0; j<width; ++j )
+    {
+        if( beta == Field(0) )
+        {
+            EL_PARALLEL_FOR
+            for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+                DBuf[iLoc+j*DLDim] =
+                  alpha*invDiagBuf[iLoc]*RBuf[iLoc+j*RLDim];
+        }
+        else
+        {
+            EL_PARALLEL_FOR
+            for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+                DBuf[iLoc+j*DLDim] =
+                  alpha*invDiagBuf[iLoc]*RBuf[iLoc+j*RLDim] +
+                  beta*DBuf[iLoc+j*DLDim];
+        }
+    }
+}
+
+// Estimate the spectral radius of inv(D) A with the power method
+template<typename Field>
+Base<Field> SpectralRadius
+( const DistSparseMatrix<Field>& A,
+  const Matrix<Field>& invDiag,
+  Int numIts )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int n = A.Height();
+    DistMultiVec<Field> x(A.Grid()), y(A.Grid());
+    Uniform( x, n, 1 );
+    Zeros( y, n, 1 );
+    Real lambda = 0;
+    for( Int it=0; it<Max(numIts,Int(1)); ++it )
+    {
+        const Real xNorm = FrobeniusNorm( x );
+        if( xNorm == Real(0) )
+            break;
+        Multiply( NORMAL, Field(1), A, x, Field(0), y );
+        DiagonalUpdate( Field(1)/xNorm, invDiag, y, Field(0), x );
+        lambda = FrobeniusNorm( x );
+    }
+    return lambda;
+}
+
+// Group the local rows of A into aggregates of strongly-connected rows (using
+// only the connections between local rows) and return the number of local
+// aggregates
+template<typename Field>
+Int Aggregate
+( const DistSparseMatrix<Field>& A,
+  const Matrix<Field>& invDiag,
+  Base<Field> theta,
+  vector<Int>& aggregates )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int localHeight = A.LocalHeight();
+    const Int firstLocalRow = A.FirstLocalRow();
+    const Int numLocalEntries = A.NumLocalEntries();
+    const Int* rowBuf = A.LockedSourceBuffer();
+    const Int* colBuf = A.LockedTargetBuffer();
+    const Field* valBuf = A.LockedValueBuffer();
+
+    // Form the graph of the strong connections between the local rows, i.e.,
+    // |a_ij|^2 >= theta^2 |a_ii a_jj|
+    DistGraph strength( A.Height(), A.Grid() );
+    strength.Reserve( numLocalEntries );
+    const Real thetaSquared = theta*theta;
+    for( Int e=0; e<numLocalEntries; ++e )
+    {
+        const Int iLoc = rowBuf[e] - firstLocalRow;
+        const Int jLoc = colBuf[e] - firstLocalRow;
+        if( jLoc < 0 || jLoc >= localHeight || jLoc == iLoc )
+            continue;
+        const Real absValSquared = RealPart(Conj(valBuf[e])*valBuf[e]);
+        const Real diagProd = Abs(invDiag(iLoc)*invDiag(jLoc));
+        if( absValSquared*diagProd >= thetaSquared )
+            strength.QueueLocalConnection( iLoc, colBuf[e] );
+    }
+    strength.ProcessLocalQueues();
+    const Int* offsetBuf = strength.LockedOffsetBuffer();
+    const Int* targetBuf = strength.LockedTargetBuffer();
+
+    // Phase 1: form an aggregate from each row whose strong neighborhood is
+    // not yet aggregated
+    aggregates.assign( localHeight, -1 );
+    Int numAggregates = 0;
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        if( aggregates[iLoc] != -1 || offsetBuf[iLoc] == offsetBuf[iLoc+1] )
+            continue;
+        bool free = true;
+        for( Int e=offsetBuf[iLoc]; e<offsetBuf[iLoc+1]; ++e )
+            if( aggregates[targetBuf[e]-firstLocalRow] != -1 )
+            {
+                free = false;
+                break;
+            }
+        if( !free )
+            continue;
+        aggregates[iLoc] = numAggregates;
+        for( Int e=offsetBuf[iLoc]; e<offsetBuf[iLoc+1]; ++e )
+            aggregates[targetBuf[e]-firstLocalRow] = numAggregates;
+        ++numAggregates;
+    }
+
+    // Phase 2: add each remaining row to the aggregate of a strong neighbor
+    // from the first phase (every row with a strong neighbor has one)
+    const vector<Int> firstPhase( aggregates );
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        if( aggregates[iLoc] != -1 )
+            continue;
+        for( Int e=offsetBuf[iLoc]; e<offsetBuf[iLoc+1]; ++e )
+        {
+            const Int neighbor = firstPhase[targetBuf[e]-firstLocalRow];
+            if( neighbor != -1 )
+            {
+                aggregates[iLoc] = neighbor;
+                break;
+            }
+        }
+    }
+
+    // Phase 3: isolated rows form their own aggregates
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        if( aggregates[iLoc] == -1 )
+            aggregates[iLoc] = numAggregates++;
+
+    return numAggregates;
+}
+
+// Overwrite P with the smoothed prolongator,
+//   P = (I - omega/lambda_max inv(D) A) T,
+// where column k of the tentative prolongator, T, is the normalized indicator
+// vector of aggregate k
+template<typename Field>
+void Prolongator
+( const Level<Field>& level,
+  const vector<Int>& aggregates,
+  Int numLocalAggregates,
+  Base<Field> damping,
+        DistSparseMatrix<Field>& P )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const auto& A = level.A;
+    const Grid& grid = A.Grid();
+    mpi::Comm comm = grid.Comm();
+    const Int localHeight = A.LocalHeight();
+    const Int firstLocalRow = A.FirstLocalRow();
+
+    const Int firstAggregate =
+      mpi::Scan( numLocalAggregates, comm ) - numLocalAggregates;
+    const Int numAggregates = mpi::AllReduce( numLocalAggregates, comm );
+    vector<Int> aggregateSizes( numLocalAggregates, 0 );
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        ++aggregateSizes[aggregates[iLoc]];
+
+    DistSparseMatrix<Field> T(grid);
+    T.Resize( A.Height(), numAggregates );
+    T.Reserve( localHeight );
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        const Int k = aggregates[iLoc];
+        T.QueueLocalUpdate
+        ( iLoc, firstAggregate+k, Field(1/Sqrt(Real(aggregateSizes[k]))) );
+    }
+    T.ProcessLocalQueues();
+
+    // P := T - omega/lambda_max inv(D) A T
+    Multiply( Field(1), A, T, P );
+    const Field alpha = -damping/level.lambdaMax;
+    const Int numLocalEntries = P.NumLocalEntries();
+    const Int* rowBuf = P.LockedSourceBuffer();
+    Field* valBuf = P.ValueBuffer();
+    for( Int e=0; e<numLocalEntries; ++e )
+        valBuf[e] *= alpha*level.invDiag(rowBuf[e]-firstLocalRow);
+    Axpy( Field(1), T, P );
+}
+
+} // anonymous namespace
+
+} // namespace amg
+
+template<typename Field>
+DistAMG<Field>::DistAMG() { }
+
+template<typename Field>
+void DistAMG<Field>::Setup
+( const DistSparseMatrix<Field>& A, const AMGCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( A.Height() != A.Width() )
+        LogicError("AMG requires a square matrix");
+    const Grid& grid = A.Grid();
+    const int commRank = mpi::Rank( grid.Comm() );
+    ctrl_ = ctrl;
+    levels_.clear();
+    coarseFact_.reset();
+
+    levels_.emplace_back( new amg::Level<Field>(grid) );
+    levels_.back()->A = A;
+    const Int numEntries = A.NumEntries();
+    Int totalEntries = numEntries;
+    vector<Int> aggregates;
+    Base<Field> strengthTol = ctrl.strengthTol;
+    while( true )
+    {
+        auto& level = *levels_.back();
+        const Int n = level.A.Height();
+        if( ctrl.progress && commRank == 0 )
+            Output("AMG level ",levels_.size()-1,": ",n," rows");
+        if( n <= ctrl.maxCoarseSize || Int(levels_.size()) >= ctrl.maxLevels )
+            break;
+
+        amg::LocalInverseDiagonal( level.A, level.invDiag );
+        level.lambdaMax =
+          amg::SpectralRadius( level.A, level.invDiag, ctrl.numPowerIts );
+        const Int numLocalAggregates =
+          amg::Aggregate
+          ( level.A, level.invDiag, strengthTol, aggregates );
+        const Int numAggregates =
+          mpi::AllReduce( numLocalAggregates, grid.Comm() );
+        if( numAggregates == 0 || numAggregates >= n )
+            break;
+        strengthTol /= 2;
+
+        // A_c := P^H A P
+        amg::Prolongator
+        ( level, aggregates, numLocalAggregates, ctrl.prolongatorDamping,
+          level.P );
+        Adjoint( level.P, level.R );
+        DistSparseMatrix<Field> AP(grid);
+        Multiply( Field(1), level.A, level.P, AP );
+        levels_.emplace_back( new amg::Level<Field>(grid) );
+        Multiply( Field(1), level.R, AP, levels_.back()->A );
+        totalEntries += levels_.back()->A.NumEntries();
+    }
+    operatorComplexity_ = double(totalEntries) / Max(numEntries,Int(1));
+
+    // Factor the coarsest operator
+    coarseFact_.reset( new DistSparseLDLFactorization<Field> );
+    coarseFact_->Initialize( levels_.back()->A, true );
+    coarseFact_->Factor();
+    if( ctrl.progress && commRank == 0 )
+        Output("AMG operator complexity: ",operatorComplexity_);
+}
+
+template<typename Field>
+void DistAMG<Field>::Smooth
+( const amg::Level<Field>& level,
+  const DistMultiVec<Field>& B,
+        DistMultiVec<Field>& X,
+        bool zeroInit ) const
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const auto& A = level.A;
+    const Int numSteps = ctrl_.numSmoothingSteps;
+    if( numSteps <= 0 )
+        return;
+
+    // R := B - A X
+    DistMultiVec<Field> R(B);
+    if( !zeroInit )
+        Multiply( NORMAL, Field(-1), A, X, Field(1), R );
+
+    if( ctrl_.smoother == AMG_JACOBI )
+    {
+        const Field omega = ctrl_.jacobiDamping / level.lambdaMax;
+        for( Int step=0; step<numSteps; ++step )
+        {
+            if( step > 0 )
+            {
+                R = B;
+                Multiply( NORMAL, Field(-1), A, X, Field(1), R );
+            }
+            // X := X + omega inv(D) R
+            amg::DiagonalUpdate( omega, level.invDiag, R, Field(1), X );
+        }
+    }
+    else
+    {
+        // The Chebyshev iteration for inv(D) A X = inv(D) B over the
+        // interval [lower,upper], e.g., see "Algorithm 12.1" of
+        //   Yousef Saad
+        //   "Iterative Methods for Sparse Linear Systems", 2nd edition,
+        //   SIAM, 2003.
+        const Real upper = Real(11)/Real(10)*level.lambdaMax;
+        const Real lower = upper / ctrl_.chebyshevRatio;
+        const Real theta = (upper+lower)/2;
+        const Real delta = (upper-lower)/2;
+        const Real sigma = theta / delta;
+        Real rho = 1/sigma;
+
+        // D := inv(D) R / theta
+        DistMultiVec<Field> D(B);
+        amg::DiagonalUpdate
+        ( Field(1/theta), level.invDiag, R, Field(0), D );
+        for( Int step=0; step<numSteps; ++step )
+        {
+            X += D;
+            if( step == numSteps-1 )
+                break;
+
+            // R := R - A D, D := rho_new rho D + 2 rho_new/delta inv(D) R
+            Multiply( NORMAL, Field(-1), A, D, Field(1), R );
+            const Real rhoNew = 1/(2*sigma-rho);
+            amg::DiagonalUpdate
+            ( Field(2*rhoNew/delta), level.invDiag, R, Field(rhoNew*rho), D );
+            rho = rhoNew;
+        }
+    }
+}
+
+template<typename Field>
+void DistAMG<Field>::Cycle
+( Int levelIndex,
+  const DistMultiVec<Field>& B,
+        DistMultiVec<Field>& X ) const
+{
+    EL_DEBUG_CSE
+    if( levelIndex == Int(levels_.size())-1 )
+    {
+        X = B;
+        coarseFact_->Solve( X );
+        return;
+    }
+    const auto& level = *levels_[levelIndex];
+    const auto& A = level.A;
+    const Grid& grid = A.Grid();
+    const Int width = B.Width();
+
+    // Pre-smooth from X = 0
+    X.SetGrid( grid );
+    Zeros( X, A.Height(), width );
+    Smooth( level, B, X, true );
+
+    // Correct with the coarse-grid solution of P^H A P E = P^H (B - A X)
+    DistMultiVec<Field> R(B), BCoarse(grid), XCoarse(grid);
+    Multiply( NORMAL, Field(-1), A, X, Field(1), R );
+    Zeros( BCoarse, level.R.Height(), width );
+    Multiply( NORMAL, Field(1), level.R, R, Field(0), BCoarse );
+    Cycle( levelIndex+1, BCoarse, XCoarse );
+    Multiply( NORMAL, Field(1), level.P, XCoarse, Field(1), X );
+
+    // Post-smooth
+    Smooth( level, B, X, false );
+}
+
+template<typename Field>
+void DistAMG<Field>::Apply( DistMultiVec<Field>& B ) const
+{
+    EL_DEBUG_CSE
+    if( !coarseFact_ )
+        LogicError("AMG::Setup must be called before AMG::Apply");
+    if( B.Height() != levels_[0]->A.Height() )
+        LogicError
+        ("Expected ",levels_[0]->A.Height()," rows but B had ",B.Height());
+    DistMultiVec<Field> X(B.Grid());
+    Cycle( 0, B, X );
+    B = X;
+}
+
+template<typename Field>
+void DistAMG<Field>::operator()( DistMultiVec<Field>& B ) const
+{ Apply( B ); }
+
+template<typename Field>
+Int DistAMG<Field>::NumLevels() const { return levels_.size(); }
+
+template<typename Field>
+double DistAMG<Field>::OperatorComplexity() const
+{ return operatorComplexity_; }
+
+template<typename Field>
+const DistSparseMatrix<Field>& DistAMG<Field>::Operator( Int level ) const
+{
+    EL_DEBUG_CSE
+    if( level < 0 || level >= NumLevels() )
+        LogicError("Invalid AMG level ",level);
+    return levels_[level]->A;
+}
+
+template<typename Field>
+const DistSparseMatrix<Field>& DistAMG<Field>::Prolongator( Int level ) const
+{
+    EL_DEBUG_CSE
+    if( level < 0 || level >= NumLevels()-1 )
+        LogicError("Invalid AMG prolongator level ",level);
+    return levels_[level]->P;
+}
+
+#define PROTO(Field) \
+  template struct amg::Level<Field>; \
+  template class DistAMG<Field>;
+
+#define EL_NO_INT_PROTO
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -12,6 +12,19 @@ using namespace El;
 
 extern "C" {
 
+ElError ElBisectCtrlDefault( ElBisectCtrl* ctrl )
+{
+    ctrl->sequential = true;
+    ctrl->numDistSeps = 1;
+    ctrl->numSeqSeps = 1;
+    ctrl->cutoff = 1024;
+    ctrl->storeFactRecvInds = false;
+    ctrl->native = false;
+    ctrl->ordering = EL_SPARSE_NESTED_DISSECTION;
+    ctrl->minDegreeCutoff = 200000;
+    return EL_SUCCESS;
+}
+
 #define C_PROTO_BASE(SIG,SIGBASE,T) \
   /* Median
      ====== */ \
@@ -12,38 +12,41 @@
 
 #ifdef EL_HAVE_PARMETIS
 # include "parmetis.h"
-#else
+#elif defined(EL_HAVE_METIS)
 # include "metis.h"
 #endif
 
+#include "./Bisect/Multilevel.hpp"
+
 namespace El {
 
-Int Bisect
-( const Graph& graph,
-  Graph& leftChild,
-  Graph& rightChild,
-  vector<Int>& perm,
-  const BisectCtrl& ctrl )
+namespace {
+
+// (Par)METIS and the native partitioner assume that there are no
+// self-connections or connections outside the sources, so we must manually
+// remove them from the (local) connectivity
+void ValidAdjacency
+( const Int* sourceBuf,
+  const Int* targetBuf,
+        Int numEdges,
+        Int numTotalSources,
+        Int firstSource,
+        Int numSources,
+        vector<Int>& offsets,
+        vector<Int>& targets )
 {
     EL_DEBUG_CSE
-#ifdef EL_HAVE_METIS
-    // METIS assumes that there are no self-connections or connections 
-    // outside the sources, so we must manually remove them from our graph
-    const Int numSources = graph.NumSources();
-    const Int numEdges = graph.NumEdges();
-    const Int* sourceBuf = graph.LockedSourceBuffer();
-    const Int* targetBuf = graph.LockedTargetBuffer();
     Int numValidEdges = 0;
-    for( Int i=0; i<numEdges; ++i )
-        if( sourceBuf[i] != targetBuf[i] && targetBuf[i] < numSources )
+    for( Int edge=0; edge<numEdges; ++edge )
+        if( sourceBuf[edge] != targetBuf[edge] &&
+            targetBuf[edge] < numTotalSources )
             ++numValidEdges;
 
-    // Fill our connectivity (ignoring self and too-large connections)
-    vector<idx_t> xAdj( numSources+1 );
-    vector<idx_t> adjacency( Max(numValidEdges,1) );
+    offsets.resize( numSources+1 );
+    targets.resize( numValidEdges );
     Int validCounter=0;
     Int sourceOff=0;
-    Int prevSource=-1;
+    Int prevSource=firstSource-1;
     for( Int edge=0; edge<numEdges; ++edge )
     {
         const Int source = sourceBuf[edge];
@@ -54,25 +57,59 @@ Int Bisect
         )
         while( source != prevSource )
         {
-            xAdj[sourceOff++] = validCounter;
+            offsets[sourceOff++] = validCounter;
             ++prevSource;
         }
-        if( source != target && target < numSources )
-            adjacency[validCounter++] = target;
+        if( source != target && target < numTotalSources )
+            targets[validCounter++] = target;
+    }
+    while( sourceOff <= numSources )
+        offsets[sourceOff++] = validCounter;
+}
+
+} // anonymous namespace
+
+Int Bisect
+( const Graph& graph,
+  Graph& leftChild,
+  Graph& rightChild,
+  vector<Int>& perm,
+  const BisectCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int numSources = graph.NumSources();
+    vector<Int> xAdj, adjacency;
+    ValidAdjacency
+    ( graph.LockedSourceBuffer(), graph.LockedTargetBuffer(),
+      graph.NumEdges(), numSources, 0, numSources, xAdj, adjacency );
+
+    vector<Int> part;
+#ifdef EL_HAVE_METIS
+    if( !ctrl.native )
+    {
+        // Call METIS_ComputeVertexSeparator, which is meant to be used by
+        // ParMETIS (and note that idx_t might be different than Int)
+        vector<idx_t> xAdj_idx_t( xAdj.begin(), xAdj.end() );
+        vector<idx_t> adjacency_idx_t( Max(adjacency.size(),size_t(1)) );
+        std::copy
+        ( adjacency.begin(), adjacency.end(), adjacency_idx_t.begin() );
+        idx_t nvtxs = numSources;
+        idx_t options[METIS_NOPTIONS];
+        METIS_SetDefaultOptions( options );
+        options[METIS_OPTION_NSEPS] = ctrl.numSeqSeps;
+        vector<idx_t> part_idx_t(numSources);
+        idx_t sepSize;
+        METIS_ComputeVertexSeparator
+        ( &nvtxs, xAdj_idx_t.data(), adjacency_idx_t.data(), NULL, options,
+          &sepSize, part_idx_t.data() );
+        part.assign( part_idx_t.begin(), part_idx_t.end() );
+    }
+    else
+#endif
+    {
+        auto weighted = bisect::FromAdjacency( numSources, xAdj, adjacency );
+        bisect::Separator( weighted, ctrl.numSeqSeps, 0, part );
     }
-    while( sourceOff <= numSources)
-    { xAdj[sourceOff++] = validCounter; }
-
-    // Call METIS_ComputeVertexSeparator, which is meant to be used by ParMETIS
-    idx_t nvtxs = numSources;
-    idx_t options[METIS_NOPTIONS];
-    METIS_SetDefaultOptions( options );
-    options[METIS_OPTION_NSEPS] = ctrl.numSeqSeps;
-    vector<idx_t> part(numSources);
-    idx_t sepSize;
-    METIS_ComputeVertexSeparator
-    ( &nvtxs, xAdj.data(), adjacency.data(), NULL, options, 
-      &sepSize, part.data() );
     
     Int sizes[3] = { 0, 0, 0 };
     for( Int s=0; s<numSources; ++s ) 
@@ -89,10 +126,6 @@ Int Bisect
     BuildChildrenFromPerm
     ( graph, perm, sizes[0], leftChild, sizes[1], rightChild );
     return sizes[2];
-#else
-    LogicError("METIS interface was not available");
-    return -1;
-#endif
 }
 
 Int Bisect
@@ -104,7 +137,6 @@ Int Bisect
   const BisectCtrl& ctrl )
 {
     EL_DEBUG_CSE
-#ifdef EL_HAVE_METIS
     const Grid& grid = graph.Grid();
     const int commSize = grid.Size();
     const int commRank = grid.Rank();
@@ -113,46 +145,19 @@ Int Bisect
         ("This routine assumes at least two processes are used, "
          "otherwise one child will be lost");
 
-    // (Par)METIS assumes that there are no self-connections or connections 
-    // outside the sources, so we must manually remove them from our graph
-    const Int numSources = graph.NumSources();
-    const Int numLocalEdges = graph.NumLocalEdges();
-    const Int* sourceBuf = graph.LockedSourceBuffer();
-    const Int* targetBuf = graph.LockedTargetBuffer();
-    Int numLocalValidEdges = 0;
-    for( Int i=0; i<numLocalEdges; ++i )
-        if( sourceBuf[i] != targetBuf[i] && targetBuf[i] < numSources )
-            ++numLocalValidEdges;
-
     // Fill our local connectivity (ignoring self and too-large connections)
+    const Int numSources = graph.NumSources();
     const Int blocksize = graph.Blocksize();
     const Int numLocalSources = graph.NumLocalSources();
     const Int firstLocalSource = graph.FirstLocalSource();
-    vector<idx_t> xAdj( numLocalSources+1 );
-    vector<idx_t> adjacency( Max(numLocalValidEdges,1) );
-    Int validCounter=0;
-    Int sourceOff=0;
-    Int prevSource=firstLocalSource-1;
-    for( Int localEdge=0; localEdge<numLocalEdges; ++localEdge )
-    {
-        const Int source = sourceBuf[localEdge];
-        const Int target = targetBuf[localEdge];
-        EL_DEBUG_ONLY(
-          if( source < prevSource )
-              RuntimeError("sources were not properly sorted");
-        )
-        while( source != prevSource )
-        {
-            xAdj[sourceOff++] = validCounter;
-            ++prevSource;
-        }
-        if( source != target && target < numSources )
-            adjacency[validCounter++] = target;
-    }
-    while( sourceOff <= numLocalSources)
-    { xAdj[sourceOff++] = validCounter; }
-
-    vector<idx_t> sizes(3);
+    vector<Int> xAdj, adjacency;
+    ValidAdjacency
+    ( graph.LockedSourceBuffer(), graph.LockedTargetBuffer(),
+      graph.NumLocalEdges(), numSources, firstLocalSource, numLocalSources,
+      xAdj, adjacency );
+    const Int numLocalValidEdges = adjacency.size();
+
+    vector<Int> sizes(3);
     if( ctrl.sequential )
     {
         // Gather the number of local valid edges on the root process
@@ -171,7 +176,7 @@ Int Bisect
         for( int q=0; q<commSize; ++q )
             maxLocalValidEdges = Max( maxLocalValidEdges, edgeSizes[q] );
         adjacency.resize( Max(maxLocalValidEdges,1) );
-        vector<idx_t> globalAdj;
+        vector<Int> globalAdj;
         if( commRank == 0 )
             globalAdj.resize( maxLocalValidEdges*commSize, 0 );
         mpi::Gather
@@ -191,7 +196,7 @@ Int Bisect
         }
 
         // Set up the global xAdj vector
-        vector<idx_t> globalXAdj;
+        vector<Int> globalXAdj;
         if( commRank == 0 )
             globalXAdj.resize( numSources+1 );
         // For now, simply loop over the processes for the receives
@@ -223,23 +228,9 @@ Int Bisect
         vector<Int> seqPerm;
         if( commRank == 0 )
         {
-            // Call METIS_ComputeVertexSeparator, which is meant for ParMETIS
-            idx_t nvtxs = numSources;
-            idx_t options[METIS_NOPTIONS];
-            METIS_SetDefaultOptions( options );
-            options[METIS_OPTION_NSEPS] = ctrl.numSeqSeps;
-            vector<idx_t> part(numSources);
-            idx_t sepSize;
-
-            if( globalAdj.size() > 0 )
+            vector<Int> part(numSources);
+            if( globalAdj.size() == 0 )
             {
-                METIS_ComputeVertexSeparator
-                ( &nvtxs, globalXAdj.data(), globalAdj.data(), NULL, options,
-                  &sepSize, part.data() );
-            } 
-            else
-            {
-                sepSize = 0;
                 for( Int i=0; i<numSources; ++i )
                 {
                     if( i <= numSources/2 )
@@ -248,6 +239,32 @@ Int Bisect
                         part[i] = 1;
                 } 
             }
+#ifdef EL_HAVE_METIS
+            else if( !ctrl.native )
+            {
+                // Call METIS_ComputeVertexSeparator, which is meant for
+                // ParMETIS (and note that idx_t might be different than Int)
+                vector<idx_t>
+                  xAdj_idx_t( globalXAdj.begin(), globalXAdj.end() );
+                vector<idx_t> adj_idx_t( globalAdj.begin(), globalAdj.end() );
+                idx_t nvtxs = numSources;
+                idx_t options[METIS_NOPTIONS];
+                METIS_SetDefaultOptions( options );
+                options[METIS_OPTION_NSEPS] = ctrl.numSeqSeps;
+                vector<idx_t> part_idx_t(numSources);
+                idx_t sepSize;
+                METIS_ComputeVertexSeparator
+                ( &nvtxs, xAdj_idx_t.data(), adj_idx_t.data(), NULL, options,
+                  &sepSize, part_idx_t.data() );
+                std::copy( part_idx_t.begin(), part_idx_t.end(), part.begin() );
+            } 
+#endif
+            else
+            {
+                auto weighted =
+                  bisect::FromAdjacency( numSources, globalXAdj, globalAdj );
+                bisect::Separator( weighted, ctrl.numSeqSeps, 0, part );
+            }
 
             for( Int j=0; j<3; ++j )
                 sizes[j] = 0;
@@ -285,13 +302,11 @@ Int Bisect
         }
 
         // Broadcast the sizes information from the root
-        mpi::Broadcast
-        ( reinterpret_cast<byte*>(sizes.data()), 3*sizeof(idx_t), 0,
-          grid.Comm() );
+        mpi::Broadcast( sizes.data(), 3, 0, grid.Comm() );
     }
-    else
-    {
 #ifdef EL_HAVE_PARMETIS
+    else if( !ctrl.native )
+    {
         // Describe the source distribution
         vector<idx_t> vtxDist( commSize+1 );
         for( int i=0; i<commSize; ++i )
@@ -302,30 +317,36 @@ Int Bisect
         perm.SetGrid( grid );
         perm.Resize( numSources );
 
+        // Since idx_t might be different than Int
+        vector<idx_t> xAdj_idx_t( xAdj.begin(), xAdj.end() );
+        vector<idx_t> adj_idx_t( Max(adjacency.size(),size_t(1)) );
+        std::copy( adjacency.begin(), adjacency.end(), adj_idx_t.begin() );
         vector<idx_t> perm_idx_t( perm.NumLocalSources() );
+        vector<idx_t> sizes_idx_t(3);
+
         // Use the custom ParMETIS interface
         idx_t nseqseps = ctrl.numSeqSeps;
         idx_t nparseps = ctrl.numDistSeps;
         real_t imbalance = 1.1;
         mpi::Comm comm = grid.Comm();
         ParMETIS_ComputeVertexSeparator
-        ( vtxDist.data(), xAdj.data(), adjacency.data(), &nparseps, &nseqseps, 
-          &imbalance, NULL, perm_idx_t.data(), sizes.data(), &comm.comm );
+        ( vtxDist.data(), xAdj_idx_t.data(), adj_idx_t.data(), &nparseps,
+          &nseqseps, &imbalance, NULL, perm_idx_t.data(), sizes_idx_t.data(),
+          &comm.comm );
 
-        // Since idx_t might be different than Int
         std::copy( perm_idx_t.begin(), perm_idx_t.end(), perm.Buffer() );
-#else
-        LogicError("ParMETIS was not available");
+        std::copy( sizes_idx_t.begin(), sizes_idx_t.end(), sizes.begin() );
+    }
 #endif
+    else
+    {
+        bisect::DistSeparator
+        ( graph, xAdj, adjacency, ctrl.numDistSeps, perm, sizes.data() );
     }
     EL_DEBUG_ONLY(EnsurePermutation( perm ))
     BuildChildFromPerm
     ( graph, perm, sizes[0], sizes[1], onLeft, childGrid, child );
     return sizes[2];
-#else
-    LogicError("METIS was not available");
-    return -1;
-#endif
 }
 
 void EnsurePermutation( const vector<Int>& map )
@@ -0,0 +1,957 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_BISECT_MULTILEVEL_HPP
+#define EL_BISECT_MULTILEVEL_HPP
+
+#include <queue>
+
+// A native multilevel vertex separator in the spirit of
+//
+//   G. Karypis and V. Kumar, "A fast and high quality multilevel scheme for
+//   partitioning irregular graphs", SIAM J. Sci. Comput., Vol. 20, No. 1, 1998.
+//
+// The graph is repeatedly coarsened via heavy-edge matching, the coarsest
+// graph is bisected via greedy graph growing (from several seeds), and the
+// bisection is projected back up the hierarchy with Fiduccia-Mattheyses (FM)
+// refinement at each level. A vertex separator is finally extracted from the
+// cut edges as a minimum vertex cover of the bipartite boundary graph (via
+// Konig's theorem) and then thinned.
+//
+// In the distributed case, each process first coarsens the subgraph induced by
+// its own sources, the (much smaller) coarse graph is then replicated and
+// partitioned independently by every process, the best of the results is
+// projected back to the original graph, and its separator is thinned.
+
+namespace El {
+namespace bisect {
+
+// An undirected graph with vertex and edge weights in a compressed format
+// which does not contain any self-connections
+struct WeightedGraph
+{
+    Int numVertices=0;
+    Int totalWeight=0;
+    vector<Int> offsets;
+    vector<Int> targets;
+    vector<Int> edgeWeights;
+    vector<Int> vertexWeights;
+};
+
+// Stop coarsening once there are this many vertices or the graph no longer
+// shrinks by a reasonable factor
+const Int coarsenLimit = 128;
+const double coarsenRatio = 0.9;
+const Int numInitialTrials = 4;
+const Int numRefinePasses = 8;
+const double imbalance = 0.05;
+
+inline WeightedGraph FromAdjacency
+( Int numVertices, const vector<Int>& offsets, const vector<Int>& targets )
+{
+    EL_DEBUG_CSE
+    WeightedGraph graph;
+    graph.numVertices = numVertices;
+    graph.totalWeight = numVertices;
+    graph.offsets = offsets;
+    graph.targets = targets;
+    graph.edgeWeights.resize( targets.size(), 1 );
+    graph.vertexWeights.resize( numVertices, 1 );
+    return graph;
+}
+
+// Returns the largest weight that either side of a bisection may have
+inline Int MaxPartWeight( const WeightedGraph& graph )
+{
+    Int maxVertexWeight = 0;
+    for( Int v=0; v<graph.numVertices; ++v )
+        maxVertexWeight = Max( maxVertexWeight, graph.vertexWeights[v] );
+    const Int balanced = (graph.totalWeight+1) / 2;
+    return Max
+      ( Int(Ceil((1+imbalance)*graph.totalWeight/2.)),
+        balanced+maxVertexWeight );
+}
+
+// Coarsening
+// ==========
+
+// Visit the vertices in a random order and match each unmatched vertex with
+// the unmatched neighbor sharing the heaviest edge (if any)
+inline Int HeavyEdgeMatching
+( const WeightedGraph& graph,
+        std::mt19937& generator,
+        vector<Int>& coarseMap )
+{
+    EL_DEBUG_CSE
+    const Int numVertices = graph.numVertices;
+    const Int maxVertexWeight =
+      Max( Int(1), Int(1.5*graph.totalWeight/coarsenLimit) );
+
+    vector<Int> order( numVertices );
+    for( Int v=0; v<numVertices; ++v )
+        order[v] = v;
+    std::shuffle( order.begin(), order.end(), generator );
+
+    vector<Int> match( numVertices, -1 );
+    for( Int k=0; k<numVertices; ++k )
+    {
+        const Int v = order[k];
+        if( match[v] != -1 )
+            continue;
+        Int best = v;
+        Int bestWeight = 0;
+        for( Int e=graph.offsets[v]; e<graph.offsets[v+1]; ++e )
+        {
+            const Int u = graph.targets[e];
+            if( match[u] == -1 && graph.edgeWeights[e] > bestWeight &&
+                graph.vertexWeights[u]+graph.vertexWeights[v] <=
+                maxVertexWeight )
+            {
+                best = u;
+                bestWeight = graph.edgeWeights[e];
+            }
+        }
+        match[v] = best;
+        match[best] = v;
+    }
+
+    // Number the coarse vertices in order of their smallest fine vertex
+    coarseMap.resize( numVertices );
+    Int numCoarse = 0;
+    for( Int v=0; v<numVertices; ++v )
+    {
+        if( match[v] >= v )
+            coarseMap[v] = numCoarse++;
+        else
+            coarseMap[v] = coarseMap[match[v]];
+    }
+    return numCoarse;
+}
+
+// Form the coarse graph by merging the adjacency lists of the fine vertices
+// mapped to each coarse vertex (in parallel over the coarse vertices)
+inline void Contract
+( const WeightedGraph& graph,
+  const vector<Int>& coarseMap,
+        Int numCoarse,
+        WeightedGraph& coarse )
+{
+    EL_DEBUG_CSE
+    const Int numVertices = graph.numVertices;
+
+    // List the (at most two) fine vertices of each coarse vertex
+    vector<Int> fineOffsets( numCoarse+1, 0 );
+    for( Int v=0; v<numVertices; ++v )
+        ++fineOffsets[coarseMap[v]+1];
+    for( Int c=0; c<numCoarse; ++c )
+        fineOffsets[c+1] += fineOffsets[c];
+    vector<Int> fine( numVertices );
+    {
+        auto offs = fineOffsets;
+        for( Int v=0; v<numVertices; ++v )
+            fine[offs[coarseMap[v]]++] = v;
+    }
+
+    // Bound the number of coarse edges of each coarse vertex
+    vector<Int> boundOffsets( numCoarse+1, 0 );
+    for( Int c=0; c<numCoarse; ++c )
+    {
+        Int bound = 0;
+        for( Int k=fineOffsets[c]; k<fineOffsets[c+1]; ++k )
+            bound += graph.offsets[fine[k]+1] - graph.offsets[fine[k]];
+        boundOffsets[c+1] = boundOffsets[c] + bound;
+    }
+
+    coarse.numVertices = numCoarse;
+    coarse.totalWeight = graph.totalWeight;
+    coarse.vertexWeights.resize( numCoarse );
+    vector<Int> boundTargets( boundOffsets[numCoarse] ),
+                boundWeights( boundOffsets[numCoarse] ),
+                numUnique( numCoarse );
+    auto merge = [&]( Int cBeg, Int cEnd )
+      {
+        // 'position' marks where each coarse neighbor was stored
+        vector<Int> position( numCoarse, -1 );
+        for( Int c=cBeg; c<cEnd; ++c )
+        {
+            const Int offset = boundOffsets[c];
+            Int num = 0;
+            Int vertexWeight = 0;
+            for( Int k=fineOffsets[c]; k<fineOffsets[c+1]; ++k )
+            {
+                const Int v = fine[k];
+                vertexWeight += graph.vertexWeights[v];
+                for( Int e=graph.offsets[v]; e<graph.offsets[v+1]; ++e )
+                {
+                    const Int target = coarseMap[graph.targets[e]];
+                    if( target == c )
+                        continue;
+                    if( position[target] == -1 )
+                    {
+                        position[target] = offset+num;
+                        boundTargets[offset+num] = target;
+                        boundWeights[offset+num] = graph.edgeWeights[e];
+                        ++num;
+                    }
+                    else
+                        boundWeights[position[target]] += graph.edgeWeights[e];
+                }
+            }
+            for( Int k=0; k<num; ++k )
+                position[boundTargets[offset+k]] = -1;
+            numUnique[c] = num;
+            coarse.vertexWeights[c] = vertexWeight;
+        }
+      };
+#ifdef EL_HYBRID
+    if( numCoarse >= 4*coarsenLimit )
+    {
+        #pragma omp parallel
+        {
+            const Int numThreads = omp_get_num_threads();
+            const Int thread = omp_get_thread_num();
+            const Int chunk = (numCoarse+numThreads-1) / numThreads;
+            merge
+            ( Min(thread*chunk,numCoarse), Min((thread+1)*chunk,numCoarse) );
+        }
+    }
+    else
+#endif
+    merge( 0, numCoarse );
+
+    // Compact the merged adjacency lists
+    coarse.offsets.resize( numCoarse+1 );
+    coarse.offsets[0] = 0;
+    for( Int c=0; c<numCoarse; ++c )
+        coarse.offsets[c+1] = coarse.offsets[c] + numUnique[c];
+    const Int numEdges = coarse.offsets[numCoarse];
+    coarse.targets.resize( numEdges );
+    coarse.edgeWeights.resize( numEdges );
+    EL_PARALLEL_FOR
+    for( Int c=0; c<numCoarse; ++c )
+    {
+        const Int boundOffset = boundOffsets[c];
+        const Int offset = coarse.offsets[c];
+        for( Int k=0; k<numUnique[c]; ++k )
+        {
+            coarse.targets[offset+k] = boundTargets[boundOffset+k];
+            coarse.edgeWeights[offset+k] = boundWeights[boundOffset+k];
+        }
+    }
+}
+
+// Bisection
+// =========
+
+inline Int EdgeCut( const WeightedGraph& graph, const vector<Int>& part )
+{
+    Int cut = 0;
+    for( Int v=0; v<graph.numVertices; ++v )
+        for( Int e=graph.offsets[v]; e<graph.offsets[v+1]; ++e )
+            if( part[graph.targets[e]] != part[v] )
+                cut += graph.edgeWeights[e];
+    return cut/2;
+}
+
+// Greedily grow the first part from a random seed, always adding the vertex
+// which most decreases the edge cut, until it holds half of the weight
+inline void GrowBisection
+( const WeightedGraph& graph,
+        std::mt19937& generator,
+        vector<Int>& part )
+{
+    EL_DEBUG_CSE
+    const Int numVertices = graph.numVertices;
+    part.assign( numVertices, 1 );
+    if( numVertices == 0 )
+        return;
+
+    // gain[v] is the decrease in the edge cut from moving v into part 0
+    vector<Int> gain( numVertices );
+    for( Int v=0; v<numVertices; ++v )
+    {
+        gain[v] = 0;
+        for( Int e=graph.offsets[v]; e<graph.offsets[v+1]; ++e )
+            gain[v] -= graph.edgeWeights[e];
+    }
+
+    std::priority_queue<pair<Int,Int>> queue;
+    std::uniform_int_distribution<Int> dist( 0, numVertices-1 );
+    const Int halfWeight = graph.totalWeight / 2;
+    Int weight = 0;
+    Int numMoved = 0;
+    while( weight < halfWeight && numMoved < numVertices-1 )
+    {
+        // Drop stale entries and restart from a new seed if the current
+        // component has been exhausted
+        while( !queue.empty() &&
+               (part[queue.top().second] == 0 ||
+                gain[queue.top().second] != queue.top().first) )
+            queue.pop();
+        if( queue.empty() )
+        {
+            Int seed = dist( generator );
+            while( part[seed] == 0 )
+                seed = (seed+1) % numVertices;
+            queue.push( pair<Int,Int>(gain[seed],seed) );
+        }
+        const Int v = queue.top().second;
+        queue.pop();
+        part[v] = 0;
+        weight += graph.vertexWeights[v];
+        ++numMoved;
+        for( Int e=graph.offsets[v]; e<graph.offsets[v+1]; ++e )
+        {
+            const Int u = graph.targets[e];
+            if( part[u] == 1 )
+            {
+                gain[u] += 2*graph.edgeWeights[e];
+                queue.push( pair<Int,Int>(gain[u],u) );
+            }
+        }
+    }
+}
+
+// Fiduccia-Mattheyses refinement of an edge bisection: vertices are moved one
+// at a time (each at most once per pass) in order of their gain, even when
+// the cut temporarily increases, and the best prefix of the moves is kept
+inline void RefineBisection
+( const WeightedGraph& graph,
+        vector<Int>& part,
+        Int maxPartWeight )
+{
+    EL_DEBUG_CSE
+    const Int numVertices = graph.numVertices;
+    const Int maxFruitless = Max( Int(50), numVertices/100 );
+    vector<Int> gain( numVertices );
+    vector<char> moved( numVertices );
+    vector<Int> moves;
+    for( Int pass=0; pass<numRefinePasses; ++pass )
+    {
+        Int partWeights[2] = { 0, 0 };
+        Int cut = 0;
+        std::priority_queue<pair<Int,Int>> queues[2];
+        for( Int v=0; v<numVertices; ++v )
+        {
+            partWeights[part[v]] += graph.vertexWeights[v];
+            Int external = 0, internal = 0;
+            for( Int e=graph.offsets[v]; e<graph.offsets[v+1]; ++e )
+            {
+                if( part[graph.targets[e]] == part[v] )
+                    internal += graph.edgeWeights[e];
+                else
+                    external += graph.edgeWeights[e];
+            }
+            gain[v] = external - internal;
+            cut += external;
+            moved[v] = false;
+            if( external > 0 )
+                queues[part[v]].push( pair<Int,Int>(gain[v],v) );
+        }
+        cut /= 2;
+
+        auto excess = [&]()
+          { return Max( Max(partWeights[0],partWeights[1])-maxPartWeight,
+                        Int(0) ); };
+        Int bestExcess = excess();
+        Int bestCut = cut;
+        Int bestImbalance = Abs(partWeights[0]-partWeights[1]);
+        Int numBest = 0;
+        moves.clear();
+        while( Int(moves.size())-numBest < maxFruitless )
+        {
+            // Find the best (fresh) candidate on each side
+            Int candidates[2] = { -1, -1 };
+            for( Int side=0; side<2; ++side )
+            {
+                auto& queue = queues[side];
+                while( !queue.empty() )
+                {
+                    const Int v = queue.top().second;
+                    if( moved[v] || part[v] != side ||
+                        gain[v] != queue.top().first )
+                    {
+                        queue.pop();
+                        continue;
+                    }
+                    if( partWeights[side] <= maxPartWeight &&
+                        partWeights[1-side]+graph.vertexWeights[v] >
+                        maxPartWeight )
+                    {
+                        // This move would violate the balance constraint
+                        queue.pop();
+                        continue;
+                    }
+                    candidates[side] = v;
+                    break;
+                }
+            }
+            Int side;
+            if( partWeights[0] > maxPartWeight && candidates[0] != -1 )
+                side = 0;
+            else if( partWeights[1] > maxPartWeight && candidates[1] != -1 )
+                side = 1;
+            else if( candidates[0] == -1 && candidates[1] == -1 )
+                break;
+            else if( candidates[1] == -1 )
+                side = 0;
+            else if( candidates[0] == -1 )
+                side = 1;
+            else if( gain[candidates[0]] != gain[candidates[1]] )
+                side = ( gain[candidates[0]] > gain[candidates[1]] ? 0 : 1 );
+            else
+                side = ( partWeights[0] >= partWeights[1] ? 0 : 1 );
+
+            const Int v = candidates[side];
+            queues[side].pop();
+            part[v] = 1-side;
+            moved[v] = true;
+            partWeights[side] -= graph.vertexWeights[v];
+            partWeights[1-side] += graph.vertexWeights[v];
+            cut -= gain[v];
+            gain[v] = -gain[v];
+            moves.push_back( v );
+            for( Int e=graph.offsets[v]; e<graph.offsets[v+1]; ++e )
+            {
+                const Int u = graph.targets[e];
+                if( part[u] == part[v] )
+                    gain[u] -= 2*graph.edgeWeights[e];
+                else
+                    gain[u] += 2*graph.edgeWeights[e];
+                if( !moved[u] )
+                    queues[part[u]].push( pair<Int,Int>(gain[u],u) );
+            }
+
+            const Int newExcess = excess();
+            const Int newImbalance = Abs(partWeights[0]-partWeights[1]);
+            if( newExcess < bestExcess ||
+                (newExcess == bestExcess && cut < bestCut) ||
+                (newExcess == bestExcess && cut == bestCut &&
+                 newImbalance < bestImbalance) )
+            {
+                bestExcess = newExcess;
+                bestCut = cut;
+                bestImbalance = newImbalance;
+                numBest = moves.size();
+            }
+        }
+
+        // Roll back the moves after the best prefix
+        for( Int k=moves.size()-1; k>=numBest; --k )
+            part[moves[k]] = 1-part[moves[k]];
+        if( numBest == 0 )
+            break;
+    }
+}
+
+// Coarsen, bisect the coarsest graph from several seeds (in parallel), and
+// then refine the bisection while uncoarsening. Returns the edge cut.
+inline Int MultilevelBisection
+( const WeightedGraph& graph,
+        Int seed,
+        vector<Int>& part )
+{
+    EL_DEBUG_CSE
+    std::mt19937 generator( seed );
+
+    vector<WeightedGraph> levels;
+    vector<vector<Int>> coarseMaps;
+    const WeightedGraph* current = &graph;
+    while( current->numVertices > coarsenLimit )
+    {
+        vector<Int> coarseMap;
+        const Int numCoarse =
+          HeavyEdgeMatching( *current, generator, coarseMap );
+        if( numCoarse > coarsenRatio*current->numVertices )
+            break;
+        WeightedGraph coarse;
+        Contract( *current, coarseMap, numCoarse, coarse );
+        levels.push_back( std::move(coarse) );
+        coarseMaps.push_back( std::move(coarseMap) );
+        current = &levels.back();
+    }
+
+    // Bisect the coarsest graph from several seeds
+    const Int maxPartWeight = MaxPartWeight( *current );
+    vector<vector<Int>> trialParts( numInitialTrials );
+    vector<Int> trialCuts( numInitialTrials );
+    EL_PARALLEL_FOR
+    for( Int trial=0; trial<numInitialTrials; ++trial )
+    {
+        std::mt19937 trialGenerator( seed*numInitialTrials+trial );
+        GrowBisection( *current, trialGenerator, trialParts[trial] );
+        RefineBisection( *current, trialParts[trial], maxPartWeight );
+        trialCuts[trial] = EdgeCut( *current, trialParts[trial] );
+    }
+    Int bestTrial = 0;
+    for( Int trial=1; trial<numInitialTrials; ++trial )
+        if( trialCuts[trial] < trialCuts[bestTrial] )
+            bestTrial = trial;
+    part.swap( trialParts[bestTrial] );
+
+    // Project and refine
+    for( Int level=Int(levels.size())-1; level>=0; --level )
+    {
+        const WeightedGraph& fine = ( level == 0 ? graph : levels[level-1] );
+        const auto& coarseMap = coarseMaps[level];
+        vector<Int> finePart( fine.numVertices );
+        for( Int v=0; v<fine.numVertices; ++v )
+            finePart[v] = part[coarseMap[v]];
+        part.swap( finePart );
+        RefineBisection( fine, part, MaxPartWeight(fine) );
+    }
+    return EdgeCut( graph, part );
+}
+
+// Separator extraction
+// ====================
+
+// Move each separator vertex which is not adjacent to one of the two parts
+// into the other part (subject to the balance constraint)
+inline void ThinSeparator( const WeightedGraph& graph, vector<Int>& part )
+{
+    EL_DEBUG_CSE
+    const Int numVertices = graph.numVertices;
+    const Int maxPartWeight = MaxPartWeight( graph );
+    Int partWeights[3] = { 0, 0, 0 };
+    for( Int v=0; v<numVertices; ++v )
+        partWeights[part[v]] += graph.vertexWeights[v];
+    for( Int v=0; v<numVertices; ++v )
+    {
+        if( part[v] != 2 )
+            continue;
+        bool touches[3] = { false, false, false };
+        for( Int e=graph.offsets[v]; e<graph.offsets[v+1]; ++e )
+            touches[part[graph.targets[e]]] = true;
+        Int side = -1;
+        if( !touches[0] && !touches[1] )
+            side = ( partWeights[0] <= partWeights[1] ? 0 : 1 );
+        else if( !touches[1] )
+            side = 0;
+        else if( !touches[0] )
+            side = 1;
+        if( side != -1 &&
+            partWeights[side]+graph.vertexWeights[v] <= maxPartWeight )
+        {
+            part[v] = side;
+            partWeights[side] += graph.vertexWeights[v];
+            partWeights[2] -= graph.vertexWeights[v];
+        }
+    }
+}
+
+// Overwrite an edge bisection with a vertex separator (marked with a 2) formed
+// from a minimum vertex cover of the bipartite graph of cut edges, which,
+// by Konig's theorem, follows from a maximum matching. Returns the weight of
+// the separator.
+inline Int VertexSeparator( const WeightedGraph& graph, vector<Int>& part )
+{
+    EL_DEBUG_CSE
+    const Int numVertices = graph.numVertices;
+
+    // Number the boundary vertices on each side
+    vector<Int> boundaryIndex( numVertices, -1 );
+    vector<Int> boundary[2];
+    for( Int v=0; v<numVertices; ++v )
+    {
+        for( Int e=graph.offsets[v]; e<graph.offsets[v+1]; ++e )
+        {
+            if( part[graph.targets[e]] != part[v] )
+            {
+                boundaryIndex[v] = boundary[part[v]].size();
+                boundary[part[v]].push_back( v );
+                break;
+            }
+        }
+    }
+    const Int numLeft = boundary[0].size();
+    const Int numRight = boundary[1].size();
+
+    // Greedily initialize a matching and then augment it along alternating
+    // paths found via breadth-first searches from each unmatched left vertex
+    vector<Int> leftMatch( numLeft, -1 ), rightMatch( numRight, -1 );
+    for( Int l=0; l<numLeft; ++l )
+    {
+        const Int v = boundary[0][l];
+        for( Int e=graph.offsets[v]; e<graph.offsets[v+1]; ++e )
+        {
+            const Int u = graph.targets[e];
+            if( part[u] == 1 && rightMatch[boundaryIndex[u]] == -1 )
+            {
+                leftMatch[l] = boundaryIndex[u];
+                rightMatch[boundaryIndex[u]] = l;
+                break;
+            }
+        }
+    }
+    vector<Int> visited( numRight, -1 ), parent( numRight ), queue;
+    for( Int root=0; root<numLeft; ++root )
+    {
+        if( leftMatch[root] != -1 )
+            continue;
+        queue.assign( 1, root );
+        Int freeRight = -1;
+        for( Int k=0; k<Int(queue.size()) && freeRight==-1; ++k )
+        {
+            const Int v = boundary[0][queue[k]];
+            for( Int e=graph.offsets[v]; e<graph.offsets[v+1]; ++e )
+            {
+                const Int u = graph.targets[e];
+                if( part[u] != 1 )
+                    continue;
+                const Int r = boundaryIndex[u];
+                if( visited[r] == root )
+                    continue;
+                visited[r] = root;
+                parent[r] = queue[k];
+                if( rightMatch[r] == -1 )
+                {
+                    freeRight = r;
+                    break;
+                }
+                queue.push_back( rightMatch[r] );
+            }
+        }
+        // Flip the matching along the augmenting path
+        for( Int r=freeRight; r!=-1; )
+        {
+            const Int l = parent[r];
+            const Int rNext = leftMatch[l];
+            leftMatch[l] = r;
+            rightMatch[r] = l;
+            r = rNext;
+        }
+    }
+
+    // By Konig's theorem, a minimum cover consists of the boundary vertices on
+    // one side which are not reachable from its unmatched vertices via
+    // alternating paths and the boundary vertices on the other side which
+    // are. Either side may be used, so keep the cover (after thinning) with
+    // the smaller weight and then the better balance.
+    const vector<Int>* matches[2] = { &leftMatch, &rightMatch };
+    vector<char> reached[2];
+    vector<Int> trialPart, bestPart;
+    Int separatorWeight = -1, bestImbalance = -1;
+    for( Int from=0; from<2; ++from )
+    {
+        const Int to = 1-from;
+        reached[0].assign( numLeft, false );
+        reached[1].assign( numRight, false );
+        queue.clear();
+        for( Int i=0; i<Int(boundary[from].size()); ++i )
+        {
+            if( (*matches[from])[i] == -1 )
+            {
+                reached[from][i] = true;
+                queue.push_back( i );
+            }
+        }
+        for( Int k=0; k<Int(queue.size()); ++k )
+        {
+            const Int v = boundary[from][queue[k]];
+            for( Int e=graph.offsets[v]; e<graph.offsets[v+1]; ++e )
+            {
+                const Int u = graph.targets[e];
+                if( part[u] != to )
+                    continue;
+                const Int j = boundaryIndex[u];
+                if( reached[to][j] )
+                    continue;
+                reached[to][j] = true;
+                const Int i = (*matches[to])[j];
+                if( i != -1 && !reached[from][i] )
+                {
+                    reached[from][i] = true;
+                    queue.push_back( i );
+                }
+            }
+        }
+
+        trialPart = part;
+        for( Int i=0; i<Int(boundary[from].size()); ++i )
+            if( !reached[from][i] )
+                trialPart[boundary[from][i]] = 2;
+        for( Int j=0; j<Int(boundary[to].size()); ++j )
+            if( reached[to][j] )
+                trialPart[boundary[to][j]] = 2;
+        ThinSeparator( graph, trialPart );
+
+        Int partWeights[3] = { 0, 0, 0 };
+        for( Int v=0; v<numVertices; ++v )
+            partWeights[trialPart[v]] += graph.vertexWeights[v];
+        const Int trialImbalance = Abs(partWeights[0]-partWeights[1]);
+        if( from == 0 || partWeights[2] < separatorWeight ||
+            (partWeights[2] == separatorWeight &&
+             trialImbalance < bestImbalance) )
+        {
+            separatorWeight = partWeights[2];
+            bestImbalance = trialImbalance;
+            bestPart.swap( trialPart );
+        }
+    }
+    part.swap( bestPart );
+    return separatorWeight;
+}
+
+// Compute a vertex separator from the best of 'numSeps' multilevel runs,
+// with the part of each vertex (0, 1, or 2 for the separator) returned in
+// 'part', as for METIS_ComputeVertexSeparator. Returns the separator weight.
+inline Int Separator
+( const WeightedGraph& graph,
+        Int numSeps,
+        Int seed,
+        vector<Int>& part )
+{
+    EL_DEBUG_CSE
+    const Int numVertices = graph.numVertices;
+    if( graph.offsets[numVertices] == 0 )
+    {
+        // There are no edges, so simply split the vertices in half
+        part.resize( numVertices );
+        for( Int v=0; v<numVertices; ++v )
+            part[v] = ( v <= numVertices/2 ? 0 : 1 );
+        return 0;
+    }
+
+    Int bestWeight = -1;
+    vector<Int> trialPart;
+    for( Int sep=0; sep<Max(numSeps,Int(1)); ++sep )
+    {
+        MultilevelBisection( graph, seed*Max(numSeps,Int(1))+sep, trialPart );
+        const Int weight = VertexSeparator( graph, trialPart );
+        if( bestWeight == -1 || weight < bestWeight )
+        {
+            bestWeight = weight;
+            part.swap( trialPart );
+        }
+    }
+    return bestWeight;
+}
+
+// The distributed separator
+// =========================
+
+// Given each process's (global) adjacency lists of its local sources, with
+// self-connections and connections outside of the sources removed, compute
+// the relabeling 'perm' of the sources which orders the left part first, then
+// the right part, and then the separator. The sizes of the three sets are
+// returned in 'sizes'.
+inline void DistSeparator
+( const DistGraph& graph,
+  const vector<Int>& offsets,
+  const vector<Int>& targets,
+        Int numSeps,
+        DistMap& perm,
+        Int* sizes )
+{
+    EL_DEBUG_CSE
+    const Grid& grid = graph.Grid();
+    mpi::Comm comm = grid.Comm();
+    const int commRank = grid.Rank();
+    const int commSize = grid.Size();
+    const Int numSources = graph.NumSources();
+    const Int numLocalSources = graph.NumLocalSources();
+    const Int firstLocalSource = graph.FirstLocalSource();
+
+    // Coarsen the subgraph induced by the local sources
+    // =================================================
+    vector<Int> localOffsets( numLocalSources+1 ), localTargets;
+    localTargets.reserve( targets.size() );
+    for( Int s=0; s<numLocalSources; ++s )
+    {
+        localOffsets[s] = localTargets.size();
+        for( Int e=offsets[s]; e<offsets[s+1]; ++e )
+        {
+            const Int target = targets[e] - firstLocalSource;
+            if( target >= 0 && target < numLocalSources )
+                localTargets.push_back( target );
+        }
+    }
+    localOffsets[numLocalSources] = localTargets.size();
+    WeightedGraph local =
+      FromAdjacency( numLocalSources, localOffsets, localTargets );
+    SwapClear( localOffsets );
+    SwapClear( localTargets );
+
+    const Int localLimit = Max( coarsenLimit, 64*coarsenLimit/commSize );
+    vector<Int> localMap( numLocalSources );
+    for( Int s=0; s<numLocalSources; ++s )
+        localMap[s] = s;
+    std::mt19937 generator( commRank );
+    while( local.numVertices > localLimit )
+    {
+        vector<Int> coarseMap;
+        const Int numCoarse = HeavyEdgeMatching( local, generator, coarseMap );
+        if( numCoarse > coarsenRatio*local.numVertices )
+            break;
+        WeightedGraph coarse;
+        Contract( local, coarseMap, numCoarse, coarse );
+        for( Int s=0; s<numLocalSources; ++s )
+            localMap[s] = coarseMap[localMap[s]];
+        local = std::move( coarse );
+    }
+
+    // Number the coarse vertices and map the local edges onto them
+    // ============================================================
+    const Int numLocalCoarse = local.numVertices;
+    vector<int> coarseSizes( commSize ), coarseOffsets;
+    mpi::AllGather( &numLocalCoarse, 1, coarseSizes.data(), 1, comm );
+    const Int numCoarse = Scan( coarseSizes, coarseOffsets );
+    const Int firstLocalCoarse = coarseOffsets[commRank];
+
+    DistMap coarseMap( numSources, grid );
+    for( Int s=0; s<numLocalSources; ++s )
+        coarseMap.SetLocal( s, firstLocalCoarse+localMap[s] );
+    vector<Int> coarseTargets( targets );
+    coarseMap.Translate( coarseTargets );
+
+    // Since every connection of a coarse vertex is stored by its owner, the
+    // duplicates can be combined locally
+    vector<Int> edgeSources, edgeTargets, edgeWeights;
+    {
+        vector<pair<Int,Int>> edges;
+        edges.reserve( coarseTargets.size() );
+        for( Int s=0; s<numLocalSources; ++s )
+        {
+            const Int source = firstLocalCoarse + localMap[s];
+            for( Int e=offsets[s]; e<offsets[s+1]; ++e )
+                if( coarseTargets[e] != source )
+                    edges.push_back( pair<Int,Int>(source,coarseTargets[e]) );
+        }
+        SwapClear( coarseTargets );
+        std::sort( edges.begin(), edges.end() );
+        for( Int e=0; e<Int(edges.size()); ++e )
+        {
+            if( e > 0 && edges[e] == edges[e-1] )
+            {
+                ++edgeWeights.back();
+                continue;
+            }
+            edgeSources.push_back( edges[e].first );
+            edgeTargets.push_back( edges[e].second );
+            edgeWeights.push_back( 1 );
+        }
+    }
+
+    // Replicate the coarse graph
+    // ==========================
+    const int numLocalEdges = edgeSources.size();
+    vector<int> edgeSizes( commSize ), edgeOffsets;
+    mpi::AllGather( &numLocalEdges, 1, edgeSizes.data(), 1, comm );
+    const Int numEdges = Scan( edgeSizes, edgeOffsets );
+    vector<Int> allSources( numEdges );
+    WeightedGraph coarse;
+    coarse.numVertices = numCoarse;
+    coarse.totalWeight = numSources;
+    coarse.targets.resize( numEdges );
+    coarse.edgeWeights.resize( numEdges );
+    coarse.vertexWeights.resize( numCoarse );
+    mpi::AllGather
+    ( edgeSources.data(), numLocalEdges,
+      allSources.data(), edgeSizes.data(), edgeOffsets.data(), comm );
+    mpi::AllGather
+    ( edgeTargets.data(), numLocalEdges,
+      coarse.targets.data(), edgeSizes.data(), edgeOffsets.data(), comm );
+    mpi::AllGather
+    ( edgeWeights.data(), numLocalEdges,
+      coarse.edgeWeights.data(), edgeSizes.data(), edgeOffsets.data(), comm );
+    mpi::AllGather
+    ( local.vertexWeights.data(), int(numLocalCoarse),
+      coarse.vertexWeights.data(), coarseSizes.data(), coarseOffsets.data(),
+      comm );
+    coarse.offsets.assign( numCoarse+1, 0 );
+    for( Int e=0; e<numEdges; ++e )
+        ++coarse.offsets[allSources[e]+1];
+    for( Int c=0; c<numCoarse; ++c )
+        coarse.offsets[c+1] += coarse.offsets[c];
+    SwapClear( allSources );
+
+    // Partition the coarse graph differently on each process and keep the best
+    // ========================================================================
+    vector<Int> coarsePart;
+    const Int separatorWeight =
+      Separator( coarse, numSeps, commRank, coarsePart );
+    vector<Int> separatorWeights( commSize );
+    mpi::AllGather( &separatorWeight, 1, separatorWeights.data(), 1, comm );
+    int bestRank = 0;
+    for( int q=1; q<commSize; ++q )
+        if( separatorWeights[q] < separatorWeights[bestRank] )
+            bestRank = q;
+    mpi::Broadcast( coarsePart.data(), numCoarse, bestRank, comm );
+
+    // Project the separator and thin it (towards one side at a time, so that
+    // concurrent moves cannot connect the two sides)
+    // =====================================================================
+    vector<Int> part( numLocalSources );
+    for( Int s=0; s<numLocalSources; ++s )
+        part[s] = coarsePart[firstLocalCoarse+localMap[s]];
+    SwapClear( coarsePart );
+    Int partWeights[3] = { 0, 0, 0 };
+    for( Int s=0; s<numLocalSources; ++s )
+        ++partWeights[part[s]];
+    mpi::AllReduce( partWeights, 3, comm );
+    const Int maxPartWeight = Max
+      ( Int(Ceil((1+imbalance)*numSources/2.)), (numSources+1)/2 );
+    const Int firstSide = ( partWeights[0] <= partWeights[1] ? 0 : 1 );
+    DistMap partMap( numSources, grid );
+    for( Int round=0; round<2; ++round )
+    {
+        const Int side = ( round == 0 ? firstSide : 1-firstSide );
+        for( Int s=0; s<numLocalSources; ++s )
+            partMap.SetLocal( s, part[s] );
+        vector<Int> targetParts( targets );
+        partMap.Translate( targetParts );
+
+        // Split the remaining room on this side evenly between the processes
+        Int room = (maxPartWeight-partWeights[side]) / commSize;
+        Int numLocalMoved = 0;
+        for( Int s=0; s<numLocalSources && room>0; ++s )
+        {
+            if( part[s] != 2 )
+                continue;
+            bool touchesOther = false;
+            for( Int e=offsets[s]; e<offsets[s+1]; ++e )
+                if( targetParts[e] == 1-side )
+                    touchesOther = true;
+            if( !touchesOther )
+            {
+                part[s] = side;
+                --room;
+                ++numLocalMoved;
+            }
+        }
+        const Int numMoved = mpi::AllReduce( numLocalMoved, comm );
+        partWeights[side] += numMoved;
+        partWeights[2] -= numMoved;
+    }
+
+    // Order the left part, then the right part, and then the separator
+    // ================================================================
+    Int localSizes[3] = { 0, 0, 0 };
+    for( Int s=0; s<numLocalSources; ++s )
+        ++localSizes[part[s]];
+    Int localOffs[3];
+    mpi::Scan( localSizes, localOffs, 3, mpi::SUM, comm );
+    for( Int j=0; j<3; ++j )
+    {
+        localOffs[j] -= localSizes[j];
+        sizes[j] = partWeights[j];
+    }
+    localOffs[1] += sizes[0];
+    localOffs[2] += sizes[0] + sizes[1];
+
+    perm.SetGrid( grid );
+    perm.Resize( numSources );
+    for( Int s=0; s<numLocalSources; ++s )
+        perm.SetLocal( s, localOffs[part[s]]++ );
+}
+
+} // namespace bisect
+} // namespace El
+
+#endif // ifndef EL_BISECT_MULTILEVEL_HPP
@@ -101,16 +101,20 @@ ElError ElBPDNADMMCtrlDefault_d( ElBPDNADMMCtrl_d* ctrl )
 ElError ElBPDNCtrlDefault_s( ElBPDNCtrl_s* ctrl )
 {
     ctrl->useIPM = true;
+    ctrl->useFISTA = false;
     ElBPDNADMMCtrlDefault_s( &ctrl->admmCtrl );
     ElQPAffineCtrlDefault_s( &ctrl->ipmCtrl );
+    ElFirstOrderCtrlDefault_s( &ctrl->fistaCtrl );
     return EL_SUCCESS;
 }
 
 ElError ElBPDNCtrlDefault_d( ElBPDNCtrl_d* ctrl )
 {
     ctrl->useIPM = true;
+    ctrl->useFISTA = false;
     ElBPDNADMMCtrlDefault_d( &ctrl->admmCtrl );
     ElQPAffineCtrlDefault_d( &ctrl->ipmCtrl );
+    ElFirstOrderCtrlDefault_d( &ctrl->fistaCtrl );
     return EL_SUCCESS;
 }
 
@@ -122,6 +126,7 @@ ElError ElNNLSCtrlDefault_s( ElNNLSCtrl_s* ctrl )
     ElADMMCtrlDefault_s( &ctrl->admmCtrl );
     ElQPDirectCtrlDefault_s( &ctrl->qpCtrl );
     ElSOCPAffineCtrlDefault_s( &ctrl->socpCtrl );
+    ElFirstOrderCtrlDefault_s( &ctrl->fistaCtrl );
     return EL_SUCCESS;
 }
 
@@ -131,6 +136,7 @@ ElError ElNNLSCtrlDefault_d( ElNNLSCtrl_d* ctrl )
     ElADMMCtrlDefault_d( &ctrl->admmCtrl );
     ElQPDirectCtrlDefault_d( &ctrl->qpCtrl );
     ElSOCPAffineCtrlDefault_d( &ctrl->socpCtrl );
+    ElFirstOrderCtrlDefault_d( &ctrl->fistaCtrl );
     return EL_SUCCESS;
 }
 
@@ -140,6 +146,9 @@ ElError ElNMFCtrlDefault_s( ElNMFCtrl_s* ctrl )
 {
     ElNNLSCtrlDefault_s( &ctrl->nnlsCtrl );
     ctrl->maxIter = 20;
+    ctrl->approach = EL_NMF_NNLS;
+    ctrl->tol = 0;
+    ctrl->progress = false;
     return EL_SUCCESS;
 }
 
@@ -147,6 +156,9 @@ ElError ElNMFCtrlDefault_d( ElNMFCtrl_d* ctrl )
 {
     ElNNLSCtrlDefault_d( &ctrl->nnlsCtrl );
     ctrl->maxIter = 20;
+    ctrl->approach = EL_NMF_NNLS;
+    ctrl->tol = 0;
+    ctrl->progress = false;
     return EL_SUCCESS;
 }
 
@@ -156,8 +168,10 @@ ElError ElRPCACtrlDefault_s( ElRPCACtrl_s* ctrl )
 {
     ctrl->useALM = true;
     ctrl->usePivQR = false;
+    ctrl->useSubspace = false;
     ctrl->progress = true;
     ctrl->numPivSteps = 7;
+    ctrl->numSubspaceIts = 2;
     ctrl->maxIts = 1000;
     ctrl->tau = 0;
     ctrl->beta = 1;
@@ -170,8 +184,10 @@ ElError ElRPCACtrlDefault_d( ElRPCACtrl_d* ctrl )
 {
     ctrl->useALM = true;
     ctrl->usePivQR = false;
+    ctrl->useSubspace = false;
     ctrl->progress = true;
     ctrl->numPivSteps = 7;
+    ctrl->numSubspaceIts = 2;
     ctrl->maxIts = 1000;
     ctrl->tau = 0;
     ctrl->beta = 1;
@@ -190,6 +206,8 @@ ElError ElSparseInvCovCtrlDefault_s( ElSparseInvCovCtrl_s* ctrl )
     ctrl->absTol = 1e-6;
     ctrl->relTol = 1e-4;
     ctrl->progress = true;
+    ctrl->screen = true;
+    ctrl->maxLocalBlockSize = 1000;
     return EL_SUCCESS;
 }
 
@@ -201,20 +219,48 @@ ElError ElSparseInvCovCtrlDefault_d( ElSparseInvCovCtrl_d* ctrl )
     ctrl->absTol = 1e-6;
     ctrl->relTol = 1e-4;
     ctrl->progress = true;
+    ctrl->screen = true;
+    ctrl->maxLocalBlockSize = 1000;
     return EL_SUCCESS;
 }
 
 /* Support Vector Machine
    ====================== */
+ElError ElSVMCoordinateDescentCtrlDefault_s
+( ElSVMCoordinateDescentCtrl_s* ctrl )
+{
+    ctrl->squaredHinge = false;
+    ctrl->shrink = true;
+    ctrl->maxIter = 1000;
+    ctrl->tol = 0.1;
+    ctrl->progress = false;
+    return EL_SUCCESS;
+}
+
+ElError ElSVMCoordinateDescentCtrlDefault_d
+( ElSVMCoordinateDescentCtrl_d* ctrl )
+{
+    ctrl->squaredHinge = false;
+    ctrl->shrink = true;
+    ctrl->maxIter = 1000;
+    ctrl->tol = 0.1;
+    ctrl->progress = false;
+    return EL_SUCCESS;
+}
+
 ElError ElSVMCtrlDefault_s( ElSVMCtrl_s* ctrl )
 {
+    ctrl->approach = EL_SVM_IPM;
     ElQPAffineCtrlDefault_s( &ctrl->ipmCtrl );
+    ElSVMCoordinateDescentCtrlDefault_s( &ctrl->cdCtrl );
     return EL_SUCCESS;
 }
 
 ElError ElSVMCtrlDefault_d( ElSVMCtrl_d* ctrl )
 {
+    ctrl->approach = EL_SVM_IPM;
     ElQPAffineCtrlDefault_d( &ctrl->ipmCtrl );
+    ElSVMCoordinateDescentCtrlDefault_d( &ctrl->cdCtrl );
     return EL_SUCCESS;
 }
 
@@ -609,6 +655,18 @@ ElError ElSVMCtrlDefault_d( ElSVMCtrl_d* ctrl )
     ElNMFCtrl_ ## SIG ctrl ) \
   { EL_TRY( NMF( *CReflect(A), *CReflect(X), *CReflect(Y), \
       CReflect(ctrl) ) ) } \
+  ElError ElNMFXSparse_ ## SIG \
+  ( ElConstSparseMatrix_ ## SIG A, \
+    ElMatrix_ ## SIG X, ElMatrix_ ## SIG Y, \
+    ElNMFCtrl_ ## SIG ctrl ) \
+  { EL_TRY( NMF( *CReflect(A), *CReflect(X), *CReflect(Y), \
+      CReflect(ctrl) ) ) } \
+  ElError ElNMFXDistSparse_ ## SIG \
+  ( ElConstDistSparseMatrix_ ## SIG A, \
+    ElDistMultiVec_ ## SIG X, ElDistMultiVec_ ## SIG Y, \
+    ElNMFCtrl_ ## SIG ctrl ) \
+  { EL_TRY( NMF( *CReflect(A), *CReflect(X), *CReflect(Y), \
+      CReflect(ctrl) ) ) } \
   /* Robust least squares
      ==================== */ \
   ElError ElRLS_ ## SIG \
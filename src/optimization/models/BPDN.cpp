@@ -9,6 +9,7 @@
 #include <El.hpp>
 #include "./BPDN/ADMM.hpp"
 #include "./BPDN/IPM.hpp"
+#include "./BPDN/FISTA.hpp"
 
 namespace El {
 
@@ -21,7 +22,9 @@ void BPDN
   const BPDNCtrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
-    if( ctrl.useIPM )
+    if( ctrl.useFISTA )
+        bpdn::FISTA( A, b, lambda, x, ctrl.fistaCtrl );
+    else if( ctrl.useIPM )
         bpdn::IPM( A, b, lambda, x, ctrl.ipmCtrl );
     else
         bpdn::ADMM( A, b, lambda, x, ctrl.admmCtrl );
@@ -36,7 +39,9 @@ void BPDN
   const BPDNCtrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
-    if( ctrl.useIPM )
+    if( ctrl.useFISTA )
+        bpdn::FISTA( A, b, lambda, x, ctrl.fistaCtrl );
+    else if( ctrl.useIPM )
         bpdn::IPM( A, b, lambda, x, ctrl.ipmCtrl );
     else
         bpdn::ADMM( A, b, lambda, x, ctrl.admmCtrl );
@@ -51,9 +56,12 @@ void BPDN
   const BPDNCtrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
-    if( !ctrl.useIPM )
+    if( ctrl.useFISTA )
+        bpdn::FISTA( A, b, lambda, x, ctrl.fistaCtrl );
+    else if( ctrl.useIPM )
+        bpdn::IPM( A, b, lambda, x, ctrl.ipmCtrl );
+    else
         LogicError("ADMM-based BPDN not yet supported for sparse matrices");
-    bpdn::IPM( A, b, lambda, x, ctrl.ipmCtrl );
 }
 
 template<typename Real>
@@ -65,9 +73,12 @@ void BPDN
   const BPDNCtrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
-    if( !ctrl.useIPM )
+    if( ctrl.useFISTA )
+        bpdn::FISTA( A, b, lambda, x, ctrl.fistaCtrl );
+    else if( ctrl.useIPM )
+        bpdn::IPM( A, b, lambda, x, ctrl.ipmCtrl );
+    else
         LogicError("ADMM-based BPDN not yet supported for sparse matrices");
-    bpdn::IPM( A, b, lambda, x, ctrl.ipmCtrl );
 }
 
 #define PROTO(Real) \
@@ -0,0 +1,90 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "../FirstOrder.hpp"
+
+namespace El {
+namespace bpdn {
+
+// Solve
+//
+//   min (1/2) || b - A x ||_2^2 + lambda || x ||_1
+//
+// via FISTA, whose proximal map is soft-thresholding by (step*lambda).
+// Only products with A and A^T are required.
+//
+
+template<typename Real>
+void FISTA
+( const Matrix<Real>& A,
+  const Matrix<Real>& b,
+        Real lambda,
+        Matrix<Real>& x,
+  const FirstOrderCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    auto prox = [&]( Matrix<Real>& z, Real step )
+      { SoftThreshold( z, step*lambda ); };
+    Zeros( x, A.Width(), b.Width() );
+    first_order::FISTA( A, b, x, Real(1), Real(0), prox, ctrl );
+}
+
+template<typename Real>
+void FISTA
+( const AbstractDistMatrix<Real>& APre,
+  const AbstractDistMatrix<Real>& bPre,
+        Real lambda,
+        AbstractDistMatrix<Real>& xPre,
+  const FirstOrderCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    DistMatrixReadProxy<Real,Real,MC,MR> AProx( APre ), bProx( bPre );
+    DistMatrixWriteProxy<Real,Real,MC,MR> xProx( xPre );
+    auto& A = AProx.GetLocked();
+    auto& b = bProx.GetLocked();
+    auto& x = xProx.Get();
+
+    auto prox = [&]( DistMatrix<Real>& z, Real step )
+      { SoftThreshold( z.Matrix(), step*lambda ); };
+    Zeros( x, A.Width(), b.Width() );
+    first_order::FISTA( A, b, x, Real(1), Real(0), prox, ctrl );
+}
+
+template<typename Real>
+void FISTA
+( const SparseMatrix<Real>& A,
+  const Matrix<Real>& b,
+        Real lambda,
+        Matrix<Real>& x,
+  const FirstOrderCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    auto prox = [&]( Matrix<Real>& z, Real step )
+      { SoftThreshold( z, step*lambda ); };
+    Zeros( x, A.Width(), b.Width() );
+    first_order::FISTA( A, b, x, Real(1), Real(0), prox, ctrl );
+}
+
+template<typename Real>
+void FISTA
+( const DistSparseMatrix<Real>& A,
+  const DistMultiVec<Real>& b,
+        Real lambda,
+        DistMultiVec<Real>& x,
+  const FirstOrderCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    auto prox = [&]( DistMultiVec<Real>& z, Real step )
+      { SoftThreshold( z.Matrix(), step*lambda ); };
+    x.SetGrid( b.Grid() );
+    Zeros( x, A.Width(), b.Width() );
+    first_order::FISTA( A, b, x, Real(1), Real(0), prox, ctrl );
+}
+
+} // namespace bpdn
+} // namespace El
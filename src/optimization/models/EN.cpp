@@ -7,6 +7,7 @@
    http://opensource.org/licenses/BSD-2-Clause
 */
 #include <El.hpp>
+#include "./FirstOrder.hpp"
 
 // An elastic net seeks the solution to the optimization problem
 //
@@ -349,6 +350,83 @@ void EN
     x.ProcessQueues();
 }
 
+// Matrix-free FISTA variants
+// ==========================
+// The smooth portion, || b - A x ||_2^2 + lambda_2 || x ||_2^2, has gradient
+// 2 A^T (A x - b) + 2 lambda_2 x, while the proximal map of the l1 penalty is
+// soft-thresholding.
+
+template<typename Real>
+void EN
+( const Matrix<Real>& A,
+  const Matrix<Real>& b,
+        Real lambda1,
+        Real lambda2,
+        Matrix<Real>& x,
+  const FirstOrderCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    auto prox = [&]( Matrix<Real>& z, Real step )
+      { SoftThreshold( z, step*lambda1 ); };
+    Zeros( x, A.Width(), b.Width() );
+    first_order::FISTA( A, b, x, Real(2), 2*lambda2, prox, ctrl );
+}
+
+template<typename Real>
+void EN
+( const AbstractDistMatrix<Real>& APre,
+  const AbstractDistMatrix<Real>& bPre,
+        Real lambda1,
+        Real lambda2,
+        AbstractDistMatrix<Real>& xPre,
+  const FirstOrderCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    DistMatrixReadProxy<Real,Real,MC,MR> AProx( APre ), bProx( bPre );
+    DistMatrixWriteProxy<Real,Real,MC,MR> xProx( xPre );
+    auto& A = AProx.GetLocked();
+    auto& b = bProx.GetLocked();
+    auto& x = xProx.Get();
+
+    auto prox = [&]( DistMatrix<Real>& z, Real step )
+      { SoftThreshold( z.Matrix(), step*lambda1 ); };
+    Zeros( x, A.Width(), b.Width() );
+    first_order::FISTA( A, b, x, Real(2), 2*lambda2, prox, ctrl );
+}
+
+template<typename Real>
+void EN
+( const SparseMatrix<Real>& A,
+  const Matrix<Real>& b,
+        Real lambda1,
+        Real lambda2,
+        Matrix<Real>& x,
+  const FirstOrderCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    auto prox = [&]( Matrix<Real>& z, Real step )
+      { SoftThreshold( z, step*lambda1 ); };
+    Zeros( x, A.Width(), b.Width() );
+    first_order::FISTA( A, b, x, Real(2), 2*lambda2, prox, ctrl );
+}
+
+template<typename Real>
+void EN
+( const DistSparseMatrix<Real>& A,
+  const DistMultiVec<Real>& b,
+        Real lambda1,
+        Real lambda2,
+        DistMultiVec<Real>& x,
+  const FirstOrderCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    auto prox = [&]( DistMultiVec<Real>& z, Real step )
+      { SoftThreshold( z.Matrix(), step*lambda1 ); };
+    x.SetGrid( b.Grid() );
+    Zeros( x, A.Width(), b.Width() );
+    first_order::FISTA( A, b, x, Real(2), 2*lambda2, prox, ctrl );
+}
+
 #define PROTO(Real) \
   template void EN \
   ( const Matrix<Real>& A, \
@@ -377,7 +455,35 @@ void EN
           Real lambda1, \
           Real lambda2, \
           DistMultiVec<Real>& x, \
-    const qp::affine::Ctrl<Real>& ctrl );
+    const qp::affine::Ctrl<Real>& ctrl ); \
+  template void EN \
+  ( const Matrix<Real>& A, \
+    const Matrix<Real>& b, \
+          Real lambda1, \
+          Real lambda2, \
+          Matrix<Real>& x, \
+    const FirstOrderCtrl<Real>& ctrl ); \
+  template void EN \
+  ( const AbstractDistMatrix<Real>& A, \
+    const AbstractDistMatrix<Real>& b, \
+          Real lambda1, \
+          Real lambda2, \
+          AbstractDistMatrix<Real>& x, \
+    const FirstOrderCtrl<Real>& ctrl ); \
+  template void EN \
+  ( const SparseMatrix<Real>& A, \
+    const Matrix<Real>& b, \
+          Real lambda1, \
+          Real lambda2, \
+          Matrix<Real>& x, \
+    const FirstOrderCtrl<Real>& ctrl ); \
+  template void EN \
+  ( const DistSparseMatrix<Real>& A, \
+    const DistMultiVec<Real>& b, \
+          Real lambda1, \
+          Real lambda2, \
+          DistMultiVec<Real>& x, \
+    const FirstOrderCtrl<Real>& ctrl );
 
 #define EL_NO_INT_PROTO
 #define EL_NO_COMPLEX_PROTO
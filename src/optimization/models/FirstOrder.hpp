@@ -0,0 +1,275 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_MODELS_FIRSTORDER_HPP
+#define EL_MODELS_FIRSTORDER_HPP
+
+// Matrix-free first-order drivers which only require the application of a
+// (sparse or dense) operator and its transpose, along with cheap proximal
+// maps, so that each iteration costs O(nnz(A)) work and no factorization
+// memory is required.
+//
+// FISTA solves
+//
+//   min (c/2) || A x - b ||_2^2 + (mu/2) || x ||_2^2 + g(x)
+//
+// via the accelerated proximal gradient method of [1], with the
+// gradient-based adaptive restart of [2].
+//
+// PDHG solves
+//
+//   min f(x) + g(K x)
+//
+// via the (accelerated, if f is gamma-strongly convex) primal-dual hybrid
+// gradient method of [3], given the proximal maps of f and of the convex
+// conjugate g^*.
+//
+// In both cases, unless a step size is explicitly specified, the relevant
+// operator norm is estimated with a few steps of the power method.
+//
+// [1] A. Beck and M. Teboulle, "A fast iterative shrinkage-thresholding
+//     algorithm for linear inverse problems", SIAM J. Imaging Sciences,
+//     Vol. 2, No. 1, 2009.
+//
+// [2] B. O'Donoghue and E. Candes, "Adaptive restart for accelerated gradient
+//     schemes", Foundations of Computational Mathematics, Vol. 15, 2015.
+//
+// [3] A. Chambolle and T. Pock, "A first-order primal-dual algorithm for
+//     convex problems with applications to imaging", J. Math. Imaging and
+//     Vision, Vol. 40, No. 1, 2011.
+//
+
+namespace El {
+namespace first_order {
+
+// Y := alpha op(A) X
+// ==================
+template<typename Real>
+void Apply
+( Orientation orientation, Real alpha,
+  const Matrix<Real>& A, const Matrix<Real>& X, Matrix<Real>& Y )
+{ Gemm( orientation, NORMAL, alpha, A, X, Y ); }
+
+template<typename Real>
+void Apply
+( Orientation orientation, Real alpha,
+  const DistMatrix<Real>& A, const DistMatrix<Real>& X, DistMatrix<Real>& Y )
+{ Gemm( orientation, NORMAL, alpha, A, X, Y ); }
+
+template<typename Real>
+void Apply
+( Orientation orientation, Real alpha,
+  const SparseMatrix<Real>& A, const Matrix<Real>& X, Matrix<Real>& Y )
+{
+    const Int height = ( orientation==NORMAL ? A.Height() : A.Width() );
+    Zeros( Y, height, X.Width() );
+    Multiply( orientation, alpha, A, X, Real(0), Y );
+}
+
+template<typename Real>
+void Apply
+( Orientation orientation, Real alpha,
+  const DistSparseMatrix<Real>& A,
+  const DistMultiVec<Real>& X,
+        DistMultiVec<Real>& Y )
+{
+    const Int height = ( orientation==NORMAL ? A.Height() : A.Width() );
+    Y.SetGrid( X.Grid() );
+    Zeros( Y, height, X.Width() );
+    Multiply( orientation, alpha, A, X, Real(0), Y );
+}
+
+// The entrywise proximal maps only need the locally-owned entries
+// ===============================================================
+template<typename Real>
+Matrix<Real>& LocalPart( Matrix<Real>& X ) { return X; }
+template<typename Real>
+Matrix<Real>& LocalPart( DistMatrix<Real>& X ) { return X.Matrix(); }
+template<typename Real>
+Matrix<Real>& LocalPart( DistMultiVec<Real>& X ) { return X.Matrix(); }
+
+// Estimate || A ||_2^2 via the power method on A^T A
+// ==================================================
+template<typename Real,class OpType,class VecType>
+Real TwoNormSquaredEstimate
+( const OpType& A, const VecType& x, Int numPowerIts )
+{
+    EL_DEBUG_CSE
+    VecType v(x), w(x);
+    Uniform( v, A.Width(), 1 );
+    Real normSq = 0;
+    for( Int it=0; it<Max(numPowerIts,1); ++it )
+    {
+        const Real vNorm = FrobeniusNorm( v );
+        if( vNorm == Real(0) )
+            break;
+        Scale( Real(1)/vNorm, v );
+        Apply( NORMAL, Real(1), A, v, w );
+        Apply( TRANSPOSE, Real(1), A, w, v );
+        normSq = FrobeniusNorm( v );
+    }
+    return normSq;
+}
+
+// Accelerated proximal gradient
+// =============================
+// The functor 'prox' is called as prox(x,t) and should overwrite x with the
+// proximal map of t g evaluated at x. Returns the number of iterations.
+template<typename Real,class OpType,class VecType,class ProxType>
+Int FISTA
+( const OpType& A,
+  const VecType& b,
+        VecType& x,
+        Real c,
+        Real mu,
+  const ProxType& prox,
+  const FirstOrderCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Width();
+    const Int k = b.Width();
+    if( x.Height() != n || x.Width() != k )
+        Zeros( x, n, k );
+
+    Real step = ctrl.stepSize;
+    if( step <= Real(0) )
+    {
+        // The power method underestimates the Lipschitz constant, so pad it
+        const Real normSq =
+          TwoNormSquaredEstimate<Real>( A, x, ctrl.numPowerIts );
+        const Real lipschitz = Real(1.05)*(c*normSq + mu);
+        step = ( lipschitz > Real(0) ? Real(1)/lipschitz : Real(1) );
+    }
+
+    VecType y(x), xOld(x), xDiff(x), grad(x), r(b);
+    Real theta = 1;
+    Int numIts = 0;
+    for( ; numIts<ctrl.maxIter; ++numIts )
+    {
+        // grad := c A^T (A y - b) + mu y
+        Apply( NORMAL, Real(1), A, y, r );
+        Axpy( Real(-1), b, r );
+        Apply( TRANSPOSE, c, A, r, grad );
+        if( mu != Real(0) )
+            Axpy( mu, y, grad );
+
+        // x := prox_{step g}(y - step grad)
+        xOld = x;
+        x = y;
+        Axpy( -step, grad, x );
+        prox( x, step );
+
+        xDiff = x;
+        Axpy( Real(-1), xOld, xDiff );
+        const Real diffNorm = FrobeniusNorm( xDiff );
+        const Real xNorm = FrobeniusNorm( x );
+        const Real relChange = diffNorm / Max(xNorm,Real(1));
+        if( ctrl.progress )
+            Output("  iter ",numIts,": || x - xOld ||_F / || x ||_F = ",
+              relChange);
+        if( relChange <= ctrl.tol )
+        {
+            ++numIts;
+            break;
+        }
+
+        // Restart the momentum whenever it opposes the proximal step,
+        // i.e., when (y - x)^T (x - xOld) > 0
+        Axpy( Real(-1), x, y );
+        if( ctrl.adaptiveRestart && Dot( y, xDiff ) > Real(0) )
+        {
+            theta = 1;
+            y = x;
+            continue;
+        }
+
+        const Real thetaNew = (1 + Sqrt(1+4*theta*theta)) / 2;
+        y = x;
+        Axpy( (theta-1)/thetaNew, xDiff, y );
+        theta = thetaNew;
+    }
+    if( ctrl.progress && numIts == ctrl.maxIter )
+        Output("FISTA did not converge within ",ctrl.maxIter," iterations");
+    return numIts;
+}
+
+// Primal-dual hybrid gradient
+// ===========================
+// The functors are called as primalProx(x,tau), which should overwrite x with
+// prox_{tau f}(x), and dualProx(y,sigma), which should overwrite y with
+// prox_{sigma g^*}(y). If gamma > 0, f is assumed to be gamma-strongly convex
+// and the step sizes are accelerated. Returns the number of iterations.
+template<typename Real,class OpType,class VecType,
+         class PrimalProxType,class DualProxType>
+Int PDHG
+( const OpType& K,
+        VecType& x,
+        VecType& y,
+  const PrimalProxType& primalProx,
+  const DualProxType& dualProx,
+        Real gamma,
+  const FirstOrderCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    Real tau = ctrl.stepSize;
+    if( tau <= Real(0) )
+    {
+        const Real normSq =
+          TwoNormSquaredEstimate<Real>( K, x, ctrl.numPowerIts );
+        tau = ( normSq > Real(0) ? Real(0.95)/Sqrt(normSq) : Real(1) );
+    }
+    Real sigma = tau;
+
+    VecType xBar(x), xOld(x), Kx(y), KTy(x);
+    Int numIts = 0;
+    for( ; numIts<ctrl.maxIter; ++numIts )
+    {
+        // y := prox_{sigma g^*}(y + sigma K xBar)
+        Apply( NORMAL, sigma, K, xBar, Kx );
+        Axpy( Real(1), Kx, y );
+        dualProx( y, sigma );
+
+        // x := prox_{tau f}(x - tau K^T y)
+        xOld = x;
+        Apply( TRANSPOSE, tau, K, y, KTy );
+        Axpy( Real(-1), KTy, x );
+        primalProx( x, tau );
+
+        Real theta = 1;
+        if( gamma > Real(0) )
+        {
+            theta = 1 / Sqrt(1+2*gamma*tau);
+            tau *= theta;
+            sigma /= theta;
+        }
+
+        // xBar := x + theta (x - xOld)
+        Axpy( Real(-1), x, xOld );
+        const Real diffNorm = FrobeniusNorm( xOld );
+        const Real xNorm = FrobeniusNorm( x );
+        const Real relChange = diffNorm / Max(xNorm,Real(1));
+        if( ctrl.progress )
+            Output("  iter ",numIts,": || x - xOld ||_F / || x ||_F = ",
+              relChange);
+        if( relChange <= ctrl.tol )
+        {
+            ++numIts;
+            break;
+        }
+        xBar = x;
+        Axpy( -theta, xOld, xBar );
+    }
+    if( ctrl.progress && numIts == ctrl.maxIter )
+        Output("PDHG did not converge within ",ctrl.maxIter," iterations");
+    return numIts;
+}
+
+} // namespace first_order
+} // namespace El
+
+#endif // ifndef EL_MODELS_FIRSTORDER_HPP
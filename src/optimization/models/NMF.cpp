@@ -7,12 +7,13 @@
    http://opensource.org/licenses/BSD-2-Clause
 */
 #include <El.hpp>
+#include "./NMF/HALS.hpp"
 
 namespace El {
 
 // TODO(poulson):
-// Better convergence criterions. E.g., accept a relative tolerance in addition
-// to the maximum number of iterations.
+// Better convergence criterions for the NNLS approach. E.g., accept a
+// relative tolerance in addition to the maximum number of iterations.
 
 template<typename Real>
 void NMF
@@ -22,6 +23,11 @@ void NMF
   const NMFCtrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
+    if( ctrl.approach != NMF_NNLS )
+    {
+        nmf::Alternate( A, X, Y, ctrl );
+        return;
+    }
 
     Matrix<Real> AAdj, XAdj, YAdj;
     Adjoint( A, AAdj );
@@ -43,6 +49,19 @@ void NMF
   const NMFCtrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
+    if( ctrl.approach != NMF_NNLS )
+    {
+        // Keep entire rows of the factors local so that the column updates
+        // do not require communication
+        DistMatrixReadProxy<Real,Real,MC,MR> AProx( APre );
+        auto& A = AProx.GetLocked();
+        DistMatrix<Real,VC,STAR> X(A.Grid()), Y(A.Grid());
+        Copy( XPre, X );
+        nmf::Alternate( A, X, Y, ctrl );
+        Copy( X, XPre );
+        Copy( Y, YPre );
+        return;
+    }
 
     DistMatrixReadProxy<Real,Real,MC,MR>
       AProx( APre );
@@ -66,6 +85,33 @@ void NMF
     }
 }
 
+template<typename Real>
+void NMF
+( const SparseMatrix<Real>& A,
+        Matrix<Real>& X,
+        Matrix<Real>& Y,
+  const NMFCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( ctrl.approach == NMF_NNLS )
+        LogicError("Sparse NMF requires the HALS or multiplicative approach");
+    nmf::Alternate( A, X, Y, ctrl );
+}
+
+template<typename Real>
+void NMF
+( const DistSparseMatrix<Real>& A,
+        DistMultiVec<Real>& X,
+        DistMultiVec<Real>& Y,
+  const NMFCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( ctrl.approach == NMF_NNLS )
+        LogicError("Sparse NMF requires the HALS or multiplicative approach");
+    Y.SetGrid( X.Grid() );
+    nmf::Alternate( A, X, Y, ctrl );
+}
+
 #define PROTO(Real) \
   template void NMF \
   ( const Matrix<Real>& A, \
@@ -76,6 +122,16 @@ void NMF
   ( const AbstractDistMatrix<Real>& A, \
           AbstractDistMatrix<Real>& X, \
           AbstractDistMatrix<Real>& Y, \
+    const NMFCtrl<Real>& ctrl ); \
+  template void NMF \
+  ( const SparseMatrix<Real>& A, \
+          Matrix<Real>& X, \
+          Matrix<Real>& Y, \
+    const NMFCtrl<Real>& ctrl ); \
+  template void NMF \
+  ( const DistSparseMatrix<Real>& A, \
+          DistMultiVec<Real>& X, \
+          DistMultiVec<Real>& Y, \
     const NMFCtrl<Real>& ctrl );
 
 #define EL_NO_INT_PROTO
@@ -0,0 +1,217 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_NMF_HALS_HPP
+#define EL_NMF_HALS_HPP
+
+// Alternating updates of the factors of A ~= X Y^T, with X, Y >= 0, which
+// avoid solving full NNLS subproblems. Each half-step only requires a single
+// product with A (or A^T), e.g., P := A^T X, along with the k x k Gram
+// matrix G := X^T X, after which the factor is updated in place using only
+// its locally-owned rows:
+//
+//   HALS [1]:
+//     for l=0,...,k-1,
+//       Y(:,l) := max(0, Y(:,l) + (P(:,l) - Y G(:,l)) / G(l,l)),
+//
+//   Multiplicative [2]:
+//     Y := Y .* P ./ (Y G).
+//
+// Since the distributed factors are stored with entire rows local to each
+// process, the only communication beyond the products with A is the
+// summation of the k x k Gram matrices.
+//
+// [1] A. Cichocki and A.-H. Phan, "Fast local algorithms for large scale
+//     nonnegative matrix and tensor factorizations", IEICE Transactions on
+//     Fundamentals of Electronics, Vol. E92-A, No. 3, 2009.
+//
+// [2] D. Lee and H. S. Seung, "Algorithms for non-negative matrix
+//     factorization", Advances in Neural Information Processing Systems 13,
+//     2001.
+//
+
+namespace El {
+namespace nmf {
+
+// P := op(A) X
+// ============
+template<typename Real>
+void Apply
+( Orientation orientation,
+  const Matrix<Real>& A, const Matrix<Real>& X, Matrix<Real>& P )
+{ Gemm( orientation, NORMAL, Real(1), A, X, P ); }
+
+template<typename Real>
+void Apply
+( Orientation orientation,
+  const DistMatrix<Real>& A,
+  const DistMatrix<Real,VC,STAR>& X,
+        DistMatrix<Real,VC,STAR>& P )
+{ Gemm( orientation, NORMAL, Real(1), A, X, P ); }
+
+template<typename Real>
+void Apply
+( Orientation orientation,
+  const SparseMatrix<Real>& A, const Matrix<Real>& X, Matrix<Real>& P )
+{
+    const Int height = ( orientation==NORMAL ? A.Height() : A.Width() );
+    Zeros( P, height, X.Width() );
+    Multiply( orientation, Real(1), A, X, Real(0), P );
+}
+
+template<typename Real>
+void Apply
+( Orientation orientation,
+  const DistSparseMatrix<Real>& A,
+  const DistMultiVec<Real>& X,
+        DistMultiVec<Real>& P )
+{
+    const Int height = ( orientation==NORMAL ? A.Height() : A.Width() );
+    P.SetGrid( X.Grid() );
+    Zeros( P, height, X.Width() );
+    Multiply( orientation, Real(1), A, X, Real(0), P );
+}
+
+// G := X^T X (replicated)
+// =======================
+template<typename Real>
+void Gram( const Matrix<Real>& X, Matrix<Real>& G )
+{ Gemm( TRANSPOSE, NORMAL, Real(1), X, X, G ); }
+
+template<typename Real>
+void Gram( const DistMatrix<Real,VC,STAR>& X, Matrix<Real>& G )
+{
+    Gemm( TRANSPOSE, NORMAL, Real(1), X.LockedMatrix(), X.LockedMatrix(), G );
+    AllReduce( G, X.ColComm() );
+}
+
+template<typename Real>
+void Gram( const DistMultiVec<Real>& X, Matrix<Real>& G )
+{
+    Gemm( TRANSPOSE, NORMAL, Real(1), X.LockedMatrix(), X.LockedMatrix(), G );
+    AllReduce( G, X.Grid().Comm() );
+}
+
+template<typename Real>
+Matrix<Real>& LocalPart( Matrix<Real>& X ) { return X; }
+template<typename Real>
+Matrix<Real>& LocalPart( DistMatrix<Real,VC,STAR>& X ) { return X.Matrix(); }
+template<typename Real>
+Matrix<Real>& LocalPart( DistMultiVec<Real>& X ) { return X.Matrix(); }
+
+template<typename Real>
+bool IsRoot( const Matrix<Real>& X ) { return true; }
+template<typename Real>
+bool IsRoot( const DistMatrix<Real,VC,STAR>& X )
+{ return X.Grid().Rank() == 0; }
+template<typename Real>
+bool IsRoot( const DistMultiVec<Real>& X )
+{ return X.Grid().Rank() == 0; }
+
+// Local updates of the rows of a factor
+// =====================================
+template<typename Real>
+void HALSSweep( const Matrix<Real>& G, const Matrix<Real>& P, Matrix<Real>& Y )
+{
+    EL_DEBUG_CSE
+    const Int k = G.Height();
+    Matrix<Real> t;
+    for( Int l=0; l<k; ++l )
+    {
+        // A zero column of the other factor leaves this column undetermined
+        const Real gamma = G(l,l);
+        if( gamma <= Real(0) )
+            continue;
+
+        // t := P(:,l) - Y G(:,l)
+        t = P( ALL, IR(l) );
+        Gemv( NORMAL, Real(-1), Y, G( ALL, IR(l) ), Real(1), t );
+
+        // Y(:,l) := max(0, Y(:,l) + t / gamma)
+        auto yl = Y( ALL, IR(l) );
+        Axpy( Real(1)/gamma, t, yl );
+        LowerClip( yl, Real(0) );
+    }
+}
+
+template<typename Real>
+void MultiplicativeUpdate
+( const Matrix<Real>& G, const Matrix<Real>& P, Matrix<Real>& Y )
+{
+    EL_DEBUG_CSE
+    const Int m = Y.Height();
+    const Int k = Y.Width();
+    const Real tiny = limits::SafeMin<Real>();
+    Matrix<Real> YG;
+    Gemm( NORMAL, NORMAL, Real(1), Y, G, YG );
+    for( Int l=0; l<k; ++l )
+        for( Int i=0; i<m; ++i )
+            Y(i,l) *= Max(P(i,l),Real(0)) / (YG(i,l)+tiny);
+}
+
+// Alternate between updating Y given X and X given Y
+// ==================================================
+template<typename Real,class OpType,class FactorType>
+void Alternate
+( const OpType& A,
+        FactorType& X,
+        FactorType& Y,
+  const NMFCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int k = X.Width();
+    const Real ANorm = FrobeniusNorm( A );
+    const bool multiplicative = ( ctrl.approach == NMF_MULTIPLICATIVE );
+
+    Matrix<Real> G, H;
+    FactorType P(X);
+    Zeros( Y, A.Width(), k );
+    Real relResid = 1;
+    for( Int iter=0; iter<ctrl.maxIter; ++iter )
+    {
+        // Update Y using P := A^T X and G := X^T X. Since the multiplicative
+        // update cannot leave zero, the initial Y is formed by a HALS sweep.
+        Apply( TRANSPOSE, A, X, P );
+        Gram( X, G );
+        if( multiplicative && iter > 0 )
+            MultiplicativeUpdate( G, LocalPart(P), LocalPart(Y) );
+        else
+            HALSSweep( G, LocalPart(P), LocalPart(Y) );
+
+        // Update X using P := A Y and G := Y^T Y
+        Apply( NORMAL, A, Y, P );
+        Gram( Y, G );
+        if( multiplicative )
+            MultiplicativeUpdate( G, LocalPart(P), LocalPart(X) );
+        else
+            HALSSweep( G, LocalPart(P), LocalPart(X) );
+
+        if( ctrl.tol > Real(0) || ctrl.progress )
+        {
+            // || A - X Y^T ||_F^2 = || A ||_F^2 - 2 <A Y, X> + <Y^T Y, X^T X>
+            Gram( X, H );
+            const Real residSq = ANorm*ANorm - 2*Dot(P,X) + Dot(G,H);
+            const Real newRelResid = ( ANorm == Real(0) ? Real(0) :
+              Sqrt(Max(residSq,Real(0))) / ANorm );
+            if( ctrl.progress && IsRoot(X) )
+                Output
+                ("NMF iter ",iter,": || A - X Y^T ||_F / || A ||_F = ",
+                 newRelResid);
+            const bool converged =
+              ( relResid-newRelResid <= ctrl.tol*relResid );
+            relResid = newRelResid;
+            if( ctrl.tol > Real(0) && converged )
+                break;
+        }
+    }
+}
+
+} // namespace nmf
+} // namespace El
+
+#endif // ifndef EL_NMF_HALS_HPP
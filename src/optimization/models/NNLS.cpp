@@ -10,6 +10,7 @@
 #include "./NNLS/SOCP.hpp"
 #include "./NNLS/QP.hpp"
 #include "./NNLS/ADMM.hpp"
+#include "./NNLS/FISTA.hpp"
 
 namespace El {
 
@@ -42,6 +43,12 @@ namespace El {
 // Note that the matrix A^T A is cached amongst all instances
 // (and this caching is the reason NNLS supports X and B as matrices).
 //
+// FISTA formulation
+// -----------------
+//
+// Solve all of the problems simultaneously with a matrix-free projected
+// accelerated gradient method which only requires products with A and A^T.
+//
 
 template<typename Real>
 void NNLS
@@ -55,6 +62,8 @@ void NNLS
         nnls::SOCP( A, B, X, ctrl.socpCtrl );
     else if( ctrl.approach == NNLS_QP )
         nnls::QP( A, B, X, ctrl.qpCtrl );
+    else if( ctrl.approach == NNLS_FISTA )
+        nnls::FISTA( A, B, X, ctrl.fistaCtrl );
     else
         nnls::ADMM( A, B, X, ctrl.admmCtrl );
 }
@@ -71,6 +80,8 @@ void NNLS
         nnls::SOCP( A, B, X, ctrl.socpCtrl );
     else if( ctrl.approach == NNLS_QP )
         nnls::QP( A, B, X, ctrl.qpCtrl );
+    else if( ctrl.approach == NNLS_FISTA )
+        nnls::FISTA( A, B, X, ctrl.fistaCtrl );
     else
         nnls::ADMM( A, B, X, ctrl.admmCtrl );
 }
@@ -87,6 +98,8 @@ void NNLS
         nnls::SOCP( A, B, X, ctrl.socpCtrl );
     else if( ctrl.approach == NNLS_QP )
         nnls::QP( A, B, X, ctrl.qpCtrl );
+    else if( ctrl.approach == NNLS_FISTA )
+        nnls::FISTA( A, B, X, ctrl.fistaCtrl );
     else
         LogicError("ADMM NNLS not yet supported for sparse matrices");
 }
@@ -103,6 +116,8 @@ void NNLS
         nnls::SOCP( A, B, X, ctrl.socpCtrl );
     else if( ctrl.approach == NNLS_QP )
         nnls::QP( A, B, X, ctrl.qpCtrl );
+    else if( ctrl.approach == NNLS_FISTA )
+        nnls::FISTA( A, B, X, ctrl.fistaCtrl );
     else
         LogicError("ADMM NNLS not yet supported for sparse matrices");
 }
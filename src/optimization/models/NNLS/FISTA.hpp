@@ -0,0 +1,87 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "../FirstOrder.hpp"
+
+namespace El {
+namespace nnls {
+
+// Solve each problem
+//
+//   min (1/2) || A x - b ||_2^2
+//   s.t. x >= 0
+//
+// via FISTA, whose proximal map is the projection onto the non-negative
+// orthant. Only products with A and A^T are required.
+//
+
+template<typename Real>
+void FISTA
+( const Matrix<Real>& A,
+  const Matrix<Real>& B,
+        Matrix<Real>& X,
+  const FirstOrderCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    auto prox = []( Matrix<Real>& Z, Real /*step*/ )
+      { LowerClip( Z, Real(0) ); };
+    Zeros( X, A.Width(), B.Width() );
+    first_order::FISTA( A, B, X, Real(1), Real(0), prox, ctrl );
+}
+
+template<typename Real>
+void FISTA
+( const AbstractDistMatrix<Real>& APre,
+  const AbstractDistMatrix<Real>& BPre,
+        AbstractDistMatrix<Real>& XPre,
+  const FirstOrderCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    DistMatrixReadProxy<Real,Real,MC,MR> AProx( APre ), BProx( BPre );
+    DistMatrixWriteProxy<Real,Real,MC,MR> XProx( XPre );
+    auto& A = AProx.GetLocked();
+    auto& B = BProx.GetLocked();
+    auto& X = XProx.Get();
+
+    auto prox = []( DistMatrix<Real>& Z, Real /*step*/ )
+      { LowerClip( Z.Matrix(), Real(0) ); };
+    Zeros( X, A.Width(), B.Width() );
+    first_order::FISTA( A, B, X, Real(1), Real(0), prox, ctrl );
+}
+
+template<typename Real>
+void FISTA
+( const SparseMatrix<Real>& A,
+  const Matrix<Real>& B,
+        Matrix<Real>& X,
+  const FirstOrderCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    auto prox = []( Matrix<Real>& Z, Real /*step*/ )
+      { LowerClip( Z, Real(0) ); };
+    Zeros( X, A.Width(), B.Width() );
+    first_order::FISTA( A, B, X, Real(1), Real(0), prox, ctrl );
+}
+
+template<typename Real>
+void FISTA
+( const DistSparseMatrix<Real>& A,
+  const DistMultiVec<Real>& B,
+        DistMultiVec<Real>& X,
+  const FirstOrderCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    auto prox = []( DistMultiVec<Real>& Z, Real /*step*/ )
+      { LowerClip( Z.Matrix(), Real(0) ); };
+    X.SetGrid( B.Grid() );
+    Zeros( X, A.Width(), B.Width() );
+    first_order::FISTA( A, B, X, Real(1), Real(0), prox, ctrl );
+}
+
+} // namespace nnls
+} // namespace El
@@ -23,7 +23,7 @@ void NormalizeEntries( Matrix<Field>& A )
 {
     auto unitMap = []( const Field& alpha )
       { return alpha==Field(0) ? Field(1) : alpha/Abs(alpha); };
-    EntrywiseMap( A, MakeFunction(unitMap) );
+    EntrywiseMap( A, unitMap );
 }
 
 template<typename Field>
@@ -31,7 +31,7 @@ void NormalizeEntries( AbstractDistMatrix<Field>& A )
 {
     auto unitMap = []( const Field& alpha )
       { return alpha==Field(0) ? Field(1) : alpha/Abs(alpha); };
-    EntrywiseMap( A, MakeFunction(unitMap) );
+    EntrywiseMap( A, unitMap );
 }
 
 // NOTE: If 'tau' is passed in as zero, it is set to 1/sqrt(max(m,n))
@@ -59,7 +59,7 @@ void ADMM
     const Real tol = ctrl.tol;
 
     const double startTime = mpi::Time();
-    Matrix<Field> E, Y;
+    Matrix<Field> E, Y, V;
     Zeros( Y, m, n );
 
     const Real frobM = FrobeniusNorm( M );
@@ -90,7 +90,9 @@ void ADMM
         L -= S;
         Axpy( Field(1)/beta, Y, L );
         Int rank;
-        if( ctrl.usePivQR )
+        if( ctrl.useSubspace )
+            rank = svt::Subspace( L, Real(1)/beta, V, ctrl.numSubspaceIts );
+        else if( ctrl.usePivQR )
             rank = SVT( L, Real(1)/beta, ctrl.numPivSteps );
         else
             rank = SVT( L, Real(1)/beta );
@@ -165,7 +167,7 @@ void ADMM
     const Real tol = ctrl.tol;
 
     const double startTime = mpi::Time();
-    DistMatrix<Field> E( M.Grid() ), Y( M.Grid() );
+    DistMatrix<Field> E( M.Grid() ), Y( M.Grid() ), V( M.Grid() );
     Zeros( Y, m, n );
 
     const Real frobM = FrobeniusNorm( M );
@@ -196,7 +198,9 @@ void ADMM
         L -= S;
         Axpy( Field(1)/beta, Y, L );
         Int rank;
-        if( ctrl.usePivQR )
+        if( ctrl.useSubspace )
+            rank = svt::Subspace( L, Real(1)/beta, V, ctrl.numSubspaceIts );
+        else if( ctrl.usePivQR )
             rank = SVT( L, Real(1)/beta, ctrl.numPivSteps );
         else
             rank = SVT( L, Real(1)/beta );
@@ -285,7 +289,7 @@ void ALM
     Zeros( S, m, n );
 
     Int numIts=0, numPrimalIts=0;
-    Matrix<Field> LLast, SLast, E;
+    Matrix<Field> LLast, SLast, E, V;
     while( true )
     {
         ++numIts;
@@ -309,7 +313,9 @@ void ALM
             L = M;
             L -= S;
             Axpy( Field(1)/beta, Y, L );
-            if( ctrl.usePivQR )
+            if( ctrl.useSubspace )
+                rank = svt::Subspace( L, Real(1)/beta, V, ctrl.numSubspaceIts );
+            else if( ctrl.usePivQR )
                 rank = SVT( L, Real(1)/beta, ctrl.numPivSteps );
             else
                 rank = SVT( L, Real(1)/beta );
@@ -434,7 +440,8 @@ void ALM
     Zeros( S, m, n );
 
     Int numIts=0, numPrimalIts=0;
-    DistMatrix<Field> LLast( M.Grid() ), SLast( M.Grid() ), E( M.Grid() );
+    DistMatrix<Field> LLast( M.Grid() ), SLast( M.Grid() ), E( M.Grid() ),
+      V( M.Grid() );
     while( true )
     {
         ++numIts;
@@ -458,7 +465,9 @@ void ALM
             L = M;
             L -= S;
             Axpy( Field(1)/beta, Y, L );
-            if( ctrl.usePivQR )
+            if( ctrl.useSubspace )
+                rank = svt::Subspace( L, Real(1)/beta, V, ctrl.numSubspaceIts );
+            else if( ctrl.usePivQR )
                 rank = SVT( L, Real(1)/beta, ctrl.numPivSteps );
             else
                 rank = SVT( L, Real(1)/beta );
@@ -8,6 +8,7 @@
 */
 #include <El.hpp>
 #include "./SVM/IPM.hpp"
+#include "./SVM/CoordinateDescent.hpp"
 
 namespace El {
 
@@ -20,6 +21,8 @@ void SVM
   const SVMCtrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
+    if( ctrl.approach == SVM_COORDINATE_DESCENT )
+        LogicError("Coordinate descent is only supported for sparse SVMs");
     svm::IPM( A, d, lambda, x, ctrl.ipmCtrl );
 }
 
@@ -32,6 +35,8 @@ void SVM
   const SVMCtrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
+    if( ctrl.approach == SVM_COORDINATE_DESCENT )
+        LogicError("Coordinate descent is only supported for sparse SVMs");
     svm::IPM( A, d, lambda, x, ctrl.ipmCtrl );
 }
 
@@ -44,7 +49,10 @@ void SVM
   const SVMCtrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
-    svm::IPM( A, d, lambda, x, ctrl.ipmCtrl );
+    if( ctrl.approach == SVM_COORDINATE_DESCENT )
+        svm::CoordinateDescent( A, d, lambda, x, ctrl.cdCtrl );
+    else
+        svm::IPM( A, d, lambda, x, ctrl.ipmCtrl );
 }
 
 template<typename Real>
@@ -56,7 +64,10 @@ void SVM
   const SVMCtrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
-    svm::IPM( A, d, lambda, x, ctrl.ipmCtrl );
+    if( ctrl.approach == SVM_COORDINATE_DESCENT )
+        svm::CoordinateDescent( A, d, lambda, x, ctrl.cdCtrl );
+    else
+        svm::IPM( A, d, lambda, x, ctrl.ipmCtrl );
 }
 
 #define PROTO(Real) \
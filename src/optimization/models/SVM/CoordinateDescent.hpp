@@ -0,0 +1,224 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+// Dual coordinate descent [1] for the linear soft-margin SVM
+//
+//   min_{w,beta} (1/2) || [w; beta] ||_2^2 +
+//                lambda sum_i max(0, 1 - d_i (a_i^T w + beta))^p,
+//
+// with p=1 (hinge loss) or p=2 (squared hinge loss), where the rows of A are
+// the samples. Unlike the IPM formulation, the offset beta is handled as the
+// coefficient of a constant feature and is therefore (weakly) regularized.
+// Each epoch sweeps over a random permutation of the (unshrunken) dual
+// variables and costs O(nnz(A)).
+//
+// In the distributed case, each process performs an epoch over its own
+// samples against a local copy of [w; beta], and the updates are then summed
+// across processes, with the local subproblems made safe for summation by
+// scaling their curvature by the number of processes, as in CoCoA+ [2].
+//
+// [1] C.-J. Hsieh, K.-W. Chang, C.-J. Lin, S. S. Keerthi, and
+//     S. Sundararajan, "A dual coordinate descent method for large-scale
+//     linear SVM", Proceedings of ICML, 2008.
+//
+// [2] C. Ma, V. Smith, M. Jaggi, M. I. Jordan, P. Richtarik, and M. Takac,
+//     "Adding vs. averaging in distributed primal-dual optimization",
+//     Proceedings of ICML, 2015.
+//
+
+namespace El {
+namespace svm {
+
+// Run dual coordinate descent over the locally-stored rows of a CSR matrix,
+// returning the replicated vector [w; beta]
+template<typename Real>
+void CoordinateDescent
+(       Int numLocalSamples,
+        Int numFeatures,
+  const Int* offsets,
+  const Int* targets,
+  const Real* values,
+  const Real* labels,
+        Real lambda,
+        vector<Real>& w,
+        mpi::Comm comm,
+  const CoordinateDescentCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int n = numFeatures;
+    const Int mLocal = numLocalSamples;
+    const Int m = mpi::AllReduce( mLocal, comm );
+    const Real sigma = mpi::Size( comm );
+    const Real upper = ( ctrl.squaredHinge ? limits::Max<Real>() : lambda );
+    const Real diagShift = ( ctrl.squaredHinge ? 1/(2*lambda) : Real(0) );
+    const Real infinity = limits::Max<Real>();
+
+    // The diagonal of the (scaled) dual Hessian, including the bias feature
+    vector<Real> hessDiag( mLocal );
+    for( Int i=0; i<mLocal; ++i )
+    {
+        Real rowNormSq = 1;
+        for( Int e=offsets[i]; e<offsets[i+1]; ++e )
+            rowNormSq += values[e]*values[e];
+        hessDiag[i] = sigma*rowNormSq + diagShift;
+    }
+
+    vector<Real> alpha( mLocal, Real(0) ), wLocal, update;
+    w.assign( n+1, Real(0) );
+    vector<Int> active( mLocal );
+    for( Int i=0; i<mLocal; ++i )
+        active[i] = i;
+    Int numActive = mLocal;
+    Real PGMaxOld = infinity, PGMinOld = -infinity;
+    for( Int iter=0; iter<ctrl.maxIter; ++iter )
+    {
+        wLocal = w;
+        update.assign( n+1, Real(0) );
+        std::shuffle( active.begin(), active.begin()+numActive, Generator() );
+
+        Real PGMax = -infinity, PGMin = infinity;
+        Int s = 0;
+        while( s < numActive )
+        {
+            const Int i = active[s];
+            Real dot = wLocal[n];
+            for( Int e=offsets[i]; e<offsets[i+1]; ++e )
+                dot += values[e]*wLocal[targets[e]];
+            const Real G = labels[i]*dot - 1 + diagShift*alpha[i];
+
+            // Compute the projected gradient, shrinking variables which are
+            // at a bound and are unlikely to move
+            Real PG = 0;
+            if( alpha[i] == Real(0) )
+            {
+                if( ctrl.shrink && G > PGMaxOld )
+                {
+                    std::swap( active[s], active[--numActive] );
+                    continue;
+                }
+                else if( G < Real(0) )
+                    PG = G;
+            }
+            else if( alpha[i] == upper )
+            {
+                if( ctrl.shrink && G < PGMinOld )
+                {
+                    std::swap( active[s], active[--numActive] );
+                    continue;
+                }
+                else if( G > Real(0) )
+                    PG = G;
+            }
+            else
+                PG = G;
+            PGMax = Max( PGMax, PG );
+            PGMin = Min( PGMin, PG );
+
+            if( Abs(PG) > Real(1e-12) )
+            {
+                const Real alphaOld = alpha[i];
+                alpha[i] = Min( Max( alphaOld-G/hessDiag[i], Real(0) ), upper );
+                const Real delta = (alpha[i]-alphaOld)*labels[i];
+                for( Int e=offsets[i]; e<offsets[i+1]; ++e )
+                {
+                    update[targets[e]] += delta*values[e];
+                    wLocal[targets[e]] += sigma*delta*values[e];
+                }
+                update[n] += delta;
+                wLocal[n] += sigma*delta;
+            }
+            ++s;
+        }
+
+        // Sum the updates from each process
+        mpi::AllReduce( update.data(), n+1, comm );
+        for( Int j=0; j<=n; ++j )
+            w[j] += update[j];
+        PGMax = mpi::AllReduce( PGMax, mpi::MAX, comm );
+        PGMin = mpi::AllReduce( PGMin, mpi::MIN, comm );
+        const Int totalActive = mpi::AllReduce( numActive, comm );
+        if( ctrl.progress && mpi::Rank(comm) == 0 )
+            Output
+            ("  epoch ",iter,": PGMax - PGMin = ",PGMax-PGMin,
+             ", # active = ",totalActive);
+
+        if( PGMax - PGMin <= ctrl.tol )
+        {
+            if( totalActive == m )
+                break;
+            // Check the optimality of the shrunken variables
+            numActive = mLocal;
+            PGMaxOld = infinity;
+            PGMinOld = -infinity;
+            continue;
+        }
+        PGMaxOld = ( PGMax > Real(0) ? PGMax : infinity );
+        PGMinOld = ( PGMin < Real(0) ? PGMin : -infinity );
+    }
+}
+
+template<typename Real>
+void CoordinateDescent
+( const SparseMatrix<Real>& A,
+  const Matrix<Real>& d,
+        Real lambda,
+        Matrix<Real>& x,
+  const CoordinateDescentCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    EL_DEBUG_ONLY(
+      if( d.Height() != m || d.Width() != 1 )
+          LogicError("d should be a column vector of length ",m);
+    )
+    vector<Real> w;
+    CoordinateDescent
+    ( m, n, A.LockedOffsetBuffer(), A.LockedTargetBuffer(),
+      A.LockedValueBuffer(), d.LockedBuffer(), lambda, w,
+      mpi::COMM_SELF, ctrl );
+
+    x.Resize( n+1, 1 );
+    for( Int j=0; j<=n; ++j )
+        x(j) = w[j];
+}
+
+template<typename Real>
+void CoordinateDescent
+( const DistSparseMatrix<Real>& A,
+  const DistMultiVec<Real>& d,
+        Real lambda,
+        DistMultiVec<Real>& x,
+  const CoordinateDescentCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Width();
+    EL_DEBUG_ONLY(
+      if( d.Height() != A.Height() || d.Width() != 1 )
+          LogicError("d should be a column vector of length ",A.Height());
+      if( d.LocalHeight() != A.LocalHeight() )
+          LogicError("d and A should have the same row distribution");
+    )
+    vector<Real> w;
+    CoordinateDescent
+    ( A.LocalHeight(), n, A.LockedOffsetBuffer(), A.LockedTargetBuffer(),
+      A.LockedValueBuffer(), d.LockedMatrix().LockedBuffer(), lambda, w,
+      A.Grid().Comm(), ctrl );
+
+    x.SetGrid( A.Grid() );
+    x.Resize( n+1, 1 );
+    const Int firstLocalRow = x.FirstLocalRow();
+    const Int localHeight = x.LocalHeight();
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        x.SetLocal( iLoc, 0, w[firstLocalRow+iLoc] );
+}
+
+} // namespace svm
+} // namespace El
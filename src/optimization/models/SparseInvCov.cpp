@@ -16,23 +16,141 @@
 //     minimize Tr(S*X) - log det X + lambda ||X||_1
 // where S is the empirical covariance of the data matrix D.
 //
+// Since the solution is block-diagonal along the connected components of the
+// graph with edges | S(i,j) | > lambda, i != j (see Witten et al., "New
+// insights and faster computations for the graphical lasso"), the components
+// are (optionally) computed first and each diagonal block is solved
+// independently. Isolated variables have the closed-form solution
+// X(i,i) = 1/(S(i,i)+lambda).
+//
 
 namespace El {
 
+namespace sparse_inv_cov {
+
+inline Int Find( vector<Int>& parents, Int i )
+{
+    while( parents[i] != i )
+    {
+        parents[i] = parents[parents[i]];
+        i = parents[i];
+    }
+    return i;
+}
+
+inline void Union( vector<Int>& parents, Int i, Int j )
+{
+    const Int iRoot = Find( parents, i );
+    const Int jRoot = Find( parents, j );
+    if( iRoot < jRoot )
+        parents[jRoot] = iRoot;
+    else if( jRoot < iRoot )
+        parents[iRoot] = jRoot;
+}
+
+// Convert a union-find forest into the list of components, ordered by their
+// smallest member, with the members of each component in increasing order
+inline void FormBlocks( vector<Int>& parents, vector<vector<Int>>& blocks )
+{
+    const Int n = parents.size();
+    vector<Int> labels( n, -1 );
+    blocks.clear();
+    for( Int i=0; i<n; ++i )
+    {
+        const Int root = Find( parents, i );
+        if( labels[root] == -1 )
+        {
+            labels[root] = blocks.size();
+            blocks.push_back( vector<Int>() );
+        }
+        blocks[labels[root]].push_back( i );
+    }
+}
+
 template<typename Field>
-Int SparseInvCov
-( const Matrix<Field>& D,
+void ThresholdBlocks
+( const Matrix<Field>& S,
+        Base<Field> lambda,
+        vector<vector<Int>>& blocks )
+{
+    EL_DEBUG_CSE
+    const Int n = S.Height();
+    vector<Int> parents( n );
+    for( Int i=0; i<n; ++i )
+        parents[i] = i;
+    for( Int j=0; j<n; ++j )
+        for( Int i=j+1; i<n; ++i )
+            if( Abs(S(i,j)) > lambda )
+                Union( parents, i, j );
+    FormBlocks( parents, blocks );
+}
+
+template<typename Field>
+void ThresholdBlocks
+( const DistMatrix<Field>& S,
+        Base<Field> lambda,
+        vector<vector<Int>>& blocks )
+{
+    EL_DEBUG_CSE
+    const Int n = S.Height();
+    const Int localHeight = S.LocalHeight();
+    const Int localWidth = S.LocalWidth();
+    const Matrix<Field>& SLoc = S.LockedMatrix();
+
+    // Merge the locally-owned edges
+    vector<Int> parents( n );
+    for( Int i=0; i<n; ++i )
+        parents[i] = i;
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+    {
+        const Int j = S.GlobalCol(jLoc);
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        {
+            const Int i = S.GlobalRow(iLoc);
+            if( i > j && Abs(SLoc(iLoc,jLoc)) > lambda )
+                Union( parents, i, j );
+        }
+    }
+
+    // Each local forest is summarized by at most n-1 (vertex,root) links,
+    // which are exchanged and merged redundantly
+    vector<Int> links;
+    for( Int i=0; i<n; ++i )
+    {
+        const Int root = Find( parents, i );
+        if( root != i )
+        {
+            links.push_back( i );
+            links.push_back( root );
+        }
+    }
+    const mpi::Comm& comm = S.DistComm();
+    const int commSize = mpi::Size( comm );
+    const int numLinkEntries = links.size();
+    vector<int> linkSizes( commSize );
+    mpi::AllGather( &numLinkEntries, 1, linkSizes.data(), 1, comm );
+    vector<int> linkOffs;
+    const int totalLinkEntries = Scan( linkSizes, linkOffs );
+    vector<Int> allLinks( totalLinkEntries );
+    mpi::AllGather
+    ( links.data(), numLinkEntries,
+      allLinks.data(), linkSizes.data(), linkOffs.data(), comm );
+    for( Int k=0; k<totalLinkEntries; k+=2 )
+        Union( parents, allLinks[k], allLinks[k+1] );
+
+    FormBlocks( parents, blocks );
+}
+
+template<typename Field>
+Int ADMM
+( const Matrix<Field>& S,
         Base<Field> lambda,
         Matrix<Field>& Z,
   const SparseInvCovCtrl<Base<Field>>& ctrl )
 {
     EL_DEBUG_CSE
     typedef Base<Field> Real;
-    const Int n = D.Width();
-
-    Matrix<Field> S;
-    Covariance( D, S );
-    MakeHermitian( LOWER, S );
+    const Int n = S.Width();
 
     Int numIter=0;
     Matrix<Field> X, U, ZOld, XHat, T;
@@ -102,30 +220,20 @@ Int SparseInvCov
             break;
         ++numIter;
     }
-    if( ctrl.maxIter == numIter )
-        RuntimeError("ADMM failed to converge");
     return numIter;
 }
 
 template<typename Field>
-Int SparseInvCov
-( const AbstractDistMatrix<Field>& D,
+Int ADMM
+( const DistMatrix<Field>& S,
         Base<Field> lambda,
-        AbstractDistMatrix<Field>& ZPre,
+        DistMatrix<Field>& Z,
   const SparseInvCovCtrl<Base<Field>>& ctrl )
 {
     EL_DEBUG_CSE
-
-    DistMatrixWriteProxy<Field,Field,MC,MR> ZProx( ZPre );
-    auto& Z = ZProx.Get();
-
     typedef Base<Field> Real;
-    const Grid& g = D.Grid();
-    const Int n = D.Width();
-
-    DistMatrix<Field> S(g);
-    Covariance( D, S );
-    MakeHermitian( LOWER, S );
+    const Grid& g = S.Grid();
+    const Int n = S.Width();
 
     Int numIter=0;
     DistMatrix<Field> X(g), U(g), ZOld(g), XHat(g), T(g);
@@ -196,6 +304,229 @@ Int SparseInvCov
             break;
         ++numIter;
     }
+    return numIter;
+}
+
+} // namespace sparse_inv_cov
+
+template<typename Field>
+Int SparseInvCov
+( const Matrix<Field>& D,
+        Base<Field> lambda,
+        Matrix<Field>& Z,
+  const SparseInvCovCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int n = D.Width();
+
+    Matrix<Field> S;
+    Covariance( D, S );
+    MakeHermitian( LOWER, S );
+
+    vector<vector<Int>> blocks;
+    if( ctrl.screen )
+        sparse_inv_cov::ThresholdBlocks( S, lambda, blocks );
+    const Int numBlocks = blocks.size();
+    if( numBlocks <= 1 )
+    {
+        const Int numIter = sparse_inv_cov::ADMM( S, lambda, Z, ctrl );
+        if( ctrl.maxIter == numIter )
+            RuntimeError("ADMM failed to converge");
+        return numIter;
+    }
+    if( ctrl.progress )
+        Output("Screening split the problem into ",numBlocks," blocks");
+
+    Int numIter=0;
+    Zeros( Z, n, n );
+    Matrix<Field> SBlock, ZBlock;
+    for( Int b=0; b<numBlocks; ++b )
+    {
+        const vector<Int>& block = blocks[b];
+        const Int blockSize = block.size();
+        if( blockSize == 1 )
+        {
+            const Int i = block[0];
+            Z(i,i) = 1/(RealPart(S(i,i))+lambda);
+            continue;
+        }
+
+        GetSubmatrix( S, block, block, SBlock );
+        const Int blockIter =
+          sparse_inv_cov::ADMM( SBlock, lambda, ZBlock, ctrl );
+        if( ctrl.maxIter == blockIter )
+            RuntimeError("ADMM failed to converge");
+        numIter = Max( numIter, blockIter );
+
+        for( Int jBlock=0; jBlock<blockSize; ++jBlock )
+            for( Int iBlock=0; iBlock<blockSize; ++iBlock )
+                Z(block[iBlock],block[jBlock]) = ZBlock(iBlock,jBlock);
+    }
+    return numIter;
+}
+
+template<typename Field>
+Int SparseInvCov
+( const AbstractDistMatrix<Field>& D,
+        Base<Field> lambda,
+        AbstractDistMatrix<Field>& ZPre,
+  const SparseInvCovCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+
+    DistMatrixWriteProxy<Field,Field,MC,MR> ZProx( ZPre );
+    auto& Z = ZProx.Get();
+
+    const Grid& g = D.Grid();
+    const Int n = D.Width();
+
+    DistMatrix<Field> S(g);
+    Covariance( D, S );
+    MakeHermitian( LOWER, S );
+
+    vector<vector<Int>> blocks;
+    if( ctrl.screen )
+        sparse_inv_cov::ThresholdBlocks( S, lambda, blocks );
+    const Int numBlocks = blocks.size();
+    if( numBlocks <= 1 )
+    {
+        const Int numIter = sparse_inv_cov::ADMM( S, lambda, Z, ctrl );
+        if( ctrl.maxIter == numIter )
+            RuntimeError("ADMM failed to converge");
+        return numIter;
+    }
+
+    // Assign each of the small, nontrivial blocks to a single process,
+    // greedily balancing the O(blockSize^3) cost per iteration, and solve the
+    // large blocks over the entire grid
+    // ======================================================================
+    const int commSize = g.Size();
+    const int commRank = g.Rank();
+    vector<Int> smallBlocks, largeBlocks;
+    for( Int b=0; b<numBlocks; ++b )
+    {
+        const Int blockSize = blocks[b].size();
+        if( blockSize > ctrl.maxLocalBlockSize )
+            largeBlocks.push_back( b );
+        else if( blockSize > 1 )
+            smallBlocks.push_back( b );
+    }
+    std::stable_sort
+    ( smallBlocks.begin(), smallBlocks.end(),
+      [&]( const Int& a, const Int& b )
+      { return blocks[a].size() > blocks[b].size(); } );
+    vector<double> loads( commSize, 0 );
+    vector<Int> myBlocks;
+    for( const Int& b : smallBlocks )
+    {
+        const double blockSize = blocks[b].size();
+        const int owner =
+          std::min_element( loads.begin(), loads.end() ) - loads.begin();
+        loads[owner] += blockSize*blockSize*blockSize;
+        if( owner == commRank )
+            myBlocks.push_back( b );
+    }
+    if( ctrl.progress && commRank == 0 )
+        Output
+        ("Screening split the problem into ",numBlocks," blocks (",
+         largeBlocks.size()," solved over the full grid)");
+
+    // Pull the entries of S needed for our small blocks
+    // =================================================
+    Int numPulls = 0;
+    for( const Int& b : myBlocks )
+        numPulls += blocks[b].size()*blocks[b].size();
+    S.ReservePulls( numPulls );
+    for( const Int& b : myBlocks )
+    {
+        const vector<Int>& block = blocks[b];
+        for( const Int& j : block )
+            for( const Int& i : block )
+                S.QueuePull( i, j );
+    }
+    vector<Field> pullBuf;
+    S.ProcessPullQueue( pullBuf );
+
+    Zeros( Z, n, n );
+
+    // Solve the small blocks sequentially and queue their nonzeros
+    // ============================================================
+    auto localCtrl( ctrl );
+    localCtrl.progress = false;
+    Int numIter = 0;
+    Int offset = 0;
+    Matrix<Field> SBlock, ZBlock;
+    vector<Entry<Field>> updates;
+    for( const Int& b : myBlocks )
+    {
+        const vector<Int>& block = blocks[b];
+        const Int blockSize = block.size();
+        SBlock.Resize( blockSize, blockSize );
+        for( Int jBlock=0; jBlock<blockSize; ++jBlock )
+            for( Int iBlock=0; iBlock<blockSize; ++iBlock )
+                SBlock(iBlock,jBlock) = pullBuf[offset++];
+
+        const Int blockIter =
+          sparse_inv_cov::ADMM( SBlock, lambda, ZBlock, localCtrl );
+        numIter = Max( numIter, blockIter );
+
+        for( Int jBlock=0; jBlock<blockSize; ++jBlock )
+            for( Int iBlock=0; iBlock<blockSize; ++iBlock )
+                if( ZBlock(iBlock,jBlock) != Field(0) )
+                    updates.push_back
+                    ( Entry<Field>{
+                      block[iBlock], block[jBlock], ZBlock(iBlock,jBlock) } );
+    }
+
+    // Solve the large blocks over the full grid
+    // =========================================
+    DistMatrix<Field> SLarge(g), ZLarge(g);
+    for( const Int& b : largeBlocks )
+    {
+        const vector<Int>& block = blocks[b];
+        GetSubmatrix( S, block, block, SLarge );
+        const Int blockIter =
+          sparse_inv_cov::ADMM( SLarge, lambda, ZLarge, ctrl );
+        numIter = Max( numIter, blockIter );
+
+        const Matrix<Field>& ZLargeLoc = ZLarge.LockedMatrix();
+        for( Int jLoc=0; jLoc<ZLarge.LocalWidth(); ++jLoc )
+        {
+            const Int j = block[ZLarge.GlobalCol(jLoc)];
+            for( Int iLoc=0; iLoc<ZLarge.LocalHeight(); ++iLoc )
+                if( ZLargeLoc(iLoc,jLoc) != Field(0) )
+                    updates.push_back
+                    ( Entry<Field>{
+                      block[ZLarge.GlobalRow(iLoc)], j,
+                      ZLargeLoc(iLoc,jLoc) } );
+        }
+    }
+
+    // Isolated variables have a closed-form solution
+    // ==============================================
+    for( Int b=0; b<numBlocks; ++b )
+    {
+        if( blocks[b].size() != 1 )
+            continue;
+        const Int i = blocks[b][0];
+        if( S.IsLocal(i,i) )
+        {
+            const Int iLoc = S.LocalRow(i);
+            const Int jLoc = S.LocalCol(i);
+            updates.push_back
+            ( Entry<Field>{
+              i, i, 1/(RealPart(S.GetLocal(iLoc,jLoc))+lambda) } );
+        }
+    }
+
+    // Assemble the block-diagonal solution
+    // ====================================
+    Z.Reserve( updates.size() );
+    for( const auto& entry : updates )
+        Z.QueueUpdate( entry );
+    Z.ProcessQueues();
+
+    numIter = mpi::AllReduce( numIter, mpi::MAX, g.Comm() );
     if( ctrl.maxIter == numIter )
         RuntimeError("ADMM failed to converge");
     return numIter;
@@ -7,6 +7,7 @@
    http://opensource.org/licenses/BSD-2-Clause
 */
 #include <El.hpp>
+#include "./FirstOrder.hpp"
 
 // 1D total variation denoising (TV):
 //
@@ -20,6 +21,15 @@
 //
 // where x is in R^n and t is in R^(n-1).
 //
+// Alternatively, the problem can be solved without any factorizations via
+// the primal-dual hybrid gradient method applied to
+//
+//   min_x max_{|| y ||_oo <= lambda} (1/2) || b - x ||_2^2 + y^T D x,
+//
+// where the primal proximal map is x := (x + tau b) / (1 + tau), the dual
+// proximal map is a clipping to [-lambda,lambda], and the strong convexity of
+// the primal objective allows for accelerated step sizes.
+//
 
 namespace El {
 
@@ -204,6 +214,95 @@ void TV
     x = xHat( IR(0,n), ALL );
 }
 
+template<typename Real>
+void TV
+( const AbstractDistMatrix<Real>& b,
+        Real lambda,
+        AbstractDistMatrix<Real>& x,
+  const FirstOrderCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    DistMultiVec<Real> bDMV(b.Grid()), xDMV(b.Grid());
+    bDMV = b;
+    TV( bDMV, lambda, xDMV, ctrl );
+    Copy( xDMV, x );
+}
+
+template<typename Real>
+void TV
+( const Matrix<Real>& b,
+        Real lambda,
+        Matrix<Real>& x,
+  const FirstOrderCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int n = b.Height();
+
+    // D := the 1D finite-difference operator
+    // ======================================
+    SparseMatrix<Real> D;
+    Zeros( D, Max(n-1,0), n );
+    D.Reserve( 2*Max(n-1,0) );
+    for( Int e=0; e<n-1; ++e )
+    {
+        D.QueueUpdate( e, e,   Real( 1) );
+        D.QueueUpdate( e, e+1, Real(-1) );
+    }
+    D.ProcessQueues();
+
+    auto primalProx = [&]( Matrix<Real>& z, Real tau )
+      {
+          Axpy( tau, b, z );
+          z *= Real(1)/(1+tau);
+      };
+    auto dualProx = [&]( Matrix<Real>& y, Real /*sigma*/ )
+      { Clip( y, -lambda, lambda ); };
+
+    Matrix<Real> y;
+    Zeros( y, Max(n-1,0), 1 );
+    x = b;
+    first_order::PDHG( D, x, y, primalProx, dualProx, Real(1), ctrl );
+}
+
+template<typename Real>
+void TV
+( const DistMultiVec<Real>& b,
+        Real lambda,
+        DistMultiVec<Real>& x,
+  const FirstOrderCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int n = b.Height();
+    const Grid& grid = b.Grid();
+
+    // D := the 1D finite-difference operator
+    // ======================================
+    DistSparseMatrix<Real> D(grid);
+    Zeros( D, Max(n-1,0), n );
+    D.Reserve( 2*D.LocalHeight() );
+    for( Int iLoc=0; iLoc<D.LocalHeight(); ++iLoc )
+    {
+        const Int i = D.GlobalRow(iLoc);
+        D.QueueLocalUpdate( iLoc, i,   Real( 1) );
+        D.QueueLocalUpdate( iLoc, i+1, Real(-1) );
+    }
+    D.ProcessLocalQueues();
+
+    auto primalProx = [&]( DistMultiVec<Real>& z, Real tau )
+      {
+          Axpy( tau, b, z );
+          Scale( Real(1)/(1+tau), z );
+      };
+    auto dualProx = [&]( DistMultiVec<Real>& y, Real /*sigma*/ )
+      { Clip( y, -lambda, lambda ); };
+
+    DistMultiVec<Real> y(grid);
+    Zeros( y, Max(n-1,0), 1 );
+    x.SetGrid( grid );
+    x = b;
+    first_order::PDHG( D, x, y, primalProx, dualProx, Real(1), ctrl );
+}
+
 #define PROTO(Real) \
   template void TV \
   ( const AbstractDistMatrix<Real>& b, \
@@ -219,7 +318,22 @@ void TV
   ( const DistMultiVec<Real>& b, \
           Real lambda, \
           DistMultiVec<Real>& x, \
-    const qp::affine::Ctrl<Real>& ctrl );
+    const qp::affine::Ctrl<Real>& ctrl ); \
+  template void TV \
+  ( const AbstractDistMatrix<Real>& b, \
+          Real lambda, \
+          AbstractDistMatrix<Real>& x, \
+    const FirstOrderCtrl<Real>& ctrl ); \
+  template void TV \
+  ( const Matrix<Real>& b, \
+          Real lambda, \
+          Matrix<Real>& x, \
+    const FirstOrderCtrl<Real>& ctrl ); \
+  template void TV \
+  ( const DistMultiVec<Real>& b, \
+          Real lambda, \
+          DistMultiVec<Real>& x, \
+    const FirstOrderCtrl<Real>& ctrl );
 
 #define EL_NO_INT_PROTO
 #define EL_NO_COMPLEX_PROTO
@@ -15,7 +15,7 @@ void LowerClip( Matrix<Real>& X, const Real& lowerBound )
 {
     EL_DEBUG_CSE
     auto lowerClip = [&]( const Real& alpha ) { return Max(lowerBound,alpha); };
-    EntrywiseMap( X, MakeFunction(lowerClip) );
+    EntrywiseMap( X, lowerClip );
 }
 
 template<typename Real>
@@ -23,7 +23,7 @@ void UpperClip( Matrix<Real>& X, const Real& upperBound )
 {
     EL_DEBUG_CSE
     auto upperClip = [&]( const Real& alpha ) { return Min(upperBound,alpha); };
-    EntrywiseMap( X, MakeFunction(upperClip) );
+    EntrywiseMap( X, upperClip );
 }
 
 template<typename Real>
@@ -32,7 +32,7 @@ void Clip( Matrix<Real>& X, const Real& lowerBound, const Real& upperBound )
     EL_DEBUG_CSE
     auto clip = [&]( const Real& alpha )
       { return Max(lowerBound,Min(upperBound,alpha)); };
-    EntrywiseMap( X, MakeFunction(clip) );
+    EntrywiseMap( X, clip );
 }
 
 template<typename Real>
@@ -18,7 +18,7 @@ void HingeLossProx( Matrix<Real>& A, const Real& tau )
       [=]( const Real& alpha ) -> Real
       { if( alpha < 1 ) { return Min(alpha+1/tau,Real(1)); }
         else            { return alpha;                    } };
-    EntrywiseMap( A, MakeFunction(hingeProx) );
+    EntrywiseMap( A, hingeProx );
 }
 
 template<typename Real>
@@ -29,7 +29,7 @@ void HingeLossProx( AbstractDistMatrix<Real>& A, const Real& tau )
       [=]( const Real& alpha ) -> Real
       { if( alpha < 1 ) { return Min(alpha+1/tau,Real(1)); }
         else            { return alpha;                    } };
-    EntrywiseMap( A, MakeFunction(hingeProx) );
+    EntrywiseMap( A, hingeProx );
 }
 
 #define PROTO(Real) \
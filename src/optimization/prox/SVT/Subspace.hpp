@@ -0,0 +1,215 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_SVT_SUBSPACE_HPP
+#define EL_SVT_SUBSPACE_HPP
+
+namespace El {
+namespace svt {
+
+// Singular-value soft-thresholding via a warm-started subspace iteration.
+//
+// On entry, the columns of V should span an estimate of the dominant right
+// singular subspace of A (e.g., the V returned by the previous call within an
+// iterative method such as RPCA); its width is used as the prediction of the
+// number of singular values above the threshold. If V is empty (or of the
+// wrong height), a Gaussian starting basis is used instead.
+//
+// A few steps of subspace iteration are used to compute the leading
+// singular triplets, and, if all of them lie above the threshold, the basis
+// is doubled in size (keeping the current vectors) until one does not. On
+// exit, A is overwritten with its thresholded approximation and V holds the
+// leading right singular vectors (plus a small amount of oversampling) for
+// warm-starting the next call. The cost is O(m n k) for a basis of width k
+// rather than the O(m n min(m,n)) of a full SVD.
+
+namespace subspace {
+
+const Int oversample = 5;
+const Int minBasisSize = 10;
+
+} // namespace subspace
+
+template<typename Field>
+Int Subspace
+( Matrix<Field>& A, const Base<Field>& tau, Matrix<Field>& V,
+  Int numIts, bool relative )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int minDim = Min(m,n);
+    if( minDim == 0 )
+    {
+        V.Resize( n, 0 );
+        return 0;
+    }
+
+    Int k;
+    if( V.Height() == n && V.Width() > 0 )
+        k = Min( V.Width(), minDim );
+    else
+        k = Min( subspace::minBasisSize, minDim );
+
+    Matrix<Field> Q, B, U, VB;
+    Matrix<Real> s;
+    while( true )
+    {
+        // Extend the warm-start basis with Gaussian vectors as needed
+        const Int kOld = ( V.Height() == n ? Min(V.Width(),k) : 0 );
+        if( kOld < k || V.Width() != k )
+        {
+            Matrix<Field> VNew;
+            Gaussian( VNew, n, k );
+            if( kOld > 0 )
+            {
+                auto VNewLeft = VNew( ALL, IR(0,kOld) );
+                VNewLeft = V( ALL, IR(0,kOld) );
+            }
+            V = VNew;
+        }
+
+        // Subspace iteration
+        for( Int it=0; it<numIts; ++it )
+        {
+            Gemm( NORMAL, NORMAL, Field(1), A, V, Q );
+            qr::ExplicitUnitary( Q );
+            Gemm( ADJOINT, NORMAL, Field(1), A, Q, V );
+            qr::ExplicitUnitary( V );
+        }
+        Gemm( NORMAL, NORMAL, Field(1), A, V, Q );
+        qr::ExplicitUnitary( Q );
+
+        // Compute the SVD of the k x n projection Q^H A
+        Gemm( ADJOINT, NORMAL, Field(1), Q, A, B );
+        SVDCtrl<Real> ctrl;
+        ctrl.overwrite = true;
+        SVD( B, U, s, VB, ctrl );
+
+        const Real thresh = ( relative ? tau*s(0) : tau );
+        if( k == minDim || s(k-1) <= thresh )
+            break;
+
+        // Every computed singular value was above the threshold, so grow the
+        // basis (keeping the current right singular vectors)
+        V = VB;
+        k = Min( 2*k, minDim );
+    }
+
+    SoftThreshold( s, tau, relative );
+    const Int rank = ZeroNorm( s );
+
+    // A := (Q U) diag(s) VB^H
+    Matrix<Field> QU;
+    Gemm( NORMAL, NORMAL, Field(1), Q, U, QU );
+    DiagonalScale( RIGHT, NORMAL, s, QU );
+    Gemm( NORMAL, ADJOINT, Field(1), QU, VB, Field(0), A );
+
+    // Keep the leading right singular vectors for the next call
+    const Int kNext = Min( Max(rank+subspace::oversample,1), k );
+    V = VB( ALL, IR(0,kNext) );
+
+    return rank;
+}
+
+template<typename Field>
+Int Subspace
+( AbstractDistMatrix<Field>& APre, const Base<Field>& tau,
+  AbstractDistMatrix<Field>& VPre, Int numIts, bool relative )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+
+    DistMatrixReadWriteProxy<Field,Field,MC,MR> AProx( APre ), VProx( VPre );
+    auto& A = AProx.Get();
+    auto& V = VProx.Get();
+    const Grid& g = A.Grid();
+
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int minDim = Min(m,n);
+    if( minDim == 0 )
+    {
+        V.Resize( n, 0 );
+        return 0;
+    }
+
+    Int k;
+    if( V.Height() == n && V.Width() > 0 )
+        k = Min( V.Width(), minDim );
+    else
+        k = Min( subspace::minBasisSize, minDim );
+
+    DistMatrix<Field> Q(g), B(g), U(g), VB(g);
+    DistMatrix<Real,VR,STAR> s(g);
+    while( true )
+    {
+        // Extend the warm-start basis with Gaussian vectors as needed
+        const Int kOld = ( V.Height() == n ? Min(V.Width(),k) : 0 );
+        if( kOld < k || V.Width() != k )
+        {
+            DistMatrix<Field> VNew(g);
+            Gaussian( VNew, n, k );
+            if( kOld > 0 )
+            {
+                auto VNewLeft = VNew( ALL, IR(0,kOld) );
+                VNewLeft = V( ALL, IR(0,kOld) );
+            }
+            V = VNew;
+        }
+
+        // Subspace iteration
+        for( Int it=0; it<numIts; ++it )
+        {
+            Gemm( NORMAL, NORMAL, Field(1), A, V, Q );
+            qr::ExplicitUnitary( Q );
+            Gemm( ADJOINT, NORMAL, Field(1), A, Q, V );
+            qr::ExplicitUnitary( V );
+        }
+        Gemm( NORMAL, NORMAL, Field(1), A, V, Q );
+        qr::ExplicitUnitary( Q );
+
+        // Compute the SVD of the k x n projection Q^H A
+        Gemm( ADJOINT, NORMAL, Field(1), Q, A, B );
+        SVDCtrl<Real> ctrl;
+        ctrl.overwrite = true;
+        SVD( B, U, s, VB, ctrl );
+
+        const Real sMax = s.Get( 0, 0 );
+        const Real sMin = s.Get( k-1, 0 );
+        const Real thresh = ( relative ? tau*sMax : tau );
+        if( k == minDim || sMin <= thresh )
+            break;
+
+        // Every computed singular value was above the threshold, so grow the
+        // basis (keeping the current right singular vectors)
+        V = VB;
+        k = Min( 2*k, minDim );
+    }
+
+    SoftThreshold( s, tau, relative );
+    const Int rank = ZeroNorm( s );
+
+    // A := (Q U) diag(s) VB^H
+    DistMatrix<Field> QU(g);
+    Gemm( NORMAL, NORMAL, Field(1), Q, U, QU );
+    DiagonalScale( RIGHT, NORMAL, s, QU );
+    Gemm( NORMAL, ADJOINT, Field(1), QU, VB, Field(0), A );
+
+    // Keep the leading right singular vectors for the next call
+    const Int kNext = Min( Max(rank+subspace::oversample,1), k );
+    V = VB( ALL, IR(0,kNext) );
+
+    return rank;
+}
+
+} // namespace svt
+} // namespace El
+
+#endif // ifndef EL_SVT_SUBSPACE_HPP
@@ -25,6 +25,11 @@ ElError ElMehrotraCtrlDefault_s( ElMehrotraCtrl_s* ctrl )
     ctrl->maxIts = 100;
     ctrl->maxStepRatio = 0.99;
     ctrl->system = EL_FULL_KKT;
+    ctrl->splitDenseColumns = true;
+    ctrl->denseColumnRatio = 0.1;
+    ctrl->maxDenseColumns = 100;
+    ctrl->reuseFactorization = false;
+    ctrl->maxReuseIts = 20;
     ctrl->mehrotra = true;
     ctrl->centralityRule = &StepLengthCentrality<float>;
     ctrl->standardInitShift = true;
@@ -65,6 +70,11 @@ ElError ElMehrotraCtrlDefault_d( ElMehrotraCtrl_d* ctrl )
     ctrl->maxIts = 100;
     ctrl->maxStepRatio = 0.99;
     ctrl->system = EL_FULL_KKT;
+    ctrl->splitDenseColumns = true;
+    ctrl->denseColumnRatio = 0.1;
+    ctrl->maxDenseColumns = 100;
+    ctrl->reuseFactorization = false;
+    ctrl->maxReuseIts = 20;
     ctrl->mehrotra = true;
     ctrl->centralityRule = &StepLengthCentrality<double>;
     ctrl->standardInitShift = true;
@@ -120,6 +130,30 @@ ElError ElADMMCtrlDefault_d( ElADMMCtrl_d* ctrl )
     return EL_SUCCESS;
 }
 
+/* Matrix-free first-order methods
+   =============================== */
+ElError ElFirstOrderCtrlDefault_s( ElFirstOrderCtrl_s* ctrl )
+{
+    ctrl->maxIter = 5000;
+    ctrl->tol = 1e-4;
+    ctrl->stepSize = 0;
+    ctrl->numPowerIts = 20;
+    ctrl->adaptiveRestart = true;
+    ctrl->progress = false;
+    return EL_SUCCESS;
+}
+
+ElError ElFirstOrderCtrlDefault_d( ElFirstOrderCtrl_d* ctrl )
+{
+    ctrl->maxIter = 5000;
+    ctrl->tol = 1e-6;
+    ctrl->stepSize = 0;
+    ctrl->numPowerIts = 20;
+    ctrl->adaptiveRestart = true;
+    ctrl->progress = false;
+    return EL_SUCCESS;
+}
+
 /* Linear programs
    =============== */
 
@@ -29,6 +29,34 @@ void LP
         LogicError("Unsupported solver");
 }
 
+template<typename Real>
+Int LP
+( const vector<DirectLPProblem<Matrix<Real>,Matrix<Real>>>& problems,
+        vector<DirectLPSolution<Matrix<Real>>>& solutions,
+  const BatchMehrotraCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int numProblems = problems.size();
+    vector<Matrix<Real>> Q(numProblems), A(numProblems), b(numProblems),
+      c(numProblems), x, y, z;
+    for( Int k=0; k<numProblems; ++k )
+    {
+        LockedView( A[k], problems[k].A );
+        LockedView( b[k], problems[k].b );
+        LockedView( c[k], problems[k].c );
+    }
+    const Int numFailed = QP( Q, A, b, c, x, y, z, ctrl );
+
+    solutions.resize( numProblems );
+    for( Int k=0; k<numProblems; ++k )
+    {
+        solutions[k].x = x[k];
+        solutions[k].y = y[k];
+        solutions[k].z = z[k];
+    }
+    return numFailed;
+}
+
 // This interface is now deprecated.
 template<typename Real>
 void LP
@@ -378,6 +406,10 @@ void LP
   ( const DirectLPProblem<Matrix<Real>,Matrix<Real>>& problem, \
           DirectLPSolution<Matrix<Real>>& solution, \
     const lp::direct::Ctrl<Real>& ctrl ); \
+  template Int LP \
+  ( const vector<DirectLPProblem<Matrix<Real>,Matrix<Real>>>& problems, \
+          vector<DirectLPSolution<Matrix<Real>>>& solutions, \
+    const BatchMehrotraCtrl<Real>& ctrl ); \
   template void LP \
   ( const Matrix<Real>& A, \
     const Matrix<Real>& b, \
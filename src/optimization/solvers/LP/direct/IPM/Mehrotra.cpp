@@ -1441,6 +1441,24 @@ void EquilibratedMehrotra
     }
     regTmp *= origTwoNormEst;
 
+    // Split any dense columns of A off from the normal equations
+    // ==========================================================
+    SparseMatrix<Real> ASparse;
+    Matrix<Real> ADense, UDense, JInvUDense, schurDense;
+    vector<Int> denseCols;
+    if( ctrl.system == NORMAL_KKT && ctrl.splitDenseColumns )
+    {
+        SplitDenseColumns
+        ( problem.A, ASparse, ADense, denseCols,
+          ctrl.denseColumnRatio, ctrl.maxDenseColumns );
+        if( ctrl.print && !denseCols.empty() )
+            Output("Split off ",denseCols.size()," dense columns of A");
+    }
+    const bool haveDenseCols = !denseCols.empty();
+    const bool reuseFact = ctrl.reuseFactorization && !haveDenseCols;
+    bool factored = false, reusedFact = false;
+    const Real pivotRaiseTol = Sqrt(limits::Epsilon<Real>());
+
     Real muOld = 0.1;
     Real relError = 1;
     SparseMatrix<Real> J, JOrig;
@@ -1633,9 +1651,19 @@ void EquilibratedMehrotra
             // ------------------------
             // TODO(poulson): Apply updates to a matrix of explicit zeros
             // (with the correct sparsity pattern)
-            NormalKKT
-            ( problem.A, gammaPerm, deltaPerm,
-              solution.x, solution.z, J, false );
+            if( haveDenseCols )
+            {
+                NormalKKT
+                ( ASparse, gammaPerm, deltaPerm,
+                  solution.x, solution.z, J, false );
+                RaiseSmallPivots( J, pivotRaiseTol );
+            }
+            else
+            {
+                NormalKKT
+                ( problem.A, gammaPerm, deltaPerm,
+                  solution.x, solution.z, J, false );
+            }
             NormalKKTRHS
             ( problem.A, gammaPerm, solution.x, solution.z,
               residual.dualEquality, residual.primalEquality,
@@ -1643,36 +1671,61 @@ void EquilibratedMehrotra
 
             // Solve for the direction
             // -----------------------
-            try
+            reusedFact = reuseFact && factored &&
+              NormalPCG
+              ( J, sparseLDLFact, affineCorrection.y,
+                ctrl.solveCtrl.relTol, ctrl.maxReuseIts, ctrl.print );
+            if( !reusedFact )
             {
-                if( numIts == 0 )
+                try
                 {
-                    const bool hermitian = true;
-                    const BisectCtrl bisectCtrl;
-                    sparseLDLFact.Initialize( J, hermitian, bisectCtrl );
+                    if( numIts == 0 )
+                    {
+                        const bool hermitian = true;
+                        const BisectCtrl bisectCtrl;
+                        sparseLDLFact.Initialize( J, hermitian, bisectCtrl );
+                    }
+                    else
+                    {
+                        sparseLDLFact.ChangeNonzeroValues( J );
+                    }
+
+                    sparseLDLFact.Factor( LDL_2D );
+                    factored = true;
+
+                    if( haveDenseCols )
+                    {
+                        NormalLowRankFactor
+                        ( ADense, denseCols, gammaPerm, solution.x, solution.z,
+                          UDense );
+                        NormalSchurComplement
+                        ( sparseLDLFact, UDense, JInvUDense, schurDense );
+                        SolveNormalWithDenseColumns
+                        ( problem.A, gammaPerm, deltaPerm,
+                          solution.x, solution.z,
+                          sparseLDLFact, UDense, JInvUDense, schurDense,
+                          affineCorrection.y, ctrl.solveCtrl );
+                    }
+                    else
+                    {
+                        // NOTE: regTmp should be all zeros; replace with
+                        // unregularized
+                        reg_ldl::RegularizedSolveAfter
+                        ( J, regTmp, sparseLDLFact, affineCorrection.y,
+                          ctrl.solveCtrl.relTol,
+                          ctrl.solveCtrl.maxRefineIts,
+                          ctrl.solveCtrl.progress,
+                          ctrl.solveCtrl.time );
+                    }
                 }
-                else
+                catch(...)
                 {
-                    sparseLDLFact.ChangeNonzeroValues( J );
+                    if( relError <= ctrl.minTol )
+                        break;
+                    else
+                        RuntimeError
+                        ("Could not achieve minimum tolerance of ",ctrl.minTol);
                 }
-
-                sparseLDLFact.Factor( LDL_2D );
-
-                // NOTE: regTmp should be all zeros; replace with unregularized
-                reg_ldl::RegularizedSolveAfter
-                ( J, regTmp, sparseLDLFact, affineCorrection.y,
-                  ctrl.solveCtrl.relTol,
-                  ctrl.solveCtrl.maxRefineIts,
-                  ctrl.solveCtrl.progress,
-                  ctrl.solveCtrl.time );
-            }
-            catch(...)
-            {
-                if( relError <= ctrl.minTol )
-                    break;
-                else
-                    RuntimeError
-                    ("Could not achieve minimum tolerance of ",ctrl.minTol);
             }
             ExpandNormalSolution
             ( problem.A, gammaPerm, solution.x, solution.z,
@@ -1821,13 +1874,35 @@ void EquilibratedMehrotra
               residual.dualConic, correction.y );
             try
             {
-                // NOTE: regTmp should be all zeros; replace with unregularized
-                reg_ldl::RegularizedSolveAfter
-                ( J, regTmp, sparseLDLFact, correction.y,
-                  ctrl.solveCtrl.relTol,
-                  ctrl.solveCtrl.maxRefineIts,
-                  ctrl.solveCtrl.progress,
-                  ctrl.solveCtrl.time );
+                if( haveDenseCols )
+                {
+                    SolveNormalWithDenseColumns
+                    ( problem.A, gammaPerm, deltaPerm, solution.x, solution.z,
+                      sparseLDLFact, UDense, JInvUDense, schurDense,
+                      correction.y, ctrl.solveCtrl );
+                }
+                else if( !reusedFact ||
+                         !NormalPCG
+                          ( J, sparseLDLFact, correction.y,
+                            ctrl.solveCtrl.relTol, ctrl.maxReuseIts,
+                            ctrl.print ) )
+                {
+                    if( reusedFact )
+                    {
+                        // The stale factorization sufficed for the
+                        // predictor but not for the corrector
+                        sparseLDLFact.ChangeNonzeroValues( J );
+                        sparseLDLFact.Factor( LDL_2D );
+                    }
+                    // NOTE: regTmp should be all zeros; replace with
+                    // unregularized
+                    reg_ldl::RegularizedSolveAfter
+                    ( J, regTmp, sparseLDLFact, correction.y,
+                      ctrl.solveCtrl.relTol,
+                      ctrl.solveCtrl.maxRefineIts,
+                      ctrl.solveCtrl.progress,
+                      ctrl.solveCtrl.time );
+                }
             }
             catch(...)
             {
@@ -2041,6 +2116,25 @@ void EquilibratedMehrotra
     Real muOld = 0.1;
     Real relError = 1;
 
+    // Split any dense columns of A off from the normal equations
+    // ==========================================================
+    DistSparseMatrix<Real> ASparse(grid);
+    DistMultiVec<Real> ADense(grid), UDense(grid), JInvUDense(grid);
+    Matrix<Real> schurDense;
+    vector<Int> denseCols;
+    if( ctrl.system == NORMAL_KKT && ctrl.splitDenseColumns )
+    {
+        SplitDenseColumns
+        ( problem.A, ASparse, ADense, denseCols,
+          ctrl.denseColumnRatio, ctrl.maxDenseColumns );
+        if( ctrl.print && !denseCols.empty() && commRank == 0 )
+            Output("Split off ",denseCols.size()," dense columns of A");
+    }
+    const bool haveDenseCols = !denseCols.empty();
+    const bool reuseFact = ctrl.reuseFactorization && !haveDenseCols;
+    bool factored = false, reusedFact = false;
+    const Real pivotRaiseTol = Sqrt(limits::Epsilon<Real>());
+
     DistGraphMultMeta metaOrig, meta;
     DistSparseMatrix<Real> J(grid), JOrig(grid);
     DistMultiVec<Real> d(grid), w(grid);
@@ -2264,9 +2358,19 @@ void EquilibratedMehrotra
             // Assemble the KKT system
             // -----------------------
             // TODO(poulson): Apply updates on top of explicit zeros
-            NormalKKT
-            ( problem.A, gammaPerm, deltaPerm, solution.x, solution.z,
-              J, false );
+            if( haveDenseCols )
+            {
+                NormalKKT
+                ( ASparse, gammaPerm, deltaPerm, solution.x, solution.z,
+                  J, false );
+                RaiseSmallPivots( J, pivotRaiseTol );
+            }
+            else
+            {
+                NormalKKT
+                ( problem.A, gammaPerm, deltaPerm, solution.x, solution.z,
+                  J, false );
+            }
             NormalKKTRHS
             ( problem.A, gammaPerm, solution.x, solution.z,
               residual.dualEquality, residual.primalEquality,
@@ -2288,47 +2392,71 @@ void EquilibratedMehrotra
 
             // Solve for the direction
             // -----------------------
-            try
+            reusedFact = reuseFact && factored &&
+              NormalPCG
+              ( J, sparseLDLFact, affineCorrection.y,
+                ctrl.solveCtrl.relTol, ctrl.maxReuseIts, ctrl.print );
+            if( !reusedFact )
             {
-                if( numIts == 0 )
+                try
                 {
+                    if( numIts == 0 )
+                    {
+                        if( commRank == 0 && ctrl.time )
+                            timer.Start();
+                        const bool hermitian = true;
+                        const BisectCtrl bisectCtrl;
+                        sparseLDLFact.Initialize( J, hermitian, bisectCtrl );
+                        if( commRank == 0 && ctrl.time )
+                            Output("Analysis: ",timer.Stop()," secs");
+                    }
+                    else
+                    {
+                        sparseLDLFact.ChangeNonzeroValues( J );
+                    }
+
                     if( commRank == 0 && ctrl.time )
                         timer.Start();
-                    const bool hermitian = true;
-                    const BisectCtrl bisectCtrl;
-                    sparseLDLFact.Initialize( J, hermitian, bisectCtrl );
+                    sparseLDLFact.Factor( LDL_2D );
+                    factored = true;
                     if( commRank == 0 && ctrl.time )
-                        Output("Analysis: ",timer.Stop()," secs");
+                        Output("LDL: ",timer.Stop()," secs");
+
+                    if( commRank == 0 && ctrl.time )
+                        timer.Start();
+                    if( haveDenseCols )
+                    {
+                        NormalLowRankFactor
+                        ( ADense, denseCols, gammaPerm, solution.x, solution.z,
+                          UDense );
+                        NormalSchurComplement
+                        ( sparseLDLFact, UDense, JInvUDense, schurDense );
+                        SolveNormalWithDenseColumns
+                        ( problem.A, gammaPerm, deltaPerm,
+                          solution.x, solution.z,
+                          sparseLDLFact, UDense, JInvUDense, schurDense,
+                          affineCorrection.y, ctrl.solveCtrl );
+                    }
+                    else
+                    {
+                        reg_ldl::RegularizedSolveAfter
+                        ( J, regTmp, sparseLDLFact, affineCorrection.y,
+                          ctrl.solveCtrl.relTol,
+                          ctrl.solveCtrl.maxRefineIts,
+                          ctrl.solveCtrl.progress,
+                          ctrl.solveCtrl.time );
+                    }
+                    if( commRank == 0 && ctrl.time )
+                        Output("Affine: ",timer.Stop()," secs");
                 }
-                else
+                catch(...)
                 {
-                    sparseLDLFact.ChangeNonzeroValues( J );
+                    if( relError <= ctrl.minTol )
+                        break;
+                    else
+                        RuntimeError
+                        ("Could not achieve minimum tolerance of ",ctrl.minTol);
                 }
-
-                if( commRank == 0 && ctrl.time )
-                    timer.Start();
-                sparseLDLFact.Factor( LDL_2D );
-                if( commRank == 0 && ctrl.time )
-                    Output("LDL: ",timer.Stop()," secs");
-
-                if( commRank == 0 && ctrl.time )
-                    timer.Start();
-                reg_ldl::RegularizedSolveAfter
-                ( J, regTmp, sparseLDLFact, affineCorrection.y,
-                  ctrl.solveCtrl.relTol,
-                  ctrl.solveCtrl.maxRefineIts,
-                  ctrl.solveCtrl.progress,
-                  ctrl.solveCtrl.time );
-                if( commRank == 0 && ctrl.time )
-                    Output("Affine: ",timer.Stop()," secs");
-            }
-            catch(...)
-            {
-                if( relError <= ctrl.minTol )
-                    break;
-                else
-                    RuntimeError
-                    ("Could not achieve minimum tolerance of ",ctrl.minTol);
             }
             ExpandNormalSolution
             ( problem.A, gammaPerm, solution.x, solution.z,
@@ -2487,12 +2615,33 @@ void EquilibratedMehrotra
             {
                 if( commRank == 0 && ctrl.time )
                     timer.Start();
-                reg_ldl::RegularizedSolveAfter
-                ( J, regTmp, sparseLDLFact, correction.y,
-                  ctrl.solveCtrl.relTol,
-                  ctrl.solveCtrl.maxRefineIts,
-                  ctrl.solveCtrl.progress,
-                  ctrl.solveCtrl.time );
+                if( haveDenseCols )
+                {
+                    SolveNormalWithDenseColumns
+                    ( problem.A, gammaPerm, deltaPerm, solution.x, solution.z,
+                      sparseLDLFact, UDense, JInvUDense, schurDense,
+                      correction.y, ctrl.solveCtrl );
+                }
+                else if( !reusedFact ||
+                         !NormalPCG
+                          ( J, sparseLDLFact, correction.y,
+                            ctrl.solveCtrl.relTol, ctrl.maxReuseIts,
+                            ctrl.print ) )
+                {
+                    if( reusedFact )
+                    {
+                        // The stale factorization sufficed for the
+                        // predictor but not for the corrector
+                        sparseLDLFact.ChangeNonzeroValues( J );
+                        sparseLDLFact.Factor( LDL_2D );
+                    }
+                    reg_ldl::RegularizedSolveAfter
+                    ( J, regTmp, sparseLDLFact, correction.y,
+                      ctrl.solveCtrl.relTol,
+                      ctrl.solveCtrl.maxRefineIts,
+                      ctrl.solveCtrl.progress,
+                      ctrl.solveCtrl.time );
+                }
                 if( commRank == 0 && ctrl.time )
                     Output("Corrector: ",timer.Stop()," secs");
             }
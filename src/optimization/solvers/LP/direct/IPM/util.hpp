@@ -239,6 +239,108 @@ void ExpandNormalSolution
   const DistMultiVec<Real>& dy,
         DistMultiVec<Real>& dz );
 
+// Dense-column handling for the normal system
+// ===========================================
+template<typename Real>
+void SplitDenseColumns
+( const SparseMatrix<Real>& A,
+        SparseMatrix<Real>& ASparse,
+        Matrix<Real>& ADense,
+        vector<Int>& denseCols,
+        Real denseRatio,
+        Int maxDenseCols );
+template<typename Real>
+void SplitDenseColumns
+( const DistSparseMatrix<Real>& A,
+        DistSparseMatrix<Real>& ASparse,
+        DistMultiVec<Real>& ADense,
+        vector<Int>& denseCols,
+        Real denseRatio,
+        Int maxDenseCols );
+
+template<typename Real>
+void NormalLowRankFactor
+( const Matrix<Real>& ADense,
+  const vector<Int>& denseCols,
+        Real gamma,
+  const Matrix<Real>& x,
+  const Matrix<Real>& z,
+        Matrix<Real>& U );
+template<typename Real>
+void NormalLowRankFactor
+( const DistMultiVec<Real>& ADense,
+  const vector<Int>& denseCols,
+        Real gamma,
+  const DistMultiVec<Real>& x,
+  const DistMultiVec<Real>& z,
+        DistMultiVec<Real>& U );
+
+template<typename Real>
+void RaiseSmallPivots( SparseMatrix<Real>& J, Real relTol );
+template<typename Real>
+void RaiseSmallPivots( DistSparseMatrix<Real>& J, Real relTol );
+
+template<typename Real>
+void NormalSchurComplement
+( const SparseLDLFactorization<Real>& sparseLDLFact,
+  const Matrix<Real>& U,
+        Matrix<Real>& JInvU,
+        Matrix<Real>& S );
+template<typename Real>
+void NormalSchurComplement
+( const DistSparseLDLFactorization<Real>& sparseLDLFact,
+  const DistMultiVec<Real>& U,
+        DistMultiVec<Real>& JInvU,
+        Matrix<Real>& S );
+
+template<typename Real>
+void SolveNormalWithDenseColumns
+( const SparseMatrix<Real>& A,
+        Real gamma,
+        Real delta,
+  const Matrix<Real>& x,
+  const Matrix<Real>& z,
+  const SparseLDLFactorization<Real>& sparseLDLFact,
+  const Matrix<Real>& U,
+  const Matrix<Real>& JInvU,
+  const Matrix<Real>& S,
+        Matrix<Real>& d,
+  const RegSolveCtrl<Real>& solveCtrl );
+template<typename Real>
+void SolveNormalWithDenseColumns
+( const DistSparseMatrix<Real>& A,
+        Real gamma,
+        Real delta,
+  const DistMultiVec<Real>& x,
+  const DistMultiVec<Real>& z,
+  const DistSparseLDLFactorization<Real>& sparseLDLFact,
+  const DistMultiVec<Real>& U,
+  const DistMultiVec<Real>& JInvU,
+  const Matrix<Real>& S,
+        DistMultiVec<Real>& d,
+  const RegSolveCtrl<Real>& solveCtrl );
+
+// Attempt to solve the normal equations with PCG, preconditioned by the
+// factorization of the normal matrix from a previous iteration. Returns false,
+// leaving 'd' unchanged, if more than 'maxIts' iterations would be required or
+// PCG broke down.
+template<typename Real>
+bool NormalPCG
+( const SparseMatrix<Real>& J,
+  const SparseLDLFactorization<Real>& sparseLDLFact,
+        Matrix<Real>& d,
+        Real relTol,
+        Int maxIts,
+        bool progress );
+template<typename Real>
+bool NormalPCG
+( const DistSparseMatrix<Real>& J,
+  const DistSparseLDLFactorization<Real>& sparseLDLFact,
+        DistMultiVec<Real>& d,
+        Real relTol,
+        Int maxIts,
+        bool progress );
+
 } // namespace direct
 } // namespace lp
 } // namespace El
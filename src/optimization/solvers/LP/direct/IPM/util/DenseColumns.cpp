@@ -0,0 +1,583 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+namespace lp {
+namespace direct {
+
+// A handful of dense columns in A suffices to make the normal matrix
+// A D^2 A^T + delta^2 I completely dense. Following [1], we split the columns
+// of A into a sparse set, A_s, and a dense set, A_d, so that
+//
+//   A D^2 A^T + delta^2 I = (A_s D_s^2 A_s^T + delta^2 I) + U U^T,
+//
+// where U = A_d D_d is m x k, with k small. Only the first term, J_s, is
+// factored with the sparse-direct solver, and the low-rank term is handled via
+// the Sherman-Morrison-Woodbury formula,
+//
+//   inv(J_s + U U^T) = inv(J_s) - inv(J_s) U inv(S) U^T inv(J_s),
+//
+// where the k x k (capacitance) matrix S = I + U^T inv(J_s) U is SPD and can
+// be Cholesky-factored.
+//
+// Removing the dense columns can leave J_s (nearly) singular, e.g., when a row
+// of A only has nonzeros in dense columns. We therefore raise the small
+// diagonal entries of J_s to a relative threshold (in the spirit of the
+// "modified Schur complement" of [1]) and remove the resulting perturbation
+// via iterative refinement against the exact normal operator, which is applied
+// using products with A and A^T rather than the explicit normal matrix.
+//
+// The dense columns are simply left empty in A_s, which keeps the width of A,
+// so that the existing sparse NormalKKT routine can be reused unmodified.
+//
+// [1] Knud D. Andersen, "A modified Schur-complement method for handling dense
+//     columns in interior-point methods for linear programming",
+//     ACM Transactions on Mathematical Software, 22(3), pp. 348--356, 1996.
+//
+
+namespace {
+
+// Choose the columns with at least 'denseRatio' times the height in nonzeros
+// which also have at least ten times the average number of nonzeros per
+// column. If there are more than 'maxDenseCols' such columns, only the
+// densest are kept.
+template<typename Real>
+void ChooseDenseColumns
+( const vector<Int>& colCounts,
+        Int height,
+        Int numEntries,
+        Real denseRatio,
+        Int maxDenseCols,
+        vector<Int>& denseCols )
+{
+    EL_DEBUG_CSE
+    const Int width = colCounts.size();
+    denseCols.resize( 0 );
+    if( maxDenseCols <= 0 )
+        return;
+    for( Int j=0; j<width; ++j )
+    {
+        const Int count = colCounts[j];
+        if( count > 0 &&
+            Real(count) >= denseRatio*Real(height) &&
+            count*width >= 10*numEntries )
+            denseCols.push_back( j );
+    }
+    if( Int(denseCols.size()) > maxDenseCols )
+    {
+        std::stable_sort
+        ( denseCols.begin(), denseCols.end(),
+          [&]( const Int& a, const Int& b )
+          { return colCounts[a] > colCounts[b]; } );
+        denseCols.resize( maxDenseCols );
+        std::sort( denseCols.begin(), denseCols.end() );
+    }
+}
+
+} // anonymous namespace
+
+template<typename Real>
+void SplitDenseColumns
+( const SparseMatrix<Real>& A,
+        SparseMatrix<Real>& ASparse,
+        Matrix<Real>& ADense,
+        vector<Int>& denseCols,
+        Real denseRatio,
+        Int maxDenseCols )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int numEntries = A.NumEntries();
+    const Int* colBuf = A.LockedTargetBuffer();
+    const Real* valBuf = A.LockedValueBuffer();
+
+    vector<Int> colCounts( n, 0 );
+    for( Int e=0; e<numEntries; ++e )
+        ++colCounts[colBuf[e]];
+    ChooseDenseColumns
+    ( colCounts, m, numEntries, denseRatio, maxDenseCols, denseCols );
+    const Int numDense = denseCols.size();
+
+    vector<Int> denseIndex( n, -1 );
+    Int numDenseEntries = 0;
+    for( Int jj=0; jj<numDense; ++jj )
+    {
+        denseIndex[denseCols[jj]] = jj;
+        numDenseEntries += colCounts[denseCols[jj]];
+    }
+
+    Zeros( ADense, m, numDense );
+    Zeros( ASparse, m, n );
+    ASparse.Reserve( numEntries-numDenseEntries );
+    for( Int e=0; e<numEntries; ++e )
+    {
+        const Int i = A.Row(e);
+        const Int j = colBuf[e];
+        if( denseIndex[j] >= 0 )
+            ADense(i,denseIndex[j]) = valBuf[e];
+        else
+            ASparse.QueueUpdate( i, j, valBuf[e] );
+    }
+    ASparse.ProcessQueues();
+}
+
+template<typename Real>
+void SplitDenseColumns
+( const DistSparseMatrix<Real>& A,
+        DistSparseMatrix<Real>& ASparse,
+        DistMultiVec<Real>& ADense,
+        vector<Int>& denseCols,
+        Real denseRatio,
+        Int maxDenseCols )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Grid& grid = A.Grid();
+    const Int numLocalEntries = A.NumLocalEntries();
+    const Int* colBuf = A.LockedTargetBuffer();
+    const Real* valBuf = A.LockedValueBuffer();
+
+    vector<Int> colCounts( n, 0 );
+    for( Int e=0; e<numLocalEntries; ++e )
+        ++colCounts[colBuf[e]];
+    mpi::AllReduce( colCounts.data(), n, grid.Comm() );
+    ChooseDenseColumns
+    ( colCounts, m, A.NumEntries(), denseRatio, maxDenseCols, denseCols );
+    const Int numDense = denseCols.size();
+
+    vector<Int> denseIndex( n, -1 );
+    for( Int jj=0; jj<numDense; ++jj )
+        denseIndex[denseCols[jj]] = jj;
+
+    ADense.SetGrid( grid );
+    Zeros( ADense, m, numDense );
+    auto& ADenseLoc = ADense.Matrix();
+    ASparse.SetGrid( grid );
+    Zeros( ASparse, m, n );
+    ASparse.Reserve( numLocalEntries );
+    for( Int e=0; e<numLocalEntries; ++e )
+    {
+        const Int iLoc = A.Row(e) - A.FirstLocalRow();
+        const Int j = colBuf[e];
+        if( denseIndex[j] >= 0 )
+            ADenseLoc(iLoc,denseIndex[j]) = valBuf[e];
+        else
+            ASparse.QueueLocalUpdate( iLoc, j, valBuf[e] );
+    }
+    ASparse.ProcessLocalQueues();
+}
+
+template<typename Real>
+void NormalLowRankFactor
+( const Matrix<Real>& ADense,
+  const vector<Int>& denseCols,
+        Real gamma,
+  const Matrix<Real>& x,
+  const Matrix<Real>& z,
+        Matrix<Real>& U )
+{
+    EL_DEBUG_CSE
+    const Int numDense = denseCols.size();
+
+    // U := A_d D_d, where inv(D)^2 = (z ./ x) .+ gamma^2
+    // ==================================================
+    U = ADense;
+    for( Int jj=0; jj<numDense; ++jj )
+    {
+        const Int j = denseCols[jj];
+        auto u = U( ALL, IR(jj) );
+        u *= 1/Sqrt(z(j)/x(j) + gamma*gamma);
+    }
+}
+
+template<typename Real>
+void NormalLowRankFactor
+( const DistMultiVec<Real>& ADense,
+  const vector<Int>& denseCols,
+        Real gamma,
+  const DistMultiVec<Real>& x,
+  const DistMultiVec<Real>& z,
+        DistMultiVec<Real>& U )
+{
+    EL_DEBUG_CSE
+    const Int numDense = denseCols.size();
+
+    // Gather the relevant entries of inv(D) onto each process
+    // =======================================================
+    vector<Real> dInvDense( numDense, Real(0) );
+    for( Int jj=0; jj<numDense; ++jj )
+    {
+        const Int j = denseCols[jj];
+        if( x.IsLocalRow(j) )
+        {
+            const Int jLoc = x.LocalRow(j);
+            dInvDense[jj] =
+              Sqrt(z.GetLocal(jLoc,0)/x.GetLocal(jLoc,0) + gamma*gamma);
+        }
+    }
+    mpi::AllReduce( dInvDense.data(), numDense, x.Grid().Comm() );
+
+    // U := A_d D_d
+    // ============
+    U = ADense;
+    auto& ULoc = U.Matrix();
+    for( Int jj=0; jj<numDense; ++jj )
+    {
+        auto uLoc = ULoc( ALL, IR(jj) );
+        uLoc *= 1/dInvDense[jj];
+    }
+}
+
+template<typename Real>
+void RaiseSmallPivots( SparseMatrix<Real>& J, Real relTol )
+{
+    EL_DEBUG_CSE
+    const Int m = J.Height();
+    Real* valBuf = J.ValueBuffer();
+    Real maxDiag = 0;
+    for( Int i=0; i<m; ++i )
+        maxDiag = Max( maxDiag, Abs(valBuf[J.Offset(i,i)]) );
+    const Real tau = relTol*Max(maxDiag,Real(1));
+    for( Int i=0; i<m; ++i )
+    {
+        const Int e = J.Offset( i, i );
+        if( valBuf[e] < tau )
+            valBuf[e] = tau;
+    }
+}
+
+template<typename Real>
+void RaiseSmallPivots( DistSparseMatrix<Real>& J, Real relTol )
+{
+    EL_DEBUG_CSE
+    const Int localHeight = J.LocalHeight();
+    Real* valBuf = J.ValueBuffer();
+    Real maxDiag = 0;
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        const Int i = J.GlobalRow(iLoc);
+        maxDiag = Max( maxDiag, Abs(valBuf[J.Offset(iLoc,i)]) );
+    }
+    maxDiag = mpi::AllReduce( maxDiag, mpi::MAX, J.Grid().Comm() );
+    const Real tau = relTol*Max(maxDiag,Real(1));
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        const Int e = J.Offset( iLoc, J.GlobalRow(iLoc) );
+        if( valBuf[e] < tau )
+            valBuf[e] = tau;
+    }
+}
+
+template<typename Real>
+void NormalSchurComplement
+( const SparseLDLFactorization<Real>& sparseLDLFact,
+  const Matrix<Real>& U,
+        Matrix<Real>& JInvU,
+        Matrix<Real>& S )
+{
+    EL_DEBUG_CSE
+    const Int numDense = U.Width();
+
+    // JInvU := inv(J_s) U
+    // ===================
+    JInvU = U;
+    sparseLDLFact.Solve( JInvU );
+
+    // S := I + U^T inv(J_s) U = L L^T
+    // ===============================
+    Identity( S, numDense, numDense );
+    Gemm( TRANSPOSE, NORMAL, Real(1), U, JInvU, Real(1), S );
+    MakeSymmetric( LOWER, S );
+    Cholesky( LOWER, S );
+}
+
+template<typename Real>
+void NormalSchurComplement
+( const DistSparseLDLFactorization<Real>& sparseLDLFact,
+  const DistMultiVec<Real>& U,
+        DistMultiVec<Real>& JInvU,
+        Matrix<Real>& S )
+{
+    EL_DEBUG_CSE
+    const Int numDense = U.Width();
+
+    // JInvU := inv(J_s) U
+    // ===================
+    JInvU = U;
+    sparseLDLFact.Solve( JInvU );
+
+    // S := I + U^T inv(J_s) U = L L^T
+    // ===============================
+    // Each process forms its contribution to U^T inv(J_s) U from its local
+    // rows, which are then summed in a single reduction.
+    Zeros( S, numDense, numDense );
+    Gemm
+    ( TRANSPOSE, NORMAL,
+      Real(1), U.LockedMatrix(), JInvU.LockedMatrix(), Real(0), S );
+    mpi::AllReduce( S.Buffer(), numDense*numDense, U.Grid().Comm() );
+    ShiftDiagonal( S, Real(1) );
+    MakeSymmetric( LOWER, S );
+    Cholesky( LOWER, S );
+}
+
+template<typename Real>
+void SolveNormalWithDenseColumns
+( const SparseMatrix<Real>& A,
+        Real gamma,
+        Real delta,
+  const Matrix<Real>& x,
+  const Matrix<Real>& z,
+  const SparseLDLFactorization<Real>& sparseLDLFact,
+  const Matrix<Real>& U,
+  const Matrix<Real>& JInvU,
+  const Matrix<Real>& S,
+        Matrix<Real>& d,
+  const RegSolveCtrl<Real>& solveCtrl )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Width();
+    const Int numDense = U.Width();
+
+    // d2 := (z ./ x) .+ gamma^2 = inv(D)^2
+    // ====================================
+    Matrix<Real> d2;
+    d2.Resize( n, 1 );
+    for( Int i=0; i<n; ++i )
+        d2(i) = z(i)/x(i) + gamma*gamma;
+
+    // r := r - (A D^2 A^T + delta^2 I) y
+    // ==================================
+    Matrix<Real> t;
+    auto applyNormal = [&]( const Matrix<Real>& y, Matrix<Real>& r )
+    {
+        Zeros( t, n, 1 );
+        Multiply( TRANSPOSE, Real(1), A, y, Real(0), t );
+        DiagonalSolve( LEFT, NORMAL, d2, t );
+        Multiply( NORMAL, Real(-1), A, t, Real(1), r );
+        Axpy( -delta*delta, y, r );
+    };
+
+    // r := inv(J_s + U U^T) r
+    // =======================
+    Matrix<Real> s;
+    auto applySMW = [&]( Matrix<Real>& r )
+    {
+        sparseLDLFact.Solve( r );
+        if( numDense == 0 )
+            return;
+        Zeros( s, numDense, 1 );
+        Gemv( TRANSPOSE, Real(1), U, r, Real(0), s );
+        cholesky::SolveAfter( LOWER, NORMAL, S, s );
+        Gemv( NORMAL, Real(-1), JInvU, s, Real(1), r );
+    };
+
+    const Matrix<Real> b( d );
+    const Real bNrm2 = FrobeniusNorm( b );
+    applySMW( d );
+    if( bNrm2 == Real(0) )
+        return;
+
+    Matrix<Real> r, dCand;
+    r = b;
+    applyNormal( d, r );
+    Real relErrNrm2 = FrobeniusNorm( r ) / bNrm2;
+    if( solveCtrl.progress )
+        Output("Original rel error: ",relErrNrm2);
+    Int refineIt = 0;
+    while( relErrNrm2 > solveCtrl.relTol && refineIt < solveCtrl.maxRefineIts )
+    {
+        applySMW( r );
+        dCand = d;
+        dCand += r;
+
+        r = b;
+        applyNormal( dCand, r );
+        const Real newRelErrNrm2 = FrobeniusNorm( r ) / bNrm2;
+        if( solveCtrl.progress )
+            Output("Refined rel error: ",newRelErrNrm2);
+        if( newRelErrNrm2 >= relErrNrm2 )
+            break;
+        d = dCand;
+        relErrNrm2 = newRelErrNrm2;
+        ++refineIt;
+    }
+}
+
+template<typename Real>
+void SolveNormalWithDenseColumns
+( const DistSparseMatrix<Real>& A,
+        Real gamma,
+        Real delta,
+  const DistMultiVec<Real>& x,
+  const DistMultiVec<Real>& z,
+  const DistSparseLDLFactorization<Real>& sparseLDLFact,
+  const DistMultiVec<Real>& U,
+  const DistMultiVec<Real>& JInvU,
+  const Matrix<Real>& S,
+        DistMultiVec<Real>& d,
+  const RegSolveCtrl<Real>& solveCtrl )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Width();
+    const Int numDense = U.Width();
+    const Grid& grid = A.Grid();
+    const int commRank = grid.Rank();
+
+    // d2 := (z ./ x) .+ gamma^2 = inv(D)^2
+    // ====================================
+    DistMultiVec<Real> d2(grid);
+    d2.Resize( n, 1 );
+    auto& d2Loc = d2.Matrix();
+    auto& xLoc = x.LockedMatrix();
+    auto& zLoc = z.LockedMatrix();
+    const Int nLocal = d2.LocalHeight();
+    for( Int iLoc=0; iLoc<nLocal; ++iLoc )
+        d2Loc(iLoc) = zLoc(iLoc)/xLoc(iLoc) + gamma*gamma;
+
+    // r := r - (A D^2 A^T + delta^2 I) y
+    // ==================================
+    DistMultiVec<Real> t(grid);
+    auto applyNormal = [&]( const DistMultiVec<Real>& y, DistMultiVec<Real>& r )
+    {
+        Zeros( t, n, 1 );
+        Multiply( TRANSPOSE, Real(1), A, y, Real(0), t );
+        DiagonalSolve( LEFT, NORMAL, d2, t );
+        Multiply( NORMAL, Real(-1), A, t, Real(1), r );
+        Axpy( -delta*delta, y, r );
+    };
+
+    // r := inv(J_s + U U^T) r
+    // =======================
+    Matrix<Real> s;
+    auto applySMW = [&]( DistMultiVec<Real>& r )
+    {
+        sparseLDLFact.Solve( r );
+        if( numDense == 0 )
+            return;
+        Zeros( s, numDense, 1 );
+        Gemv
+        ( TRANSPOSE, Real(1), U.LockedMatrix(), r.LockedMatrix(), Real(0), s );
+        mpi::AllReduce( s.Buffer(), numDense, grid.Comm() );
+        cholesky::SolveAfter( LOWER, NORMAL, S, s );
+        Gemv( NORMAL, Real(-1), JInvU.LockedMatrix(), s, Real(1), r.Matrix() );
+    };
+
+    DistMultiVec<Real> b(grid);
+    b = d;
+    const Real bNrm2 = FrobeniusNorm( b );
+    applySMW( d );
+    if( bNrm2 == Real(0) )
+        return;
+
+    DistMultiVec<Real> r(grid), dCand(grid);
+    r = b;
+    applyNormal( d, r );
+    Real relErrNrm2 = FrobeniusNorm( r ) / bNrm2;
+    if( solveCtrl.progress && commRank == 0 )
+        Output("Original rel error: ",relErrNrm2);
+    Int refineIt = 0;
+    while( relErrNrm2 > solveCtrl.relTol && refineIt < solveCtrl.maxRefineIts )
+    {
+        applySMW( r );
+        dCand = d;
+        dCand += r;
+
+        r = b;
+        applyNormal( dCand, r );
+        const Real newRelErrNrm2 = FrobeniusNorm( r ) / bNrm2;
+        if( solveCtrl.progress && commRank == 0 )
+            Output("Refined rel error: ",newRelErrNrm2);
+        if( newRelErrNrm2 >= relErrNrm2 )
+            break;
+        d = dCand;
+        relErrNrm2 = newRelErrNrm2;
+        ++refineIt;
+    }
+}
+
+#define PROTO(Real) \
+  template void SplitDenseColumns \
+  ( const SparseMatrix<Real>& A, \
+          SparseMatrix<Real>& ASparse, \
+          Matrix<Real>& ADense, \
+          vector<Int>& denseCols, \
+          Real denseRatio, \
+          Int maxDenseCols ); \
+  template void SplitDenseColumns \
+  ( const DistSparseMatrix<Real>& A, \
+          DistSparseMatrix<Real>& ASparse, \
+          DistMultiVec<Real>& ADense, \
+          vector<Int>& denseCols, \
+          Real denseRatio, \
+          Int maxDenseCols ); \
+  template void NormalLowRankFactor \
+  ( const Matrix<Real>& ADense, \
+    const vector<Int>& denseCols, \
+          Real gamma, \
+    const Matrix<Real>& x, \
+    const Matrix<Real>& z, \
+          Matrix<Real>& U ); \
+  template void NormalLowRankFactor \
+  ( const DistMultiVec<Real>& ADense, \
+    const vector<Int>& denseCols, \
+          Real gamma, \
+    const DistMultiVec<Real>& x, \
+    const DistMultiVec<Real>& z, \
+          DistMultiVec<Real>& U ); \
+  template void RaiseSmallPivots( SparseMatrix<Real>& J, Real relTol ); \
+  template void RaiseSmallPivots( DistSparseMatrix<Real>& J, Real relTol ); \
+  template void NormalSchurComplement \
+  ( const SparseLDLFactorization<Real>& sparseLDLFact, \
+    const Matrix<Real>& U, \
+          Matrix<Real>& JInvU, \
+          Matrix<Real>& S ); \
+  template void NormalSchurComplement \
+  ( const DistSparseLDLFactorization<Real>& sparseLDLFact, \
+    const DistMultiVec<Real>& U, \
+          DistMultiVec<Real>& JInvU, \
+          Matrix<Real>& S ); \
+  template void SolveNormalWithDenseColumns \
+  ( const SparseMatrix<Real>& A, \
+          Real gamma, \
+          Real delta, \
+    const Matrix<Real>& x, \
+    const Matrix<Real>& z, \
+    const SparseLDLFactorization<Real>& sparseLDLFact, \
+    const Matrix<Real>& U, \
+    const Matrix<Real>& JInvU, \
+    const Matrix<Real>& S, \
+          Matrix<Real>& d, \
+    const RegSolveCtrl<Real>& solveCtrl ); \
+  template void SolveNormalWithDenseColumns \
+  ( const DistSparseMatrix<Real>& A, \
+          Real gamma, \
+          Real delta, \
+    const DistMultiVec<Real>& x, \
+    const DistMultiVec<Real>& z, \
+    const DistSparseLDLFactorization<Real>& sparseLDLFact, \
+    const DistMultiVec<Real>& U, \
+    const DistMultiVec<Real>& JInvU, \
+    const Matrix<Real>& S, \
+          DistMultiVec<Real>& d, \
+    const RegSolveCtrl<Real>& solveCtrl );
+
+#define EL_NO_INT_PROTO
+#define EL_NO_COMPLEX_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace direct
+} // namespace lp
+} // namespace El
@@ -0,0 +1,116 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+#include "../util.hpp"
+
+namespace El {
+namespace lp {
+namespace direct {
+
+// Late iterations of an IPM typically produce normal matrices which are close
+// to those of the previous iterations, so a stale factorization is often a
+// good enough preconditioner for CG to converge in a handful of iterations,
+// which is far cheaper than a fresh numerical factorization.
+
+template<typename Real>
+bool NormalPCG
+( const SparseMatrix<Real>& J,
+  const SparseLDLFactorization<Real>& sparseLDLFact,
+        Matrix<Real>& d,
+        Real relTol,
+        Int maxIts,
+        bool progress )
+{
+    EL_DEBUG_CSE
+    auto applyA =
+      [&]( Real alpha, const Matrix<Real>& X, Real beta, Matrix<Real>& Y )
+      {
+          Multiply( NORMAL, alpha, J, X, beta, Y );
+      };
+    auto precond =
+      [&]( Matrix<Real>& W )
+      {
+          sparseLDLFact.Solve( W );
+      };
+    bool converged;
+    const Int numIts =
+      PCG( applyA, precond, d, relTol, maxIts, false, &converged );
+    if( progress )
+    {
+        if( converged )
+            Output("Reused factorization with ",numIts," PCG iterations");
+        else
+            Output("Refactoring since PCG failed after ",numIts," iterations");
+    }
+    return converged;
+}
+
+template<typename Real>
+bool NormalPCG
+( const DistSparseMatrix<Real>& J,
+  const DistSparseLDLFactorization<Real>& sparseLDLFact,
+        DistMultiVec<Real>& d,
+        Real relTol,
+        Int maxIts,
+        bool progress )
+{
+    EL_DEBUG_CSE
+    auto applyA =
+      [&]( Real alpha, const DistMultiVec<Real>& X,
+           Real beta, DistMultiVec<Real>& Y )
+      {
+          Multiply( NORMAL, alpha, J, X, beta, Y );
+      };
+    auto precond =
+      [&]( DistMultiVec<Real>& W )
+      {
+          sparseLDLFact.Solve( W );
+      };
+    // Every process takes part in the same reductions, so the outcome is
+    // consistent across the team
+    bool converged;
+    const Int numIts =
+      PCG( applyA, precond, d, relTol, maxIts, false, &converged );
+    if( progress && d.Grid().Rank() == 0 )
+    {
+        if( converged )
+            Output("Reused factorization with ",numIts," PCG iterations");
+        else
+            Output("Refactoring since PCG failed after ",numIts," iterations");
+    }
+    return converged;
+}
+
+#define PROTO(Real) \
+  template bool NormalPCG \
+  ( const SparseMatrix<Real>& J, \
+    const SparseLDLFactorization<Real>& sparseLDLFact, \
+          Matrix<Real>& d, \
+          Real relTol, \
+          Int maxIts, \
+          bool progress ); \
+  template bool NormalPCG \
+  ( const DistSparseMatrix<Real>& J, \
+    const DistSparseLDLFactorization<Real>& sparseLDLFact, \
+          DistMultiVec<Real>& d, \
+          Real relTol, \
+          Int maxIts, \
+          bool progress );
+
+#define EL_NO_INT_PROTO
+#define EL_NO_COMPLEX_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace direct
+} // namespace lp
+} // namespace El
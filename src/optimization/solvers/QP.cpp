@@ -86,6 +86,21 @@ void QP
         LogicError("Unsupported solver");
 }
 
+template<typename Real>
+Int QP
+( const vector<Matrix<Real>>& Q,
+  const vector<Matrix<Real>>& A,
+  const vector<Matrix<Real>>& b,
+  const vector<Matrix<Real>>& c,
+        vector<Matrix<Real>>& x,
+        vector<Matrix<Real>>& y,
+        vector<Matrix<Real>>& z,
+  const BatchMehrotraCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    return qp::direct::BatchMehrotra( Q, A, b, c, x, y, z, ctrl );
+}
+
 // Affine conic form
 // =================
 template<typename Real>
@@ -209,6 +224,15 @@ void QP
           DistMultiVec<Real>& y, \
           DistMultiVec<Real>& z, \
     const qp::direct::Ctrl<Real>& ctrl ); \
+  template Int QP \
+  ( const vector<Matrix<Real>>& Q, \
+    const vector<Matrix<Real>>& A, \
+    const vector<Matrix<Real>>& b, \
+    const vector<Matrix<Real>>& c, \
+          vector<Matrix<Real>>& x, \
+          vector<Matrix<Real>>& y, \
+          vector<Matrix<Real>>& z, \
+    const BatchMehrotraCtrl<Real>& ctrl ); \
   template void QP \
   ( const Matrix<Real>& Q, \
     const Matrix<Real>& A, \
@@ -53,6 +53,18 @@ void Mehrotra
         DistMultiVec<Real>& z,
   const MehrotraCtrl<Real>& ctrl=MehrotraCtrl<Real>() );
 
+// Returns the number of problems which did not converge
+template<typename Real>
+Int BatchMehrotra
+( const vector<Matrix<Real>>& Q,
+  const vector<Matrix<Real>>& A,
+  const vector<Matrix<Real>>& b,
+  const vector<Matrix<Real>>& c,
+        vector<Matrix<Real>>& x,
+        vector<Matrix<Real>>& y,
+        vector<Matrix<Real>>& z,
+  const BatchMehrotraCtrl<Real>& ctrl=BatchMehrotraCtrl<Real>() );
+
 } // namespace direct
 } // namespace qp
 } // namespace El
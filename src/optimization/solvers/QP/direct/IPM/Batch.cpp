@@ -0,0 +1,413 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+namespace qp {
+namespace direct {
+
+// The following solves a batch of small, independent, dense quadratic
+// programs in "direct" conic form,
+//
+//   min (1/2) x^T Q_k x + c_k^T x
+//   s.t. A_k x = b_k, x >= 0,
+//
+// using a lightweight Mehrotra Predictor-Corrector scheme which avoids the
+// per-call equilibration, control-structure, and allocation overhead of the
+// general-purpose solver. Each iteration of each problem forms and factors
+// (without pivoting) the regularized quasi-definite augmented system
+//
+//   | Q + inv(X) Z + reg I,    A^T   |
+//   |           A,          -reg I   |,
+//
+// and the problems of each group are advanced in lockstep so that the
+// per-iteration work may be threaded across problems. Problems are retired
+// from the active set as soon as they converge.
+//
+
+namespace batch {
+
+template<typename Real>
+struct Workspace
+{
+    Matrix<Real> J, rhs, rb, rc, rmu, dx, dy, dz, dxAff, dyAff, dzAff;
+    Real bNrm2, cNrm2;
+    Int numIts;
+};
+
+// Form and factor the regularized augmented system (as elsewhere, only the
+// lower triangle of Q is referenced)
+template<typename Real>
+void FactorKKT
+( const Matrix<Real>& Q,
+  const Matrix<Real>& A,
+  const Matrix<Real>& x,
+  const Matrix<Real>& z,
+        Real reg,
+        Matrix<Real>& J )
+{
+    const Int m = A.Height();
+    const Int n = A.Width();
+    Zeros( J, n+m, n+m );
+    if( Q.Height() != 0 )
+    {
+        auto JTL = J( IR(0,n), IR(0,n) );
+        JTL = Q;
+    }
+    auto JBL = J( IR(n,n+m), IR(0,n) );
+    JBL = A;
+    for( Int i=0; i<n; ++i )
+        J(i,i) += z(i)/x(i) + reg;
+    for( Int i=0; i<m; ++i )
+        J(n+i,n+i) = -reg;
+    LDL( J, false );
+}
+
+// Solve for the search direction given the residuals
+//
+//   rc = Q x + c + A^T y - z, rb = A x - b, rmu = x o z - sigma mu e
+//
+template<typename Real>
+void SolveKKT
+( const Matrix<Real>& J,
+  const Matrix<Real>& x,
+  const Matrix<Real>& z,
+  const Matrix<Real>& rc,
+  const Matrix<Real>& rb,
+  const Matrix<Real>& rmu,
+        Matrix<Real>& dx,
+        Matrix<Real>& dy,
+        Matrix<Real>& dz,
+        Matrix<Real>& rhs )
+{
+    const Int n = x.Height();
+    const Int m = rb.Height();
+    rhs.Resize( n+m, 1 );
+    for( Int i=0; i<n; ++i )
+        rhs(i) = -rc(i) - rmu(i)/x(i);
+    for( Int i=0; i<m; ++i )
+        rhs(n+i) = -rb(i);
+    ldl::SolveAfter( J, rhs, false );
+
+    dx = rhs( IR(0,n), ALL );
+    dy = rhs( IR(n,n+m), ALL );
+    dz.Resize( n, 1 );
+    for( Int i=0; i<n; ++i )
+        dz(i) = -(rmu(i) + z(i)*dx(i))/x(i);
+}
+
+template<typename Real>
+void Initialize
+( const Matrix<Real>& Q,
+  const Matrix<Real>& A,
+  const Matrix<Real>& b,
+  const Matrix<Real>& c,
+        Matrix<Real>& x,
+        Matrix<Real>& y,
+        Matrix<Real>& z,
+        Real reg,
+        Workspace<Real>& work )
+{
+    const Int m = A.Height();
+    const Int n = A.Width();
+
+    // Solve | Q + I, A^T | | x | = | -c |,
+    //       |   A,   0   | | y |   |  b |
+    // so that x is feasible and Q x + c + A^T y = -x
+    Ones( x, n, 1 );
+    Ones( z, n, 1 );
+    FactorKKT( Q, A, x, z, reg, work.J );
+    Zeros( work.rc, n, 1 );
+    work.rb = b;
+    work.rb *= -1;
+    work.rmu = c;
+    SolveKKT
+    ( work.J, x, z, work.rc, work.rb, work.rmu,
+      work.dx, work.dy, work.dz, work.rhs );
+    x = work.dx;
+    y = work.dy;
+    z = work.dx;
+    z *= -1;
+
+    // Shift x and z into the interior using Mehrotra's heuristic
+    Real xShift = 0, zShift = 0;
+    for( Int i=0; i<n; ++i )
+    {
+        xShift = Max( xShift, -Real(1.5)*x(i) );
+        zShift = Max( zShift, -Real(1.5)*z(i) );
+    }
+    Real xSum = 0, zSum = 0, xzDot = 0;
+    for( Int i=0; i<n; ++i )
+    {
+        x(i) += xShift;
+        z(i) += zShift;
+        xSum += x(i);
+        zSum += z(i);
+        xzDot += x(i)*z(i);
+    }
+    if( xzDot > Real(0) )
+    {
+        const Real xBalance = xzDot / (2*zSum);
+        const Real zBalance = xzDot / (2*xSum);
+        for( Int i=0; i<n; ++i )
+        {
+            x(i) += xBalance;
+            z(i) += zBalance;
+        }
+    }
+    else
+    {
+        for( Int i=0; i<n; ++i )
+        {
+            x(i) += 1;
+            z(i) += 1;
+        }
+    }
+}
+
+// Form the residuals of the current iterate and return whether it has
+// converged
+template<typename Real>
+bool Converged
+( const Matrix<Real>& Q,
+  const Matrix<Real>& A,
+  const Matrix<Real>& b,
+  const Matrix<Real>& c,
+  const Matrix<Real>& x,
+  const Matrix<Real>& y,
+  const Matrix<Real>& z,
+  const BatchMehrotraCtrl<Real>& ctrl,
+        Workspace<Real>& work )
+{
+    const bool isLP = ( Q.Height() == 0 );
+
+    // rb := A x - b
+    work.rb = b;
+    Gemv( NORMAL, Real(1), A, x, Real(-1), work.rb );
+    // rc := Q x + c + A^T y - z
+    work.rc = c;
+    Real xQx = 0;
+    if( !isLP )
+    {
+        Hemv( LOWER, Real(1), Q, x, Real(1), work.rc );
+        xQx = Dot( x, work.rc ) - Dot( x, c );
+    }
+    Gemv( TRANSPOSE, Real(1), A, y, Real(1), work.rc );
+    work.rc -= z;
+    const Real primObj = xQx/2 + Dot(c,x);
+    const Real dualObj = -xQx/2 - Dot(b,y);
+    const Real relGap = Abs(primObj-dualObj) / (1+Abs(primObj));
+    const Real rbConv = FrobeniusNorm(work.rb) / (1+work.bNrm2);
+    const Real rcConv = FrobeniusNorm(work.rc) / (1+work.cNrm2);
+    return Max(relGap,Max(rbConv,rcConv)) <= ctrl.targetTol;
+}
+
+// Take a predictor-corrector step using the residuals formed by Converged
+template<typename Real>
+void Step
+( const Matrix<Real>& Q,
+  const Matrix<Real>& A,
+        Matrix<Real>& x,
+        Matrix<Real>& y,
+        Matrix<Real>& z,
+  const BatchMehrotraCtrl<Real>& ctrl,
+        Workspace<Real>& work )
+{
+    const Int n = A.Width();
+    const bool isLP = ( Q.Height() == 0 );
+
+    // Compute the affine search direction
+    // ===================================
+    const Real mu = Dot(x,z) / n;
+    FactorKKT( Q, A, x, z, ctrl.reg, work.J );
+    work.rmu.Resize( n, 1 );
+    for( Int i=0; i<n; ++i )
+        work.rmu(i) = x(i)*z(i);
+    SolveKKT
+    ( work.J, x, z, work.rc, work.rb, work.rmu,
+      work.dxAff, work.dyAff, work.dzAff, work.rhs );
+
+    Real alphaAffPri = pos_orth::MaxStep( x, work.dxAff, Real(1) );
+    Real alphaAffDual = pos_orth::MaxStep( z, work.dzAff, Real(1) );
+    if( !isLP )
+        alphaAffPri = alphaAffDual = Min(alphaAffPri,alphaAffDual);
+    Real muAff = 0;
+    for( Int i=0; i<n; ++i )
+        muAff += (x(i)+alphaAffPri*work.dxAff(i))*
+                 (z(i)+alphaAffDual*work.dzAff(i));
+    muAff /= n;
+    const Real sigma = Min( Pow(muAff/mu,Real(3)), Real(1) );
+
+    // Compute the combined predictor-corrector direction
+    // ==================================================
+    for( Int i=0; i<n; ++i )
+        work.rmu(i) += work.dxAff(i)*work.dzAff(i) - sigma*mu;
+    SolveKKT
+    ( work.J, x, z, work.rc, work.rb, work.rmu,
+      work.dx, work.dy, work.dz, work.rhs );
+
+    Real alphaPri = pos_orth::MaxStep( x, work.dx, 1/ctrl.maxStepRatio );
+    Real alphaDual = pos_orth::MaxStep( z, work.dz, 1/ctrl.maxStepRatio );
+    alphaPri = Min( ctrl.maxStepRatio*alphaPri, Real(1) );
+    alphaDual = Min( ctrl.maxStepRatio*alphaDual, Real(1) );
+    if( !isLP )
+        alphaPri = alphaDual = Min(alphaPri,alphaDual);
+    Axpy( alphaPri, work.dx, x );
+    Axpy( alphaDual, work.dy, y );
+    Axpy( alphaDual, work.dz, z );
+}
+
+} // namespace batch
+
+// The per-problem work calls routines which maintain the debugging call stack
+// and run debugging checks, so the problems are only threaded in release
+// builds
+#ifdef EL_RELEASE
+# define EL_BATCH_PARALLEL_FOR EL_PARALLEL_FOR
+#else
+# define EL_BATCH_PARALLEL_FOR
+#endif
+
+template<typename Real>
+Int BatchMehrotra
+( const vector<Matrix<Real>>& Q,
+  const vector<Matrix<Real>>& A,
+  const vector<Matrix<Real>>& b,
+  const vector<Matrix<Real>>& c,
+        vector<Matrix<Real>>& x,
+        vector<Matrix<Real>>& y,
+        vector<Matrix<Real>>& z,
+  const BatchMehrotraCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int numProblems = A.size();
+    EL_DEBUG_ONLY(
+      if( Int(Q.size()) != numProblems || Int(b.size()) != numProblems ||
+          Int(c.size()) != numProblems )
+          LogicError("Inconsistent numbers of problems");
+      for( Int k=0; k<numProblems; ++k )
+      {
+          const Int m = A[k].Height();
+          const Int n = A[k].Width();
+          if( b[k].Height() != m || b[k].Width() != 1 ||
+              c[k].Height() != n || c[k].Width() != 1 )
+              LogicError("Problem ",k," has inconsistent dimensions");
+          if( Q[k].Height() != 0 &&
+              (Q[k].Height() != n || Q[k].Width() != n) )
+              LogicError("Q[",k,"] should be empty or ",n," x ",n);
+      }
+    )
+    x.resize( numProblems );
+    y.resize( numProblems );
+    z.resize( numProblems );
+
+    const Int batchSize = Max( ctrl.batchSize, Int(1) );
+    vector<batch::Workspace<Real>> work( Min(batchSize,numProblems) );
+    // 0: active, 1: converged, 2: failed
+    vector<Int> status( Min(batchSize,numProblems) );
+    vector<Int> active;
+    Int numFailed = 0;
+    for( Int offset=0; offset<numProblems; offset+=batchSize )
+    {
+        const Int groupSize = Min( batchSize, numProblems-offset );
+
+        EL_BATCH_PARALLEL_FOR
+        for( Int s=0; s<groupSize; ++s )
+        {
+            const Int k = offset + s;
+            auto& w = work[s];
+            w.bNrm2 = FrobeniusNorm( b[k] );
+            w.cNrm2 = FrobeniusNorm( c[k] );
+            w.numIts = 0;
+            status[s] = 0;
+            try
+            {
+                batch::Initialize
+                ( Q[k], A[k], b[k], c[k], x[k], y[k], z[k], ctrl.reg, w );
+            }
+            catch( ... ) { status[s] = 2; }
+        }
+
+        active.resize( 0 );
+        for( Int s=0; s<groupSize; ++s )
+            if( status[s] == 0 )
+                active.push_back( s );
+
+        // Each pass checks for convergence and, for at most 'maxIts' passes,
+        // steps the unconverged problems; the final pass only checks them
+        for( Int it=0; it<=ctrl.maxIts && !active.empty(); ++it )
+        {
+            const Int numActive = active.size();
+            const bool lastPass = ( it == ctrl.maxIts );
+            EL_BATCH_PARALLEL_FOR
+            for( Int j=0; j<numActive; ++j )
+            {
+                const Int s = active[j];
+                const Int k = offset + s;
+                try
+                {
+                    if( batch::Converged
+                        ( Q[k], A[k], b[k], c[k], x[k], y[k], z[k],
+                          ctrl, work[s] ) )
+                        status[s] = 1;
+                    else if( lastPass )
+                        status[s] = 2;
+                    else
+                    {
+                        batch::Step
+                        ( Q[k], A[k], x[k], y[k], z[k], ctrl, work[s] );
+                        ++work[s].numIts;
+                    }
+                }
+                catch( ... ) { status[s] = 2; }
+            }
+
+            // Retire the converged (and failed) problems
+            Int numStillActive = 0;
+            for( Int j=0; j<numActive; ++j )
+                if( status[active[j]] == 0 )
+                    active[numStillActive++] = active[j];
+            active.resize( numStillActive );
+            if( ctrl.progress )
+                Output
+                ("Batch ",offset/batchSize,", iteration ",it,": ",
+                 numStillActive," of ",groupSize," problems active");
+        }
+
+        for( Int s=0; s<groupSize; ++s )
+            if( status[s] != 1 )
+                ++numFailed;
+    }
+    return numFailed;
+}
+
+#define PROTO(Real) \
+  template Int BatchMehrotra \
+  ( const vector<Matrix<Real>>& Q, \
+    const vector<Matrix<Real>>& A, \
+    const vector<Matrix<Real>>& b, \
+    const vector<Matrix<Real>>& c, \
+          vector<Matrix<Real>>& x, \
+          vector<Matrix<Real>>& y, \
+          vector<Matrix<Real>>& z, \
+    const BatchMehrotraCtrl<Real>& ctrl );
+
+#define EL_NO_INT_PROTO
+#define EL_NO_COMPLEX_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+#undef EL_BATCH_PARALLEL_FOR
+
+} // namespace direct
+} // namespace qp
+} // namespace El
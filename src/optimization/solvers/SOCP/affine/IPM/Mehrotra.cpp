@@ -1230,7 +1230,11 @@ void Mehrotra
     const Int m = A.Height();
     const Int k = G.Height();
     const Int n = A.Width();
-    const Int degree = soc::Degree( firstInds );
+    // Describe the product of cones once rather than rescanning 'orders' and
+    // 'firstInds' within each cone operation of each iteration
+    cone::Table table;
+    cone::BuildTable( orders, firstInds, table );
+    const Int degree = soc::Degree( table );
     const Grid& grid = APre.Grid();
     const int commRank = grid.Rank();
     Timer timer, iterTimer;
@@ -1398,9 +1402,9 @@ void Mehrotra
         // ===================================
         // TODO(poulson): Let this be a function of the relative error, etc.
         const Real minDist = eps;
-        soc::PushInto( s, orders, firstInds, minDist, cutoffPar );
-        soc::PushInto( z, orders, firstInds, minDist, cutoffPar );
-        soc::NesterovTodd( s, z, w, orders, firstInds, cutoffPar );
+        soc::PushInto( s, table, minDist );
+        soc::PushInto( z, table, minDist );
+        soc::NesterovTodd( s, z, w, table );
 
         // Check for convergence
         // =====================
@@ -1484,17 +1488,16 @@ void Mehrotra
             if( ctrl.print && commRank == 0 )
                 Output
                 ("|| w ||_max = ",wMaxNorm," was larger than ",wMaxNormLimit);
-            soc::PushPairInto
-            ( s, z, w, orders, firstInds, wMaxNormLimit, cutoffPar );
-            soc::NesterovTodd( s, z, w, orders, firstInds, cutoffPar );
+            soc::PushPairInto( s, z, w, table, wMaxNormLimit );
+            soc::NesterovTodd( s, z, w, table );
             wMaxNorm = MaxNorm(w);
             if( ctrl.print && commRank == 0 )
                 Output("New || w ||_max = ",wMaxNorm);
         }
-        soc::SquareRoot( w, wRoot, orders, firstInds, cutoffPar );
-        soc::Inverse( wRoot, wRootInv, orders, firstInds, cutoffPar );
-        soc::ApplyQuadratic( wRoot, z, l, orders, firstInds, cutoffPar );
-        soc::Inverse( l, lInv, orders, firstInds, cutoffPar );
+        soc::SquareRoot( w, wRoot, table );
+        soc::Inverse( wRoot, wRootInv, table );
+        soc::ApplyQuadratic( wRoot, z, l, table );
+        soc::Inverse( l, lInv, table );
         const Real mu = Dot(s,z) / degree;
 
         // r_mu := l
@@ -1586,10 +1589,8 @@ void Mehrotra
           sparseOrders, sparseFirstInds,
           sparseToOrigOrders, sparseToOrigFirstInds,
           dxAff, dyAff, dzAff, dsAff, cutoffPar );
-        soc::ApplyQuadratic
-        ( wRoot, dzAff, dzAffScaled, orders, firstInds, cutoffPar );
-        soc::ApplyQuadratic
-        ( wRootInv, dsAff, dsAffScaled, orders, firstInds, cutoffPar );
+        soc::ApplyQuadratic( wRoot, dzAff, dzAffScaled, table );
+        soc::ApplyQuadratic( wRootInv, dsAff, dsAffScaled, table );
 
         if( ctrl.checkResiduals && ctrl.print )
         {
@@ -1640,10 +1641,8 @@ void Mehrotra
         // ==============================
         if( ctrl.time && commRank == 0 )
             timer.Start();
-        Real alphaAffPri =
-          soc::MaxStep( s, dsAff, orders, firstInds, Real(1), cutoffPar );
-        Real alphaAffDual =
-          soc::MaxStep( z, dzAff, orders, firstInds, Real(1), cutoffPar );
+        Real alphaAffPri = soc::MaxStep( s, dsAff, table, Real(1) );
+        Real alphaAffDual = soc::MaxStep( z, dzAff, table, Real(1) );
         if( ctrl.time && commRank == 0 )
             Output("Affine line search: ",timer.Stop()," secs");
         if( ctrl.forceSameStep )
@@ -1675,9 +1674,9 @@ void Mehrotra
         {
             // r_mu := l + inv(l) o ((inv(W)^T dsAff) o (W dzAff) - sigma*mu)
             // --------------------------------------------------------------
-            soc::Apply( dsAffScaled, dzAffScaled, rmu, orders, firstInds );
-            soc::Shift( rmu, -sigma*mu, orders, firstInds );
-            soc::Apply( lInv, rmu, orders, firstInds );
+            soc::Apply( dsAffScaled, dzAffScaled, rmu, table );
+            soc::Shift( rmu, -sigma*mu, table );
+            soc::Apply( lInv, rmu, table );
             rmu += l;
         }
         else
@@ -1736,12 +1735,8 @@ void Mehrotra
         // ============================
         if( ctrl.time && commRank == 0 )
             timer.Start();
-        Real alphaPri =
-          soc::MaxStep
-          ( s, ds, orders, firstInds, 1/ctrl.maxStepRatio, cutoffPar );
-        Real alphaDual =
-          soc::MaxStep
-          ( z, dz, orders, firstInds, 1/ctrl.maxStepRatio, cutoffPar );
+        Real alphaPri = soc::MaxStep( s, ds, table, 1/ctrl.maxStepRatio );
+        Real alphaDual = soc::MaxStep( z, dz, table, 1/ctrl.maxStepRatio );
         if( ctrl.time && commRank == 0 )
             Output("Combined line search: ",timer.Stop()," secs");
         alphaPri = Min(ctrl.maxStepRatio*alphaPri,Real(1));
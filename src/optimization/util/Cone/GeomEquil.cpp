@@ -77,7 +77,7 @@ void GeomEquil
         // Geometrically equilibrate the columns
         // -------------------------------------
         StackedGeometricColumnScaling( A, B, colScale );
-        EntrywiseMap( colScale, MakeFunction(DampScaling<Real>) );
+        EntrywiseMap( colScale, DampScaling<Real> );
         DiagonalScale( LEFT, NORMAL, colScale, dCol );
         DiagonalSolve( RIGHT, NORMAL, colScale, A );
         DiagonalSolve( RIGHT, NORMAL, colScale, B );
@@ -85,7 +85,7 @@ void GeomEquil
         // Geometrically equilibrate the rows
         // ----------------------------------
         GeometricRowScaling( A, rowScaleA );
-        EntrywiseMap( rowScaleA, MakeFunction(DampScaling<Real>) );
+        EntrywiseMap( rowScaleA, DampScaling<Real> );
         DiagonalScale( LEFT, NORMAL, rowScaleA, dRowA );
         DiagonalSolve( LEFT, NORMAL, rowScaleA, A );
 
@@ -93,7 +93,7 @@ void GeomEquil
         // intrusive change
         GeometricRowScaling( B, rowScaleB );
         cone::AllReduce( rowScaleB, orders, firstInds, mpi::MAX );
-        EntrywiseMap( rowScaleB, MakeFunction(DampScaling<Real>) );
+        EntrywiseMap( rowScaleB, DampScaling<Real> );
         DiagonalScale( LEFT, NORMAL, rowScaleB, dRowB );
         DiagonalSolve( LEFT, NORMAL, rowScaleB, B );
 
@@ -202,7 +202,7 @@ void GeomEquil
         // Geometrically equilibrate the columns
         // -------------------------------------
         StackedGeometricColumnScaling( A, B, colScale );
-        EntrywiseMap( colScale, MakeFunction(DampScaling<Real>) );
+        EntrywiseMap( colScale, DampScaling<Real> );
         DiagonalScale( LEFT, NORMAL, colScale, dCol );
         DiagonalSolve( RIGHT, NORMAL, colScale, A );
         DiagonalSolve( RIGHT, NORMAL, colScale, B );
@@ -210,7 +210,7 @@ void GeomEquil
         // Geometrically equilibrate the rows
         // ----------------------------------
         GeometricRowScaling( A, rowScaleA );
-        EntrywiseMap( rowScaleA, MakeFunction(DampScaling<Real>) );
+        EntrywiseMap( rowScaleA, DampScaling<Real> );
         DiagonalScale( LEFT, NORMAL, rowScaleA, dRowA );
         DiagonalSolve( LEFT, NORMAL, rowScaleA, A );
 
@@ -218,7 +218,7 @@ void GeomEquil
         // intrusive change
         GeometricRowScaling( B, rowScaleB );
         cone::AllReduce( rowScaleB, orders, firstInds, mpi::MAX, cutoff );
-        EntrywiseMap( rowScaleB, MakeFunction(DampScaling<Real>) );
+        EntrywiseMap( rowScaleB, DampScaling<Real> );
         DiagonalScale( LEFT, NORMAL, rowScaleB, dRowB );
         DiagonalSolve( LEFT, NORMAL, rowScaleB, B );
 
@@ -335,7 +335,7 @@ void GeomEquil
                 colScaleBuf[j] = scale;
             }
         }
-        EntrywiseMap( colScale, MakeFunction(DampScaling<Real>) );
+        EntrywiseMap( colScale, DampScaling<Real> );
         DiagonalScale( LEFT, NORMAL, colScale, dCol );
         DiagonalSolve( RIGHT, NORMAL, colScale, A );
         DiagonalSolve( RIGHT, NORMAL, colScale, B );
@@ -356,7 +356,7 @@ void GeomEquil
                 rowScaleABuf[i] = scale;
             }
         }
-        EntrywiseMap( rowScaleA, MakeFunction(DampScaling<Real>) );
+        EntrywiseMap( rowScaleA, DampScaling<Real> );
         DiagonalScale( LEFT, NORMAL, rowScaleA, dRowA );
         DiagonalSolve( LEFT, NORMAL, rowScaleA, A );
 
@@ -376,7 +376,7 @@ void GeomEquil
                 rowScaleBBuf[i] = scale;
             }
         }
-        EntrywiseMap( rowScaleB, MakeFunction(DampScaling<Real>) );
+        EntrywiseMap( rowScaleB, DampScaling<Real> );
         DiagonalScale( LEFT, NORMAL, rowScaleB, dRowB );
         DiagonalSolve( LEFT, NORMAL, rowScaleB, B );
 
@@ -518,7 +518,7 @@ void GeomEquil
                 scalesBuf[jLoc] = scale;
             }
         }
-        EntrywiseMap( scales, MakeFunction(DampScaling<Real>) );
+        EntrywiseMap( scales, DampScaling<Real> );
         DiagonalScale( LEFT, NORMAL, scales, dCol );
         DiagonalSolve( RIGHT, NORMAL, scales, A );
         DiagonalSolve( RIGHT, NORMAL, scales, B );
@@ -541,7 +541,7 @@ void GeomEquil
                 scalesBuf[iLoc] = Max(propScale,sqrtDamp*maxAbs);
             }
         }
-        EntrywiseMap( scales, MakeFunction(DampScaling<Real>) );
+        EntrywiseMap( scales, DampScaling<Real> );
         DiagonalScale( LEFT, NORMAL, scales, dRowA );
         DiagonalSolve( LEFT, NORMAL, scales, A );
 
@@ -563,7 +563,7 @@ void GeomEquil
                 scalesBuf[iLoc] = Max(propScale,sqrtDamp*maxAbs);
             }
         }
-        EntrywiseMap( scales, MakeFunction(DampScaling<Real>) );
+        EntrywiseMap( scales, DampScaling<Real> );
         DiagonalScale( LEFT, NORMAL, scales, dRowB );
         DiagonalSolve( LEFT, NORMAL, scales, B );
 
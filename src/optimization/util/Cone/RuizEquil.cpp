@@ -57,7 +57,7 @@ void RuizEquil
         ColumnMaxNorms( B, colScaleB );
         for( Int j=0; j<n; ++j )
             colScale(j) = Max(colScale(j),colScaleB(j));
-        EntrywiseMap( colScale, MakeFunction(DampScaling<Real>) );
+        EntrywiseMap( colScale, DampScaling<Real> );
         DiagonalScale( LEFT, NORMAL, colScale, dCol );
         DiagonalSolve( RIGHT, NORMAL, colScale, A );
         DiagonalSolve( RIGHT, NORMAL, colScale, B );
@@ -65,13 +65,13 @@ void RuizEquil
         // Rescale the rows
         // ----------------
         RowMaxNorms( A, rowScale );
-        EntrywiseMap( rowScale, MakeFunction(DampScaling<Real>) );
+        EntrywiseMap( rowScale, DampScaling<Real> );
         DiagonalScale( LEFT, NORMAL, rowScale, dRowA );
         DiagonalSolve( LEFT, NORMAL, rowScale, A );
 
         RowMaxNorms( B, rowScale );
         cone::AllReduce( rowScale, orders, firstInds, mpi::MAX );
-        EntrywiseMap( rowScale, MakeFunction(DampScaling<Real>) );
+        EntrywiseMap( rowScale, DampScaling<Real> );
         DiagonalScale( LEFT, NORMAL, rowScale, dRowB );
         DiagonalSolve( LEFT, NORMAL, rowScale, B );
     }
@@ -138,7 +138,7 @@ void RuizEquil
         ColumnMaxNorms( B, colScaleB );
         for( Int jLoc=0; jLoc<nLocal; ++jLoc )
             colScaleLoc(jLoc) = Max(colScaleLoc(jLoc),colScaleBLoc(jLoc));
-        EntrywiseMap( colScale, MakeFunction(DampScaling<Real>) );
+        EntrywiseMap( colScale, DampScaling<Real> );
         DiagonalScale( LEFT, NORMAL, colScale, dCol );
         DiagonalSolve( RIGHT, NORMAL, colScale, A );
         DiagonalSolve( RIGHT, NORMAL, colScale, B );
@@ -146,13 +146,13 @@ void RuizEquil
         // Rescale the rows
         // ----------------
         RowMaxNorms( A, rowScale );
-        EntrywiseMap( rowScale, MakeFunction(DampScaling<Real>) );
+        EntrywiseMap( rowScale, DampScaling<Real> );
         DiagonalScale( LEFT, NORMAL, rowScale, dRowA );
         DiagonalSolve( LEFT, NORMAL, rowScale, A );
 
         RowMaxNorms( B, rowScale );
         cone::AllReduce( rowScale, orders, firstInds, mpi::MAX, cutoff );
-        EntrywiseMap( rowScale, MakeFunction(DampScaling<Real>) );
+        EntrywiseMap( rowScale, DampScaling<Real> );
         DiagonalScale( LEFT, NORMAL, rowScale, dRowB );
         DiagonalSolve( LEFT, NORMAL, rowScale, B );
     }
@@ -193,7 +193,7 @@ void RuizEquil
         ColumnMaxNorms( B, maxAbsValsB );
         for( Int j=0; j<n; ++j )
             scales(j) = Max(scales(j),maxAbsValsB(j));
-        EntrywiseMap( scales, MakeFunction(DampScaling<Real>) );
+        EntrywiseMap( scales, DampScaling<Real> );
         DiagonalScale( LEFT, NORMAL, scales, dCol );
         DiagonalSolve( RIGHT, NORMAL, scales, A );
         DiagonalSolve( RIGHT, NORMAL, scales, B );
@@ -201,13 +201,13 @@ void RuizEquil
         // Rescale the rows
         // ----------------
         RowMaxNorms( A, scales );
-        EntrywiseMap( scales, MakeFunction(DampScaling<Real>) );
+        EntrywiseMap( scales, DampScaling<Real> );
         DiagonalScale( LEFT, NORMAL, scales, dRowA );
         DiagonalSolve( LEFT, NORMAL, scales, A );
 
         RowMaxNorms( B, scales );
         cone::AllReduce( scales, orders, firstInds, mpi::MAX );
-        EntrywiseMap( scales, MakeFunction(DampScaling<Real>) );
+        EntrywiseMap( scales, DampScaling<Real> );
         DiagonalScale( LEFT, NORMAL, scales, dRowB );
         DiagonalSolve( LEFT, NORMAL, scales, B );
     }
@@ -259,7 +259,7 @@ void RuizEquil
         for( Int jLoc=0; jLoc<nLoc; ++jLoc )
             scaleBuf[jLoc] = Max(scaleBuf[jLoc],maxAbsValBuf[jLoc]);
 
-        EntrywiseMap( scales, MakeFunction(DampScaling<Real>) );
+        EntrywiseMap( scales, DampScaling<Real> );
         DiagonalScale( LEFT, NORMAL, scales, dCol );
         DiagonalSolve( RIGHT, NORMAL, scales, A );
         DiagonalSolve( RIGHT, NORMAL, scales, B );
@@ -267,13 +267,13 @@ void RuizEquil
         // Rescale the rows
         // ----------------
         RowMaxNorms( A, scales );
-        EntrywiseMap( scales, MakeFunction(DampScaling<Real>) );
+        EntrywiseMap( scales, DampScaling<Real> );
         DiagonalScale( LEFT, NORMAL, scales, dRowA );
         DiagonalSolve( LEFT, NORMAL, scales, A );
 
         RowMaxNorms( B, scales );
         cone::AllReduce( scales, orders, firstInds, mpi::MAX, cutoff );
-        EntrywiseMap( scales, MakeFunction(DampScaling<Real>) );
+        EntrywiseMap( scales, DampScaling<Real> );
         DiagonalScale( LEFT, NORMAL, scales, dRowB );
         DiagonalSolve( LEFT, NORMAL, scales, B );
     }
@@ -0,0 +1,321 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+
+namespace {
+
+template<typename Real>
+EnableIf<IsReal<Real>,Real> ReductionIdentity( mpi::Op op )
+{
+    if( op == mpi::SUM )
+        return Real(0);
+    else if( op == mpi::MAX )
+        return limits::Lowest<Real>();
+    else if( op == mpi::MIN )
+        return limits::Max<Real>();
+    else
+        LogicError("Unsupported cone::AllReduce operation");
+    return Real(0);
+}
+
+template<typename Field>
+EnableIf<IsComplex<Field>,Field> ReductionIdentity( mpi::Op op )
+{
+    if( op != mpi::SUM )
+        LogicError("Unsupported cone::AllReduce operation");
+    return Field(0);
+}
+
+template<typename Real>
+EnableIf<IsReal<Real>,Real> Reduce( Real alpha, Real beta, mpi::Op op )
+{
+    if( op == mpi::SUM )
+        return alpha+beta;
+    else if( op == mpi::MAX )
+        return Max(alpha,beta);
+    else
+        return Min(alpha,beta);
+}
+
+template<typename Field>
+EnableIf<IsComplex<Field>,Field> Reduce( Field alpha, Field beta, mpi::Op )
+{ return alpha+beta; }
+
+} // anonymous namespace
+
+namespace cone {
+
+void BuildTable
+( const DistMultiVec<Int>& orders,
+  const DistMultiVec<Int>& firstInds,
+        Table& table )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( orders.Width() != 1 || firstInds.Width() != 1 )
+          LogicError("orders and firstInds should be column vectors");
+      if( orders.Height() != firstInds.Height() )
+          LogicError("orders and firstInds should be the same height");
+    )
+    const Grid& grid = orders.Grid();
+    const Int firstLocalRow = orders.FirstLocalRow();
+    const Int localHeight = orders.LocalHeight();
+    const Int lastLocalRow = firstLocalRow + localHeight;
+    const Int* orderBuf = orders.LockedMatrix().LockedBuffer();
+    const Int* firstIndBuf = firstInds.LockedMatrix().LockedBuffer();
+
+    table.height = orders.Height();
+    table.firstLocalRow = firstLocalRow;
+    table.localHeight = localHeight;
+    table.localBegins.clear();
+    table.localOrders.clear();
+    table.splitIndices.clear();
+    table.splitFirstInds.clear();
+    table.splitLocalBegins.clear();
+    table.splitLocalEnds.clear();
+
+    // Walk the local rows one (partial) cone at a time
+    // ================================================
+    Int localDegree = 0;
+    vector<Int> rootedSplitFirstInds;
+    Int iLoc = 0;
+    while( iLoc < localHeight )
+    {
+        const Int firstInd = firstIndBuf[iLoc];
+        const Int order = orderBuf[iLoc];
+        const Int coneEnd = firstInd + order;
+        const Int localEnd = Min(coneEnd,lastLocalRow) - firstLocalRow;
+        EL_DEBUG_ONLY(
+          if( order <= 0 || localEnd <= iLoc )
+              LogicError("Invalid cone at row ",iLoc+firstLocalRow);
+        )
+        const bool rootIsLocal = ( firstInd >= firstLocalRow );
+        if( rootIsLocal )
+            ++localDegree;
+        if( rootIsLocal && coneEnd <= lastLocalRow )
+        {
+            table.localBegins.push_back( iLoc );
+            table.localOrders.push_back( order );
+        }
+        else
+        {
+            if( rootIsLocal )
+                rootedSplitFirstInds.push_back( firstInd );
+            table.splitFirstInds.push_back( firstInd );
+            table.splitLocalBegins.push_back( iLoc );
+            table.splitLocalEnds.push_back( localEnd );
+        }
+        iLoc = localEnd;
+    }
+    table.numCones = mpi::AllReduce( localDegree, grid.Comm() );
+
+    // Enumerate the split cones by gathering their roots from their owners
+    // ====================================================================
+    // Since each process owns a contiguous block of rows, and the blocks are
+    // ordered by rank, the gathered list of roots is already sorted.
+    const int commSize = grid.Size();
+    const int numRootedSplits = rootedSplitFirstInds.size();
+    vector<int> splitSizes(commSize);
+    mpi::AllGather( &numRootedSplits, 1, splitSizes.data(), 1, grid.Comm() );
+    vector<int> splitOffs;
+    table.numSplitCones = Scan( splitSizes, splitOffs );
+    vector<Int> splitRoots( table.numSplitCones );
+    mpi::AllGather
+    ( rootedSplitFirstInds.data(), numRootedSplits,
+      splitRoots.data(), splitSizes.data(), splitOffs.data(), grid.Comm() );
+
+    const Int numLocalSplits = table.splitFirstInds.size();
+    table.splitIndices.resize( numLocalSplits );
+    for( Int k=0; k<numLocalSplits; ++k )
+    {
+        auto it = std::lower_bound
+          ( splitRoots.cbegin(), splitRoots.cend(), table.splitFirstInds[k] );
+        EL_DEBUG_ONLY(
+          if( it == splitRoots.cend() || *it != table.splitFirstInds[k] )
+              LogicError("Did not find split cone root");
+        )
+        table.splitIndices[k] = it - splitRoots.cbegin();
+    }
+}
+
+void BuildTable
+( const vector<Int>& coneOrders,
+  const Grid& grid,
+        Table& table )
+{
+    EL_DEBUG_CSE
+    const Int numOrders = coneOrders.size();
+    Int height = 0, numCones = 0;
+    for( Int k=0; k<numOrders; ++k )
+    {
+        if( coneOrders[k] < 0 )
+            LogicError("Cone ",k," has negative order ",coneOrders[k]);
+        // A cone of order zero contains no rows and does not contribute to
+        // the degree of the product cone
+        if( coneOrders[k] > 0 )
+            ++numCones;
+        height += coneOrders[k];
+    }
+
+    // Use an empty-width vector to determine our block of rows
+    DistMultiVec<Int> shape(height,0,grid);
+    const Int firstLocalRow = shape.FirstLocalRow();
+    const Int localHeight = shape.LocalHeight();
+    const Int lastLocalRow = firstLocalRow + localHeight;
+
+    table.height = height;
+    table.numCones = numCones;
+    table.firstLocalRow = firstLocalRow;
+    table.localHeight = localHeight;
+    table.localBegins.clear();
+    table.localOrders.clear();
+    table.splitIndices.clear();
+    table.splitFirstInds.clear();
+    table.splitLocalBegins.clear();
+    table.splitLocalEnds.clear();
+
+    // Since the cone orders are replicated, the split cones can be
+    // enumerated without any communication
+    Int numSplitCones = 0;
+    Int firstInd = 0;
+    for( Int k=0; k<numOrders; ++k )
+    {
+        const Int order = coneOrders[k];
+        if( order == 0 )
+            continue;
+        const Int coneEnd = firstInd + order;
+        const bool split =
+          ( shape.RowOwner(firstInd) != shape.RowOwner(coneEnd-1) );
+        const bool touchesLocal =
+          ( firstInd < lastLocalRow && coneEnd > firstLocalRow );
+        if( touchesLocal )
+        {
+            if( split )
+            {
+                table.splitIndices.push_back( numSplitCones );
+                table.splitFirstInds.push_back( firstInd );
+                table.splitLocalBegins.push_back
+                ( Max(firstInd,firstLocalRow) - firstLocalRow );
+                table.splitLocalEnds.push_back
+                ( Min(coneEnd,lastLocalRow) - firstLocalRow );
+            }
+            else
+            {
+                table.localBegins.push_back( firstInd-firstLocalRow );
+                table.localOrders.push_back( order );
+            }
+        }
+        if( split )
+            ++numSplitCones;
+        firstInd = coneEnd;
+    }
+    table.numSplitCones = numSplitCones;
+}
+
+template<typename Field>
+void Broadcast( DistMultiVec<Field>& x, const Table& table )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( x.Height() != table.height || x.Width() != 1 )
+          LogicError("x should be a column vector matching the cone table");
+    )
+    Field* xBuf = x.Matrix().Buffer();
+
+    const Int numLocalCones = table.localBegins.size();
+    for( Int k=0; k<numLocalCones; ++k )
+    {
+        const Int begin = table.localBegins[k];
+        const Int end = begin + table.localOrders[k];
+        const Field root = xBuf[begin];
+        for( Int iLoc=begin+1; iLoc<end; ++iLoc )
+            xBuf[iLoc] = root;
+    }
+
+    if( table.numSplitCones == 0 )
+        return;
+    vector<Field> splitRoots( table.numSplitCones, Field(0) );
+    const Int numLocalSplits = table.splitIndices.size();
+    for( Int k=0; k<numLocalSplits; ++k )
+    {
+        const Int begin = table.splitLocalBegins[k];
+        if( begin+table.firstLocalRow == table.splitFirstInds[k] )
+            splitRoots[table.splitIndices[k]] = xBuf[begin];
+    }
+    mpi::AllReduce( splitRoots.data(), table.numSplitCones, x.Grid().Comm() );
+    for( Int k=0; k<numLocalSplits; ++k )
+    {
+        const Field root = splitRoots[table.splitIndices[k]];
+        for( Int iLoc=table.splitLocalBegins[k];
+                 iLoc<table.splitLocalEnds[k]; ++iLoc )
+            xBuf[iLoc] = root;
+    }
+}
+
+template<typename Field>
+void AllReduce( DistMultiVec<Field>& x, const Table& table, mpi::Op op )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( x.Height() != table.height || x.Width() != 1 )
+          LogicError("x should be a column vector matching the cone table");
+    )
+    Field* xBuf = x.Matrix().Buffer();
+    const Field identity = ReductionIdentity<Field>( op );
+
+    const Int numLocalCones = table.localBegins.size();
+    for( Int k=0; k<numLocalCones; ++k )
+    {
+        const Int begin = table.localBegins[k];
+        const Int end = begin + table.localOrders[k];
+        Field value = identity;
+        for( Int iLoc=begin; iLoc<end; ++iLoc )
+            value = Reduce( value, xBuf[iLoc], op );
+        for( Int iLoc=begin; iLoc<end; ++iLoc )
+            xBuf[iLoc] = value;
+    }
+
+    if( table.numSplitCones == 0 )
+        return;
+    vector<Field> splitValues( table.numSplitCones, identity );
+    const Int numLocalSplits = table.splitIndices.size();
+    for( Int k=0; k<numLocalSplits; ++k )
+    {
+        Field& value = splitValues[table.splitIndices[k]];
+        for( Int iLoc=table.splitLocalBegins[k];
+                 iLoc<table.splitLocalEnds[k]; ++iLoc )
+            value = Reduce( value, xBuf[iLoc], op );
+    }
+    mpi::AllReduce
+    ( splitValues.data(), table.numSplitCones, op, x.Grid().Comm() );
+    for( Int k=0; k<numLocalSplits; ++k )
+    {
+        const Field value = splitValues[table.splitIndices[k]];
+        for( Int iLoc=table.splitLocalBegins[k];
+                 iLoc<table.splitLocalEnds[k]; ++iLoc )
+            xBuf[iLoc] = value;
+    }
+}
+
+#define PROTO(Field) \
+  template void Broadcast( DistMultiVec<Field>& x, const Table& table ); \
+  template void AllReduce \
+  ( DistMultiVec<Field>& x, const Table& table, mpi::Op op );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace cone
+} // namespace El
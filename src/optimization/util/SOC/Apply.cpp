@@ -171,6 +171,48 @@ void Apply
     y = z;
 }
 
+template<typename Real,
+         typename/*=EnableIf<IsReal<Real>>*/>
+void Apply
+( const DistMultiVec<Real>& x,
+  const DistMultiVec<Real>& y,
+        DistMultiVec<Real>& z,
+  const cone::Table& table )
+{
+    EL_DEBUG_CSE
+    soc::Dots( x, y, z, table );
+    auto xRoots = x;
+    auto yRoots = y;
+    cone::Broadcast( xRoots, table );
+    cone::Broadcast( yRoots, table );
+
+    const Real* xBuf     = x.LockedMatrix().LockedBuffer();
+    const Real* xRootBuf = xRoots.LockedMatrix().LockedBuffer();
+    const Real* yBuf     = y.LockedMatrix().LockedBuffer();
+    const Real* yRootBuf = yRoots.LockedMatrix().LockedBuffer();
+          Real* zBuf     = z.Matrix().Buffer();
+    cone::ForEachLocalCone( table,
+      [&]( Int begin, Int end, bool root )
+      {
+          for( Int iLoc=(root ? begin+1 : begin); iLoc<end; ++iLoc )
+              zBuf[iLoc] +=
+                xRootBuf[iLoc]*yBuf[iLoc] + yRootBuf[iLoc]*xBuf[iLoc];
+      } );
+}
+
+template<typename Real,
+         typename/*=EnableIf<IsReal<Real>>*/>
+void Apply
+( const DistMultiVec<Real>& x,
+        DistMultiVec<Real>& y,
+  const cone::Table& table )
+{
+    EL_DEBUG_CSE
+    DistMultiVec<Real> z(x.Grid());
+    soc::Apply( x, y, z, table );
+    y = z;
+}
+
 #define PROTO(Real) \
   template void Apply \
   ( const Matrix<Real>& x, \
@@ -208,7 +250,16 @@ void Apply
           DistMultiVec<Real>& y, \
     const DistMultiVec<Int>& orders, \
     const DistMultiVec<Int>& firstInds, \
-    Int cutoff );
+    Int cutoff ); \
+  template void Apply \
+  ( const DistMultiVec<Real>& x, \
+    const DistMultiVec<Real>& y, \
+          DistMultiVec<Real>& z, \
+    const cone::Table& table ); \
+  template void Apply \
+  ( const DistMultiVec<Real>& x, \
+          DistMultiVec<Real>& y, \
+    const cone::Table& table );
 
 #define EL_NO_INT_PROTO
 #define EL_NO_COMPLEX_PROTO
@@ -24,24 +24,23 @@ void ApplyQuadratic
 {
     EL_DEBUG_CSE
 
-    // detRy := det(x) R y
+    // d := det(x), Ry := R y
     Matrix<Real> d;
     soc::Dets( x, d, orders, firstInds );
     cone::Broadcast( d, orders, firstInds );
     auto Ry = y;
     soc::Reflect( Ry, orders, firstInds );
-    Matrix<Real> detRy;
-    Hadamard( d, Ry, detRy );
 
-    // z := 2 (x^T y) x
+    // xTy := x^T y
     Matrix<Real> xTy;
     soc::Dots( x, y, xTy, orders, firstInds );
     cone::Broadcast( xTy, orders, firstInds );
-    Hadamard( xTy, x, z );
-    z *= 2;
 
-    // z := z - detRy
-    z -= detRy;
+    // z := 2 (x^T y) x - det(x) R y in a single pass
+    z.Resize( x.Height(), x.Width() );
+    Entrywise(z) =
+      Real(2)*Hadamard(Entrywise(xTy),Entrywise(x)) -
+      Hadamard(Entrywise(d),Entrywise(Ry));
 }
 
 template<typename Real,
@@ -75,24 +74,23 @@ void ApplyQuadratic
     auto& orders = ordersProx.GetLocked();
     auto& firstInds = firstIndsProx.GetLocked();
 
-    // detRy := det(x) R y
+    // d := det(x), Ry := R y
     DistMatrix<Real,VC,STAR> d(x.Grid());
     soc::Dets( x, d, orders, firstInds, cutoff );
     cone::Broadcast( d, orders, firstInds, cutoff );
     auto Ry = y;
     soc::Reflect( Ry, orders, firstInds );
-    DistMatrix<Real,VC,STAR> detRy(x.Grid());
-    Hadamard( d, Ry, detRy );
 
-    // z := 2 (x^T y) x
+    // xTy := x^T y
     DistMatrix<Real,VC,STAR> xTy(x.Grid());
     soc::Dots( x, y, xTy, orders, firstInds, cutoff );
     cone::Broadcast( xTy, orders, firstInds, cutoff );
-    Hadamard( xTy, x, z );
-    z *= 2;
 
-    // z := z - detRy
-    z -= detRy;
+    // z := 2 (x^T y) x - det(x) R y in a single pass
+    z.Resize( x.Height(), x.Width() );
+    Entrywise(z) =
+      Real(2)*Hadamard(Entrywise(xTy),Entrywise(x)) -
+      Hadamard(Entrywise(d),Entrywise(Ry));
 }
 
 template<typename Real,
@@ -107,24 +105,24 @@ void ApplyQuadratic
 {
     EL_DEBUG_CSE
 
-    // detRy := det(x) R y
+    // d := det(x), Ry := R y
     DistMultiVec<Real> d(x.Grid());
     soc::Dets( x, d, orders, firstInds, cutoff );
     cone::Broadcast( d, orders, firstInds, cutoff );
     auto Ry = y;
     soc::Reflect( Ry, orders, firstInds );
-    DistMultiVec<Real> detRy(x.Grid());
-    Hadamard( d, Ry, detRy );
 
-    // z := 2 (x^T y) x
+    // xTy := x^T y
     DistMultiVec<Real> xTy(x.Grid());
     soc::Dots( x, y, xTy, orders, firstInds, cutoff );
     cone::Broadcast( xTy, orders, firstInds, cutoff );
-    Hadamard( xTy, x, z );
-    z *= 2;
 
-    // z := z - detRy
-    z -= detRy;
+    // z := 2 (x^T y) x - det(x) R y in a single pass
+    z.SetGrid( x.Grid() );
+    z.Resize( x.Height(), x.Width() );
+    Entrywise(z) =
+      Real(2)*Hadamard(Entrywise(xTy),Entrywise(x)) -
+      Hadamard(Entrywise(d),Entrywise(Ry));
 }
 
 template<typename Real,
@@ -174,6 +172,49 @@ void ApplyQuadratic
     y = z;
 }
 
+template<typename Real,
+         typename/*=EnableIf<IsReal<Real>>*/>
+void ApplyQuadratic
+( const DistMultiVec<Real>& x,
+  const DistMultiVec<Real>& y,
+        DistMultiVec<Real>& z,
+  const cone::Table& table )
+{
+    EL_DEBUG_CSE
+
+    // d := det(x), Ry := R y
+    DistMultiVec<Real> d(x.Grid());
+    soc::Dets( x, d, table );
+    cone::Broadcast( d, table );
+    auto Ry = y;
+    soc::Reflect( Ry, table );
+
+    // xTy := x^T y
+    DistMultiVec<Real> xTy(x.Grid());
+    soc::Dots( x, y, xTy, table );
+    cone::Broadcast( xTy, table );
+
+    // z := 2 (x^T y) x - det(x) R y in a single pass
+    z.SetGrid( x.Grid() );
+    z.Resize( x.Height(), x.Width() );
+    Entrywise(z) =
+      Real(2)*Hadamard(Entrywise(xTy),Entrywise(x)) -
+      Hadamard(Entrywise(d),Entrywise(Ry));
+}
+
+template<typename Real,
+         typename/*=EnableIf<IsReal<Real>>*/>
+void ApplyQuadratic
+( const DistMultiVec<Real>& x,
+        DistMultiVec<Real>& y,
+  const cone::Table& table )
+{
+    EL_DEBUG_CSE
+    DistMultiVec<Real> z(x.Grid());
+    soc::ApplyQuadratic( x, y, z, table );
+    y = z;
+}
+
 #define PROTO(Real) \
   template void ApplyQuadratic \
   ( const Matrix<Real>& x, \
@@ -211,7 +252,16 @@ void ApplyQuadratic
           DistMultiVec<Real>& y, \
     const DistMultiVec<Int>& orders, \
     const DistMultiVec<Int>& firstInds, \
-    Int cutoff );
+    Int cutoff ); \
+  template void ApplyQuadratic \
+  ( const DistMultiVec<Real>& x, \
+    const DistMultiVec<Real>& y, \
+          DistMultiVec<Real>& z, \
+    const cone::Table& table ); \
+  template void ApplyQuadratic \
+  ( const DistMultiVec<Real>& x, \
+          DistMultiVec<Real>& y, \
+    const cone::Table& table );
 
 #define EL_NO_INT_PROTO
 #define EL_NO_COMPLEX_PROTO
@@ -58,5 +58,11 @@ Int Degree( const DistMultiVec<Int>& firstInds )
     return mpi::AllReduce( localDegree, firstInds.Grid().Comm() );
 }
 
+Int Degree( const cone::Table& table )
+{
+    EL_DEBUG_CSE
+    return table.numCones;
+}
+
 } // namespace soc
 } // namespace El
@@ -72,6 +72,19 @@ void Dets
     soc::Dots( x, Rx, d, orders, firstInds, cutoff );
 }
 
+template<typename Real,
+         typename/*=EnableIf<IsReal<Real>>*/>
+void Dets
+( const DistMultiVec<Real>& x,
+        DistMultiVec<Real>& d,
+  const cone::Table& table )
+{
+    EL_DEBUG_CSE
+    auto Rx = x;
+    soc::Reflect( Rx, table );
+    soc::Dots( x, Rx, d, table );
+}
+
 #define PROTO(Real) \
   template void Dets \
   ( const Matrix<Real>& x, \
@@ -87,7 +100,11 @@ void Dets
   ( const DistMultiVec<Real>& x, \
           DistMultiVec<Real>& d, \
     const DistMultiVec<Int>& orders, \
-    const DistMultiVec<Int>& firstInds, Int cutoff );
+    const DistMultiVec<Int>& firstInds, Int cutoff ); \
+  template void Dets \
+  ( const DistMultiVec<Real>& x, \
+          DistMultiVec<Real>& d, \
+    const cone::Table& table );
 
 #define EL_NO_INT_PROTO
 #define EL_NO_COMPLEX_PROTO
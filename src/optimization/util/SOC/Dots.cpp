@@ -305,6 +305,59 @@ void Dots
     }
 }
 
+template<typename Real,
+         typename/*=EnableIf<IsReal<Real>>*/>
+void Dots
+( const DistMultiVec<Real>& x,
+  const DistMultiVec<Real>& y,
+        DistMultiVec<Real>& z,
+  const cone::Table& table )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( x.Height() != table.height || x.Width() != 1 )
+          LogicError("x should be a column vector matching the cone table");
+      if( y.Height() != x.Height() || y.Width() != x.Width() )
+          LogicError("x and y must be the same size");
+    )
+    const Grid& grid = x.Grid();
+    z.SetGrid( grid );
+    Zeros( z, x.Height(), x.Width() );
+
+    const Real* xBuf = x.LockedMatrix().LockedBuffer();
+    const Real* yBuf = y.LockedMatrix().LockedBuffer();
+          Real* zBuf = z.Matrix().Buffer();
+
+    // The cones owned by this process require no communication
+    const Int numLocalCones = table.localBegins.size();
+    for( Int k=0; k<numLocalCones; ++k )
+    {
+        const Int begin = table.localBegins[k];
+        zBuf[begin] =
+          blas::Dot( table.localOrders[k], &xBuf[begin], 1, &yBuf[begin], 1 );
+    }
+
+    // Combine the partial inner products of all split cones at once
+    if( table.numSplitCones == 0 )
+        return;
+    vector<Real> splitDots( table.numSplitCones, Real(0) );
+    const Int numLocalSplits = table.splitIndices.size();
+    for( Int k=0; k<numLocalSplits; ++k )
+    {
+        const Int begin = table.splitLocalBegins[k];
+        const Int end = table.splitLocalEnds[k];
+        splitDots[table.splitIndices[k]] =
+          blas::Dot( end-begin, &xBuf[begin], 1, &yBuf[begin], 1 );
+    }
+    mpi::AllReduce( splitDots.data(), table.numSplitCones, grid.Comm() );
+    for( Int k=0; k<numLocalSplits; ++k )
+    {
+        const Int begin = table.splitLocalBegins[k];
+        if( begin+table.firstLocalRow == table.splitFirstInds[k] )
+            zBuf[begin] = splitDots[table.splitIndices[k]];
+    }
+}
+
 #define PROTO(Real) \
   template void Dots \
   ( const Matrix<Real>& x, \
@@ -325,7 +378,12 @@ void Dots
           DistMultiVec<Real>& z, \
     const DistMultiVec<Int>& orders, \
     const DistMultiVec<Int>& firstInds, \
-    Int cutoff );
+    Int cutoff ); \
+  template void Dots \
+  ( const DistMultiVec<Real>& x, \
+    const DistMultiVec<Real>& y, \
+          DistMultiVec<Real>& z, \
+    const cone::Table& table );
 
 #define EL_NO_INT_PROTO
 #define EL_NO_COMPLEX_PROTO
@@ -27,7 +27,7 @@ void Inverse
     soc::Dets( x, dInv, orders, firstInds );
     cone::Broadcast( dInv, orders, firstInds );
     auto entryInv = []( const Real& alpha ) { return Real(1)/alpha; };
-    EntrywiseMap( dInv, MakeFunction(entryInv) );
+    EntrywiseMap( dInv, entryInv );
 
     auto Rx = x;
     soc::Reflect( Rx, orders, firstInds );
@@ -67,7 +67,7 @@ void Inverse
     soc::Dets( x, dInv, orders, firstInds, cutoff );
     cone::Broadcast( dInv, orders, firstInds );
     auto entryInv = []( const Real& alpha ) { return Real(1)/alpha; };
-    EntrywiseMap( dInv, MakeFunction(entryInv) );
+    EntrywiseMap( dInv, entryInv );
 
     auto Rx = x;
     soc::Reflect( Rx, orders, firstInds );
@@ -90,7 +90,7 @@ void Inverse
     soc::Dets( x, dInv, orders, firstInds, cutoff );
     cone::Broadcast( dInv, orders, firstInds );
     auto entryInv = []( const Real& alpha ) { return Real(1)/alpha; };
-    EntrywiseMap( dInv, MakeFunction(entryInv) );
+    EntrywiseMap( dInv, entryInv );
 
     auto Rx = x;
     soc::Reflect( Rx, orders, firstInds );
@@ -98,6 +98,27 @@ void Inverse
     Hadamard( dInv, Rx, xInv );
 }
 
+template<typename Real,
+         typename/*=EnableIf<IsReal<Real>>*/>
+void Inverse
+( const DistMultiVec<Real>& x,
+        DistMultiVec<Real>& xInv,
+  const cone::Table& table )
+{
+    EL_DEBUG_CSE
+
+    DistMultiVec<Real> dInv(x.Grid());
+    soc::Dets( x, dInv, table );
+    cone::Broadcast( dInv, table );
+    auto entryInv = []( const Real& alpha ) { return Real(1)/alpha; };
+    EntrywiseMap( dInv, entryInv );
+
+    auto Rx = x;
+    soc::Reflect( Rx, table );
+
+    Hadamard( dInv, Rx, xInv );
+}
+
 #define PROTO(Real) \
   template void Inverse \
   ( const Matrix<Real>& x, \
@@ -115,7 +136,11 @@ void Inverse
           DistMultiVec<Real>& xInv, \
     const DistMultiVec<Int>& orders, \
     const DistMultiVec<Int>& firstInds, \
-    Int cutoff );
+    Int cutoff ); \
+  template void Inverse \
+  ( const DistMultiVec<Real>& x, \
+          DistMultiVec<Real>& xInv, \
+    const cone::Table& table );
 
 #define EL_NO_INT_PROTO
 #define EL_NO_COMPLEX_PROTO
@@ -125,6 +125,42 @@ void LowerNorms
             lowerNormBuf[iLoc] = Sqrt(lowerNormBuf[iLoc]);
 }
 
+template<typename Real,
+         typename/*=EnableIf<IsReal<Real>>*/>
+void LowerNorms
+( const DistMultiVec<Real>& x,
+        DistMultiVec<Real>& lowerNorms,
+  const cone::Table& table )
+{
+    EL_DEBUG_CSE
+    auto xLower = x;
+    Real* xLowerBuf = xLower.Matrix().Buffer();
+    const Int numLocalCones = table.localBegins.size();
+    for( Int k=0; k<numLocalCones; ++k )
+        xLowerBuf[table.localBegins[k]] = 0;
+    const Int numLocalSplits = table.splitIndices.size();
+    for( Int k=0; k<numLocalSplits; ++k )
+    {
+        const Int begin = table.splitLocalBegins[k];
+        if( begin+table.firstLocalRow == table.splitFirstInds[k] )
+            xLowerBuf[begin] = 0;
+    }
+
+    soc::Dots( xLower, xLower, lowerNorms, table );
+    Real* lowerNormBuf = lowerNorms.Matrix().Buffer();
+    for( Int k=0; k<numLocalCones; ++k )
+    {
+        const Int begin = table.localBegins[k];
+        lowerNormBuf[begin] = Sqrt(lowerNormBuf[begin]);
+    }
+    for( Int k=0; k<numLocalSplits; ++k )
+    {
+        const Int begin = table.splitLocalBegins[k];
+        if( begin+table.firstLocalRow == table.splitFirstInds[k] )
+            lowerNormBuf[begin] = Sqrt(lowerNormBuf[begin]);
+    }
+}
+
 #define PROTO(Real) \
   template void LowerNorms \
   ( const Matrix<Real>& x, \
@@ -142,7 +178,11 @@ void LowerNorms
           DistMultiVec<Real>& lowerNorms, \
     const DistMultiVec<Int>& orders, \
     const DistMultiVec<Int>& firstInds, \
-    Int cutoff );
+    Int cutoff ); \
+  template void LowerNorms \
+  ( const DistMultiVec<Real>& x, \
+          DistMultiVec<Real>& lowerNorms, \
+    const cone::Table& table );
 
 #define EL_NO_INT_PROTO
 #define EL_NO_COMPLEX_PROTO
@@ -329,6 +329,46 @@ Real MaxStep
     return Real(mpi::AllReduce( alpha, mpi::MIN, grid.Comm() ));
 }
 
+template<typename Real,
+         typename/*=EnableIf<IsReal<Real>>*/>
+Real MaxStep
+( const DistMultiVec<Real>& x,
+  const DistMultiVec<Real>& y,
+  const cone::Table& table,
+  Real upperBound )
+{
+    EL_DEBUG_CSE
+    typedef Promote<Real> PReal;
+    const Grid& grid = x.Grid();
+
+    DistMultiVec<PReal> xProm(grid), yProm(grid),
+                        xDets(grid), yDets(grid), xTRys(grid);
+    Copy( x, xProm );
+    Copy( y, yProm );
+    soc::Dets( xProm, xDets, table );
+    soc::Dets( yProm, yDets, table );
+    auto Ry = yProm;
+    soc::Reflect( Ry, table );
+    soc::Dots( xProm, Ry, xTRys, table );
+
+    const PReal* xBuf = xProm.LockedMatrix().LockedBuffer();
+    const PReal* yBuf = yProm.LockedMatrix().LockedBuffer();
+    const PReal* xDetBuf = xDets.LockedMatrix().LockedBuffer();
+    const PReal* yDetBuf = yDets.LockedMatrix().LockedBuffer();
+    const PReal* xTRyBuf = xTRys.LockedMatrix().LockedBuffer();
+
+    PReal alpha = upperBound;
+    cone::ForEachLocalCone( table,
+      [&]( Int begin, Int /*end*/, bool root )
+      {
+          if( root )
+              alpha = ChooseStepLength
+              ( xBuf[begin], yBuf[begin], xDetBuf[begin], yDetBuf[begin],
+                xTRyBuf[begin], alpha );
+      } );
+    return Real(mpi::AllReduce( alpha, mpi::MIN, grid.Comm() ));
+}
+
 #define PROTO(Real) \
   template Real MaxStep \
   ( const Matrix<Real>& s, \
@@ -347,7 +387,12 @@ Real MaxStep
     const DistMultiVec<Real>& ds, \
     const DistMultiVec<Int>& orders, \
     const DistMultiVec<Int>& firstInds, \
-    Real upperBound, Int cutoff );
+    Real upperBound, Int cutoff ); \
+  template Real MaxStep \
+  ( const DistMultiVec<Real>& x, \
+    const DistMultiVec<Real>& y, \
+    const cone::Table& table, \
+    Real upperBound );
 
 #define EL_NO_INT_PROTO
 #define EL_NO_COMPLEX_PROTO
@@ -180,6 +180,33 @@ Real MinEig
     return mpi::AllReduce( minEigLocal, mpi::MIN, grid.Comm() );
 }
 
+template<typename Real,
+         typename/*=EnableIf<IsReal<Real>>*/>
+Real MinEig( const DistMultiVec<Real>& x, const cone::Table& table )
+{
+    EL_DEBUG_CSE
+    DistMultiVec<Real> lowerNorms(x.Grid());
+    soc::LowerNorms( x, lowerNorms, table );
+
+    const Real* xBuf = x.LockedMatrix().LockedBuffer();
+    const Real* lowerNormBuf = lowerNorms.LockedMatrix().LockedBuffer();
+    Real minEigLocal = limits::Max<Real>();
+    const Int numLocalCones = table.localBegins.size();
+    for( Int k=0; k<numLocalCones; ++k )
+    {
+        const Int begin = table.localBegins[k];
+        minEigLocal = Min(minEigLocal,xBuf[begin]-lowerNormBuf[begin]);
+    }
+    const Int numLocalSplits = table.splitIndices.size();
+    for( Int k=0; k<numLocalSplits; ++k )
+    {
+        const Int begin = table.splitLocalBegins[k];
+        if( begin+table.firstLocalRow == table.splitFirstInds[k] )
+            minEigLocal = Min(minEigLocal,xBuf[begin]-lowerNormBuf[begin]);
+    }
+    return mpi::AllReduce( minEigLocal, mpi::MIN, x.Grid().Comm() );
+}
+
 #define PROTO(Real) \
   template void MinEig \
   ( const Matrix<Real>& x, \
@@ -211,7 +238,9 @@ Real MinEig
   ( const DistMultiVec<Real>& x, \
     const DistMultiVec<Int>& orders, \
     const DistMultiVec<Int>& firstInds, \
-    Int cutoff );
+    Int cutoff ); \
+  template Real MinEig \
+  ( const DistMultiVec<Real>& x, const cone::Table& table );
 
 #define EL_NO_INT_PROTO
 #define EL_NO_COMPLEX_PROTO
@@ -150,6 +150,43 @@ void ClassicalNT
     Copy( wProm, w );
 }
 
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>>
+void ClassicalNT
+( const DistMultiVec<Real>& s,
+  const DistMultiVec<Real>& z,
+        DistMultiVec<Real>& w,
+  const cone::Table& table )
+{
+    EL_DEBUG_CSE
+    typedef Promote<Real> PReal;
+    const Grid& grid = s.Grid();
+
+    DistMultiVec<PReal> sProm(grid), zProm(grid);
+    Copy( s, sProm );
+    Copy( z, zProm );
+
+    DistMultiVec<PReal> sRoot(grid);
+    soc::SquareRoot( sProm, sRoot, table );
+
+    // a := Q_{sqrt(s)}(z)
+    // -------------------
+    DistMultiVec<PReal> a(grid);
+    soc::ApplyQuadratic( sRoot, zProm, a, table );
+
+    // a := inv(sqrt(a)) = inv(sqrt((Q_{sqrt(s)}(z))))
+    // -----------------------------------------------
+    DistMultiVec<PReal> b(grid);
+    soc::SquareRoot( a, b, table );
+    soc::Inverse( b, a, table );
+
+    // w := Q_{sqrt(s)}(a)
+    // -------------------
+    DistMultiVec<PReal> wProm(grid);
+    soc::ApplyQuadratic( sRoot, a, wProm, table );
+    Copy( wProm, w );
+}
+
 // See Section 4.2 of
 // http://www.seas.ucla.edu/~vandenbe/publications/coneprog.pdf
 
@@ -357,6 +394,70 @@ void VandenbergheNT
     Copy( wProm, w );
 }
 
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>>
+void VandenbergheNT
+( const DistMultiVec<Real>& s,
+  const DistMultiVec<Real>& z,
+        DistMultiVec<Real>& w,
+  const cone::Table& table )
+{
+    EL_DEBUG_CSE
+    typedef Promote<Real> PReal;
+    const Grid& grid = s.Grid();
+
+    DistMultiVec<PReal> sProm(grid), zProm(grid);
+    Copy( s, sProm );
+    Copy( z, zProm );
+
+    // Normalize with respect to the Jordan determinant
+    // ================================================
+    const Int nLocal = sProm.LocalHeight();
+    DistMultiVec<PReal> sDets(grid), zDets(grid);
+    soc::Dets( sProm, sDets, table );
+    soc::Dets( zProm, zDets, table );
+    cone::Broadcast( sDets, table );
+    cone::Broadcast( zDets, table );
+    auto& sPromLoc = sProm.Matrix();
+    auto& zPromLoc = zProm.Matrix();
+    auto& sDetsLoc = sDets.LockedMatrix();
+    auto& zDetsLoc = zDets.LockedMatrix();
+    for( Int iLoc=0; iLoc<nLocal; ++iLoc )
+    {
+        sPromLoc(iLoc) /= Sqrt(sDetsLoc(iLoc));
+        zPromLoc(iLoc) /= Sqrt(zDetsLoc(iLoc));
+    }
+
+    // Compute the 'gamma' coefficients
+    // ================================
+    DistMultiVec<PReal> gammas(grid);
+    soc::Dots( zProm, sProm, gammas, table );
+    cone::Broadcast( gammas, table );
+    auto& gammasLoc = gammas.Matrix();
+    for( Int iLoc=0; iLoc<nLocal; ++iLoc )
+        gammasLoc(iLoc) = Sqrt((PReal(1)+gammasLoc(iLoc))/PReal(2));
+
+    // Compute the normalized scaling point
+    // ====================================
+    auto wProm = zProm;
+    soc::Reflect( wProm, table );
+    wProm += sProm;
+    DiagonalSolve( LEFT, NORMAL, gammas, wProm );
+    wProm *= PReal(1)/PReal(2);
+
+    // Rescale the scaling point
+    // =========================
+    auto& wPromLoc = wProm.Matrix();
+    for( Int iLoc=0; iLoc<nLocal; ++iLoc )
+    {
+        const PReal sDet = sDetsLoc(iLoc);
+        const PReal zDet = zDetsLoc(iLoc);
+        const PReal scale = Pow(sDet,PReal(0.25))/Pow(zDet,PReal(0.25));
+        wPromLoc(iLoc) *= scale;
+    }
+    Copy( wProm, w );
+}
+
 } // anonymous namespace
 
 template<typename Real,
@@ -411,6 +512,22 @@ void NesterovTodd
         VandenbergheNT( s, z, w, orders, firstInds, cutoff );
 }
 
+template<typename Real,
+         typename/*=EnableIf<IsReal<Real>>*/>
+void NesterovTodd
+( const DistMultiVec<Real>& s,
+  const DistMultiVec<Real>& z,
+        DistMultiVec<Real>& w,
+  const cone::Table& table )
+{
+    EL_DEBUG_CSE
+    const bool useClassical = false;
+    if( useClassical )
+        ClassicalNT( s, z, w, table );
+    else
+        VandenbergheNT( s, z, w, table );
+}
+
 #define PROTO(Real) \
   template void NesterovTodd \
   ( const Matrix<Real>& s, \
@@ -431,7 +548,12 @@ void NesterovTodd
           DistMultiVec<Real>& w, \
     const DistMultiVec<Int>& orders, \
     const DistMultiVec<Int>& firstInds, \
-    Int cutoff );
+    Int cutoff ); \
+  template void NesterovTodd \
+  ( const DistMultiVec<Real>& s, \
+    const DistMultiVec<Real>& z, \
+          DistMultiVec<Real>& w, \
+    const cone::Table& table );
 
 #define EL_NO_INT_PROTO
 #define EL_NO_COMPLEX_PROTO
@@ -109,6 +109,31 @@ Int NumOutside
     return mpi::AllReduce( numLocalNonSOC, grid.Comm() );
 }
 
+template<typename Real,
+         typename/*=EnableIf<IsReal<Real>>*/>
+Int NumOutside( const DistMultiVec<Real>& x, const cone::Table& table )
+{
+    EL_DEBUG_CSE
+    DistMultiVec<Real> d(x.Grid());
+    soc::Dets( x, d, table );
+
+    const Real* dBuf = d.LockedMatrix().LockedBuffer();
+    Int numLocalNonSOC = 0;
+    const Int numLocalCones = table.localBegins.size();
+    for( Int k=0; k<numLocalCones; ++k )
+        if( dBuf[table.localBegins[k]] < Real(0) )
+            ++numLocalNonSOC;
+    const Int numLocalSplits = table.splitIndices.size();
+    for( Int k=0; k<numLocalSplits; ++k )
+    {
+        const Int begin = table.splitLocalBegins[k];
+        if( begin+table.firstLocalRow == table.splitFirstInds[k] &&
+            dBuf[begin] < Real(0) )
+            ++numLocalNonSOC;
+    }
+    return mpi::AllReduce( numLocalNonSOC, x.Grid().Comm() );
+}
+
 #define PROTO(Real) \
   template Int NumOutside \
   ( const Matrix<Real>& x, \
@@ -123,7 +148,9 @@ Int NumOutside
   ( const DistMultiVec<Real>& x, \
     const DistMultiVec<Int>& orders, \
     const DistMultiVec<Int>& firstInds, \
-    Int cutoff );
+    Int cutoff ); \
+  template Int NumOutside \
+  ( const DistMultiVec<Real>& x, const cone::Table& table );
 
 #define EL_NO_INT_PROTO
 #define EL_NO_COMPLEX_PROTO
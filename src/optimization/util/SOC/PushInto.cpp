@@ -103,6 +103,27 @@ void PushInto
     }
 }
 
+template<typename Real,
+         typename/*=EnableIf<IsReal<Real>>*/>
+void PushInto
+(       DistMultiVec<Real>& x,
+  const cone::Table& table,
+  Real minDist )
+{
+    EL_DEBUG_CSE
+    DistMultiVec<Real> d(x.Grid());
+    soc::LowerNorms( x, d, table );
+
+    Real* xBuf = x.Matrix().Buffer();
+    const Real* dBuf = d.LockedMatrix().LockedBuffer();
+    cone::ForEachLocalCone( table,
+      [&]( Int begin, Int /*end*/, bool root )
+      {
+          if( root && xBuf[begin]-dBuf[begin] < minDist )
+              xBuf[begin] = minDist + dBuf[begin];
+      } );
+}
+
 #define PROTO(Real) \
   template void PushInto \
   (       Matrix<Real>& x, \
@@ -118,7 +139,11 @@ void PushInto
   (       DistMultiVec<Real>& x, \
     const DistMultiVec<Int>& orders, \
     const DistMultiVec<Int>& firstInds, \
-    Real minDist, Int cutoff );
+    Real minDist, Int cutoff ); \
+  template void PushInto \
+  (       DistMultiVec<Real>& x, \
+    const cone::Table& table, \
+    Real minDist );
 
 #define EL_NO_INT_PROTO
 #define EL_NO_COMPLEX_PROTO
@@ -131,6 +131,31 @@ void PushPairInto
     }
 }
 
+template<typename Real,
+         typename/*=EnableIf<IsReal<Real>>*/>
+void PushPairInto
+(       DistMultiVec<Real>& s,
+        DistMultiVec<Real>& z,
+  const DistMultiVec<Real>& w,
+  const cone::Table& table,
+  Real wMaxNormLimit )
+{
+    EL_DEBUG_CSE
+    Real* sBuf = s.Matrix().Buffer();
+    Real* zBuf = z.Matrix().Buffer();
+    const Real* wBuf = w.LockedMatrix().LockedBuffer();
+    cone::ForEachLocalCone( table,
+      [&]( Int begin, Int /*end*/, bool root )
+      {
+          if( root && wBuf[begin] > wMaxNormLimit )
+          {
+              // TODO(poulson): Switch to a non-adhoc modification
+              sBuf[begin] += Real(1)/wMaxNormLimit;
+              zBuf[begin] += Real(1)/wMaxNormLimit;
+          }
+      } );
+}
+
 #define PROTO(Real) \
   template void PushPairInto \
   (       Matrix<Real>& s, \
@@ -152,7 +177,13 @@ void PushPairInto
     const DistMultiVec<Real>& w, \
     const DistMultiVec<Int>& orders, \
     const DistMultiVec<Int>& firstInds, \
-    Real wMaxNormLimit, Int cutoff );
+    Real wMaxNormLimit, Int cutoff ); \
+  template void PushPairInto \
+  (       DistMultiVec<Real>& s, \
+          DistMultiVec<Real>& z, \
+    const DistMultiVec<Real>& w, \
+    const cone::Table& table, \
+    Real wMaxNormLimit );
 
 #define EL_NO_INT_PROTO
 #define EL_NO_COMPLEX_PROTO
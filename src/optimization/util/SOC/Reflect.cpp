@@ -98,6 +98,37 @@ void Reflect
             xBuf[iLoc] = -xBuf[iLoc];
 }
 
+template<typename Real,
+         typename/*=EnableIf<IsReal<Real>>*/>
+void Reflect( DistMultiVec<Real>& x, const cone::Table& table )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( x.Height() != table.height || x.Width() != 1 )
+          LogicError("x should be a column vector matching the cone table");
+    )
+    Real* xBuf = x.Matrix().Buffer();
+
+    const Int numLocalCones = table.localBegins.size();
+    for( Int k=0; k<numLocalCones; ++k )
+    {
+        const Int begin = table.localBegins[k];
+        const Int end = begin + table.localOrders[k];
+        for( Int iLoc=begin+1; iLoc<end; ++iLoc )
+            xBuf[iLoc] = -xBuf[iLoc];
+    }
+
+    const Int numLocalSplits = table.splitIndices.size();
+    for( Int k=0; k<numLocalSplits; ++k )
+    {
+        const Int begin = table.splitLocalBegins[k];
+        const Int end = table.splitLocalEnds[k];
+        for( Int iLoc=begin; iLoc<end; ++iLoc )
+            if( iLoc+table.firstLocalRow != table.splitFirstInds[k] )
+                xBuf[iLoc] = -xBuf[iLoc];
+    }
+}
+
 #define PROTO(Real) \
   template void Reflect \
   (       Matrix<Real>& x, \
@@ -110,7 +141,9 @@ void Reflect
   template void Reflect \
   (       DistMultiVec<Real>& x, \
     const DistMultiVec<Int>& orders, \
-    const DistMultiVec<Int>& firstInds );
+    const DistMultiVec<Int>& firstInds ); \
+  template void Reflect \
+  ( DistMultiVec<Real>& x, const cone::Table& table );
 
 #define EL_NO_INT_PROTO
 #define EL_NO_COMPLEX_PROTO
@@ -101,6 +101,27 @@ void Shift
             xBuf[iLoc] += shift;
 }
 
+template<typename Real,
+         typename/*=EnableIf<IsReal<Real>>*/>
+void Shift
+(       DistMultiVec<Real>& x,
+        Real shift,
+  const cone::Table& table )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( x.Height() != table.height || x.Width() != 1 )
+          LogicError("x should be a column vector matching the cone table");
+    )
+    Real* xBuf = x.Matrix().Buffer();
+    cone::ForEachLocalCone( table,
+      [&]( Int begin, Int /*end*/, bool root )
+      {
+          if( root )
+              xBuf[begin] += shift;
+      } );
+}
+
 #define PROTO(Real) \
   template void Shift \
   (       Matrix<Real>& x, Real shift, \
@@ -113,7 +134,10 @@ void Shift
   template void Shift \
   (       DistMultiVec<Real>& x, Real shift, \
     const DistMultiVec<Int>& orders, \
-    const DistMultiVec<Int>& firstInds );
+    const DistMultiVec<Int>& firstInds ); \
+  template void Shift \
+  (       DistMultiVec<Real>& x, Real shift, \
+    const cone::Table& table );
 
 #define EL_NO_INT_PROTO
 #define EL_NO_COMPLEX_PROTO
@@ -146,6 +146,45 @@ void SquareRoot
     }
 }
 
+template<typename Real,
+         typename/*=EnableIf<IsReal<Real>>*/>
+void SquareRoot
+( const DistMultiVec<Real>& x,
+        DistMultiVec<Real>& xRoot,
+  const cone::Table& table )
+{
+    EL_DEBUG_CSE
+    const Grid& grid = x.Grid();
+    const Real* xBuf = x.LockedMatrix().LockedBuffer();
+
+    DistMultiVec<Real> d(grid);
+    soc::Dets( x, d, table );
+    cone::Broadcast( d, table );
+    const Real* dBuf = d.LockedMatrix().LockedBuffer();
+
+    auto roots = x;
+    cone::Broadcast( roots, table );
+    const Real* rootBuf = roots.LockedMatrix().LockedBuffer();
+
+    xRoot.SetGrid( grid );
+    Zeros( xRoot, x.Height(), 1 );
+    Real* xRootBuf = xRoot.Matrix().Buffer();
+    cone::ForEachLocalCone( table,
+      [&]( Int begin, Int end, bool root )
+      {
+          for( Int iLoc=begin; iLoc<end; ++iLoc )
+          {
+              const Real x0 = rootBuf[iLoc];
+              const Real det = dBuf[iLoc];
+              const Real eta0 = Sqrt(x0+Sqrt(det))/Sqrt(Real(2));
+              if( root && iLoc == begin )
+                  xRootBuf[iLoc] = eta0;
+              else
+                  xRootBuf[iLoc] = xBuf[iLoc]/(2*eta0);
+          }
+      } );
+}
+
 #define PROTO(Real) \
   template void SquareRoot \
   ( const Matrix<Real>& x, \
@@ -163,7 +202,11 @@ void SquareRoot
           DistMultiVec<Real>& xRoot, \
     const DistMultiVec<Int>& orders, \
     const DistMultiVec<Int>& firstInds, \
-    Int cutoff );
+    Int cutoff ); \
+  template void SquareRoot \
+  ( const DistMultiVec<Real>& x, \
+          DistMultiVec<Real>& xRoot, \
+    const cone::Table& table );
 
 #define EL_NO_INT_PROTO
 #define EL_NO_COMPLEX_PROTO
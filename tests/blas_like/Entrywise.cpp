@@ -0,0 +1,180 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Compare fused entrywise expressions with the equivalent sequences of
+// Axpy, Hadamard and EntrywiseMap applied to the local matrices
+
+template<typename T>
+Matrix<T>& LocalMatrix( Matrix<T>& A ) { return A; }
+template<typename T>
+Matrix<T>& LocalMatrix( DistMatrix<T>& A ) { return A.Matrix(); }
+template<typename T>
+Matrix<T>& LocalMatrix( DistMultiVec<T>& A ) { return A.Matrix(); }
+
+template<typename T>
+void CheckLocal
+( const Matrix<T>& Y, const Matrix<T>& YRef, mpi::Comm comm,
+  const string& label )
+{
+    typedef Base<T> Real;
+    const Real eps = limits::Epsilon<Real>();
+    Real maxError = 0, maxAbs = 0;
+    for( Int j=0; j<Y.Width(); ++j )
+        for( Int i=0; i<Y.Height(); ++i )
+        {
+            maxError = Max( maxError, Abs(Y(i,j)-YRef(i,j)) );
+            maxAbs = Max( maxAbs, Abs(YRef(i,j)) );
+        }
+    maxError = mpi::AllReduce( maxError, mpi::MAX, comm );
+    maxAbs = mpi::AllReduce( maxAbs, mpi::MAX, comm );
+    if( maxError > 10*eps*Max(maxAbs,Real(1)) )
+        RuntimeError(label,": maximum entrywise error of ",maxError);
+    OutputFromRoot(comm,label," PASSED");
+}
+
+// X, Z and W must be filled with entries of magnitude at most one and have
+// the same shape and distribution as Y
+template<typename T,class Container>
+void TestExpressions
+( Container& X, Container& Z, Container& W, Container& Y, mpi::Comm comm,
+  const string& kind )
+{
+    OutputFromRoot(comm,"Testing ",kind," with ",TypeName<T>());
+    PushIndent();
+
+    const T alpha = T(3)/T(4), beta = T(-2);
+    const auto& XLoc = LocalMatrix( X );
+    const auto& ZLoc = LocalMatrix( Z );
+    const auto& WLoc = LocalMatrix( W );
+    auto& YLoc = LocalMatrix( Y );
+    Matrix<T> YRef, T1;
+
+    // Y := alpha X + Z o W
+    Entrywise(Y) =
+      alpha*Entrywise(X) + Hadamard(Entrywise(Z),Entrywise(W));
+    Hadamard( ZLoc, WLoc, YRef );
+    Axpy( alpha, XLoc, YRef );
+    CheckLocal( YLoc, YRef, comm, "Y := alpha X + Z o W" );
+
+    // Y += X*beta - (-Z), with a mapping which captures a value
+    auto shift = [&]( const T& x ) { return x + beta; };
+    Entrywise(Y) += Entrywise(X)*beta - (-Entrywise(Z));
+    Entrywise(Y) -= Map( Entrywise(W), shift );
+    Axpy( beta, XLoc, YRef );
+    Axpy( T(1), ZLoc, YRef );
+    T1 = WLoc;
+    EntrywiseMap( T1, std::function<T(const T&)>(shift) );
+    Axpy( T(-1), T1, YRef );
+    CheckLocal( YLoc, YRef, comm, "Y += X beta + Z; Y -= map(W)" );
+
+    // Y *= (X + W) while Y also appears as an operand
+    Entrywise(Y) *= Entrywise(X) + Entrywise(W);
+    Entrywise(Y) = Entrywise(Y) - Hadamard(Entrywise(Y),Entrywise(Z));
+    T1 = XLoc;
+    T1 += WLoc;
+    Hadamard( YRef, T1, YRef );
+    Hadamard( YRef, ZLoc, T1 );
+    YRef -= T1;
+    CheckLocal( YLoc, YRef, comm, "Y *= X + W; Y := Y - Y o Z" );
+
+    // Assigning one target to another evaluates rather than copies the
+    // target
+    Entrywise(Y) = Entrywise(X);
+    CheckLocal( YLoc, XLoc, comm, "Y := X" );
+    auto YTarget = Entrywise(Y);
+    YTarget = Entrywise(Z);
+    CheckLocal( YLoc, ZLoc, comm, "Y := Z through a copied target" );
+
+    PopIndent();
+}
+
+template<typename T>
+void TestMatrix( Int m, Int n )
+{
+    Matrix<T> X, Z, W, Y;
+    Uniform( X, m, n );
+    Uniform( Z, m, n );
+    Uniform( W, m, n );
+    Uniform( Y, m, n );
+    TestExpressions<T>( X, Z, W, Y, mpi::COMM_SELF, "Matrix" );
+
+    // Nonconformal expressions must be rejected
+    Matrix<T> V;
+    Uniform( V, m, n+1 );
+    bool threw = false;
+    try { Entrywise(Y) = Entrywise(X) + Entrywise(V); }
+    catch( std::exception& e ) { threw = true; }
+    if( !threw )
+        LogicError("A nonconformal expression was not rejected");
+}
+
+template<typename T>
+void TestDistMatrix( Int m, Int n, const Grid& grid )
+{
+    DistMatrix<T> X(grid), Z(grid), W(grid), Y(grid);
+    Uniform( X, m, n );
+    Uniform( Z, m, n );
+    Uniform( W, m, n );
+    Uniform( Y, m, n );
+    TestExpressions<T>( X, Z, W, Y, grid.Comm(), "DistMatrix" );
+
+    // Operands with different alignments must be rejected
+    if( grid.Height() > 1 )
+    {
+        DistMatrix<T> V(grid);
+        V.AlignCols( 1 );
+        Uniform( V, m, n );
+        bool threw = false;
+        try { Entrywise(Y) = Entrywise(X) + Entrywise(V); }
+        catch( std::exception& e ) { threw = true; }
+        if( !threw )
+            LogicError("A misaligned expression was not rejected");
+    }
+}
+
+template<typename T>
+void TestDistMultiVec( Int m, Int n, const Grid& grid )
+{
+    DistMultiVec<T> X(grid), Z(grid), W(grid), Y(grid);
+    Uniform( X, m, n );
+    Uniform( Z, m, n );
+    Uniform( W, m, n );
+    Uniform( Y, m, n );
+    TestExpressions<T>( X, Z, W, Y, grid.Comm(), "DistMultiVec" );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--m","height of matrices",100);
+        const Int n = Input("--n","width of matrices",37);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid grid( comm );
+        if( mpi::Rank(comm) == 0 )
+        {
+            TestMatrix<float>( m, n );
+            TestMatrix<Complex<double>>( m, n );
+        }
+        TestDistMatrix<double>( m, n, grid );
+        TestDistMatrix<Complex<float>>( m, n, grid );
+        TestDistMultiVec<double>( m, n, grid );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -165,6 +165,59 @@ void TestGemm
             ( orientA, orientB, alpha, A, B, beta, COrig, C, print );
         PopIndent();
     }
+
+    // Test the 1D variants for products with only one large dimension
+    const std::pair<GemmAlgorithm,std::string> skinnyAlgs[] =
+      { {GEMM_SKINNY_INNER,"Skinny Inner Product Algorithm:"},
+        {GEMM_SKINNY_OUTER,"Skinny Outer Product Algorithm:"} };
+    for( const auto& skinnyAlg : skinnyAlgs )
+    {
+        C = COrig;
+        OutputFromRoot(g.Comm(),skinnyAlg.second);
+        PushIndent();
+        mpi::Barrier( g.Comm() );
+        timer.Start();
+        Gemm( orientA, orientB, alpha, A, B, beta, C, skinnyAlg.first );
+        mpi::Barrier( g.Comm() );
+        runTime = timer.Stop();
+        realGFlops = 2.*double(m)*double(n)*double(k)/(1.e9*runTime);
+        gFlops = ( IsComplex<T>::value ? 4*realGFlops : realGFlops );
+        OutputFromRoot
+        (g.Comm(),"Finished in ",runTime," seconds (",gFlops," GFlop/s)");
+        if( print )
+            Print( C, BuildString("C := ",alpha," A B + ",beta," C") );
+        if( correctness )
+            TestAssociativity
+            ( orientA, orientB, alpha, A, B, beta, COrig, C, print );
+        PopIndent();
+    }
+
+    // Test the skinny variants with results which are redundantly stored
+    // over one dimension of the grid
+    DistMatrix<T,MC,STAR> C_MC_STAR(g);
+    DistMatrix<T,STAR,MR> C_STAR_MR(g);
+    const std::pair<ElementalMatrix<T>*,std::string> redundantCs[] =
+      { {&C_MC_STAR,"[MC,STAR]"}, {&C_STAR_MR,"[STAR,MR]"} };
+    for( const auto& skinnyAlg : skinnyAlgs )
+    {
+        for( const auto& redundantC : redundantCs )
+        {
+            Copy( COrig, *redundantC.first );
+            OutputFromRoot
+            (g.Comm(),skinnyAlg.second," (",redundantC.second," C)");
+            PushIndent();
+            Gemm
+            ( orientA, orientB, alpha, A, B, beta, *redundantC.first,
+              skinnyAlg.first );
+            Copy( *redundantC.first, C );
+            if( print )
+                Print( C, BuildString("C := ",alpha," A B + ",beta," C") );
+            if( correctness )
+                TestAssociativity
+                ( orientA, orientB, alpha, A, B, beta, COrig, C, print );
+            PopIndent();
+        }
+    }
     PopIndent();
 }
 
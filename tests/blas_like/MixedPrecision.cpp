@@ -0,0 +1,209 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Compare the mixed-precision Gemm and Trsm with the same-precision routines
+// applied to upcast copies of the low-precision operands. Since upcasting is
+// exact, both compute in the high precision and should agree to within its
+// rounding errors.
+
+template<typename T>
+void CheckAgreement
+( const Matrix<T>& X, const Matrix<T>& XRef, Int dim, const string& label )
+{
+    typedef Base<T> Real;
+    const Real eps = limits::Epsilon<Real>();
+    Matrix<T> E( X );
+    E -= XRef;
+    const Real relError = FrobeniusNorm( E ) / FrobeniusNorm( XRef );
+    if( relError > 100*eps*dim )
+        RuntimeError(label,": relative difference of ",relError);
+}
+
+template<typename T>
+void CheckAgreement
+( const AbstractDistMatrix<T>& X, const AbstractDistMatrix<T>& XRef, Int dim,
+  const string& label )
+{
+    typedef Base<T> Real;
+    const Real eps = limits::Epsilon<Real>();
+    DistMatrix<T> E( X );
+    Axpy( T(-1), XRef, E );
+    const Real relError = FrobeniusNorm( E ) / FrobeniusNorm( XRef );
+    if( relError > 100*eps*dim )
+        RuntimeError(label,": relative difference of ",relError);
+}
+
+template<typename TA,typename TB,typename TC>
+void TestGemm
+( Orientation orientA, Orientation orientB, Int m, Int n, Int k,
+  const Grid& grid )
+{
+    const string label =
+      "Gemm "+string(1,OrientationToChar(orientA))+
+      string(1,OrientationToChar(orientB))+" with A in "+TypeName<TA>()+
+      ", B in "+TypeName<TB>()+" and C in "+TypeName<TC>();
+    const TC alpha = TC(2), beta = TC(-3)/TC(2);
+
+    // Sequential
+    Matrix<TA> A;
+    Matrix<TB> B;
+    Matrix<TC> C, AUp, BUp, CRef;
+    if( orientA == NORMAL )
+        Uniform( A, m, k );
+    else
+        Uniform( A, k, m );
+    if( orientB == NORMAL )
+        Uniform( B, k, n );
+    else
+        Uniform( B, n, k );
+    Uniform( C, m, n );
+    Copy( A, AUp );
+    Copy( B, BUp );
+    CRef = C;
+    Gemm( orientA, orientB, alpha, A, B, beta, C );
+    Gemm( orientA, orientB, alpha, AUp, BUp, beta, CRef );
+    CheckAgreement( C, CRef, k, "Sequential "+label );
+
+    // Distributed
+    DistMatrix<TA> ADist(grid);
+    DistMatrix<TB> BDist(grid);
+    DistMatrix<TC> CDist(grid), AUpDist(grid), BUpDist(grid), CRefDist(grid);
+    if( orientA == NORMAL )
+        Uniform( ADist, m, k );
+    else
+        Uniform( ADist, k, m );
+    if( orientB == NORMAL )
+        Uniform( BDist, k, n );
+    else
+        Uniform( BDist, n, k );
+    Uniform( CDist, m, n );
+    Copy( ADist, AUpDist );
+    Copy( BDist, BUpDist );
+    CRefDist = CDist;
+    Gemm( orientA, orientB, alpha, ADist, BDist, beta, CDist );
+    Gemm( orientA, orientB, alpha, AUpDist, BUpDist, beta, CRefDist );
+    CheckAgreement( CDist, CRefDist, k, "Distributed "+label );
+
+    OutputFromRoot(grid.Comm(),label," PASSED");
+}
+
+// A triangular matrix which is well-conditioned whether or not its diagonal
+// is treated as unit
+template<typename F>
+void MakeTriangular( UpperOrLower uplo, Int n, Matrix<F>& A )
+{
+    Uniform( A, n, n );
+    MakeTrapezoidal( uplo, A );
+    A *= F(1)/F(n);
+    ShiftDiagonal( A, F(1) );
+}
+
+template<typename F>
+void MakeTriangular( UpperOrLower uplo, Int n, AbstractDistMatrix<F>& A )
+{
+    Uniform( A, n, n );
+    MakeTrapezoidal( uplo, A );
+    A *= F(1)/F(n);
+    ShiftDiagonal( A, F(1) );
+}
+
+template<typename FA,typename FB>
+void TestTrsm
+( LeftOrRight side, UpperOrLower uplo, Orientation orientation,
+  UnitOrNonUnit diag, Int m, Int n, const Grid& grid )
+{
+    const string label =
+      "Trsm "+string(1,LeftOrRightToChar(side))+
+      string(1,UpperOrLowerToChar(uplo))+
+      string(1,OrientationToChar(orientation))+
+      string(1,UnitOrNonUnitToChar(diag))+" with A in "+TypeName<FA>()+
+      " and B in "+TypeName<FB>();
+    const FB alpha = FB(3);
+    const Int dim = ( side == LEFT ? m : n );
+
+    // Sequential
+    Matrix<FA> A;
+    Matrix<FB> AUp, B, BRef;
+    MakeTriangular( uplo, dim, A );
+    Copy( A, AUp );
+    Uniform( B, m, n );
+    BRef = B;
+    Trsm( side, uplo, orientation, diag, alpha, A, B );
+    Trsm( side, uplo, orientation, diag, alpha, AUp, BRef );
+    CheckAgreement( B, BRef, dim, "Sequential "+label );
+
+    // Distributed
+    DistMatrix<FA> ADist(grid);
+    DistMatrix<FB> AUpDist(grid), BDist(grid), BRefDist(grid);
+    MakeTriangular( uplo, dim, ADist );
+    Copy( ADist, AUpDist );
+    Uniform( BDist, m, n );
+    BRefDist = BDist;
+    Trsm( side, uplo, orientation, diag, alpha, ADist, BDist );
+    Trsm( side, uplo, orientation, diag, alpha, AUpDist, BRefDist );
+    CheckAgreement( BDist, BRefDist, dim, "Distributed "+label );
+
+    OutputFromRoot(grid.Comm(),label," PASSED");
+}
+
+template<typename Lo,typename Hi>
+void TestMixed( Int m, Int n, Int k, const Grid& grid )
+{
+    OutputFromRoot
+    (grid.Comm(),"Testing ",TypeName<Lo>()," with ",TypeName<Hi>());
+    PushIndent();
+
+    vector<Orientation> orients = { NORMAL, TRANSPOSE };
+    if( IsComplex<Lo>::value )
+        orients.push_back( ADJOINT );
+    for( const auto orientA : orients )
+        for( const auto orientB : orients )
+        {
+            TestGemm<Lo,Lo,Hi>( orientA, orientB, m, n, k, grid );
+            TestGemm<Lo,Hi,Hi>( orientA, orientB, m, n, k, grid );
+            TestGemm<Hi,Lo,Hi>( orientA, orientB, m, n, k, grid );
+        }
+
+    for( const auto side : { LEFT, RIGHT } )
+        for( const auto uplo : { LOWER, UPPER } )
+            for( const auto orientation : orients )
+                for( const auto diag : { NON_UNIT, UNIT } )
+                    TestTrsm<Lo,Hi>
+                    ( side, uplo, orientation, diag, m, n, grid );
+
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--m","height of result",53);
+        const Int n = Input("--n","width of result",41);
+        const Int k = Input("--k","inner dimension",37);
+        const Int nb = Input("--nb","algorithmic blocksize",8);
+        ProcessInput();
+        PrintInputReport();
+
+        // Use a small blocksize so that several panels are converted
+        SetBlocksize( nb );
+        const Grid grid( comm );
+        TestMixed<float,double>( m, n, k, grid );
+        TestMixed<Complex<float>,Complex<double>>( m, n, k, grid );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -69,6 +69,87 @@ void RunTests( Int m )
     PopIndent();
 }
 
+template<typename T>
+void CheckSparseProduct
+( const DistSparseMatrix<T>& C,
+  const DistMultiVec<T>& X,
+  const DistMultiVec<T>& Z,
+  const string& name )
+{
+    EL_DEBUG_CSE
+    typedef Base<T> Real;
+    // || C X - A^2 X ||_F / || A^2 X ||_F
+    DistMultiVec<T> E(Z.Grid());
+    E = Z;
+    Multiply( NORMAL, T(1), C, X, T(-1), E );
+    const Real relError = FrobeniusNorm(E) / FrobeniusNorm(Z);
+    if( relError > 100*limits::Epsilon<Real>() )
+    {
+        Output("|| A^2 X - (",name,") X ||_F / || A^2 X ||_F = ",relError);
+        RuntimeError("Sparse product (",name,") was inaccurate");
+    }
+}
+
+template<typename T>
+void TestSparseMultiply( Int n, const Grid& grid )
+{
+    EL_DEBUG_CSE
+    typedef Base<T> Real;
+    Output("Testing sparse products with ",TypeName<T>());
+
+    // Compare the sequential product against a dense one
+    SparseMatrix<T> ASeq, CSeq;
+    Laplacian( ASeq, n, n );
+    Multiply( T(1), ASeq, ASeq, CSeq );
+    Matrix<T> ADense, CDense;
+    Laplacian( ADense, n, n );
+    Gemm( NORMAL, NORMAL, T(1), ADense, ADense, CDense );
+    const Real CFrob = FrobeniusNorm( CDense );
+    for( Int e=0; e<CSeq.NumEntries(); ++e )
+        CDense( CSeq.Row(e), CSeq.Col(e) ) -= CSeq.Value(e);
+    if( FrobeniusNorm(CDense) > 100*limits::Epsilon<Real>()*CFrob )
+        RuntimeError("Sequential sparse product was inaccurate");
+
+    // Compare the distributed products against applying A twice
+    DistSparseMatrix<T> A(grid), C(grid);
+    Laplacian( A, n, n );
+    DistMultiVec<T> X(grid), Y(grid), Z(grid);
+    Uniform( X, n*n, 2 );
+    Zeros( Y, n*n, 2 );
+    Zeros( Z, n*n, 2 );
+    Multiply( NORMAL, T(1), A, X, T(0), Y );
+    Multiply( NORMAL, T(1), A, Y, T(0), Z );
+
+    Multiply( T(1), A, A, C, SPARSE_MULTIPLY_ROW_WISE );
+    CheckSparseProduct( C, X, Z, "row-wise" );
+    Multiply( T(1), A, A, C, SPARSE_MULTIPLY_SUMMA );
+    CheckSparseProduct( C, X, Z, "SUMMA" );
+    MultiplySymbolic( A, A, C );
+    MultiplyNumeric( T(1), A, A, C );
+    CheckSparseProduct( C, X, Z, "symbolic/numeric" );
+    Output("Test passed");
+}
+
+void RunSparseTests( Int n, const Grid& grid )
+{
+    PushIndent();
+    TestSparseMultiply<float>( n, grid );
+    TestSparseMultiply<Complex<float>>( n, grid );
+    TestSparseMultiply<double>( n, grid );
+    TestSparseMultiply<Complex<double>>( n, grid );
+#ifdef EL_HAVE_QD
+    TestSparseMultiply<DoubleDouble>( n, grid );
+    TestSparseMultiply<QuadDouble>( n, grid );
+#endif
+#ifdef EL_HAVE_QUAD
+    TestSparseMultiply<Quad>( n, grid );
+#endif
+#ifdef EL_HAVE_MPC
+    TestSparseMultiply<BigFloat>( n, grid );
+#endif
+    PopIndent();
+}
+
 int main( int argc, char* argv[] )
 {
     Environment env( argc, argv );
@@ -81,6 +162,13 @@ int main( int argc, char* argv[] )
             Output("Testing with matrix height of ",m);
             RunTests(m);
         }
+
+        const Grid grid( mpi::COMM_WORLD );
+        for( Int n=4; n<=16; n*=2 )
+        {
+            Output("Testing sparse products with a ",n," x ",n," grid");
+            RunSparseTests( n, grid );
+        }
     }
     catch( exception& e ) { ReportException(e); }
     return 0;
@@ -0,0 +1,244 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+typedef std::map<pair<Int,Int>,double> EdgeMap;
+
+// Generate a list of edges with many duplicates (and integer values, so that
+// their sums are exact regardless of the summation order)
+void RandomEdges
+( Int numSources, Int firstSource, Int numTargets, Int numEdges,
+  vector<Int>& sources, vector<Int>& targets, vector<double>& values )
+{
+    sources.resize( numEdges );
+    targets.resize( numEdges );
+    values.resize( numEdges );
+    for( Int e=0; e<numEdges; ++e )
+    {
+        sources[e] = firstSource + SampleUniform<Int>(0,numSources);
+        targets[e] = SampleUniform<Int>(0,numTargets);
+        values[e] = double(SampleUniform<Int>(-10,11));
+    }
+}
+
+void CheckConsolidated
+( Int numSources,
+  Int firstSource,
+  const EdgeMap& expected,
+  const vector<Int>& sources,
+  const vector<Int>& targets,
+  const vector<double>* values,
+  const vector<Int>& offsets,
+  const string& label )
+{
+    const Int numEdges = expected.size();
+    if( Int(sources.size()) != numEdges || Int(targets.size()) != numEdges ||
+        (values && Int(values->size()) != numEdges) )
+        RuntimeError
+        (label,": expected ",numEdges," edges but had ",sources.size());
+    if( Int(offsets.size()) != numSources+1 )
+        RuntimeError(label,": there were ",offsets.size()," offsets");
+
+    // std::map orders the edges by source and then target
+    Int e = 0;
+    for( const auto& edge : expected )
+    {
+        if( sources[e] != edge.first.first || targets[e] != edge.first.second )
+            RuntimeError
+            (label,": edge ",e," was (",sources[e],",",targets[e],
+             ") rather than (",edge.first.first,",",edge.first.second,")");
+        if( values && (*values)[e] != edge.second )
+            RuntimeError
+            (label,": edge ",e," had value ",(*values)[e]," rather than ",
+             edge.second);
+        ++e;
+    }
+    for( Int s=0; s<numSources; ++s )
+        for( Int f=offsets[s]; f<offsets[s+1]; ++f )
+            if( sources[f] != firstSource+s )
+                RuntimeError(label,": offsets were inconsistent");
+    Output(label," PASSED");
+}
+
+void TestConsolidate
+( Int numSources, Int firstSource, Int numTargets, Int numEdges )
+{
+    Output
+    ("Testing Consolidate with ",numEdges," edges over ",numSources,
+     " sources and ",numTargets," targets");
+    PushIndent();
+
+    vector<Int> sourcesOrig, targetsOrig;
+    vector<double> valuesOrig;
+    RandomEdges
+    ( numSources, firstSource, numTargets, numEdges,
+      sourcesOrig, targetsOrig, valuesOrig );
+    EdgeMap expected;
+    for( Int e=0; e<numEdges; ++e )
+        expected[pair<Int,Int>(sourcesOrig[e],targetsOrig[e])] +=
+          valuesOrig[e];
+
+    // Unsorted edges with values
+    auto sources = sourcesOrig;
+    auto targets = targetsOrig;
+    auto values = valuesOrig;
+    vector<Int> offsets;
+    assembly::Consolidate
+    ( numSources, firstSource, sources, targets, &values, offsets );
+    CheckConsolidated
+    ( numSources, firstSource, expected, sources, targets, &values, offsets,
+      "Unsorted with values" );
+
+    // Unsorted edges without values
+    sources = sourcesOrig;
+    targets = targetsOrig;
+    vector<double>* noValues = nullptr;
+    assembly::Consolidate
+    ( numSources, firstSource, sources, targets, noValues, offsets );
+    CheckConsolidated
+    ( numSources, firstSource, expected, sources, targets, noValues, offsets,
+      "Unsorted without values" );
+
+    // Sorted edges (with duplicates) using the 'sorted' hint
+    vector<pair<pair<Int,Int>,double>> sortedEdges;
+    for( Int e=0; e<numEdges; ++e )
+        sortedEdges.emplace_back
+        ( pair<Int,Int>(sourcesOrig[e],targetsOrig[e]), valuesOrig[e] );
+    std::stable_sort
+    ( sortedEdges.begin(), sortedEdges.end(),
+      []( const pair<pair<Int,Int>,double>& a,
+          const pair<pair<Int,Int>,double>& b )
+      { return a.first < b.first; } );
+    sources.resize( numEdges );
+    targets.resize( numEdges );
+    values.resize( numEdges );
+    for( Int e=0; e<numEdges; ++e )
+    {
+        sources[e] = sortedEdges[e].first.first;
+        targets[e] = sortedEdges[e].first.second;
+        values[e] = sortedEdges[e].second;
+    }
+    assembly::Consolidate
+    ( numSources, firstSource, sources, targets, &values, offsets, true );
+    CheckConsolidated
+    ( numSources, firstSource, expected, sources, targets, &values, offsets,
+      "Sorted with values" );
+
+    // Remove every third unique edge, which must preserve the order of the
+    // remaining (consolidated) edges
+    set<pair<Int,Int>> markedForRemoval;
+    Int e = 0;
+    for( auto it=expected.begin(); it!=expected.end(); ++e )
+    {
+        if( e % 3 == 0 )
+        {
+            markedForRemoval.insert( it->first );
+            it = expected.erase( it );
+        }
+        else
+            ++it;
+    }
+    // Marking an edge which does not exist has no effect
+    markedForRemoval.insert( pair<Int,Int>(firstSource,numTargets) );
+    auto targetsCopy = targets;
+    auto sourcesCopy = sources;
+    assembly::RemoveMarked( sources, targets, &values, markedForRemoval );
+    if( !markedForRemoval.empty() )
+        RuntimeError("The marked edges were not cleared");
+    assembly::Consolidate
+    ( numSources, firstSource, sources, targets, &values, offsets, true );
+    CheckConsolidated
+    ( numSources, firstSource, expected, sources, targets, &values, offsets,
+      "Removal with values" );
+
+    // ...and the same without values
+    for( const auto& edge : sortedEdges )
+        if( !expected.count(edge.first) )
+            markedForRemoval.insert( edge.first );
+    assembly::RemoveMarked
+    ( sourcesCopy, targetsCopy, noValues, markedForRemoval );
+    assembly::Consolidate
+    ( numSources, firstSource, sourcesCopy, targetsCopy, noValues, offsets,
+      true );
+    CheckConsolidated
+    ( numSources, firstSource, expected, sourcesCopy, targetsCopy, noValues,
+      offsets, "Removal without values" );
+
+    PopIndent();
+}
+
+// Queue duplicate entries and removals through the public interface
+void TestSparseMatrix( Int n )
+{
+    Output("Testing SparseMatrix assembly with n=",n);
+    PushIndent();
+
+    SparseMatrix<double> A( n, n );
+    EdgeMap expected;
+    for( Int copy=0; copy<3; ++copy )
+        for( Int i=0; i<n; ++i )
+            for( Int j=Max(i-2,Int(0)); j<Min(i+3,n); ++j )
+            {
+                A.QueueUpdate( i, j, double(i+copy) );
+                expected[pair<Int,Int>(i,j)] += double(i+copy);
+            }
+    // Entries (i,i+1) are removed after they are assembled
+    A.ProcessQueues();
+    for( Int i=0; i+1<n; ++i )
+    {
+        A.QueueZero( i, i+1 );
+        expected.erase( pair<Int,Int>(i,i+1) );
+    }
+    A.ProcessQueues();
+
+    if( A.NumEntries() != Int(expected.size()) )
+        RuntimeError
+        ("SparseMatrix had ",A.NumEntries()," entries rather than ",
+         expected.size());
+    Int e = 0;
+    for( const auto& entry : expected )
+    {
+        if( A.Row(e) != entry.first.first || A.Col(e) != entry.first.second ||
+            A.Value(e) != entry.second )
+            RuntimeError("SparseMatrix entry ",e," was incorrect");
+        ++e;
+    }
+    Output("SparseMatrix PASSED");
+
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int numSources = Input("--numSources","number of sources",50);
+        const Int numTargets = Input("--numTargets","number of targets",40);
+        ProcessInput();
+        PrintInputReport();
+
+        if( mpi::Rank(comm) == 0 )
+        {
+            // Few edges per source (insertion sort) and many edges per source
+            // (which is threaded and uses a stable sort of the targets)
+            TestConsolidate( numSources, 0, numTargets, 3*numSources );
+            TestConsolidate( numSources, 17, numTargets, 100*numSources );
+            TestConsolidate( numSources, 5, 3, 0 );
+            TestSparseMatrix( 20 );
+        }
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
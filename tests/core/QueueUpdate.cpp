@@ -0,0 +1,163 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Every process queues updates to every entry of an m x n matrix, so that
+// each entry receives (possibly duplicate) contributions from every process.
+// The entries are integers so that the sums are exact regardless of the order
+// in which the duplicates are combined.
+
+template<typename T>
+T Contribution( Int i, Int j, Int m, int rank )
+{ return T(i+j*m+1+rank); }
+
+template<typename T>
+void CheckSum
+( const AbstractDistMatrix<T>& A,
+  Int numCopies, const string& label )
+{
+    const Grid& g = A.Grid();
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int commSize = mpi::Size( g.Comm() );
+
+    DistMatrix<T,STAR,STAR> A_STAR_STAR( A );
+    Int myErrorFlag = 0;
+    for( Int j=0; j<n; ++j )
+    {
+        for( Int i=0; i<m; ++i )
+        {
+            // The sum of Contribution(i,j,m,q) over all ranks q
+            const T expected =
+              T(numCopies)*(T(commSize)*T(i+j*m+1) +
+                            T(commSize*(commSize-1)/2));
+            if( A_STAR_STAR.GetLocal(i,j) != expected )
+                myErrorFlag = 1;
+        }
+    }
+    const Int errorFlag = mpi::AllReduce( myErrorFlag, g.Comm() );
+    if( errorFlag != 0 )
+        RuntimeError(label," did not sum the queued updates");
+    OutputFromRoot(g.Comm(),label," PASSED");
+}
+
+template<typename T,Dist U,Dist V>
+void TestQueueUpdate( Int m, Int n, const Grid& g )
+{
+    const int commRank = g.Rank();
+    const string dists =
+      string("[")+DistToString(U)+","+DistToString(V)+"]";
+    OutputFromRoot(g.Comm(),"Testing ",dists," with ",TypeName<T>());
+    PushIndent();
+
+    DistMatrix<T,U,V> A(g);
+
+    // Individual updates, each queued twice
+    Zeros( A, m, n );
+    A.Reserve( 2*m*n );
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<m; ++i )
+        {
+            const T value = Contribution<T>(i,j,m,commRank);
+            A.QueueUpdate( i, j, value );
+            A.QueueUpdate( i, j, value );
+        }
+    A.ProcessQueues();
+    CheckSum( A, 2, "Duplicate updates" );
+
+    // Individual updates queued from within a parallel region
+    Zeros( A, m, n );
+    A.Reserve( m*n );
+    EL_PARALLEL_FOR
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<m; ++i )
+            A.QueueUpdate( i, j, Contribution<T>(i,j,m,commRank) );
+    A.ProcessQueues();
+    CheckSum( A, 1, "Threaded updates" );
+
+    // Overlapping block updates: the whole matrix followed by its four
+    // quadrants (of unequal size)
+    Matrix<T> block;
+    auto fillBlock = [&]( Matrix<T>& B, Int i0, Int j0, Int height, Int width )
+      {
+        B.Resize( height, width );
+        for( Int j=0; j<width; ++j )
+            for( Int i=0; i<height; ++i )
+                B(i,j) = Contribution<T>(i0+i,j0+j,m,commRank);
+      };
+    Zeros( A, m, n );
+    fillBlock( block, 0, 0, m, n );
+    A.QueueUpdate( 0, 0, block );
+    const Int mSplit = m/3;
+    const Int nSplit = (2*n)/3;
+    const Int iQuad[4] = { 0, mSplit, 0, mSplit };
+    const Int jQuad[4] = { 0, 0, nSplit, nSplit };
+    const Int heights[4] = { mSplit, m-mSplit, mSplit, m-mSplit };
+    const Int widths[4] = { nSplit, nSplit, n-nSplit, n-nSplit };
+    for( Int k=0; k<4; ++k )
+    {
+        fillBlock( block, iQuad[k], jQuad[k], heights[k], widths[k] );
+        A.QueueUpdate( iQuad[k], jQuad[k], block );
+    }
+    A.ProcessQueues();
+    CheckSum( A, 2, "Block updates" );
+
+    // Block updates (of single columns) queued from within a parallel region
+    // alongside individual updates of the same entries
+    Zeros( A, m, n );
+    A.Reserve( m*n );
+    EL_PARALLEL_FOR
+    for( Int j=0; j<n; ++j )
+    {
+        Matrix<T> column;
+        fillBlock( column, 0, j, m, 1 );
+        A.QueueUpdate( 0, j, column );
+        for( Int i=0; i<m; ++i )
+            A.QueueUpdate( i, j, Contribution<T>(i,j,m,commRank) );
+    }
+    A.ProcessQueues();
+    CheckSum( A, 2, "Threaded block updates" );
+
+    PopIndent();
+}
+
+template<typename T>
+void TestDistributions( Int m, Int n, const Grid& g )
+{
+    TestQueueUpdate<T,MC,  MR  >( m, n, g );
+    TestQueueUpdate<T,MC,  STAR>( m, n, g );
+    TestQueueUpdate<T,STAR,VR  >( m, n, g );
+    TestQueueUpdate<T,MD,  STAR>( m, n, g );
+    TestQueueUpdate<T,STAR,STAR>( m, n, g );
+    TestQueueUpdate<T,CIRC,CIRC>( m, n, g );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--m","height of matrix",37);
+        const Int n = Input("--n","width of matrix",23);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+        TestDistributions<Int>( m, n, g );
+        TestDistributions<double>( m, n, g );
+        TestDistributions<Complex<float>>( m, n, g );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,260 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Build sparse matrices from batches of coordinate (COO) triplets and from
+// compressed sparse row (CSR) arrays and compare them against the dense
+// matrix formed from the same entries. All of the values are integers so that
+// the sums of duplicate entries are exact.
+
+struct Triplets
+{
+    vector<Int> rows, cols;
+    vector<double> values;
+};
+
+// A set of triplets with duplicates (and a trailing update of the last entry
+// through the END sentinel) along with the resulting dense matrix
+void GenerateTriplets( Int m, Int n, Triplets& triplets, Matrix<double>& A )
+{
+    Zeros( A, m, n );
+    for( Int copy=0; copy<2; ++copy )
+        for( Int i=0; i<m; ++i )
+            for( Int j=0; j<n; ++j )
+                if( (3*i+5*j+copy) % 4 == 0 )
+                {
+                    const double value = double(1+(i+2*j+copy) % 7);
+                    triplets.rows.push_back( i );
+                    triplets.cols.push_back( j );
+                    triplets.values.push_back( value );
+                    A(i,j) += value;
+                }
+    triplets.rows.push_back( END );
+    triplets.cols.push_back( END );
+    triplets.values.push_back( 1 );
+    A(m-1,n-1) += 1;
+}
+
+// Form the CSR arrays of the rows [rowBeg,rowEnd) of A, where the entries of
+// every other row are listed in reverse order, and the first entry of every
+// third row is split into two duplicates, if 'scramble' is true
+void FormCSR
+( const Matrix<double>& A, Int rowBeg, Int rowEnd, bool scramble,
+  vector<Int>& offsets, vector<Int>& cols, vector<double>& values )
+{
+    const Int n = A.Width();
+    offsets.assign( 1, 0 );
+    cols.clear();
+    values.clear();
+    for( Int i=rowBeg; i<rowEnd; ++i )
+    {
+        const Int rowOffset = cols.size();
+        for( Int j=0; j<n; ++j )
+        {
+            if( A(i,j) == 0. )
+                continue;
+            if( scramble && i % 3 == 0 && Int(cols.size()) == rowOffset )
+            {
+                cols.push_back( j );
+                values.push_back( A(i,j)-1 );
+                cols.push_back( j );
+                values.push_back( 1 );
+            }
+            else
+            {
+                cols.push_back( j );
+                values.push_back( A(i,j) );
+            }
+        }
+        if( scramble && i % 2 == 0 )
+        {
+            std::reverse( cols.begin()+rowOffset, cols.end() );
+            std::reverse( values.begin()+rowOffset, values.end() );
+        }
+        offsets.push_back( cols.size() );
+    }
+}
+
+void CheckMatrix
+( const Matrix<double>& A, const Matrix<double>& AExpected,
+  const string& label, mpi::Comm comm )
+{
+    Int myErrorFlag = 0;
+    if( A.Height() != AExpected.Height() || A.Width() != AExpected.Width() )
+        myErrorFlag = 1;
+    else
+        for( Int j=0; j<A.Width(); ++j )
+            for( Int i=0; i<A.Height(); ++i )
+                if( A(i,j) != AExpected(i,j) )
+                    myErrorFlag = 1;
+    const Int errorFlag = mpi::AllReduce( myErrorFlag, comm );
+    if( errorFlag != 0 )
+        RuntimeError(label," did not match the expected matrix");
+    OutputFromRoot(comm,label," PASSED");
+}
+
+void CheckMatrix
+( const SparseMatrix<double>& A, const Matrix<double>& AExpected,
+  const string& label )
+{
+    A.AssertConsistent();
+    Matrix<double> ADense;
+    Copy( A, ADense );
+    CheckMatrix( ADense, AExpected, label, mpi::COMM_SELF );
+}
+
+void CheckMatrix
+( const DistSparseMatrix<double>& A, const Matrix<double>& AExpected,
+  const string& label )
+{
+    A.AssertLocallyConsistent();
+    DistMatrix<double,STAR,STAR> ADense( A.Grid() );
+    Copy( A, ADense );
+    CheckMatrix( ADense.Matrix(), AExpected, label, A.Grid().Comm() );
+}
+
+void TestSparseMatrix( Int m, Int n )
+{
+    Output("Testing SparseMatrix");
+    PushIndent();
+
+    Triplets triplets;
+    Matrix<double> AExpected;
+    GenerateTriplets( m, n, triplets, AExpected );
+
+    SparseMatrix<double> A;
+    A.Resize( m, n );
+    A.QueueUpdates
+    ( triplets.rows.size(), triplets.rows.data(), triplets.cols.data(),
+      triplets.values.data() );
+    A.ProcessQueues();
+    CheckMatrix( A, AExpected, "QueueUpdates" );
+
+    // Queue the triplets again on top of the existing entries
+    A.QueueUpdates
+    ( triplets.rows.size(), triplets.rows.data(), triplets.cols.data(),
+      triplets.values.data() );
+    A.ProcessQueues();
+    Matrix<double> ADoubled( AExpected );
+    ADoubled *= 2;
+    CheckMatrix( A, ADoubled, "QueueUpdates onto existing entries" );
+
+    vector<Int> offsets, cols;
+    vector<double> values;
+    FormCSR( AExpected, 0, m, false, offsets, cols, values );
+    A.ImportCSR( m, n, offsets.data(), cols.data(), values.data() );
+    CheckMatrix( A, AExpected, "ImportCSR of sorted rows" );
+
+    FormCSR( AExpected, 0, m, true, offsets, cols, values );
+    A.ImportCSR( m, n, offsets.data(), cols.data(), values.data() );
+    CheckMatrix( A, AExpected, "ImportCSR of unsorted rows" );
+
+    PopIndent();
+}
+
+void TestDistSparseMatrix( Int m, Int n, const Grid& grid )
+{
+    mpi::Comm comm = grid.Comm();
+    const int commRank = mpi::Rank( comm );
+    const int commSize = mpi::Size( comm );
+    OutputFromRoot(comm,"Testing DistSparseMatrix");
+    PushIndent();
+
+    Triplets triplets;
+    Matrix<double> AExpected;
+    GenerateTriplets( m, n, triplets, AExpected );
+    const Int numTriplets = triplets.rows.size();
+
+    // Each process queues a strided subset of the triplets, most of which
+    // belong to other processes
+    Triplets myTriplets;
+    for( Int e=commRank; e<numTriplets; e+=commSize )
+    {
+        myTriplets.rows.push_back( triplets.rows[e] );
+        myTriplets.cols.push_back( triplets.cols[e] );
+        myTriplets.values.push_back( triplets.values[e] );
+    }
+    DistSparseMatrix<double> A( grid );
+    A.Resize( m, n );
+    A.QueueUpdates
+    ( myTriplets.rows.size(), myTriplets.rows.data(),
+      myTriplets.cols.data(), myTriplets.values.data() );
+    A.ProcessQueues();
+    CheckMatrix( A, AExpected, "QueueUpdates" );
+
+    // Each process queues the triplets of its own rows by their local indices
+    const Int firstLocalRow = A.FirstLocalRow();
+    const Int localHeight = A.LocalHeight();
+    Triplets localTriplets;
+    for( Int e=0; e<numTriplets; ++e )
+    {
+        const Int row = triplets.rows[e];
+        if( row == END )
+        {
+            if( firstLocalRow+localHeight == m && localHeight > 0 )
+            {
+                localTriplets.rows.push_back( END );
+                localTriplets.cols.push_back( END );
+                localTriplets.values.push_back( triplets.values[e] );
+            }
+        }
+        else if( row >= firstLocalRow && row < firstLocalRow+localHeight )
+        {
+            localTriplets.rows.push_back( row-firstLocalRow );
+            localTriplets.cols.push_back( triplets.cols[e] );
+            localTriplets.values.push_back( triplets.values[e] );
+        }
+    }
+    Zeros( A, m, n );
+    A.QueueLocalUpdates
+    ( localTriplets.rows.size(), localTriplets.rows.data(),
+      localTriplets.cols.data(), localTriplets.values.data() );
+    A.ProcessLocalQueues();
+    CheckMatrix( A, AExpected, "QueueLocalUpdates" );
+
+    vector<Int> offsets, cols;
+    vector<double> values;
+    FormCSR
+    ( AExpected, firstLocalRow, firstLocalRow+localHeight, false,
+      offsets, cols, values );
+    A.ImportLocalCSR( m, n, offsets.data(), cols.data(), values.data() );
+    CheckMatrix( A, AExpected, "ImportLocalCSR of sorted rows" );
+
+    FormCSR
+    ( AExpected, firstLocalRow, firstLocalRow+localHeight, true,
+      offsets, cols, values );
+    A.ImportLocalCSR( m, n, offsets.data(), cols.data(), values.data() );
+    CheckMatrix( A, AExpected, "ImportLocalCSR of unsorted rows" );
+
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--m","height of matrix",31);
+        const Int n = Input("--n","width of matrix",17);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid grid( comm );
+        if( mpi::Rank(comm) == 0 )
+            TestSparseMatrix( m, n );
+        TestDistSparseMatrix( m, n, grid );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
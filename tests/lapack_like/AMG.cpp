@@ -0,0 +1,99 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Check that PCG preconditioned with smoothed aggregation AMG converges on
+// the 2D Poisson equation in a number of iterations which is bounded
+// independently of the mesh size
+
+Int SolvePoisson
+( Int n, AMGSmoother smoother, Int maxCoarseSize, const Grid& grid )
+{
+    const double relTol = 1e-8;
+    const Int maxIts = 200;
+
+    // The negative of the 2D Laplacian is positive-definite
+    DistSparseMatrix<double> A( grid );
+    Helmholtz( A, n, n, 0. );
+
+    AMGCtrl<double> ctrl;
+    ctrl.smoother = smoother;
+    ctrl.maxCoarseSize = maxCoarseSize;
+    DistAMG<double> amg;
+    amg.Setup( A, ctrl );
+    if( amg.NumLevels() < 2 )
+        RuntimeError("The ",n," x ",n," problem was not coarsened");
+
+    auto applyA =
+      [&]( double alpha, const DistMultiVec<double>& X,
+           double beta,        DistMultiVec<double>& Y )
+      { Multiply( NORMAL, alpha, A, X, beta, Y ); };
+    DistMultiVec<double> B( grid ), X( grid );
+    Uniform( B, n*n, 1 );
+    X = B;
+    const Int numIts = PCG( applyA, amg, X, relTol, maxIts, false );
+
+    const double BNorm = FrobeniusNorm( B );
+    Multiply( NORMAL, -1., A, X, 1., B );
+    const double relResidual = FrobeniusNorm( B ) / BNorm;
+    OutputFromRoot
+    (grid.Comm(),n," x ",n," grid: ",amg.NumLevels()," levels, operator "
+     "complexity ",amg.OperatorComplexity(),", ",numIts," iterations, "
+     "relative residual ",relResidual);
+    if( relResidual > 100*relTol )
+        RuntimeError("The residual was unacceptably large");
+    return numIts;
+}
+
+void TestMeshIndependence
+( Int nCoarse, Int nFine, AMGSmoother smoother, Int maxCoarseSize,
+  Int maxIts, const Grid& grid )
+{
+    OutputFromRoot
+    (grid.Comm(),"Testing ",
+     smoother == AMG_JACOBI ? "Jacobi" : "Chebyshev"," smoothing");
+    PushIndent();
+    const Int coarseIts =
+      SolvePoisson( nCoarse, smoother, maxCoarseSize, grid );
+    const Int fineIts = SolvePoisson( nFine, smoother, maxCoarseSize, grid );
+    if( Max(coarseIts,fineIts) > maxIts )
+        RuntimeError
+        ("PCG required ",coarseIts," and ",fineIts," iterations rather than "
+         "at most ",maxIts);
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int nCoarse = Input("--nCoarse","size of the coarse mesh",40);
+        const Int nFine = Input("--nFine","size of the fine mesh",80);
+        const Int maxCoarseSize =
+          Input("--maxCoarseSize","maximum size of the coarsest level",100);
+        const Int maxIts =
+          Input("--maxIts","maximum number of PCG iterations",30);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid grid( comm );
+        TestMeshIndependence
+        ( nCoarse, nFine, AMG_CHEBYSHEV, maxCoarseSize, maxIts, grid );
+        TestMeshIndependence
+        ( nCoarse, nFine, AMG_JACOBI, maxCoarseSize, maxIts, grid );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,241 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// The (symmetric) adjacency of an n1 x n2 x n3 grid with a 7-point stencil,
+// optionally with a second, disconnected copy of the grid
+void GridAdjacency
+( Int n1, Int n2, Int n3, bool twoComponents,
+  vector<Int>& sources, vector<Int>& targets )
+{
+    const Int numCopies = ( twoComponents ? 2 : 1 );
+    const Int gridSize = n1*n2*n3;
+    sources.clear();
+    targets.clear();
+    for( Int copy=0; copy<numCopies; ++copy )
+    {
+        for( Int i=0; i<gridSize; ++i )
+        {
+            const Int x = i % n1;
+            const Int y = (i/n1) % n2;
+            const Int z = i/(n1*n2);
+            auto connect = [&]( Int j )
+              {
+                  sources.push_back( copy*gridSize+i );
+                  targets.push_back( copy*gridSize+j );
+              };
+            if( x > 0 )    connect( i-1 );
+            if( x+1 < n1 ) connect( i+1 );
+            if( y > 0 )    connect( i-n1 );
+            if( y+1 < n2 ) connect( i+n1 );
+            if( z > 0 )    connect( i-n1*n2 );
+            if( z+1 < n3 ) connect( i+n1*n2 );
+        }
+    }
+}
+
+// Ensure that 'perm' is a permutation which orders the left part, then the
+// right part, and then the separator, that no edge connects the two parts,
+// and that the parts are reasonably balanced
+void CheckPartition
+( Int numSources,
+  const vector<Int>& sources,
+  const vector<Int>& targets,
+  const vector<Int>& perm,
+  Int leftSize,
+  Int rightSize,
+  Int sepSize,
+  Int maxSepSize,
+  const string& label )
+{
+    if( Int(perm.size()) != numSources )
+        RuntimeError(label,": the permutation was of the wrong size");
+    if( leftSize+rightSize+sepSize != numSources )
+        RuntimeError
+        (label,": part sizes ",leftSize,", ",rightSize," and ",sepSize,
+         " do not sum to ",numSources);
+    vector<Int> timesMapped( numSources, 0 );
+    for( Int s=0; s<numSources; ++s )
+    {
+        if( perm[s] < 0 || perm[s] >= numSources )
+            RuntimeError(label,": vertex ",s," was mapped out of bounds");
+        ++timesMapped[perm[s]];
+    }
+    for( Int s=0; s<numSources; ++s )
+        if( timesMapped[s] != 1 )
+            RuntimeError(label,": the map was not a permutation");
+
+    auto part = [&]( Int s )
+      {
+          if( perm[s] < leftSize )
+              return 0;
+          else if( perm[s] < leftSize+rightSize )
+              return 1;
+          else
+              return 2;
+      };
+    const Int numEdges = sources.size();
+    for( Int e=0; e<numEdges; ++e )
+    {
+        const int sourcePart = part( sources[e] );
+        const int targetPart = part( targets[e] );
+        if( sourcePart != 2 && targetPart != 2 && sourcePart != targetPart )
+            RuntimeError
+            (label,": edge (",sources[e],",",targets[e],
+             ") connects the two parts");
+    }
+
+    if( sepSize > maxSepSize )
+        RuntimeError
+        (label,": the separator of size ",sepSize," exceeded ",maxSepSize);
+    if( Min(leftSize,rightSize) < (numSources-sepSize)/5 )
+        RuntimeError
+        (label,": parts of sizes ",leftSize," and ",rightSize,
+         " were badly unbalanced");
+}
+
+void TestSequential
+( Int n1, Int n2, Int n3, bool twoComponents, Int maxSepSize, bool native )
+{
+    const string label =
+      string(native ? "Native" : "Default")+" bisection of "+
+      (twoComponents ? "two " : "a ")+std::to_string(n1)+" x "+
+      std::to_string(n2)+" x "+std::to_string(n3)+" grid"+
+      (twoComponents ? "s" : "");
+
+    vector<Int> sources, targets;
+    GridAdjacency( n1, n2, n3, twoComponents, sources, targets );
+    const Int numSources = (twoComponents ? 2 : 1)*n1*n2*n3;
+    Graph graph( numSources );
+    const Int numEdges = sources.size();
+    graph.Reserve( numEdges );
+    for( Int e=0; e<numEdges; ++e )
+        graph.QueueConnection( sources[e], targets[e] );
+    graph.ProcessQueues();
+
+    BisectCtrl ctrl;
+    ctrl.native = native;
+    Graph leftChild, rightChild;
+    vector<Int> perm;
+    const Int sepSize = Bisect( graph, leftChild, rightChild, perm, ctrl );
+    const Int leftSize = leftChild.NumSources();
+    const Int rightSize = rightChild.NumSources();
+    CheckPartition
+    ( numSources, sources, targets, perm, leftSize, rightSize, sepSize,
+      maxSepSize, label );
+
+    // The children must hold the edges of their parts (with the original
+    // target indices relabeled)
+    Int numChildEdges = 0;
+    for( Int e=0; e<numEdges; ++e )
+        if( perm[sources[e]] < leftSize+rightSize )
+            ++numChildEdges;
+    if( leftChild.NumEdges()+rightChild.NumEdges() != numChildEdges )
+        RuntimeError
+        (label,": the children had ",
+         leftChild.NumEdges()+rightChild.NumEdges()," edges rather than ",
+         numChildEdges);
+    Output(label," with separator of size ",sepSize," PASSED");
+}
+
+void TestDistributed
+( Int n1, Int n2, Int n3, Int maxSepSize, bool native, const Grid& grid )
+{
+    mpi::Comm comm = grid.Comm();
+    const string label =
+      string(native ? "Native" : "Default")+" distributed bisection of a "+
+      std::to_string(n1)+" x "+std::to_string(n2)+" x "+std::to_string(n3)+
+      " grid";
+
+    vector<Int> sources, targets;
+    GridAdjacency( n1, n2, n3, false, sources, targets );
+    const Int numSources = n1*n2*n3;
+    DistGraph graph( numSources, grid );
+    const Int firstLocalSource = graph.FirstLocalSource();
+    const Int numLocalSources = graph.NumLocalSources();
+    const Int numEdges = sources.size();
+    graph.Reserve( 6*numLocalSources );
+    for( Int e=0; e<numEdges; ++e )
+        if( sources[e] >= firstLocalSource &&
+            sources[e] < firstLocalSource+numLocalSources )
+            graph.QueueLocalConnection
+            ( sources[e]-firstLocalSource, targets[e] );
+    graph.ProcessLocalQueues();
+
+    BisectCtrl ctrl;
+    ctrl.native = native;
+    ctrl.sequential = false;
+    unique_ptr<Grid> childGrid;
+    DistGraph child;
+    DistMap permMap;
+    bool onLeft;
+    const Int sepSize =
+      Bisect( graph, childGrid, child, permMap, onLeft, ctrl );
+
+    // Replicate the permutation and the sizes of the two parts
+    vector<Int> perm( numSources, 0 );
+    for( Int sLoc=0; sLoc<permMap.NumLocalSources(); ++sLoc )
+        perm[permMap.FirstLocalSource()+sLoc] = permMap.GetLocal(sLoc);
+    mpi::AllReduce( perm.data(), numSources, comm );
+    Int leftSize = ( onLeft ? child.NumSources() : 0 );
+    leftSize = mpi::AllReduce( leftSize, mpi::MAX, comm );
+    const Int rightSize = numSources - sepSize - leftSize;
+    if( !onLeft && child.NumSources() != rightSize )
+        RuntimeError(label,": the right child was of the wrong size");
+
+    CheckPartition
+    ( numSources, sources, targets, perm, leftSize, rightSize, sepSize,
+      maxSepSize, label );
+    OutputFromRoot(comm,label," with separator of size ",sepSize," PASSED");
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::Rank( comm );
+    const int commSize = mpi::Size( comm );
+
+    try
+    {
+        const Int n = Input("--n","size of the 2D grids",40);
+        const Int n3D = Input("--n3D","size of the 3D grids",10);
+        ProcessInput();
+        PrintInputReport();
+
+        // An n x n grid has a separator of size n and an n x n x n grid has
+        // a separator of size n^2; allow for twice as many vertices
+        const Int maxSep2D = 2*n;
+        const Int maxSep3D = 2*n3D*n3D;
+        if( commRank == 0 )
+        {
+            for( const bool native : { true, false } )
+            {
+                TestSequential( n, n, 1, false, maxSep2D, native );
+                TestSequential( 2*n, n/2, 1, false, maxSep2D/2, native );
+                TestSequential( n, n, 1, true, maxSep2D, native );
+                TestSequential( n3D, n3D, n3D, false, maxSep3D, native );
+            }
+        }
+        if( commSize > 1 )
+        {
+            const Grid grid( comm );
+            for( const bool native : { true, false } )
+            {
+                TestDistributed( n, n, 1, maxSep2D, native, grid );
+                TestDistributed( n3D, n3D, n3D, maxSep3D, native, grid );
+            }
+        }
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
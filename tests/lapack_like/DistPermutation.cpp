@@ -0,0 +1,275 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// The swap destinations of a pivot-like sequence (each destination is at least
+// as large as its origin, so that the sequence is applied with a single
+// exchange) and of a general sequence (which is applied swap by swap)
+vector<Int> SwapDests( Int size, Int numSwaps, bool monotone )
+{
+    vector<Int> dests( numSwaps );
+    for( Int k=0; k<numSwaps; ++k )
+        dests[k] = ( monotone ? k + (7*k+3) % (size-k) : (5*k+2) % size );
+    return dests;
+}
+
+// Apply the swaps one at a time to a replicated copy of A
+template<typename T>
+void ReferenceSwaps
+( const vector<Int>& dests, Int offset, bool rows, bool inverse,
+  DistMatrix<T,STAR,STAR>& A )
+{
+    auto& ALoc = A.Matrix();
+    const Int numSwaps = dests.size();
+    for( Int k=0; k<numSwaps; ++k )
+    {
+        const Int j = ( inverse ? numSwaps-1-k : k );
+        if( rows )
+            RowSwap( ALoc, j+offset, dests[j]+offset );
+        else
+            ColSwap( ALoc, j+offset, dests[j]+offset );
+    }
+}
+
+template<typename T>
+void CheckEqual
+( const AbstractDistMatrix<T>& A, const DistMatrix<T,STAR,STAR>& ARef,
+  const string& label )
+{
+    DistMatrix<T,STAR,STAR> A_STAR_STAR( A );
+    Int myErrorFlag = 0;
+    for( Int j=0; j<A.Width(); ++j )
+        for( Int i=0; i<A.Height(); ++i )
+            if( A_STAR_STAR.GetLocal(i,j) != ARef.GetLocal(i,j) )
+                myErrorFlag = 1;
+    const Int errorFlag = mpi::AllReduce( myErrorFlag, A.Grid().Comm() );
+    if( errorFlag != 0 )
+        RuntimeError(label," did not match the reference");
+}
+
+// Permute the rows (or columns) of A with P, both directly and with the
+// split-phase interface, and check the results (and their inverses) against
+// applying the swaps one at a time
+template<typename T>
+void TestApplication
+( const DistPermutation& P,
+  const vector<Int>& dests,
+  Int offset,
+  bool rows,
+  const DistMatrix<T,STAR,STAR>& AOrig,
+  AbstractDistMatrix<T>& A,
+  const string& label )
+{
+    const Grid& grid = A.Grid();
+    DistMatrix<T,STAR,STAR> ARef( AOrig ), AInvRef( AOrig );
+    ReferenceSwaps( dests, offset, rows, false, ARef );
+    ReferenceSwaps( dests, offset, rows, true, AInvRef );
+
+    // Apply each permutation twice so that the cached metadata is reused
+    for( Int rep=0; rep<2; ++rep )
+    {
+        Copy( AOrig, A );
+        if( rows )
+            P.PermuteRows( A, offset );
+        else
+            P.PermuteCols( A, offset );
+        CheckEqual( A, ARef, label+" permutation" );
+        if( rows )
+            P.InversePermuteRows( A, offset );
+        else
+            P.InversePermuteCols( A, offset );
+        CheckEqual( A, AOrig, label+" round trip" );
+    }
+
+    Copy( AOrig, A );
+    if( rows )
+        P.InversePermuteRows( A, offset );
+    else
+        P.InversePermuteCols( A, offset );
+    CheckEqual( A, AInvRef, label+" inverse permutation" );
+
+    // Overlap each split-phase permutation with unrelated communication
+    PermutationExchange<T> exchange;
+    DistMatrix<T> B(grid), C(grid);
+    Uniform( B, 20, 20 );
+    Copy( AOrig, A );
+    if( rows )
+        P.StartPermuteRows( A, exchange, offset );
+    else
+        P.StartPermuteCols( A, exchange, offset );
+    Gemm( NORMAL, NORMAL, T(1), B, B, C );
+    P.FinishPermutation( exchange );
+    CheckEqual( A, ARef, label+" split-phase permutation" );
+    if( rows )
+        P.StartInversePermuteRows( A, exchange, offset );
+    else
+        P.StartInversePermuteCols( A, exchange, offset );
+    Gemm( NORMAL, NORMAL, T(1), B, B, C );
+    P.FinishPermutation( exchange );
+    CheckEqual( A, AOrig, label+" split-phase round trip" );
+
+    OutputFromRoot(grid.Comm(),label," PASSED");
+}
+
+template<typename T>
+void TestPermutations( Int m, Int n, const Grid& grid )
+{
+    OutputFromRoot(grid.Comm(),"Testing with ",TypeName<T>());
+    PushIndent();
+
+    DistMatrix<T,STAR,STAR> AOrig(grid);
+    Uniform( AOrig, m, n );
+
+    DistMatrix<T> A(grid);
+    DistMatrix<T,VC,STAR> A_VC_STAR(grid);
+    DistMatrix<T,STAR,VR> A_STAR_VR(grid);
+    DistMatrix<T,MR,MC> A_MR_MC(grid);
+    const int colAlign = grid.Height() > 1 ? 1 : 0;
+    const int rowAlign = grid.Width() > 1 ? 1 : 0;
+
+    for( const bool monotone : { true, false } )
+    {
+        const string kind = ( monotone ? "pivot sequence" : "swap sequence" );
+        for( const Int offset : { Int(0), Int(3) } )
+        {
+            const string suffix = " with offset "+std::to_string(offset);
+
+            // Permute the rows
+            const Int numRowSwaps = Min(m-offset,n);
+            const auto rowDests =
+              SwapDests( m-offset, numRowSwaps, monotone );
+            DistPermutation P(grid);
+            P.MakeIdentity( m-offset );
+            P.ReserveSwaps( numRowSwaps );
+            for( Int k=0; k<numRowSwaps; ++k )
+                P.Swap( k, rowDests[k] );
+
+            A.Align( colAlign, rowAlign );
+            TestApplication
+            ( P, rowDests, offset, true, AOrig, A,
+              "[MC,MR] rows of "+kind+suffix );
+            TestApplication
+            ( P, rowDests, offset, true, AOrig, A_VC_STAR,
+              "[VC,STAR] rows of "+kind+suffix );
+            TestApplication
+            ( P, rowDests, offset, true, AOrig, A_MR_MC,
+              "[MR,MC] rows of "+kind+suffix );
+
+            // Permute the columns
+            const Int numColSwaps = Min(n-offset,m);
+            const auto colDests =
+              SwapDests( n-offset, numColSwaps, monotone );
+            DistPermutation Q(grid);
+            Q.MakeIdentity( n-offset );
+            Q.ReserveSwaps( numColSwaps );
+            for( Int k=0; k<numColSwaps; ++k )
+                Q.Swap( k, colDests[k] );
+            TestApplication
+            ( Q, colDests, offset, false, AOrig, A,
+              "[MC,MR] columns of "+kind+suffix );
+            TestApplication
+            ( Q, colDests, offset, false, AOrig, A_STAR_VR,
+              "[STAR,VR] columns of "+kind+suffix );
+        }
+    }
+
+    // Extending a pivot sequence must invalidate the cached metadata
+    {
+        const Int numSwaps = Min(m,n);
+        auto dests = SwapDests( m, numSwaps, true );
+        DistPermutation P(grid);
+        P.MakeIdentity( m );
+        P.ReserveSwaps( numSwaps );
+        for( Int k=0; k<numSwaps-2; ++k )
+            P.Swap( k, dests[k] );
+        Copy( AOrig, A );
+        P.PermuteRows( A );
+        for( Int k=numSwaps-2; k<numSwaps; ++k )
+            P.Swap( k, dests[k] );
+        TestApplication
+        ( P, dests, 0, true, AOrig, A, "Extended pivot sequence" );
+
+        // ...as must converting it into an explicit permutation, which
+        // supports the same operations without an offset
+        P.MakeArbitrary();
+        TestApplication
+        ( P, dests, 0, true, AOrig, A, "Explicit permutation" );
+    }
+
+    PopIndent();
+}
+
+// Check that P A = L U for the distributed LU with partial pivoting, with a
+// blocksize small enough that the pivots of several panels are overlapped with
+// the trailing updates
+template<typename Field>
+void TestLU( Int m, Int n, Int nb, const Grid& grid )
+{
+    typedef Base<Field> Real;
+    const Real eps = limits::Epsilon<Real>();
+    const Int minDim = Min(m,n);
+
+    DistMatrix<Field> AOrig(grid), A(grid);
+    Uniform( AOrig, m, n );
+    A = AOrig;
+    DistPermutation P(grid);
+    const Int oldBlocksize = Blocksize();
+    SetBlocksize( nb );
+    LU( A, P );
+    SetBlocksize( oldBlocksize );
+
+    DistMatrix<Field> L(grid), U(grid);
+    L = A( ALL, IR(0,minDim) );
+    U = A( IR(0,minDim), ALL );
+    MakeTrapezoidal( LOWER, L );
+    FillDiagonal( L, Field(1) );
+    MakeTrapezoidal( UPPER, U );
+
+    DistMatrix<Field> E( AOrig );
+    P.PermuteRows( E );
+    Gemm( NORMAL, NORMAL, Field(-1), L, U, Field(1), E );
+    const Real relResidual = FrobeniusNorm( E ) / FrobeniusNorm( AOrig );
+    OutputFromRoot
+    (grid.Comm(),"LU of ",m," x ",n," with nb=",nb,
+     ": || P A - L U ||_F / || A ||_F = ",relResidual);
+    if( relResidual > 100*eps*Max(m,n) )
+        RuntimeError("LU residual was unacceptably large");
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--m","height of matrix",37);
+        const Int n = Input("--n","width of matrix",29);
+        ProcessInput();
+        PrintInputReport();
+        if( Min(m,n) < 8 )
+            LogicError("The matrix must be at least 8 x 8");
+
+        const Grid grid( comm );
+        OutputFromRoot(comm,"Testing DistPermutation");
+        TestPermutations<double>( m, n, grid );
+        TestPermutations<Complex<float>>( m, n, grid );
+
+        OutputFromRoot(comm,"Testing LU with partial pivoting");
+        TestLU<double>( m, m, 4, grid );
+        TestLU<double>( m, n, 7, grid );
+        TestLU<double>( n, m, 7, grid );
+        TestLU<Complex<float>>( m, m, 8, grid );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
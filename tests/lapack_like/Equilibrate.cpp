@@ -0,0 +1,432 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Compare the (fused) equilibration routines against the unfused sweeps they
+// replaced, which separately form the row or column extrema of the matrix and
+// then apply the resulting scaling.
+
+namespace ref {
+
+template<typename Real>
+Real DampScaling( const Real& alpha )
+{
+    static const Real tol = Pow(limits::Epsilon<Real>(),Real(0.33));
+    if( alpha == Real(0) )
+        return 1;
+    else
+        return Max(alpha,tol);
+}
+
+template<typename Real>
+void DampScalings( Matrix<Real>& scales, bool squareRoot=false )
+{
+    for( Int i=0; i<scales.Height(); ++i )
+    {
+        scales(i) = DampScaling( scales(i) );
+        if( squareRoot )
+            scales(i) = Sqrt( scales(i) );
+    }
+}
+
+template<typename Field>
+Base<Field> MinAbsNonzero( const Matrix<Field>& A, Base<Field> upperBound )
+{
+    typedef Base<Field> Real;
+    Real minAbs = upperBound;
+    for( Int j=0; j<A.Width(); ++j )
+        for( Int i=0; i<A.Height(); ++i )
+        {
+            const Real alphaAbs = Abs(A(i,j));
+            if( alphaAbs > Real(0) )
+                minAbs = Min(minAbs,alphaAbs);
+        }
+    return minAbs;
+}
+
+template<typename Field>
+void RuizEquil
+( Matrix<Field>& A, Matrix<Base<Field>>& dRow, Matrix<Base<Field>>& dCol )
+{
+    typedef Base<Field> Real;
+    Ones( dRow, A.Height(), 1 );
+    Ones( dCol, A.Width(), 1 );
+    Matrix<Real> rowScale, colScale;
+    for( Int iter=0; iter<4; ++iter )
+    {
+        ColumnMaxNorms( A, colScale );
+        DampScalings( colScale );
+        DiagonalScale( LEFT, NORMAL, colScale, dCol );
+        DiagonalSolve( RIGHT, NORMAL, colScale, A );
+
+        RowMaxNorms( A, rowScale );
+        DampScalings( rowScale );
+        DiagonalScale( LEFT, NORMAL, rowScale, dRow );
+        DiagonalSolve( LEFT, NORMAL, rowScale, A );
+    }
+}
+
+// Rescale each row (or column) of A by the damped geometric mean of its
+// extreme nonzero magnitudes
+template<typename Field>
+void GeometricSweep
+( Matrix<Field>& A, Matrix<Base<Field>>& d, Orientation orient )
+{
+    typedef Base<Field> Real;
+    const Real sqrtDamp = Sqrt(Real(1)/Real(1000));
+    const Int numVecs = ( orient == NORMAL ? A.Height() : A.Width() );
+    for( Int k=0; k<numVecs; ++k )
+    {
+        auto a = ( orient == NORMAL ? A( IR(k), ALL ) : A( ALL, IR(k) ) );
+        const Real maxAbs = MaxAbs( a );
+        if( maxAbs > Real(0) )
+        {
+            const Real minAbs = MinAbsNonzero( a, maxAbs );
+            const Real scale = Max(Sqrt(minAbs*maxAbs),sqrtDamp*maxAbs);
+            a *= 1/scale;
+            d(k) *= scale;
+        }
+    }
+}
+
+// Scale each row (or column) so that its maximum entry is one or zero
+template<typename Field>
+void Normalize( Matrix<Field>& A, Matrix<Base<Field>>& d, Orientation orient )
+{
+    typedef Base<Field> Real;
+    const Int numVecs = ( orient == NORMAL ? A.Height() : A.Width() );
+    for( Int k=0; k<numVecs; ++k )
+    {
+        auto a = ( orient == NORMAL ? A( IR(k), ALL ) : A( ALL, IR(k) ) );
+        const Real maxAbs = MaxAbs( a );
+        if( maxAbs > Real(0) )
+        {
+            a *= 1/maxAbs;
+            d(k) *= maxAbs;
+        }
+    }
+}
+
+// The dense variants normalize the columns at the end while the sparse
+// variants normalize the rows
+template<typename Field>
+void GeomEquil
+( Matrix<Field>& A,
+  Matrix<Base<Field>>& dRow,
+  Matrix<Base<Field>>& dCol,
+  bool normalizeRows )
+{
+    typedef Base<Field> Real;
+    Ones( dRow, A.Height(), 1 );
+    Ones( dCol, A.Width(), 1 );
+    const Int minIter = 3;
+    const Int maxIter = 6;
+    const Real relTol = Real(9)/Real(10);
+
+    const Real maxAbsVal = MaxAbs( A );
+    if( maxAbsVal == Real(0) )
+        return;
+    Real ratio = maxAbsVal / MinAbsNonzero( A, maxAbsVal );
+    for( Int iter=0; iter<maxIter; ++iter )
+    {
+        GeometricSweep( A, dCol, TRANSPOSE );
+        GeometricSweep( A, dRow, NORMAL );
+
+        const Real newMaxAbsVal = MaxAbs( A );
+        const Real newRatio = newMaxAbsVal / MinAbsNonzero( A, newMaxAbsVal );
+        if( iter >= minIter && newRatio >= ratio*relTol )
+            break;
+        ratio = newRatio;
+    }
+    if( normalizeRows )
+        Normalize( A, dRow, NORMAL );
+    else
+        Normalize( A, dCol, TRANSPOSE );
+}
+
+template<typename Field>
+void SymmetricRuizEquil( Matrix<Field>& A, Matrix<Base<Field>>& d, Int maxIter )
+{
+    typedef Base<Field> Real;
+    Ones( d, A.Height(), 1 );
+    Matrix<Real> scales;
+    for( Int iter=0; iter<maxIter; ++iter )
+    {
+        ColumnMaxNorms( A, scales );
+        DampScalings( scales, true );
+        DiagonalScale( LEFT, NORMAL, scales, d );
+        DiagonalSolve( RIGHT, NORMAL, scales, A );
+        DiagonalSolve( LEFT, NORMAL, scales, A );
+    }
+}
+
+} // namespace ref
+
+// A matrix whose rows and columns are scaled over several orders of magnitude
+// and which has a zero row and a zero column in addition to scattered zeros
+template<typename Field>
+Field BadlyScaledEntry( Int i, Int j )
+{
+    typedef Base<Field> Real;
+    if( (i+2*j) % 3 == 0 || i == 5 || j == 7 )
+        return Field(0);
+    const Real exponent = Real((5*i) % 17 - 8 + (3*j) % 13 - 6);
+    const Real mag =
+      (Real(1) + Real((7*i+13*j) % 11)/Real(10)) * Pow(Real(2),exponent);
+    Field alpha = ( (i+j) % 2 ? mag : -mag );
+    if( IsComplex<Field>::value )
+        SetImagPart( alpha, mag/Real(2) );
+    return alpha;
+}
+
+template<typename Field>
+void BadlyScaled( Matrix<Field>& A, Int m, Int n, bool symmetric )
+{
+    A.Resize( m, n );
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<m; ++i )
+            A(i,j) = ( symmetric ? BadlyScaledEntry<Field>(Min(i,j),Max(i,j))
+                                 : BadlyScaledEntry<Field>(i,j) );
+}
+
+template<typename Field>
+void ToSparse( const Matrix<Field>& A, SparseMatrix<Field>& ASparse )
+{
+    const Int m = A.Height();
+    const Int n = A.Width();
+    ASparse.Resize( m, n );
+    ASparse.Reserve( m*n );
+    for( Int i=0; i<m; ++i )
+        for( Int j=0; j<n; ++j )
+            if( A(i,j) != Field(0) )
+                ASparse.QueueUpdate( i, j, A(i,j) );
+    ASparse.ProcessQueues();
+}
+
+template<typename Field>
+void ToDist( const Matrix<Field>& A, DistMatrix<Field>& ADist )
+{
+    ADist.Resize( A.Height(), A.Width() );
+    for( Int jLoc=0; jLoc<ADist.LocalWidth(); ++jLoc )
+        for( Int iLoc=0; iLoc<ADist.LocalHeight(); ++iLoc )
+            ADist.SetLocal
+            ( iLoc, jLoc, A(ADist.GlobalRow(iLoc),ADist.GlobalCol(jLoc)) );
+}
+
+template<typename Field>
+void ToDistSparse( const Matrix<Field>& A, DistSparseMatrix<Field>& ADist )
+{
+    const Int n = A.Width();
+    ADist.Resize( A.Height(), n );
+    const Int localHeight = ADist.LocalHeight();
+    ADist.Reserve( localHeight*n );
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        const Int i = ADist.GlobalRow( iLoc );
+        for( Int j=0; j<n; ++j )
+            if( A(i,j) != Field(0) )
+                ADist.QueueLocalUpdate( iLoc, j, A(i,j) );
+    }
+    ADist.ProcessLocalQueues();
+}
+
+template<typename T>
+Matrix<T> Gather( const AbstractDistMatrix<T>& A )
+{
+    DistMatrix<T,STAR,STAR> A_STAR_STAR( A );
+    return A_STAR_STAR.Matrix();
+}
+
+template<typename T>
+Matrix<T> Gather( const DistMultiVec<T>& A )
+{
+    DistMatrix<T,STAR,STAR> A_STAR_STAR( A.Grid() );
+    Copy( A, A_STAR_STAR );
+    return A_STAR_STAR.Matrix();
+}
+
+template<typename T>
+Matrix<T> Gather( const DistSparseMatrix<T>& A )
+{
+    DistMatrix<T,STAR,STAR> A_STAR_STAR( A.Grid() );
+    Copy( A, A_STAR_STAR );
+    return A_STAR_STAR.Matrix();
+}
+
+template<typename T>
+void Check
+( const Matrix<T>& X, const Matrix<T>& XRef, const string& label,
+  mpi::Comm comm )
+{
+    typedef Base<T> Real;
+    const Real eps = limits::Epsilon<Real>();
+    const Real tol = 100*eps*Max(XRef.Height(),XRef.Width());
+    Matrix<T> E( X );
+    E -= XRef;
+    const Real relError = FrobeniusNorm( E ) / FrobeniusNorm( XRef );
+    OutputFromRoot(comm,label,": || X - XRef ||_F / || XRef ||_F = ",relError);
+    if( relError > tol )
+        RuntimeError(label," differed from the unfused result by ",relError);
+}
+
+template<typename Field>
+void TestEquilibration( Int m, Int n, const Grid& grid )
+{
+    typedef Base<Field> Real;
+    mpi::Comm comm = grid.Comm();
+    OutputFromRoot(comm,"Testing with ",TypeName<Field>());
+    PushIndent();
+
+    Matrix<Field> AOrig, ASymmOrig;
+    BadlyScaled( AOrig, m, n, false );
+    BadlyScaled( ASymmOrig, n, n, true );
+
+    Matrix<Field> ARuiz( AOrig ), AGeom( AOrig ), AGeomRows( AOrig ),
+                  ASymm( ASymmOrig );
+    Matrix<Real> dRowRuiz, dColRuiz, dRowGeom, dColGeom,
+                 dRowGeomRows, dColGeomRows, dSymm;
+    ref::RuizEquil( ARuiz, dRowRuiz, dColRuiz );
+    ref::GeomEquil( AGeom, dRowGeom, dColGeom, false );
+    ref::GeomEquil( AGeomRows, dRowGeomRows, dColGeomRows, true );
+    ref::SymmetricRuizEquil( ASymm, dSymm, 3 );
+
+    // Matrix
+    {
+        Matrix<Field> A;
+        Matrix<Real> dRow, dCol;
+
+        A = AOrig;
+        RuizEquil( A, dRow, dCol );
+        Check( A, ARuiz, "Matrix RuizEquil A", comm );
+        Check( dRow, dRowRuiz, "Matrix RuizEquil dRow", comm );
+        Check( dCol, dColRuiz, "Matrix RuizEquil dCol", comm );
+
+        A = AOrig;
+        GeomEquil( A, dRow, dCol );
+        Check( A, AGeom, "Matrix GeomEquil A", comm );
+        Check( dRow, dRowGeom, "Matrix GeomEquil dRow", comm );
+        Check( dCol, dColGeom, "Matrix GeomEquil dCol", comm );
+
+        A = ASymmOrig;
+        SymmetricRuizEquil( A, dRow );
+        Check( A, ASymm, "Matrix SymmetricRuizEquil A", comm );
+        Check( dRow, dSymm, "Matrix SymmetricRuizEquil d", comm );
+    }
+
+    // DistMatrix
+    {
+        DistMatrix<Field> A(grid);
+        DistMatrix<Real,MC,STAR> dRow(grid);
+        DistMatrix<Real,MR,STAR> dCol(grid);
+
+        ToDist( AOrig, A );
+        RuizEquil( A, dRow, dCol );
+        Check( Gather(A), ARuiz, "DistMatrix RuizEquil A", comm );
+        Check( Gather(dRow), dRowRuiz, "DistMatrix RuizEquil dRow", comm );
+        Check( Gather(dCol), dColRuiz, "DistMatrix RuizEquil dCol", comm );
+
+        ToDist( AOrig, A );
+        GeomEquil( A, dRow, dCol );
+        Check( Gather(A), AGeom, "DistMatrix GeomEquil A", comm );
+        Check( Gather(dRow), dRowGeom, "DistMatrix GeomEquil dRow", comm );
+        Check( Gather(dCol), dColGeom, "DistMatrix GeomEquil dCol", comm );
+
+        ToDist( ASymmOrig, A );
+        SymmetricRuizEquil( A, dRow );
+        Check( Gather(A), ASymm, "DistMatrix SymmetricRuizEquil A", comm );
+        Check( Gather(dRow), dSymm, "DistMatrix SymmetricRuizEquil d", comm );
+    }
+
+    // SparseMatrix
+    {
+        SparseMatrix<Field> A;
+        Matrix<Field> ADense;
+        Matrix<Real> dRow, dCol;
+
+        ToSparse( AOrig, A );
+        RuizEquil( A, dRow, dCol );
+        Copy( A, ADense );
+        Check( ADense, ARuiz, "SparseMatrix RuizEquil A", comm );
+        Check( dRow, dRowRuiz, "SparseMatrix RuizEquil dRow", comm );
+        Check( dCol, dColRuiz, "SparseMatrix RuizEquil dCol", comm );
+
+        ToSparse( AOrig, A );
+        GeomEquil( A, dRow, dCol );
+        Copy( A, ADense );
+        Check( ADense, AGeomRows, "SparseMatrix GeomEquil A", comm );
+        Check( dRow, dRowGeomRows, "SparseMatrix GeomEquil dRow", comm );
+        Check( dCol, dColGeomRows, "SparseMatrix GeomEquil dCol", comm );
+
+        ToSparse( ASymmOrig, A );
+        SymmetricRuizEquil( A, dRow );
+        Copy( A, ADense );
+        Check( ADense, ASymm, "SparseMatrix SymmetricRuizEquil A", comm );
+        Check( dRow, dSymm, "SparseMatrix SymmetricRuizEquil d", comm );
+    }
+
+    // DistSparseMatrix
+    {
+        DistSparseMatrix<Field> A(grid);
+        DistMultiVec<Real> dRow(grid), dCol(grid);
+
+        ToDistSparse( AOrig, A );
+        RuizEquil( A, dRow, dCol );
+        Check( Gather(A), ARuiz, "DistSparseMatrix RuizEquil A", comm );
+        Check
+        ( Gather(dRow), dRowRuiz, "DistSparseMatrix RuizEquil dRow", comm );
+        Check
+        ( Gather(dCol), dColRuiz, "DistSparseMatrix RuizEquil dCol", comm );
+
+        ToDistSparse( AOrig, A );
+        GeomEquil( A, dRow, dCol );
+        Check( Gather(A), AGeomRows, "DistSparseMatrix GeomEquil A", comm );
+        Check
+        ( Gather(dRow), dRowGeomRows, "DistSparseMatrix GeomEquil dRow",
+          comm );
+        Check
+        ( Gather(dCol), dColGeomRows, "DistSparseMatrix GeomEquil dCol",
+          comm );
+
+        ToDistSparse( ASymmOrig, A );
+        SymmetricRuizEquil( A, dRow );
+        Check
+        ( Gather(A), ASymm, "DistSparseMatrix SymmetricRuizEquil A", comm );
+        Check
+        ( Gather(dRow), dSymm, "DistSparseMatrix SymmetricRuizEquil d", comm );
+    }
+
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--m","height of matrix",60);
+        const Int n = Input("--n","width of matrix",40);
+        ProcessInput();
+        PrintInputReport();
+        if( m <= 5 || n <= 7 )
+            LogicError("The test matrix requires m > 5 and n > 7");
+
+        const Grid grid( comm );
+        OutputFromRoot(comm,"Testing equilibration against unfused sweeps");
+        TestEquilibration<float>( m, n, grid );
+        TestEquilibration<double>( m, n, grid );
+        TestEquilibration<Complex<double>>( m, n, grid );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,178 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Compare products with (and solves against) HODLR compressions of smooth
+// kernels with those of the corresponding dense matrices
+
+// I + H, where H is the (positive-definite) Hilbert matrix, whose norm is at
+// most pi
+template<typename Field>
+Field ShiftedHilbert( Int i, Int j )
+{ return (i==j ? Field(1) : Field(0)) + Field(1)/Field(i+j+1); }
+
+// 4 I + C, where C(i,j) = 1/(x_i-y_j) with x_i = i+1/2 and y_j = j is a
+// Cauchy matrix of norm at most pi
+template<typename Field>
+Field ShiftedCauchy( Int i, Int j )
+{ return (i==j ? Field(4) : Field(0)) + Field(1)/(Field(i-j)+Field(0.5)); }
+
+template<typename Field>
+void CheckError
+( const Matrix<Field>& X, const Matrix<Field>& XRef, Base<Field> tol,
+  const string& label, mpi::Comm comm=mpi::COMM_SELF )
+{
+    Matrix<Field> E( X );
+    E -= XRef;
+    const Base<Field> relError = FrobeniusNorm( E ) / FrobeniusNorm( XRef );
+    OutputFromRoot(comm,label,": relative error of ",relError);
+    if( relError > tol )
+        RuntimeError(label,": relative error of ",relError," exceeded ",tol);
+}
+
+template<typename Field>
+void TestSequential
+( Int n, Int numRHS, const function<Field(Int,Int)>& entry,
+  const HODLRCtrl<Base<Field>>& ctrl, Base<Field> tol, const string& label )
+{
+    Output("Testing ",label," with ",TypeName<Field>());
+    PushIndent();
+
+    Matrix<Field> ADense;
+    ADense.Resize( n, n );
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<n; ++i )
+            ADense(i,j) = entry(i,j);
+
+    HODLR<Field> A( n, entry, ctrl );
+    if( A.MaxRank() > n/4 || A.NumEntries() >= n*n )
+        RuntimeError
+        (label,": maximum rank ",A.MaxRank()," with ",A.NumEntries(),
+         " entries was not compressed");
+
+    // Y := 2 A X - Y
+    Matrix<Field> X, Y, YRef;
+    Uniform( X, n, numRHS );
+    Uniform( Y, n, numRHS );
+    YRef = Y;
+    A.Multiply( Field(2), X, Field(-1), Y );
+    Gemm( NORMAL, NORMAL, Field(2), ADense, X, Field(-1), YRef );
+    CheckError( Y, YRef, tol, "Multiply" );
+
+    // X := inv(A) B
+    Matrix<Field> B, XRef;
+    Uniform( B, n, numRHS );
+    X = B;
+    A.Factor();
+    A.Solve( X );
+    XRef = B;
+    LinearSolve( ADense, XRef );
+    CheckError( X, XRef, tol, "Solve" );
+
+    PopIndent();
+}
+
+template<typename Field>
+void TestDistributed
+( Int n, Int numRHS, const function<Field(Int,Int)>& entry,
+  const HODLRCtrl<Base<Field>>& ctrl, Base<Field> tol, const string& label,
+  const Grid& grid )
+{
+    mpi::Comm comm = grid.Comm();
+    OutputFromRoot
+    (comm,"Testing distributed ",label," with ",TypeName<Field>());
+    PushIndent();
+
+    // Every process forms the dense matrix and checks the full results
+    Matrix<Field> ADense;
+    ADense.Resize( n, n );
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<n; ++i )
+            ADense(i,j) = entry(i,j);
+
+    DistHODLR<Field> A( grid );
+    A.Compress( n, entry, ctrl );
+
+    DistMultiVec<Field> X(grid), Y(grid);
+    DistMatrix<Field,STAR,STAR> X_STAR_STAR(grid), Y_STAR_STAR(grid);
+    Uniform( X, n, numRHS );
+    Uniform( Y, n, numRHS );
+    Copy( X, X_STAR_STAR );
+    Copy( Y, Y_STAR_STAR );
+    Matrix<Field> YRef( Y_STAR_STAR.Matrix() );
+    A.Multiply( Field(2), X, Field(-1), Y );
+    Copy( Y, Y_STAR_STAR );
+    Gemm( NORMAL, NORMAL, Field(2), ADense, X_STAR_STAR.Matrix(), Field(-1),
+          YRef );
+    CheckError( Y_STAR_STAR.Matrix(), YRef, tol, "Multiply", comm );
+
+    DistMultiVec<Field> B(grid);
+    DistMatrix<Field,STAR,STAR> B_STAR_STAR(grid);
+    Uniform( B, n, numRHS );
+    Copy( B, B_STAR_STAR );
+    X = B;
+    A.Factor();
+    A.Solve( X );
+    Copy( X, X_STAR_STAR );
+    Matrix<Field> XRef( B_STAR_STAR.Matrix() );
+    LinearSolve( ADense, XRef );
+    CheckError( X_STAR_STAR.Matrix(), XRef, tol, "Solve", comm );
+
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int n = Input("--n","size of matrices",1000);
+        const Int numRHS = Input("--numRHS","number of right-hand sides",3);
+        const Int maxLeafSize = Input("--maxLeafSize","maximum leaf size",64);
+        const double relTol =
+          Input("--relTol","tolerance of the cross approximation",1e-10);
+        ProcessInput();
+        PrintInputReport();
+
+        // The kernels are well-conditioned, so that the products and the
+        // solutions should be accurate to near the compression tolerance
+        HODLRCtrl<double> ctrl;
+        ctrl.maxLeafSize = maxLeafSize;
+        ctrl.relTol = relTol;
+        const double tol = 1000*relTol;
+
+        if( mpi::Rank(comm) == 0 )
+        {
+            TestSequential<double>
+            ( n, numRHS, ShiftedHilbert<double>, ctrl, tol,
+              "shifted Hilbert matrix" );
+            TestSequential<double>
+            ( n, numRHS, ShiftedCauchy<double>, ctrl, tol,
+              "shifted Cauchy matrix" );
+            TestSequential<Complex<double>>
+            ( n, numRHS, ShiftedCauchy<Complex<double>>, ctrl, tol,
+              "shifted Cauchy matrix" );
+        }
+
+        const Grid grid( comm );
+        TestDistributed<double>
+        ( n, numRHS, ShiftedHilbert<double>, ctrl, tol,
+          "shifted Hilbert matrix", grid );
+        TestDistributed<double>
+        ( n, numRHS, ShiftedCauchy<double>, ctrl, tol,
+          "shifted Cauchy matrix", grid );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
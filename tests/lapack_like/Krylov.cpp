@@ -0,0 +1,201 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Solve small symmetric positive-definite, symmetric indefinite, and
+// nonsymmetric systems with the Krylov methods which apply to them and check
+// the residuals of the solutions
+
+// The 5-point stencil over an n x n grid with the given diagonal, where the
+// couplings to the east and west neighbors are perturbed by +/- 'convection'
+Int StencilEntries
+( Int i, Int n, double diagonal, double convection,
+  vector<Int>& cols, vector<double>& values )
+{
+    const Int x = i % n;
+    const Int y = i / n;
+    cols.clear();
+    values.clear();
+    cols.push_back( i ); values.push_back( diagonal );
+    if( x > 0 )   { cols.push_back( i-1 ); values.push_back( -1-convection ); }
+    if( x+1 < n ) { cols.push_back( i+1 ); values.push_back( -1+convection ); }
+    if( y > 0 )   { cols.push_back( i-n ); values.push_back( -1 ); }
+    if( y+1 < n ) { cols.push_back( i+n ); values.push_back( -1 ); }
+    return cols.size();
+}
+
+void FormStencil
+( Int n, double diagonal, double convection, SparseMatrix<double>& A )
+{
+    Zeros( A, n*n, n*n );
+    A.Reserve( 5*n*n );
+    vector<Int> cols;
+    vector<double> values;
+    for( Int i=0; i<n*n; ++i )
+    {
+        const Int numEntries =
+          StencilEntries( i, n, diagonal, convection, cols, values );
+        for( Int e=0; e<numEntries; ++e )
+            A.QueueUpdate( i, cols[e], values[e] );
+    }
+    A.ProcessQueues();
+}
+
+void FormStencil
+( Int n, double diagonal, double convection, DistSparseMatrix<double>& A )
+{
+    Zeros( A, n*n, n*n );
+    const Int firstLocalRow = A.FirstLocalRow();
+    const Int localHeight = A.LocalHeight();
+    A.Reserve( 5*localHeight );
+    vector<Int> cols;
+    vector<double> values;
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        const Int numEntries =
+          StencilEntries
+          ( firstLocalRow+iLoc, n, diagonal, convection, cols, values );
+        for( Int e=0; e<numEntries; ++e )
+            A.QueueLocalUpdate( iLoc, cols[e], values[e] );
+    }
+    A.ProcessLocalQueues();
+}
+
+mpi::Comm VecComm( const Matrix<double>& B ) { return mpi::COMM_SELF; }
+mpi::Comm VecComm( const DistMultiVec<double>& B )
+{ return B.Grid().Comm(); }
+
+enum KrylovMethod { KRYLOV_PCG, KRYLOV_PIPELINED_PCG, KRYLOV_MINRES,
+                    KRYLOV_GMRES, KRYLOV_BICGSTAB };
+
+string MethodName( KrylovMethod method )
+{
+    switch( method )
+    {
+    case KRYLOV_PCG:           return "PCG";
+    case KRYLOV_PIPELINED_PCG: return "PipelinedPCG";
+    case KRYLOV_MINRES:        return "MINRES";
+    case KRYLOV_GMRES:         return "GMRES";
+    default:                   return "BiCGStab";
+    }
+}
+
+// Solve A X = B with the given method and a Jacobi preconditioner (which is
+// positive-definite whenever the diagonal is positive) and check that
+// || B - A X ||_F / || B ||_F is near the requested tolerance
+template<class MatType,class VecType>
+void TestMethod
+( KrylovMethod method, const MatType& A, double diagonal,
+  const VecType& BOrig, const string& label )
+{
+    const double relTol = 1e-10;
+    const Int maxIts = 1000;
+    const Int restart = A.Height();
+    mpi::Comm comm = VecComm( BOrig );
+
+    auto applyA =
+      [&]( double alpha, const VecType& x, double beta, VecType& y )
+      { Multiply( NORMAL, alpha, A, x, beta, y ); };
+    auto precond = [&]( VecType& b ) { b *= 1/Abs(diagonal); };
+
+    VecType X( BOrig );
+    Int numIts = 0;
+    switch( method )
+    {
+    case KRYLOV_PCG:
+        numIts = PCG( applyA, precond, X, relTol, maxIts, false );
+        break;
+    case KRYLOV_PIPELINED_PCG:
+        numIts = PipelinedPCG( applyA, precond, X, relTol, maxIts, false );
+        break;
+    case KRYLOV_MINRES:
+        numIts = MINRES( applyA, precond, X, relTol, maxIts, false );
+        break;
+    case KRYLOV_GMRES:
+        numIts = GMRES( applyA, precond, X, relTol, restart, maxIts, false );
+        break;
+    case KRYLOV_BICGSTAB:
+        numIts = BiCGStab( applyA, precond, X, relTol, maxIts, false );
+        break;
+    }
+
+    VecType R( BOrig );
+    Multiply( NORMAL, -1., A, X, 1., R );
+    const double relResidual = FrobeniusNorm( R ) / FrobeniusNorm( BOrig );
+    OutputFromRoot
+    (comm,MethodName(method)," on ",label,": ",numIts,
+     " iterations, relative residual ",relResidual);
+    if( relResidual > 100*relTol )
+        RuntimeError
+        (MethodName(method)," on ",label," had relative residual ",
+         relResidual);
+}
+
+template<class MatType,class VecType>
+void TestSystems( Int n, Int numRHS, MatType& A, VecType& B )
+{
+    Uniform( B, n*n, numRHS );
+
+    // Shifting the diagonal of the 5-point stencil (whose eigenvalues lie in
+    // (0,8)) by a positive amount yields a positive-definite matrix, while a
+    // diagonal below four yields an indefinite one
+    const double spdDiagonal = 4.5;
+    FormStencil( n, spdDiagonal, 0., A );
+    for( const auto method :
+         { KRYLOV_PCG, KRYLOV_PIPELINED_PCG, KRYLOV_MINRES, KRYLOV_GMRES,
+           KRYLOV_BICGSTAB } )
+        TestMethod( method, A, spdDiagonal, B, "SPD system" );
+
+    const double indefDiagonal = 2.5;
+    FormStencil( n, indefDiagonal, 0., A );
+    for( const auto method : { KRYLOV_MINRES, KRYLOV_GMRES } )
+        TestMethod( method, A, indefDiagonal, B, "indefinite system" );
+
+    const double nonsymDiagonal = 4.5, convection = 0.3;
+    FormStencil( n, nonsymDiagonal, convection, A );
+    for( const auto method : { KRYLOV_GMRES, KRYLOV_BICGSTAB } )
+        TestMethod( method, A, nonsymDiagonal, B, "nonsymmetric system" );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int n = Input("--n","size of the grid",12);
+        const Int numRHS = Input("--numRHS","number of right-hand sides",2);
+        ProcessInput();
+        PrintInputReport();
+
+        if( mpi::Rank(comm) == 0 )
+        {
+            Output("Testing with Matrix");
+            PushIndent();
+            SparseMatrix<double> A;
+            Matrix<double> B;
+            TestSystems( n, numRHS, A, B );
+            PopIndent();
+        }
+
+        const Grid grid( comm );
+        OutputFromRoot(comm,"Testing with DistMultiVec");
+        PushIndent();
+        DistSparseMatrix<double> A( grid );
+        DistMultiVec<double> B( grid );
+        TestSystems( n, numRHS, A, B );
+        PopIndent();
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,280 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Compare the sparse least squares and minimum norm solutions computed via
+// the multifrontal QR factorization and the (regularized) augmented system
+// with those of the dense pseudoinverse
+
+struct Triplets
+{
+    vector<Int> rows, cols;
+};
+
+// The sparsity pattern of an m x n matrix whose 'diagonal' (i,i%n) or
+// (j%m,j) is always present, so that it has full rank, unless the last column
+// is made a copy of the first
+void GeneratePattern
+( Int m, Int n, bool duplicateColumn, Triplets& pattern )
+{
+    const Int numIndepCols = ( duplicateColumn ? n-1 : n );
+    for( Int i=0; i<m; ++i )
+        for( Int j=0; j<numIndepCols; ++j )
+            if( (m >= n && j == i % n) || (m < n && i == j % m) ||
+                (3*i+7*j) % 11 == 0 )
+            {
+                pattern.rows.push_back( i );
+                pattern.cols.push_back( j );
+            }
+}
+
+template<typename Field>
+void GenerateValues( const Triplets& pattern, vector<Field>& values )
+{
+    const Int numEntries = pattern.rows.size();
+    values.resize( numEntries );
+    for( Int e=0; e<numEntries; ++e )
+        values[e] = SampleUniform<Field>() +
+          ( pattern.rows[e] % 7 == pattern.cols[e] % 7 ? Field(2) : Field(0) );
+}
+
+template<typename Field>
+void FormMatrix
+( Int m, Int n, bool duplicateColumn, const Triplets& pattern,
+  const vector<Field>& values, SparseMatrix<Field>& A )
+{
+    Zeros( A, m, n );
+    const Int numEntries = pattern.rows.size();
+    A.Reserve( 2*numEntries );
+    for( Int e=0; e<numEntries; ++e )
+    {
+        A.QueueUpdate( pattern.rows[e], pattern.cols[e], values[e] );
+        if( duplicateColumn && pattern.cols[e] == 0 )
+            A.QueueUpdate( pattern.rows[e], n-1, values[e] );
+    }
+    A.ProcessQueues();
+}
+
+template<typename Field>
+void FormMatrix
+( Int m, Int n, bool duplicateColumn, const Triplets& pattern,
+  const vector<Field>& values, DistSparseMatrix<Field>& A )
+{
+    Zeros( A, m, n );
+    const Int firstLocalRow = A.FirstLocalRow();
+    const Int localHeight = A.LocalHeight();
+    const Int numEntries = pattern.rows.size();
+    A.Reserve( 2*numEntries );
+    for( Int e=0; e<numEntries; ++e )
+    {
+        const Int iLoc = pattern.rows[e] - firstLocalRow;
+        if( iLoc < 0 || iLoc >= localHeight )
+            continue;
+        A.QueueLocalUpdate( iLoc, pattern.cols[e], values[e] );
+        if( duplicateColumn && pattern.cols[e] == 0 )
+            A.QueueLocalUpdate( iLoc, n-1, values[e] );
+    }
+    A.ProcessLocalQueues();
+}
+
+// Check that X is a least squares solution (or, if A has full rank, the
+// unique least squares or minimum norm solution) to A X ~= B by comparing it
+// against XRef := pinv(A) B
+template<typename Field>
+void CheckSolution
+( const Matrix<Field>& A,
+  const Matrix<Field>& B,
+  const Matrix<Field>& X,
+  const Matrix<Field>& XRef,
+  bool fullRank,
+  Base<Field> tol,
+  const string& label )
+{
+    typedef Base<Field> Real;
+    const Real BNorm = FrobeniusNorm( B );
+
+    Matrix<Field> R( B ), RRef( B );
+    Gemm( NORMAL, NORMAL, Field(-1), A, X, Field(1), R );
+    Gemm( NORMAL, NORMAL, Field(-1), A, XRef, Field(1), RRef );
+    const Real residual = FrobeniusNorm( R ) / BNorm;
+    const Real residualRef = FrobeniusNorm( RRef ) / BNorm;
+
+    // The residual of a least squares solution is orthogonal to range(A)
+    Matrix<Field> ATR;
+    Gemm( ADJOINT, NORMAL, Field(1), A, R, ATR );
+    const Real normalResidual =
+      FrobeniusNorm( ATR ) / (FrobeniusNorm( A )*BNorm);
+
+    Real solutionError = 0;
+    if( fullRank )
+    {
+        Matrix<Field> E( X );
+        E -= XRef;
+        solutionError = FrobeniusNorm( E ) / FrobeniusNorm( XRef );
+    }
+    Output
+    (label,": || B - A X ||_F / || B ||_F = ",residual," (optimal ",
+     residualRef,"), || A^H (B - A X) ||_F / (|| A ||_F || B ||_F) = ",
+     normalResidual,", relative error = ",solutionError);
+    if( Abs(residual-residualRef) > tol || normalResidual > tol ||
+        solutionError > tol )
+        RuntimeError(label,": the solution was inaccurate");
+}
+
+template<typename Field>
+void TestSequential( Int m, Int n, bool duplicateColumn, Int numRHS )
+{
+    typedef Base<Field> Real;
+    const Real eps = limits::Epsilon<Real>();
+    const string label =
+      std::to_string(m)+" x "+std::to_string(n)+
+      (duplicateColumn ? " rank-deficient" : "")+" "+
+      (m >= n ? "least squares" : "minimum norm");
+    Output("Testing sequential ",label," with ",TypeName<Field>());
+    PushIndent();
+
+    Triplets pattern;
+    vector<Field> values;
+    GeneratePattern( m, n, duplicateColumn, pattern );
+    GenerateValues( pattern, values );
+    SparseMatrix<Field> A;
+    FormMatrix( m, n, duplicateColumn, pattern, values, A );
+
+    Matrix<Field> B;
+    Uniform( B, m, numRHS );
+
+    Matrix<Field> ADense, APinv, XRef;
+    Copy( A, ADense );
+    APinv = ADense;
+    Pseudoinverse( APinv );
+    Gemm( NORMAL, NORMAL, Field(1), APinv, B, XRef );
+
+    // The multifrontal QR is backward stable, while the augmented system is
+    // regularized (and its solution refined)
+    const Real qrTol = 100*eps*Max(m,n);
+    const Real augTol = Pow( eps, Real(0.5) );
+
+    LeastSquaresCtrl<Real> ctrl;
+    ctrl.alg = LS_SPARSE_QR;
+    Matrix<Field> X;
+    LeastSquares( NORMAL, A, B, X, ctrl );
+    CheckSolution
+    ( ADense, B, X, XRef, !duplicateColumn, qrTol, "Sparse QR" );
+
+    ctrl.alg = LS_AUGMENTED;
+    LeastSquares( NORMAL, A, B, X, ctrl );
+    CheckSolution
+    ( ADense, B, X, XRef, !duplicateColumn, augTol, "Augmented system" );
+
+    if( duplicateColumn )
+    {
+        SparseQRFactorization<Field> qrFact;
+        qrFact.Factor( A );
+        if( qrFact.Rank() != n-1 )
+            RuntimeError
+            ("The sparse QR factorization had rank ",qrFact.Rank(),
+             " rather than ",n-1);
+    }
+
+    PopIndent();
+}
+
+template<typename Field>
+void TestDistributed
+( Int m, Int n, bool duplicateColumn, Int numRHS, const Grid& grid )
+{
+    typedef Base<Field> Real;
+    const Real eps = limits::Epsilon<Real>();
+    mpi::Comm comm = grid.Comm();
+    const string label =
+      std::to_string(m)+" x "+std::to_string(n)+
+      (duplicateColumn ? " rank-deficient" : "")+" "+
+      (m >= n ? "least squares" : "minimum norm");
+    OutputFromRoot
+    (comm,"Testing distributed ",label," with ",TypeName<Field>());
+    PushIndent();
+
+    // Every process generates the same values
+    Triplets pattern;
+    vector<Field> values;
+    GeneratePattern( m, n, duplicateColumn, pattern );
+    GenerateValues( pattern, values );
+    mpi::Broadcast( values.data(), values.size(), 0, comm );
+    DistSparseMatrix<Field> A(grid);
+    FormMatrix( m, n, duplicateColumn, pattern, values, A );
+    SparseMatrix<Field> ASeq;
+    FormMatrix( m, n, duplicateColumn, pattern, values, ASeq );
+
+    DistMultiVec<Field> B(grid), X(grid);
+    Uniform( B, m, numRHS );
+    DistMatrix<Field,STAR,STAR> B_STAR_STAR(grid), X_STAR_STAR(grid);
+    Copy( B, B_STAR_STAR );
+
+    Matrix<Field> ADense, APinv, XRef;
+    Copy( ASeq, ADense );
+    APinv = ADense;
+    Pseudoinverse( APinv );
+    Gemm( NORMAL, NORMAL, Field(1), APinv, B_STAR_STAR.Matrix(), XRef );
+
+    const Real qrTol = 100*eps*Max(m,n);
+    const Real augTol = Pow( eps, Real(0.5) );
+
+    LeastSquaresCtrl<Real> ctrl;
+    ctrl.alg = LS_SPARSE_QR;
+    LeastSquares( NORMAL, A, B, X, ctrl );
+    Copy( X, X_STAR_STAR );
+    if( grid.Rank() == 0 )
+        CheckSolution
+        ( ADense, B_STAR_STAR.Matrix(), X_STAR_STAR.Matrix(), XRef,
+          !duplicateColumn, qrTol, "Sparse QR" );
+
+    ctrl.alg = LS_AUGMENTED;
+    LeastSquares( NORMAL, A, B, X, ctrl );
+    Copy( X, X_STAR_STAR );
+    if( grid.Rank() == 0 )
+        CheckSolution
+        ( ADense, B_STAR_STAR.Matrix(), X_STAR_STAR.Matrix(), XRef,
+          !duplicateColumn, augTol, "Augmented system" );
+
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--m","height of tall matrices",120);
+        const Int n = Input("--n","width of tall matrices",45);
+        const Int numRHS = Input("--numRHS","number of right-hand sides",3);
+        ProcessInput();
+        PrintInputReport();
+
+        if( mpi::Rank(comm) == 0 )
+        {
+            TestSequential<double>( m, n, false, numRHS );
+            TestSequential<double>( n, m, false, numRHS );
+            TestSequential<double>( m, n, true, numRHS );
+            TestSequential<Complex<double>>( m, n, false, numRHS );
+            TestSequential<Complex<double>>( m, n, true, numRHS );
+        }
+
+        const Grid grid( comm );
+        TestDistributed<double>( m, n, false, numRHS, grid );
+        TestDistributed<double>( n, m, false, numRHS, grid );
+        TestDistributed<double>( m, n, true, numRHS, grid );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
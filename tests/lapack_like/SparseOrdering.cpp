@@ -0,0 +1,273 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Compare the fill and accuracy of sparse LDL^H factorizations using nested
+// dissection and the automatic choice (which picks approximate minimum degree
+// for the problems below unless its cutoff is lowered)
+
+// A symmetric positive-definite matrix with the given half-bandwidth, whose
+// graph is a long chain of small cliques
+template<typename Field>
+void Banded( SparseMatrix<Field>& A, Int n, Int halfBand )
+{
+    Zeros( A, n, n );
+    A.Reserve( (2*halfBand+1)*n );
+    for( Int i=0; i<n; ++i )
+        for( Int j=Max(i-halfBand,Int(0)); j<=Min(i+halfBand,n-1); ++j )
+            A.QueueUpdate( i, j, i==j ? Field(4*halfBand+1) : Field(-1) );
+    A.ProcessQueues();
+}
+
+template<typename Field>
+void Banded( DistSparseMatrix<Field>& A, Int n, Int halfBand )
+{
+    Zeros( A, n, n );
+    const Int firstLocalRow = A.FirstLocalRow();
+    const Int localHeight = A.LocalHeight();
+    A.Reserve( (2*halfBand+1)*localHeight );
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        const Int i = firstLocalRow + iLoc;
+        for( Int j=Max(i-halfBand,Int(0)); j<=Min(i+halfBand,n-1); ++j )
+            A.QueueLocalUpdate
+            ( iLoc, j, i==j ? Field(4*halfBand+1) : Field(-1) );
+    }
+    A.ProcessLocalQueues();
+}
+
+// A Hermitian positive-definite matrix with an irregular graph, where each
+// vertex is connected to a few pseudo-random others
+template<typename Field>
+void Irregular( SparseMatrix<Field>& A, Int n )
+{
+    const Int degree = 3;
+    vector<Int> sources, targets, numNeighbors( n, 0 );
+    for( Int i=0; i<n; ++i )
+        for( Int k=1; k<=degree; ++k )
+        {
+            const Int j = (i*(7*k+3)+k*k*k) % n;
+            if( j != i )
+            {
+                sources.push_back( i );
+                targets.push_back( j );
+                ++numNeighbors[i];
+                ++numNeighbors[j];
+            }
+        }
+
+    // Make the matrix strictly diagonally dominant
+    Zeros( A, n, n );
+    A.Reserve( n+2*sources.size() );
+    for( Int i=0; i<n; ++i )
+        A.QueueUpdate( i, i, Field(numNeighbors[i]+1) );
+    for( size_t e=0; e<sources.size(); ++e )
+    {
+        A.QueueUpdate( sources[e], targets[e], Field(-1) );
+        A.QueueUpdate( targets[e], sources[e], Field(-1) );
+    }
+    A.ProcessQueues();
+}
+
+Int TreeDepth( const ldl::NodeInfo& info )
+{
+    Int childDepth = 0;
+    for( const auto& child : info.children )
+        childDepth = Max( childDepth, TreeDepth(*child) );
+    return childDepth+1;
+}
+
+// Factor A, solve against a random right-hand side, and return the number of
+// entries in the factorization
+template<typename Field>
+Int FactorAndSolve
+( const SparseMatrix<Field>& A, const BisectCtrl& ctrl, const string& label,
+  Int& depth )
+{
+    typedef Base<Field> Real;
+    const Int n = A.Height();
+    const Real eps = limits::Epsilon<Real>();
+
+    SparseLDLFactorization<Field> sparseLDLFact;
+    sparseLDLFact.Initialize( A, true, ctrl );
+    sparseLDLFact.Factor();
+    const Int numEntries = sparseLDLFact.NumEntries();
+    depth = TreeDepth( sparseLDLFact.NodeInfo() );
+
+    Matrix<Field> B, X;
+    Uniform( B, n, 3 );
+    X = B;
+    sparseLDLFact.Solve( X );
+    Multiply( NORMAL, Field(-1), A, X, Field(1), B );
+    const Real relResidual = FrobeniusNorm( B ) / FrobeniusNorm( X );
+    Output
+    (label,": ",numEntries," entries, depth ",depth,
+     ", relative residual ",relResidual);
+    if( relResidual > 100*eps*n )
+        RuntimeError(label,": the residual was unacceptably large");
+    return numEntries;
+}
+
+template<typename Field>
+void TestSequential
+( const SparseMatrix<Field>& A, Int cutoff, double maxFillRatio,
+  const string& label )
+{
+    Output("Testing ",label," with ",TypeName<Field>());
+    PushIndent();
+
+    BisectCtrl ctrl;
+    ctrl.cutoff = cutoff;
+    if( ctrl.ordering != SPARSE_NESTED_DISSECTION )
+        LogicError("Nested dissection was not the default ordering");
+    Int depthND, depthAuto, depthCutoff;
+    const Int fillND = FactorAndSolve( A, ctrl, "Nested dissection", depthND );
+
+    ctrl.ordering = SPARSE_ORDERING_AUTO;
+    const Int fillAuto =
+      FactorAndSolve( A, ctrl, "Automatic ordering", depthAuto );
+    if( fillAuto > maxFillRatio*fillND )
+        RuntimeError
+        (label,": the automatic ordering had ",fillAuto,
+         " entries rather than at most ",maxFillRatio,"x",fillND);
+    // No supernodal tree may be much deeper than the depth bound
+    if( depthAuto > 40 )
+        RuntimeError(label,": the supernodal tree had depth ",depthAuto);
+
+    // Beneath the cutoff, the automatic ordering is nested dissection
+    ctrl.minDegreeCutoff = A.Height()-1;
+    const Int fillCutoff =
+      FactorAndSolve( A, ctrl, "Automatic ordering below cutoff", depthCutoff );
+    if( fillCutoff != fillND || depthCutoff != depthND )
+        RuntimeError
+        (label,": the automatic ordering below the cutoff did not use nested "
+         "dissection");
+
+    PopIndent();
+}
+
+template<typename Field>
+Int DistFactorAndSolve
+( const DistSparseMatrix<Field>& A, const BisectCtrl& ctrl,
+  const string& label )
+{
+    typedef Base<Field> Real;
+    const Grid& grid = A.Grid();
+    const Int n = A.Height();
+    const Real eps = limits::Epsilon<Real>();
+
+    DistSparseLDLFactorization<Field> sparseLDLFact;
+    sparseLDLFact.Initialize( A, true, ctrl );
+    sparseLDLFact.Factor();
+    const Int numEntries =
+      mpi::AllReduce( sparseLDLFact.NumLocalEntries(), grid.Comm() );
+
+    DistMultiVec<Field> B(grid), X(grid);
+    Uniform( B, n, 3 );
+    X = B;
+    sparseLDLFact.Solve( X );
+    Multiply( NORMAL, Field(-1), A, X, Field(1), B );
+    const Real relResidual = FrobeniusNorm( B ) / FrobeniusNorm( X );
+    OutputFromRoot
+    (grid.Comm(),label,": ",numEntries," entries, relative residual ",
+     relResidual);
+    if( relResidual > 100*eps*n )
+        RuntimeError(label,": the residual was unacceptably large");
+    return numEntries;
+}
+
+template<typename Field>
+void TestDistributed
+( const DistSparseMatrix<Field>& A, Int cutoff, double maxFillRatio,
+  const string& label )
+{
+    const Grid& grid = A.Grid();
+    const Int commSize = grid.Size();
+    OutputFromRoot
+    (grid.Comm(),"Testing distributed ",label," with ",TypeName<Field>());
+    PushIndent();
+
+    BisectCtrl ctrl;
+    ctrl.cutoff = cutoff;
+    const Int fillND = DistFactorAndSolve( A, ctrl, "Nested dissection" );
+
+    // The subgraphs owned by the processes have roughly A.Blocksize()
+    // vertices, so minimum degree is used once the cutoff reaches
+    // commSize*A.Blocksize()
+    ctrl.ordering = SPARSE_ORDERING_AUTO;
+    ctrl.minDegreeCutoff = commSize*A.Blocksize();
+    const Int fillAuto = DistFactorAndSolve( A, ctrl, "Automatic ordering" );
+    if( fillAuto > maxFillRatio*fillND )
+        RuntimeError
+        (label,": the automatic ordering had ",fillAuto,
+         " entries rather than at most ",maxFillRatio,"x",fillND);
+
+    ctrl.minDegreeCutoff = commSize*A.Blocksize()-1;
+    const Int fillCutoff =
+      DistFactorAndSolve( A, ctrl, "Automatic ordering below cutoff" );
+    if( fillCutoff != fillND )
+        RuntimeError
+        (label,": the automatic ordering below the cutoff did not use nested "
+         "dissection");
+
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int n2D = Input("--n2D","size of the 2D grid",40);
+        const Int n3D = Input("--n3D","size of the 3D grid",12);
+        const Int nBand = Input("--nBand","height of the banded matrix",5000);
+        const Int nIrreg =
+          Input("--nIrreg","height of the irregular matrix",1500);
+        const Int cutoff = Input("--cutoff","cutoff for sparse leaves",64);
+        ProcessInput();
+        PrintInputReport();
+
+        if( mpi::Rank(comm) == 0 )
+        {
+            SparseMatrix<double> A;
+            Laplacian( A, n2D, n2D );
+            A *= -1;
+            TestSequential( A, cutoff, 1.5, "2D Laplacian" );
+
+            Laplacian( A, n3D, n3D, n3D );
+            A *= -1;
+            TestSequential( A, cutoff, 1.5, "3D Laplacian" );
+
+            // A chain of cliques, whose supernodal tree must remain shallow
+            // even with small sparse leaves
+            Banded( A, nBand, 2 );
+            TestSequential( A, 16, 1.5, "Banded matrix" );
+
+            SparseMatrix<Complex<double>> AIrreg;
+            Irregular( AIrreg, nIrreg );
+            TestSequential( AIrreg, cutoff, 1.5, "Irregular matrix" );
+        }
+
+        const Grid grid( comm );
+        DistSparseMatrix<double> A( grid );
+        Laplacian( A, n3D, n3D, n3D );
+        A *= -1;
+        TestDistributed( A, cutoff, 1.5, "3D Laplacian" );
+
+        Banded( A, nBand, 2 );
+        TestDistributed( A, 16, 1.5, "Banded matrix" );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}